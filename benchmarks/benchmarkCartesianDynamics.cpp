@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/cartesianDynamics.hpp"
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/radiationPressureAccelerationModel.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+
+// Set value of gravitational parameter, equatorial radius and J2 coefficient of Mercury
+// [m^3 s^-2, m, -].
+const Real gravitationalParameter = 2.2032e13;
+const Real equatorialRadius = 2439.0e3;
+const Real j2Coefficient = 0.00006;
+
+// Set radiation pressure at 1 AU [N m^-2], 1 AU [m], radiation pressure coefficient [-], and
+// cannonball radius [m] and bulk density [kg m^-3].
+const Real referenceRadiationPressure = 4.56e-6;
+const Real referenceDistance = 1.495978707e11;
+const Real radiationPressureCoefficient = 1.5;
+const Real radius = 1.0e-3;
+const Real bulkDensity = 2000.0;
+
+// Set Cartesian state [m, m/s].
+const Real cartesianState[6] = {1513.3e3, -7412.67e3, 3012.1e3, 1.2e3, 0.3e3, -0.8e3};
+
+void benchmarkSeparateAccelerationModels(benchmark::State& state)
+{
+    Vector3 position = {{cartesianState[0], cartesianState[1], cartesianState[2]}};
+    const Vector3 velocity = {{cartesianState[3], cartesianState[4], cartesianState[5]}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+
+        const Real distance = std::sqrt(position[0] * position[0]
+                                        + position[1] * position[1]
+                                        + position[2] * position[2]);
+        const Vector3 unitVectorToSource
+            = {{-position[0] / distance, -position[1] / distance, -position[2] / distance}};
+        const Real radiationPressure
+            = computeRadiationPressure(referenceRadiationPressure, referenceDistance, distance);
+
+        const Vector3 centralBodyAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, position);
+        const Vector3 j2Acceleration = computeJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient);
+        const Vector3 radiationPressureAcceleration
+            = computeCannonballRadiationPressureAcceleration(
+                radiationPressure, radiationPressureCoefficient, unitVectorToSource,
+                radius, bulkDensity);
+        const Vector3 poyntingRobertsonDragAcceleration
+            = computeCannonballPoyntingRobertsonDragAcceleration(
+                radiationPressure, radiationPressureCoefficient, unitVectorToSource,
+                radius, bulkDensity, velocity);
+
+        Vector3 acceleration;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            acceleration[i] = centralBodyAcceleration[i]
+                              + j2Acceleration[i]
+                              + radiationPressureAcceleration[i]
+                              + poyntingRobertsonDragAcceleration[i];
+        }
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkSeparateAccelerationModels);
+
+void benchmarkCartesianDynamics(benchmark::State& state)
+{
+    const auto dynamics = makeCartesianDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(gravitationalParameter),
+        J2AccelerationModel<Real>(gravitationalParameter, equatorialRadius, j2Coefficient),
+        CannonballRadiationPressureAccelerationModel<Real>(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           radius,
+                                                           bulkDensity),
+        CannonballPoyntingRobertsonDragAccelerationModel<Real>(referenceRadiationPressure,
+                                                               referenceDistance,
+                                                               radiationPressureCoefficient,
+                                                               radius,
+                                                               bulkDensity));
+
+    Real position[3] = {cartesianState[0], cartesianState[1], cartesianState[2]};
+    const Real velocity[3] = {cartesianState[3], cartesianState[4], cartesianState[5]};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+
+        Real acceleration[3];
+        dynamics(0.0, position, velocity, acceleration);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkCartesianDynamics);
+
+void benchmarkAccelerationGradientFiniteDifferences(benchmark::State& state)
+{
+    const auto dynamics = makeCartesianDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(gravitationalParameter),
+        J2AccelerationModel<Real>(gravitationalParameter, equatorialRadius, j2Coefficient),
+        CannonballRadiationPressureAccelerationModel<Real>(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           radius,
+                                                           bulkDensity));
+
+    Real position[3] = {cartesianState[0], cartesianState[1], cartesianState[2]};
+    const Real velocity[3] = {cartesianState[3], cartesianState[4], cartesianState[5]};
+    const Real stepSize = 100.0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+
+        // Acceleration and central differences of acceleration (seven evaluations in total).
+        Real acceleration[3];
+        dynamics(0.0, position, velocity, acceleration);
+
+        Real gradient[3][3];
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            Real perturbedPosition[3] = {position[0], position[1], position[2]};
+            Real forwardAcceleration[3];
+            Real backwardAcceleration[3];
+            perturbedPosition[j] = position[j] + stepSize;
+            dynamics(0.0, perturbedPosition, velocity, forwardAcceleration);
+            perturbedPosition[j] = position[j] - stepSize;
+            dynamics(0.0, perturbedPosition, velocity, backwardAcceleration);
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                gradient[i][j]
+                    = (forwardAcceleration[i] - backwardAcceleration[i]) / (2.0 * stepSize);
+            }
+        }
+        benchmark::DoNotOptimize(acceleration);
+        benchmark::DoNotOptimize(gradient);
+    }
+}
+BENCHMARK(benchmarkAccelerationGradientFiniteDifferences);
+
+void benchmarkCartesianVariationalDynamics(benchmark::State& state)
+{
+    const auto dynamics = makeCartesianVariationalDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(gravitationalParameter),
+        J2AccelerationModel<Real>(gravitationalParameter, equatorialRadius, j2Coefficient),
+        CannonballRadiationPressureAccelerationModel<Real>(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           radius,
+                                                           bulkDensity));
+
+    Real variationalState[42];
+    initializeCartesianVariationalState(cartesianState, variationalState);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(variationalState);
+
+        Real variationalStateDerivative[42];
+        dynamics(0.0, variationalState, variationalStateDerivative);
+        benchmark::DoNotOptimize(variationalStateDerivative);
+    }
+}
+BENCHMARK(benchmarkCartesianVariationalDynamics);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/catalogFile.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+
+//! Number of objects in benchmark catalog file (12 MB in double precision).
+const std::size_t catalogFileNumberOfObjects = 262144;
+
+//! Write catalog file of Cartesian elements for full eccentricity range.
+void writeCartesianCatalogFile(const std::string& fileName)
+{
+    const std::vector<std::array<Real, 6> > samples
+        = generateCartesianElements<Real>(fullEccentricityRangeRegime, 4096);
+    CatalogFileWriter<Real> writer(fileName, cartesianCatalogElements);
+    for (std::size_t i = 0; i < catalogFileNumberOfObjects; ++i)
+    {
+        writer.appendState(samples[i % samples.size()]);
+    }
+}
+
+void benchmarkWriteCatalogFile(benchmark::State& state)
+{
+    const std::string fileName = "benchmarkWriteCatalogFile.bin";
+    for (auto _ : state)
+    {
+        writeCartesianCatalogFile(fileName);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(catalogFileNumberOfObjects * 6
+                                                        * sizeof(Real)));
+    std::remove(fileName.c_str());
+}
+BENCHMARK(benchmarkWriteCatalogFile)->Unit(benchmark::kMillisecond);
+
+void benchmarkScanMappedCatalogFile(benchmark::State& state)
+{
+    const std::string fileName = "benchmarkScanCatalogFile.bin";
+    writeCartesianCatalogFile(fileName);
+
+    for (auto _ : state)
+    {
+        const MappedCatalogFile<Real> catalog(fileName);
+        Real sum = 0.0;
+        for (std::size_t chunkIndex = 0; chunkIndex < catalog.getNumberOfChunks(); ++chunkIndex)
+        {
+            const Real* elements[6];
+            const std::size_t chunkSize = catalog.getChunk(chunkIndex, elements);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                for (std::size_t i = 0; i < chunkSize; ++i)
+                {
+                    sum += elements[k][i];
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(catalogFileNumberOfObjects * 6
+                                                        * sizeof(Real)));
+    std::remove(fileName.c_str());
+}
+BENCHMARK(benchmarkScanMappedCatalogFile)->Unit(benchmark::kMillisecond);
+
+void benchmarkConvertMappedCatalogFileInPlace(benchmark::State& state)
+{
+    const std::string fileName = "benchmarkConvertCatalogFile.bin";
+    writeCartesianCatalogFile(fileName);
+
+    MappedCatalogFile<Real> catalog(fileName, true);
+    for (auto _ : state)
+    {
+        // Round trip, such that the catalog is unchanged after each iteration.
+        for (std::size_t chunkIndex = 0; chunkIndex < catalog.getNumberOfChunks(); ++chunkIndex)
+        {
+            Real* elements[6];
+            const std::size_t chunkSize = catalog.getChunk(chunkIndex, elements);
+            convertCartesianToKeplerianElements(
+                elements, elements, chunkSize, earthGravitationalParameter);
+            convertKeplerianToCartesianElements(
+                elements, elements, chunkSize, earthGravitationalParameter);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(catalogFileNumberOfObjects));
+    std::remove(fileName.c_str());
+}
+BENCHMARK(benchmarkConvertMappedCatalogFileInPlace)->Unit(benchmark::kMillisecond);
+
+} // namespace benchmarks
+} // namespace astro
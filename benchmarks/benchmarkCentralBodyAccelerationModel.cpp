@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/centralBodyAccelerationModel.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+typedef std::array<Real, 6> Array6;
+
+void benchmarkComputeCentralBodyAcceleration(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> cartesianElements
+        = generateCartesianElements<Real>(regime, numberOfSamples);
+
+    std::vector<Vector3> positions(numberOfSamples);
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        positions[i] = {{cartesianElements[i][xPositionIndex],
+                         cartesianElements[i][yPositionIndex],
+                         cartesianElements[i][zPositionIndex]}};
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Vector3 acceleration
+            = computeCentralBodyAcceleration(earthGravitationalParameter, positions[i]);
+        benchmark::DoNotOptimize(acceleration);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkComputeCentralBodyAcceleration)->Apply(applyOrbitRegimes);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/chebyshevEphemeris.hpp"
+#include "astro/keplerPropagator.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 6> Vector6;
+
+//! Duration of benchmark ephemeris (1 day) [s].
+const Real chebyshevEphemerisDuration = 86400.0;
+
+//! Number of sampled epochs per benchmark iteration.
+const std::size_t chebyshevEphemerisNumberOfEpochs = 1024;
+
+void benchmarkKeplerPropagatorSampling(benchmark::State& state)
+{
+    const Vector6 initialState = generateCartesianElements<Real>(lowEarthOrbitRegime, 1)[0];
+    const KeplerPropagator<Real, Vector6> propagator(initialState, earthGravitationalParameter);
+
+    for (auto _ : state)
+    {
+        for (std::size_t n = 0; n < chebyshevEphemerisNumberOfEpochs; ++n)
+        {
+            benchmark::DoNotOptimize(propagator.propagate(
+                chebyshevEphemerisDuration * static_cast<Real>(n)
+                / static_cast<Real>(chebyshevEphemerisNumberOfEpochs)));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(chebyshevEphemerisNumberOfEpochs));
+}
+BENCHMARK(benchmarkKeplerPropagatorSampling);
+
+void benchmarkChebyshevEphemerisSampling(benchmark::State& state)
+{
+    const Vector6 initialState = generateCartesianElements<Real>(lowEarthOrbitRegime, 1)[0];
+    const KeplerPropagator<Real, Vector6> propagator(initialState, earthGravitationalParameter);
+    const ChebyshevEphemeris<Real> ephemeris(
+        [&propagator](const Real epoch, Real position[3])
+        {
+            const Vector6 propagatedState = propagator.propagate(epoch);
+            position[0] = propagatedState[0];
+            position[1] = propagatedState[1];
+            position[2] = propagatedState[2];
+        },
+        0.0,
+        chebyshevEphemerisDuration,
+        1.0e-3);
+
+    for (auto _ : state)
+    {
+        for (std::size_t n = 0; n < chebyshevEphemerisNumberOfEpochs; ++n)
+        {
+            Real ephemerisState[6];
+            ephemeris.evaluateState(chebyshevEphemerisDuration * static_cast<Real>(n)
+                                    / static_cast<Real>(chebyshevEphemerisNumberOfEpochs),
+                                    ephemerisState);
+            benchmark::DoNotOptimize(ephemerisState);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(chebyshevEphemerisNumberOfEpochs));
+    state.counters["coefficients"] = static_cast<double>(ephemeris.getCoefficients().size());
+}
+BENCHMARK(benchmarkChebyshevEphemerisSampling);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/conjunctionScreening.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+
+void benchmarkScreenConjunctions(benchmark::State& state)
+{
+    // Screen a catalog of low Earth orbits over 10 minutes with a 5 km screening distance.
+    const std::size_t numberOfObjects = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::array<Real, 6> > samples
+        = generateCartesianElements<Real>(lowEarthOrbitRegime, numberOfObjects);
+
+    std::vector<std::vector<Real> > columns(6, std::vector<Real>(numberOfObjects));
+    const Real* states[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            columns[k][i] = samples[i][k];
+        }
+        states[k] = columns[k].data();
+    }
+
+    std::size_t numberOfConjunctions = 0;
+    for (auto _ : state)
+    {
+        const std::vector<Conjunction<Real> > conjunctions = screenConjunctions(
+            states, numberOfObjects, static_cast<Real>(earthGravitationalParameter),
+            600.0, 5.0e3, 10.0);
+        numberOfConjunctions = conjunctions.size();
+        benchmark::DoNotOptimize(conjunctions.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(numberOfObjects));
+    state.counters["conjunctions"] = static_cast<double>(numberOfConjunctions);
+}
+BENCHMARK(benchmarkScreenConjunctions)
+    ->Arg(1000)->Arg(4000)->Arg(16000)->Unit(benchmark::kMillisecond);
+
+} // namespace benchmarks
+} // namespace astro
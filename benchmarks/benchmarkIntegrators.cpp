@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/cartesianDynamics.hpp"
+#include "astro/integrators.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 6> Vector6;
+
+// Set Earth gravitational parameter [m^3 s^-2], equatorial radius [m] and J2 coefficient [-].
+const Real earthGravitationalParameter = 3.986004415e14;
+const Real earthEquatorialRadius = 6378.1363e3;
+const Real earthJ2Coefficient = 1.0826269e-3;
+
+// Set initial Cartesian state [m, m/s] (near-circular low Earth orbit).
+const Vector6 initialCartesianState = {{7.0e6, 0.0, 0.0, 0.0, 5.3e3, 5.3e3}};
+
+// Set time-of-flight (approximately one day) [s].
+const Real timeOfFlight = 86400.0;
+
+void benchmarkRungeKutta4Integrator(benchmark::State& state)
+{
+    const auto dynamics = makeCartesianDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(earthGravitationalParameter),
+        J2AccelerationModel<Real>(
+            earthGravitationalParameter, earthEquatorialRadius, earthJ2Coefficient));
+    RungeKutta4Integrator<Real, 6> integrator;
+
+    for (auto _ : state)
+    {
+        Real time = 0.0;
+        Vector6 cartesianState = initialCartesianState;
+        integrator.integrate(dynamics, time, cartesianState, timeOfFlight, 10.0);
+        benchmark::DoNotOptimize(cartesianState);
+    }
+}
+BENCHMARK(benchmarkRungeKutta4Integrator);
+
+template <typename Tableau>
+void benchmarkEmbeddedRungeKuttaIntegrator(benchmark::State& state)
+{
+    const auto dynamics = makeCartesianDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(earthGravitationalParameter),
+        J2AccelerationModel<Real>(
+            earthGravitationalParameter, earthEquatorialRadius, earthJ2Coefficient));
+    EmbeddedRungeKuttaIntegrator<Real, 6, Tableau> integrator(1.0e-12, 1.0e-9);
+
+    for (auto _ : state)
+    {
+        Real time = 0.0;
+        Real stepSize = 10.0;
+        Vector6 cartesianState = initialCartesianState;
+        integrator.integrate(dynamics, time, cartesianState, timeOfFlight, stepSize);
+        benchmark::DoNotOptimize(cartesianState);
+    }
+}
+BENCHMARK_TEMPLATE(benchmarkEmbeddedRungeKuttaIntegrator, DormandPrince54Tableau<Real>);
+BENCHMARK_TEMPLATE(benchmarkEmbeddedRungeKuttaIntegrator, RungeKuttaFehlberg78Tableau<Real>);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/j2AccelerationModel.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+typedef std::vector<Real> Vector;
+
+// Set Earth gravitational parameter [m^3 s^-2], equatorial radius [m] and J2 coefficient [-].
+const Real earthGravitationalParameter = 3.986004415e14;
+const Real earthEquatorialRadius = 6378.1363e3;
+const Real earthJ2Coefficient = 1.0826269e-3;
+
+// Set position vector [m].
+const Vector3 leoPosition = {{3.75e6, 4.24e6, -1.39e6}};
+
+void benchmarkSeparateCentralBodyAndJ2Acceleration(benchmark::State& state)
+{
+    Vector3 position = leoPosition;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        const Vector3 centralBodyAcceleration
+            = computeCentralBodyAcceleration(earthGravitationalParameter, position);
+        const Vector3 j2Acceleration = computeJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2Coefficient);
+
+        Vector3 acceleration;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            acceleration[i] = centralBodyAcceleration[i] + j2Acceleration[i];
+        }
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkSeparateCentralBodyAndJ2Acceleration);
+
+void benchmarkFusedCentralBodyAndJ2Acceleration(benchmark::State& state)
+{
+    Vector3 position = leoPosition;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        Vector3 acceleration = computeCentralBodyAndJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2Coefficient);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkFusedCentralBodyAndJ2Acceleration);
+
+void benchmarkBatchCentralBodyAndJ2Acceleration(benchmark::State& state)
+{
+    const std::size_t numberOfPositions = static_cast<std::size_t>(state.range(0));
+
+    std::vector<Vector> positionColumns(3, Vector(numberOfPositions));
+    std::vector<Vector> accelerationColumns(3, Vector(numberOfPositions));
+    const Real* positions[3];
+    Real* accelerations[3];
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        for (std::size_t j = 0; j < numberOfPositions; ++j)
+        {
+            positionColumns[k][j]
+                = leoPosition[k] * (1.0 + 1.0e-3 * std::cos(static_cast<Real>(j + k)));
+        }
+        positions[k] = positionColumns[k].data();
+        accelerations[k] = accelerationColumns[k].data();
+    }
+
+    for (auto _ : state)
+    {
+        computeCentralBodyAndJ2Acceleration(earthGravitationalParameter, positions,
+                                            earthEquatorialRadius, earthJ2Coefficient,
+                                            accelerations, numberOfPositions);
+        benchmark::DoNotOptimize(accelerations[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkBatchCentralBodyAndJ2Acceleration)->Arg(1024);
+
+} // namespace benchmarks
+} // namespace astro
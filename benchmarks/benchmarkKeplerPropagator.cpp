@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/keplerPropagator.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+// Set Earth gravitational parameter [m^3 s^-2].
+const Real earthGravitationalParameter = 3.986004415e14;
+
+// Set initial Cartesian state [m, m/s] (elliptical orbit from ODTBX test case).
+const Real initialStateArray[6] = {3.75e6, 4.24e6, -1.39e6, -4.65e3, -2.21e3, 1.66e3};
+
+void benchmarkPropagateKeplerOrbit(benchmark::State& state)
+{
+    const Vector initialState(initialStateArray, initialStateArray + 6);
+
+    Real timeOfFlight = 0.0;
+    for (auto _ : state)
+    {
+        Vector finalState
+            = propagateKeplerOrbit(initialState, earthGravitationalParameter, timeOfFlight);
+        benchmark::DoNotOptimize(finalState);
+        timeOfFlight = timeOfFlight < 1.0e5 ? timeOfFlight + 60.0 : 0.0;
+    }
+}
+BENCHMARK(benchmarkPropagateKeplerOrbit);
+
+void benchmarkKeplerPropagatorEpochs(benchmark::State& state)
+{
+    const std::size_t numberOfEpochs = static_cast<std::size_t>(state.range(0));
+
+    const KeplerPropagator<Real, Vector> propagator(
+        Vector(initialStateArray, initialStateArray + 6), earthGravitationalParameter);
+
+    Vector timesOfFlight(numberOfEpochs);
+    for (std::size_t j = 0; j < numberOfEpochs; ++j)
+    {
+        timesOfFlight[j] = 60.0 * static_cast<Real>(j);
+    }
+
+    std::vector<Vector> stateColumns(6, Vector(numberOfEpochs));
+    Real* states[6];
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        states[i] = stateColumns[i].data();
+    }
+
+    for (auto _ : state)
+    {
+        propagator.propagate(timesOfFlight.data(), states, numberOfEpochs);
+        benchmark::DoNotOptimize(states[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkKeplerPropagatorEpochs)->Arg(1024);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/keplerianOrbit.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+// Set Keplerian elements [m, -, rad] (GTO).
+const Real keplerianStateArray[6] = {2.4e7, 0.73, 0.12, 4.0, 2.0, 0.0};
+
+//! Generate array of anomalies, evenly spaced over one revolution.
+Vector generateAnomalies(const std::size_t numberOfAnomalies)
+{
+    Vector anomalies(numberOfAnomalies);
+    for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+    {
+        anomalies[j] = 6.28 * static_cast<Real>(j) / static_cast<Real>(numberOfAnomalies) - 3.14;
+    }
+    return anomalies;
+}
+
+void benchmarkConvertKeplerianToCartesianElementsAlongOrbit(benchmark::State& state)
+{
+    const std::size_t numberOfAnomalies = static_cast<std::size_t>(state.range(0));
+    const Vector anomalies = generateAnomalies(numberOfAnomalies);
+    Vector keplerianState(keplerianStateArray, keplerianStateArray + 6);
+
+    for (auto _ : state)
+    {
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            keplerianState[trueAnomalyIndex] = anomalies[j];
+            Vector cartesianState = convertKeplerianToCartesianElements(
+                keplerianState, earthGravitationalParameter);
+            benchmark::DoNotOptimize(cartesianState);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertKeplerianToCartesianElementsAlongOrbit)->Arg(1024);
+
+void benchmarkKeplerianOrbitTrueAnomaly(benchmark::State& state)
+{
+    const std::size_t numberOfAnomalies = static_cast<std::size_t>(state.range(0));
+    const Vector anomalies = generateAnomalies(numberOfAnomalies);
+    const KeplerianOrbit<Real, Vector> orbit(
+        Vector(keplerianStateArray, keplerianStateArray + 6), earthGravitationalParameter);
+
+    for (auto _ : state)
+    {
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            Vector cartesianState = orbit.computeCartesianElements(anomalies[j]);
+            benchmark::DoNotOptimize(cartesianState);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkKeplerianOrbitTrueAnomaly)->Arg(1024);
+
+void benchmarkKeplerianOrbitTrueAnomalies(benchmark::State& state)
+{
+    const std::size_t numberOfAnomalies = static_cast<std::size_t>(state.range(0));
+    const Vector anomalies = generateAnomalies(numberOfAnomalies);
+    const KeplerianOrbit<Real, Vector> orbit(
+        Vector(keplerianStateArray, keplerianStateArray + 6), earthGravitationalParameter);
+
+    std::vector<Vector> stateColumns(6, Vector(numberOfAnomalies));
+    Real* states[6];
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        states[i] = stateColumns[i].data();
+    }
+
+    for (auto _ : state)
+    {
+        orbit.computeCartesianElements(anomalies.data(), states, numberOfAnomalies);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkKeplerianOrbitTrueAnomalies)->Arg(1024)->Arg(65536);
+
+void benchmarkKeplerianOrbitMeanAnomalies(benchmark::State& state)
+{
+    const std::size_t numberOfAnomalies = static_cast<std::size_t>(state.range(0));
+    const Vector anomalies = generateAnomalies(numberOfAnomalies);
+    const KeplerianOrbit<Real, Vector> orbit(
+        Vector(keplerianStateArray, keplerianStateArray + 6), earthGravitationalParameter);
+
+    std::vector<Vector> stateColumns(6, Vector(numberOfAnomalies));
+    Real* states[6];
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        states[i] = stateColumns[i].data();
+    }
+
+    for (auto _ : state)
+    {
+        orbit.computeCartesianElementsFromMeanAnomaly(anomalies.data(), states, numberOfAnomalies);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkKeplerianOrbitMeanAnomalies)->Arg(1024)->Arg(65536);
+
+} // namespace benchmarks
+} // namespace astro
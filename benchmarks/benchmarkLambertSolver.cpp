@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/lambertSolver.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+typedef std::array<Real, 6> Vector6;
+
+void benchmarkSolveLambertProblem(benchmark::State& state)
+{
+    const std::vector<Vector6> samples
+        = generateCartesianElements<Real>(lowEarthOrbitRegime, 1024);
+
+    std::size_t n = 0;
+    for (auto _ : state)
+    {
+        const Vector6& departureState = samples[n % samples.size()];
+        const Vector6& arrivalState = samples[(n + 1) % samples.size()];
+        const Vector3 departurePosition
+            = {{departureState[0], departureState[1], departureState[2]}};
+        const Vector3 arrivalPosition = {{arrivalState[0], arrivalState[1], arrivalState[2]}};
+        Vector3 departureVelocity;
+        Vector3 arrivalVelocity;
+        solveLambertProblem(departurePosition,
+                            arrivalPosition,
+                            Real(1800.0) + Real(10.0) * static_cast<Real>(n % 100),
+                            static_cast<Real>(earthGravitationalParameter),
+                            departureVelocity,
+                            arrivalVelocity);
+        benchmark::DoNotOptimize(departureVelocity);
+        benchmark::DoNotOptimize(arrivalVelocity);
+        ++n;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(benchmarkSolveLambertProblem);
+
+void benchmarkComputePorkchopGrid(benchmark::State& state)
+{
+    // Transfers between two Earth orbits, over a square grid of departure and arrival epochs.
+    const std::size_t numberOfEpochs = static_cast<std::size_t>(state.range(0));
+    const Vector6 departureInitialState
+        = generateCartesianElements<Real>(lowEarthOrbitRegime, 1)[0];
+    const Vector6 arrivalInitialState
+        = generateCartesianElements<Real>(geostationaryOrbitRegime, 1)[0];
+    const KeplerPropagator<Real, Vector6> departurePropagator(
+        departureInitialState, static_cast<Real>(earthGravitationalParameter));
+    const KeplerPropagator<Real, Vector6> arrivalPropagator(
+        arrivalInitialState, static_cast<Real>(earthGravitationalParameter));
+
+    std::vector<Real> departureEpochs(numberOfEpochs);
+    std::vector<Real> arrivalEpochs(numberOfEpochs);
+    std::vector<std::vector<Real> > departureColumns(6, std::vector<Real>(numberOfEpochs));
+    std::vector<std::vector<Real> > arrivalColumns(6, std::vector<Real>(numberOfEpochs));
+    for (std::size_t i = 0; i < numberOfEpochs; ++i)
+    {
+        departureEpochs[i]
+            = Real(86400.0) * static_cast<Real>(i) / static_cast<Real>(numberOfEpochs);
+        arrivalEpochs[i] = Real(3600.0) + Real(2.0) * departureEpochs[i];
+        const Vector6 departureState = departurePropagator.propagate(departureEpochs[i]);
+        const Vector6 arrivalState = arrivalPropagator.propagate(arrivalEpochs[i]);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            departureColumns[k][i] = departureState[k];
+            arrivalColumns[k][i] = arrivalState[k];
+        }
+    }
+
+    const Real* departureStates[6];
+    const Real* arrivalStates[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        departureStates[k] = departureColumns[k].data();
+        arrivalStates[k] = arrivalColumns[k].data();
+    }
+
+    std::vector<Real> departureExcessVelocities(numberOfEpochs * numberOfEpochs);
+    std::vector<Real> arrivalExcessVelocities(numberOfEpochs * numberOfEpochs);
+    for (auto _ : state)
+    {
+        computePorkchopGrid(departureEpochs.data(),
+                            departureStates,
+                            numberOfEpochs,
+                            arrivalEpochs.data(),
+                            arrivalStates,
+                            numberOfEpochs,
+                            static_cast<Real>(earthGravitationalParameter),
+                            departureExcessVelocities.data(),
+                            arrivalExcessVelocities.data());
+        benchmark::DoNotOptimize(departureExcessVelocities.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations())
+                            * static_cast<std::int64_t>(numberOfEpochs * numberOfEpochs));
+}
+BENCHMARK(benchmarkComputePorkchopGrid)->Arg(256)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+} // namespace benchmarks
+} // namespace astro
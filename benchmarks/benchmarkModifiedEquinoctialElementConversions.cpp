@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/modifiedEquinoctialElementConversions.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 6> Array6;
+
+// Number of sampled states (near-circular, near-equatorial GEO regime).
+const std::size_t numberOfGeostationaryStates = 1024;
+
+void benchmarkConvertCartesianToKeplerianElementsGeostationary(benchmark::State& state)
+{
+    const std::vector<Array6> cartesianStates
+        = generateCartesianElements<Real>(geostationaryOrbitRegime, numberOfGeostationaryStates);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Array6 keplerianElements = convertCartesianToKeplerianElements(
+            cartesianStates[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(keplerianElements);
+        i = (i + 1) % numberOfGeostationaryStates;
+    }
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsGeostationary);
+
+void benchmarkConvertCartesianToModifiedEquinoctialElements(benchmark::State& state)
+{
+    const std::vector<Array6> cartesianStates
+        = generateCartesianElements<Real>(geostationaryOrbitRegime, numberOfGeostationaryStates);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Array6 modifiedEquinoctialElements = convertCartesianToModifiedEquinoctialElements(
+            cartesianStates[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(modifiedEquinoctialElements);
+        i = (i + 1) % numberOfGeostationaryStates;
+    }
+}
+BENCHMARK(benchmarkConvertCartesianToModifiedEquinoctialElements);
+
+void benchmarkConvertModifiedEquinoctialToCartesianElements(benchmark::State& state)
+{
+    const std::vector<Array6> cartesianStates
+        = generateCartesianElements<Real>(geostationaryOrbitRegime, numberOfGeostationaryStates);
+    std::vector<Array6> modifiedEquinoctialStates(numberOfGeostationaryStates);
+    for (std::size_t i = 0; i < numberOfGeostationaryStates; ++i)
+    {
+        modifiedEquinoctialStates[i] = convertCartesianToModifiedEquinoctialElements(
+            cartesianStates[i], earthGravitationalParameter);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Array6 cartesianElements = convertModifiedEquinoctialToCartesianElements(
+            modifiedEquinoctialStates[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(cartesianElements);
+        i = (i + 1) % numberOfGeostationaryStates;
+    }
+}
+BENCHMARK(benchmarkConvertModifiedEquinoctialToCartesianElements);
+
+void benchmarkConvertCartesianToModifiedEquinoctialElementsBatch(benchmark::State& state)
+{
+    const std::size_t numberOfStates = static_cast<std::size_t>(state.range(0));
+    const std::vector<Array6> cartesianStates
+        = generateCartesianElements<Real>(geostationaryOrbitRegime, numberOfStates);
+
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    std::vector<Vector> modifiedEquinoctialColumns(6, Vector(numberOfStates));
+    const Real* cartesianElements[6];
+    Real* modifiedEquinoctialElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        for (std::size_t i = 0; i < numberOfStates; ++i)
+        {
+            cartesianColumns[j][i] = cartesianStates[i][j];
+        }
+        cartesianElements[j] = cartesianColumns[j].data();
+        modifiedEquinoctialElements[j] = modifiedEquinoctialColumns[j].data();
+    }
+
+    for (auto _ : state)
+    {
+        convertCartesianToModifiedEquinoctialElements(cartesianElements,
+                                                      modifiedEquinoctialElements,
+                                                      numberOfStates,
+                                                      earthGravitationalParameter);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertCartesianToModifiedEquinoctialElementsBatch)->Arg(1024)->Arg(65536);
+
+} // namespace benchmarks
+} // namespace astro
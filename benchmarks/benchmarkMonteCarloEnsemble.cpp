@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/integrators.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/monteCarloEnsemble.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Earth J2-coefficient [-].
+const Real earthJ2 = 1.082626925638815e-3;
+
+//! Ensemble stored as structure-of-arrays (not copyable, since it stores pointers to its columns).
+struct Ensemble
+{
+    explicit Ensemble(const std::size_t numberOfMembers)
+        : columns(6, Vector(numberOfMembers))
+    {
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            states[k] = columns[k].data();
+        }
+
+        const Real nominalState[6] = {7.0e6, 1.0e5, -2.0e5, 100.0, 7.4e3, 1.2e3};
+        Real choleskyFactor[6][6] = {};
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            choleskyFactor[k][k] = k < 3 ? 1.0e3 : 1.0;
+        }
+        generateEnsembleDispersions(
+            nominalState, choleskyFactor, 42, states, numberOfMembers);
+    }
+
+    Ensemble(const Ensemble&) = delete;
+    Ensemble& operator=(const Ensemble&) = delete;
+
+    std::vector<Vector> columns;
+    Real* states[6];
+};
+
+//! Central body and J2 dynamics of single Cartesian state.
+struct SingleStateCentralBodyAndJ2Dynamics
+{
+    void operator()(const Real, const Real* const state, Real* const stateDerivative) const
+    {
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            stateDerivative[i] = state[i + 3];
+        }
+        computeCentralBodyAndJ2Acceleration(Real(earthGravitationalParameter),
+                                            state,
+                                            Real(earthEquatorialRadius),
+                                            earthJ2,
+                                            stateDerivative + 3);
+    }
+};
+
+const std::size_t numberOfEnsembleMembers = 4096;
+const Real ensembleTimeOfFlight = 600.0;
+const Real ensembleStepSize = 10.0;
+
+void benchmarkGenerateEnsembleDispersions(benchmark::State& state)
+{
+    Ensemble ensemble(numberOfEnsembleMembers);
+    Real choleskyFactor[6][6] = {};
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        choleskyFactor[k][k] = 1.0;
+    }
+    const Real nominalState[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    std::uint64_t seed = 0;
+    for (auto _ : state)
+    {
+        generateEnsembleDispersions(nominalState,
+                                    choleskyFactor,
+                                    seed++,
+                                    ensemble.states,
+                                    numberOfEnsembleMembers,
+                                    static_cast<std::size_t>(state.range(0)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfEnsembleMembers);
+}
+BENCHMARK(benchmarkGenerateEnsembleDispersions)->Arg(1)->Arg(0)->UseRealTime();
+
+//! Propagate ensemble member by member, i.e., array-of-structures loop over scalar RK4.
+void benchmarkPropagateEnsembleMembers(benchmark::State& state)
+{
+    Ensemble ensemble(numberOfEnsembleMembers);
+    const SingleStateCentralBodyAndJ2Dynamics dynamics = SingleStateCentralBodyAndJ2Dynamics();
+    RungeKutta4Integrator<Real, 6> integrator;
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < numberOfEnsembleMembers; ++i)
+        {
+            Real memberState[6];
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                memberState[k] = ensemble.columns[k][i];
+            }
+            Real time = 0.0;
+            integrator.integrate(
+                dynamics, time, memberState, ensembleTimeOfFlight, ensembleStepSize);
+            benchmark::DoNotOptimize(memberState);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfEnsembleMembers);
+}
+BENCHMARK(benchmarkPropagateEnsembleMembers)->UseRealTime();
+
+void benchmarkPropagateEnsemble(benchmark::State& state)
+{
+    Ensemble initialEnsemble(numberOfEnsembleMembers);
+    Ensemble ensemble(numberOfEnsembleMembers);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            ensemble.columns[k].assign(initialEnsemble.columns[k].begin(),
+                                       initialEnsemble.columns[k].end());
+        }
+        state.ResumeTiming();
+
+        propagateEnsemble(ensemble.states,
+                          numberOfEnsembleMembers,
+                          Real(earthGravitationalParameter),
+                          Real(earthEquatorialRadius),
+                          earthJ2,
+                          ensembleTimeOfFlight,
+                          ensembleStepSize,
+                          static_cast<std::size_t>(state.range(0)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfEnsembleMembers);
+}
+BENCHMARK(benchmarkPropagateEnsemble)->Arg(1)->Arg(0)->UseRealTime();
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/orbitalElementConversions.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 6> Array6;
+
+// Set sample of Cartesian states [m, m/s] (elliptical orbit from ODTBX test case, LEO, GTO).
+const Real cartesianStates[3][6]
+    = {{3.75e6, 4.24e6, -1.39e6, -4.65e3, -2.21e3, 1.66e3},
+       {-2700816.14, -3314092.80, 5266346.42, 5168.606550, -5597.546618, -868.878445},
+       {6.678e6, 0.0, 1.0e5, 0.0, 1.0e4, 1.5e3}};
+
+template <typename Vector6>
+void benchmarkConvertCartesianToKeplerianElements(benchmark::State& state,
+                                                  const Vector6 (&cartesianElements)[3])
+{
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Vector6 keplerianElements = convertCartesianToKeplerianElements(
+            cartesianElements[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(keplerianElements);
+        i = (i + 1) % 3;
+    }
+}
+
+void benchmarkConvertCartesianToKeplerianElementsVector(benchmark::State& state)
+{
+    Vector cartesianElements[3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        cartesianElements[i] = Vector(cartesianStates[i], cartesianStates[i] + 6);
+    }
+    benchmarkConvertCartesianToKeplerianElements(state, cartesianElements);
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsVector);
+
+void benchmarkConvertCartesianToKeplerianElementsArray(benchmark::State& state)
+{
+    Array6 cartesianElements[3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        std::copy(cartesianStates[i], cartesianStates[i] + 6, cartesianElements[i].begin());
+    }
+    benchmarkConvertCartesianToKeplerianElements(state, cartesianElements);
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsArray);
+
+void benchmarkConvertCartesianToKeplerianElementsIntoVector(benchmark::State& state)
+{
+    Vector cartesianElements[3];
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        cartesianElements[i] = Vector(cartesianStates[i], cartesianStates[i] + 6);
+    }
+
+    // Reuse a single output vector, instead of allocating the returned vector.
+    Vector keplerianElements(6);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        convertCartesianToKeplerianElements(
+            cartesianElements[i], earthGravitationalParameter, keplerianElements);
+        benchmark::DoNotOptimize(keplerianElements.data());
+        benchmark::ClobberMemory();
+        i = (i + 1) % 3;
+    }
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsIntoVector);
+
+void benchmarkConvertCartesianToKeplerianElementsBatch(benchmark::State& state)
+{
+    const std::size_t numberOfStates = static_cast<std::size_t>(state.range(0));
+
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfStates));
+    for (std::size_t i = 0; i < numberOfStates; ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            cartesianColumns[j][i] = cartesianStates[i % 3][j];
+        }
+    }
+
+    const Real* cartesianElements[6];
+    Real* keplerianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        cartesianElements[j] = cartesianColumns[j].data();
+        keplerianElements[j] = keplerianColumns[j].data();
+    }
+
+    for (auto _ : state)
+    {
+        convertCartesianToKeplerianElements(
+            cartesianElements, keplerianElements, numberOfStates, earthGravitationalParameter);
+        benchmark::DoNotOptimize(keplerianElements[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsBatch)->Arg(1024)->Arg(65536);
+
+void benchmarkConvertKeplerianToCartesianElementsBatch(benchmark::State& state)
+{
+    const std::size_t numberOfStates = static_cast<std::size_t>(state.range(0));
+
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfStates));
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    for (std::size_t i = 0; i < numberOfStates; ++i)
+    {
+        const Vector keplerianState = convertCartesianToKeplerianElements(
+            Vector(cartesianStates[i % 3], cartesianStates[i % 3] + 6),
+            earthGravitationalParameter);
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            keplerianColumns[j][i] = keplerianState[j];
+        }
+    }
+
+    const Real* keplerianElements[6];
+    Real* cartesianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        keplerianElements[j] = keplerianColumns[j].data();
+        cartesianElements[j] = cartesianColumns[j].data();
+    }
+
+    for (auto _ : state)
+    {
+        convertKeplerianToCartesianElements(
+            keplerianElements, cartesianElements, numberOfStates, earthGravitationalParameter);
+        benchmark::DoNotOptimize(cartesianElements[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertKeplerianToCartesianElementsBatch)->Arg(1024)->Arg(65536);
+
+void benchmarkConvertEllipticalMeanAnomalyToEccentricAnomaly(benchmark::State& state)
+{
+    const std::size_t numberOfElements = static_cast<std::size_t>(state.range(0));
+
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 0.9 * static_cast<Real>(i % 97) / 96.0;
+        meanAnomalies[i] = 6.28 * static_cast<Real>(i % 101) / 100.0;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real eccentricAnomaly = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, int>(
+            eccentricities[i], meanAnomalies[i]);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfElements;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmarkConvertEllipticalMeanAnomalyToEccentricAnomaly)->Arg(1024);
+
+void benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyMarkley(benchmark::State& state)
+{
+    const std::size_t numberOfElements = static_cast<std::size_t>(state.range(0));
+
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 0.9 * static_cast<Real>(i % 97) / 96.0;
+        meanAnomalies[i] = 6.28 * static_cast<Real>(i % 101) / 100.0;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real eccentricAnomaly = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+            eccentricities[i], meanAnomalies[i]);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfElements;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyMarkley)->Arg(1024);
+
+void benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyBatch(benchmark::State& state)
+{
+    const std::size_t numberOfElements = static_cast<std::size_t>(state.range(0));
+
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    Vector eccentricAnomalies(numberOfElements);
+    std::unique_ptr<bool[]> isConverged(new bool[numberOfElements]);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 0.9 * static_cast<Real>(i % 97) / 96.0;
+        meanAnomalies[i] = 6.28 * static_cast<Real>(i % 101) / 100.0;
+    }
+
+    for (auto _ : state)
+    {
+        convertEllipticalMeanAnomalyToEccentricAnomaly<Real, int>(
+            eccentricities.data(), meanAnomalies.data(), eccentricAnomalies.data(),
+            isConverged.get(), numberOfElements);
+        benchmark::DoNotOptimize(eccentricAnomalies[0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyBatch)->Arg(1024)->Arg(65536);
+
+void benchmarkConvertHyperbolicMeanAnomalyToEccentricAnomaly(benchmark::State& state)
+{
+    const std::size_t numberOfElements = static_cast<std::size_t>(state.range(0));
+
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 1.01 + 10.0 * static_cast<Real>(i % 97) / 96.0;
+        meanAnomalies[i] = 20.0 * static_cast<Real>(i % 101) / 100.0 - 10.0;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real hyperbolicEccentricAnomaly
+            = convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, int>(
+                eccentricities[i], meanAnomalies[i]);
+        benchmark::DoNotOptimize(hyperbolicEccentricAnomaly);
+        i = (i + 1) % numberOfElements;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmarkConvertHyperbolicMeanAnomalyToEccentricAnomaly)->Arg(1024);
+
+void benchmarkConvertHyperbolicMeanAnomalyToEccentricAnomalyBatch(benchmark::State& state)
+{
+    const std::size_t numberOfElements = static_cast<std::size_t>(state.range(0));
+
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    Vector hyperbolicEccentricAnomalies(numberOfElements);
+    std::unique_ptr<bool[]> isConverged(new bool[numberOfElements]);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 1.01 + 10.0 * static_cast<Real>(i % 97) / 96.0;
+        meanAnomalies[i] = 20.0 * static_cast<Real>(i % 101) / 100.0 - 10.0;
+    }
+
+    for (auto _ : state)
+    {
+        convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, int>(
+            eccentricities.data(), meanAnomalies.data(), hyperbolicEccentricAnomalies.data(),
+            isConverged.get(), numberOfElements);
+        benchmark::DoNotOptimize(hyperbolicEccentricAnomalies[0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkConvertHyperbolicMeanAnomalyToEccentricAnomalyBatch)->Arg(1024)->Arg(65536);
+
+void benchmarkConvertCartesianToKeplerianElementsRegime(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> cartesianElements
+        = generateCartesianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Array6 keplerianElements = convertCartesianToKeplerianElements(
+            cartesianElements[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(keplerianElements);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsRegime)->Apply(applyOrbitRegimes);
+
+void benchmarkConvertKeplerianToCartesianElementsRegime(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Array6 cartesianElements = convertKeplerianToCartesianElements(
+            keplerianElements[i], earthGravitationalParameter);
+        benchmark::DoNotOptimize(cartesianElements);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertKeplerianToCartesianElementsRegime)->Apply(applyOrbitRegimes);
+
+//! Transpose sample of states to structure-of-arrays layout.
+std::vector<Vector> transposeStates(const std::vector<Array6>& states)
+{
+    std::vector<Vector> columns(6, Vector(states.size()));
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            columns[j][i] = states[i][j];
+        }
+    }
+    return columns;
+}
+
+void benchmarkConvertCartesianToKeplerianElementsBatchRegime(benchmark::State& state)
+{
+    const std::size_t numberOfStates = static_cast<std::size_t>(state.range(0));
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(1));
+
+    const std::vector<Vector> cartesianColumns
+        = transposeStates(generateCartesianElements<Real>(regime, numberOfStates));
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfStates));
+
+    const Real* cartesianElements[6];
+    Real* keplerianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        cartesianElements[j] = cartesianColumns[j].data();
+        keplerianElements[j] = keplerianColumns[j].data();
+    }
+
+    for (auto _ : state)
+    {
+        convertCartesianToKeplerianElements(
+            cartesianElements, keplerianElements, numberOfStates, earthGravitationalParameter);
+        benchmark::DoNotOptimize(keplerianElements[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertCartesianToKeplerianElementsBatchRegime)
+    ->Apply(applyBatchSizesAndOrbitRegimes);
+
+void benchmarkConvertKeplerianToCartesianElementsBatchRegime(benchmark::State& state)
+{
+    const std::size_t numberOfStates = static_cast<std::size_t>(state.range(0));
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(1));
+
+    const std::vector<Vector> keplerianColumns
+        = transposeStates(generateKeplerianElements<Real>(regime, numberOfStates));
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+
+    const Real* keplerianElements[6];
+    Real* cartesianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        keplerianElements[j] = keplerianColumns[j].data();
+        cartesianElements[j] = cartesianColumns[j].data();
+    }
+
+    for (auto _ : state)
+    {
+        convertKeplerianToCartesianElements(
+            keplerianElements, cartesianElements, numberOfStates, earthGravitationalParameter);
+        benchmark::DoNotOptimize(cartesianElements[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertKeplerianToCartesianElementsBatchRegime)
+    ->Apply(applyBatchSizesAndOrbitRegimes);
+
+void benchmarkConvertTrueAnomalyToEccentricAnomaly(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real eccentricAnomaly = convertTrueAnomalyToEccentricAnomaly(
+            keplerianElements[i][trueAnomalyIndex], keplerianElements[i][eccentricityIndex]);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertTrueAnomalyToEccentricAnomaly)->Apply(applyOrbitRegimes);
+
+void benchmarkConvertEccentricAnomalyToMeanAnomaly(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // The true anomaly sample is used as eccentric anomaly, as both are uniform in [0, 2pi).
+        Real meanAnomaly = convertEccentricAnomalyToMeanAnomaly(
+            keplerianElements[i][trueAnomalyIndex], keplerianElements[i][eccentricityIndex]);
+        benchmark::DoNotOptimize(meanAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertEccentricAnomalyToMeanAnomaly)->Apply(applyOrbitRegimes);
+
+void benchmarkConvertTrueAnomalyToMeanAnomaly(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real meanAnomaly = convertTrueAnomalyToMeanAnomaly(
+            keplerianElements[i][trueAnomalyIndex], keplerianElements[i][eccentricityIndex]);
+        benchmark::DoNotOptimize(meanAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertTrueAnomalyToMeanAnomaly)->Apply(applyOrbitRegimes);
+
+void benchmarkConvertEccentricAnomalyToTrueAnomaly(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real trueAnomaly = convertEccentricAnomalyToTrueAnomaly(
+            keplerianElements[i][trueAnomalyIndex], keplerianElements[i][eccentricityIndex]);
+        benchmark::DoNotOptimize(trueAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertEccentricAnomalyToTrueAnomaly)->Apply(applyOrbitRegimes);
+
+void benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyRegime(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // The true anomaly sample is used as mean anomaly, as both are uniform in [0, 2pi).
+        Real eccentricAnomaly = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, int>(
+            keplerianElements[i][eccentricityIndex], keplerianElements[i][trueAnomalyIndex]);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyRegime)
+    ->Apply(applyOrbitRegimes);
+
+void benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyMarkleyRegime(
+    benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // The true anomaly sample is used as mean anomaly, as both are uniform in [0, 2pi).
+        Real eccentricAnomaly = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+            keplerianElements[i][eccentricityIndex], keplerianElements[i][trueAnomalyIndex]);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkConvertEllipticalMeanAnomalyToEccentricAnomalyMarkleyRegime)
+    ->Apply(applyOrbitRegimes);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/parallelCatalog.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Catalog stored as structure-of-arrays (not copyable, since it stores pointers to its columns).
+struct Catalog
+{
+    explicit Catalog(const std::size_t numberOfElements)
+        : columns(6, Vector(numberOfElements))
+    {
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            elements[k] = columns[k].data();
+            constElements[k] = columns[k].data();
+        }
+    }
+
+    Catalog(const Catalog&) = delete;
+    Catalog& operator=(const Catalog&) = delete;
+
+    std::vector<Vector> columns;
+    Real* elements[6];
+    const Real* constElements[6];
+};
+
+//! Fill catalog with Cartesian elements for full eccentricity range.
+void fillCartesianCatalog(Catalog& catalog)
+{
+    const std::size_t numberOfObjects = catalog.columns[0].size();
+    const std::vector<std::array<Real, 6> > samples
+        = generateCartesianElements<Real>(fullEccentricityRangeRegime, numberOfObjects);
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            catalog.columns[k][i] = samples[i][k];
+        }
+    }
+}
+
+//! Add thread counts (powers of 2, up to the number of hardware threads) as benchmark argument.
+void applyThreadCounts(benchmark::internal::Benchmark* family)
+{
+    const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+    for (int threads = 1; threads < hardwareThreads; threads *= 2)
+    {
+        family->Arg(threads);
+    }
+    family->Arg(hardwareThreads > 0 ? hardwareThreads : 1);
+}
+
+void benchmarkConvertCatalogCartesianToKeplerianElements(benchmark::State& state)
+{
+    const std::size_t numberOfObjects = 65536;
+    Catalog cartesianCatalog(numberOfObjects);
+    fillCartesianCatalog(cartesianCatalog);
+    Catalog keplerianCatalog(numberOfObjects);
+
+    for (auto _ : state)
+    {
+        convertCatalogCartesianToKeplerianElements(cartesianCatalog.constElements,
+                                                   keplerianCatalog.elements,
+                                                   numberOfObjects,
+                                                   earthGravitationalParameter,
+                                                   static_cast<std::size_t>(state.range(0)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfObjects);
+}
+BENCHMARK(benchmarkConvertCatalogCartesianToKeplerianElements)
+    ->Apply(applyThreadCounts)
+    ->UseRealTime();
+
+void benchmarkPropagateCatalog(benchmark::State& state)
+{
+    const std::size_t numberOfObjects = 65536;
+    Catalog initialCatalog(numberOfObjects);
+    fillCartesianCatalog(initialCatalog);
+
+    const std::size_t numberOfEpochs = 4;
+    const Real timesOfFlight[numberOfEpochs] = {60.0, 3600.0, 21600.0, 86400.0};
+    Catalog propagatedCatalog(numberOfObjects * numberOfEpochs);
+
+    for (auto _ : state)
+    {
+        propagateCatalog(initialCatalog.constElements,
+                         numberOfObjects,
+                         timesOfFlight,
+                         numberOfEpochs,
+                         earthGravitationalParameter,
+                         propagatedCatalog.elements,
+                         static_cast<std::size_t>(state.range(0)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfObjects * numberOfEpochs);
+}
+BENCHMARK(benchmarkPropagateCatalog)->Apply(applyThreadCounts)->UseRealTime();
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/radiationPressureAccelerationModel.hpp"
+#include "astro/shadowModel.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+
+// Set solar energy flux at 1 AU [W m^-2], and reference distance [m].
+const Real solarEnergyFlux = 1361.0;
+const Real astronomicalUnit = 1.495978707e11;
+
+// Set radiation pressure coefficient [-], radius [m] and bulk density [kg m^-3] of cannonball.
+const Real radiationPressureCoefficient = 1.3;
+const Real cannonballRadius = 0.5;
+const Real cannonballBulkDensity = 200.0;
+
+// Set unit vector to the Sun [-] and velocity of cannonball [m s^-1].
+const Vector3 unitVectorToSun = {{0.6, 0.0, 0.8}};
+const Vector3 cannonballVelocity = {{-1.2e3, 5.3e3, 4.6e3}};
+
+// Set solar radius and Earth radius [m], and position of the Sun wrt the Earth [m].
+const Real sunRadius = 6.96e8;
+const Real earthRadius = 6378136.3;
+const Vector3 sunPosition = {{0.6 * astronomicalUnit, 0.0, 0.8 * astronomicalUnit}};
+
+//! Generate positions of debris cloud [m], spread around the GEO ring (one column per component).
+std::vector<std::vector<Real> > generateDebrisCloudPositions(const std::size_t numberOfObjects)
+{
+    std::vector<std::vector<Real> > positions(3, std::vector<Real>(numberOfObjects));
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        const Real angle = 6.28 * static_cast<Real>(i) / static_cast<Real>(numberOfObjects);
+        const Real wobble = 1.0e6 * std::sin(37.0 * angle);
+        positions[0][i] = (4.2164e7 + wobble) * std::cos(angle);
+        positions[1][i] = 0.5 * wobble;
+        positions[2][i] = (4.2164e7 + wobble) * std::sin(angle);
+    }
+    return positions;
+}
+
+void benchmarkComputeAbsorptionRadiationPressure(benchmark::State& state)
+{
+    Real energyFlux = solarEnergyFlux;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(energyFlux);
+        Real radiationPressure = computeAbsorptionRadiationPressure(energyFlux);
+        benchmark::DoNotOptimize(radiationPressure);
+    }
+}
+BENCHMARK(benchmarkComputeAbsorptionRadiationPressure);
+
+void benchmarkComputeRadiationPressure(benchmark::State& state)
+{
+    const Real referenceRadiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+    Real distance = 1.2 * astronomicalUnit;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distance);
+        Real radiationPressure
+            = computeRadiationPressure(referenceRadiationPressure, astronomicalUnit, distance);
+        benchmark::DoNotOptimize(radiationPressure);
+    }
+}
+BENCHMARK(benchmarkComputeRadiationPressure);
+
+void benchmarkComputeCannonballRadiationPressureAcceleration(benchmark::State& state)
+{
+    const Real radiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+    Vector3 unitVector = unitVectorToSun;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(unitVector);
+        Vector3 acceleration = computeCannonballRadiationPressureAcceleration(
+            radiationPressure, radiationPressureCoefficient, unitVector,
+            cannonballRadius, cannonballBulkDensity);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkComputeCannonballRadiationPressureAcceleration);
+
+void benchmarkComputeCannonballPoyntingRobertsonDragAcceleration(benchmark::State& state)
+{
+    const Real radiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+    Vector3 unitVector = unitVectorToSun;
+    Vector3 velocity = cannonballVelocity;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(unitVector);
+        benchmark::DoNotOptimize(velocity);
+        Vector3 acceleration = computeCannonballPoyntingRobertsonDragAcceleration(
+            radiationPressure, radiationPressureCoefficient, unitVector,
+            cannonballRadius, cannonballBulkDensity, velocity);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkComputeCannonballPoyntingRobertsonDragAcceleration);
+
+void benchmarkComputeConicalShadowFunction(benchmark::State& state)
+{
+    Vector3 position = {{-4.2164e7, earthRadius, 0.0}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        Real shadowFunction
+            = computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius);
+        benchmark::DoNotOptimize(shadowFunction);
+    }
+}
+BENCHMARK(benchmarkComputeConicalShadowFunction);
+
+void benchmarkComputeShadowedCannonballRadiationPressureAccelerationSeparately(
+    benchmark::State& state)
+{
+    const std::size_t numberOfObjects = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::vector<Real> > positions
+        = generateDebrisCloudPositions(numberOfObjects);
+    const Real referenceRadiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            const Vector3 position = {{positions[0][i], positions[1][i], positions[2][i]}};
+            const Vector3 relativeSunPosition = {{sunPosition[0] - position[0],
+                                                  sunPosition[1] - position[1],
+                                                  sunPosition[2] - position[2]}};
+            const Real sunDistance = std::sqrt(relativeSunPosition[0] * relativeSunPosition[0]
+                                               + relativeSunPosition[1] * relativeSunPosition[1]
+                                               + relativeSunPosition[2] * relativeSunPosition[2]);
+            const Vector3 unitVector = {{relativeSunPosition[0] / sunDistance,
+                                         relativeSunPosition[1] / sunDistance,
+                                         relativeSunPosition[2] / sunDistance}};
+
+            const Real shadowFunction
+                = computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius);
+            const Real radiationPressure = computeRadiationPressure(
+                referenceRadiationPressure, astronomicalUnit, sunDistance);
+            Vector3 acceleration = computeCannonballRadiationPressureAcceleration(
+                shadowFunction * radiationPressure, radiationPressureCoefficient, unitVector,
+                cannonballRadius, cannonballBulkDensity);
+            benchmark::DoNotOptimize(acceleration);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkComputeShadowedCannonballRadiationPressureAccelerationSeparately)->Arg(4096);
+
+void benchmarkComputeShadowedCannonballRadiationPressureAcceleration(benchmark::State& state)
+{
+    const std::size_t numberOfObjects = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::vector<Real> > positions
+        = generateDebrisCloudPositions(numberOfObjects);
+    const Real referenceRadiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            const Vector3 position = {{positions[0][i], positions[1][i], positions[2][i]}};
+            Vector3 acceleration = computeShadowedCannonballRadiationPressureAcceleration(
+                referenceRadiationPressure, astronomicalUnit, radiationPressureCoefficient,
+                position, sunPosition, sunRadius, earthRadius,
+                cannonballRadius, cannonballBulkDensity);
+            benchmark::DoNotOptimize(acceleration);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkComputeShadowedCannonballRadiationPressureAcceleration)->Arg(4096);
+
+void benchmarkComputeShadowedCannonballRadiationPressureAccelerationsBatch(
+    benchmark::State& state)
+{
+    const std::size_t numberOfObjects = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::vector<Real> > positionColumns
+        = generateDebrisCloudPositions(numberOfObjects);
+    std::vector<std::vector<Real> > accelerationColumns(3, std::vector<Real>(numberOfObjects));
+    std::vector<Real> shadowFunctions(numberOfObjects);
+
+    const Real* positions[3];
+    Real* accelerations[3];
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        positions[k] = positionColumns[k].data();
+        accelerations[k] = accelerationColumns[k].data();
+    }
+    const Real referenceRadiationPressure = computeAbsorptionRadiationPressure(solarEnergyFlux);
+
+    for (auto _ : state)
+    {
+        computeShadowedCannonballRadiationPressureAccelerations(
+            positions, numberOfObjects, sunPosition,
+            referenceRadiationPressure, astronomicalUnit, radiationPressureCoefficient,
+            sunRadius, earthRadius, cannonballRadius, cannonballBulkDensity,
+            accelerations, shadowFunctions.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(benchmarkComputeShadowedCannonballRadiationPressureAccelerationsBatch)
+    ->Arg(4096)
+    ->Arg(65536);
+
+} // namespace benchmarks
+} // namespace astro
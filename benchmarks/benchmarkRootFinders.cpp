@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/rootFinders.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+
+//! Solve Kepler's equation with given iteration scheme, starting from the mean anomaly.
+template <typename IterationScheme>
+void benchmarkFindRootOfKeplerEquation(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<std::array<Real, 6> > keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+    const AbsoluteStepStoppingCondition<Real> stoppingCondition(
+        Real(1.0e-3) * std::numeric_limits<Real>::epsilon());
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // The true anomaly sample is used as mean anomaly, as both are uniform in [0, 2pi).
+        const Real meanAnomaly = keplerianElements[i][trueAnomalyIndex];
+        Real eccentricAnomaly = meanAnomaly;
+        int numberOfIterations = 0;
+        findRoot<IterationScheme>(
+            EllipticalKeplerFunction<Real>(keplerianElements[i][eccentricityIndex], meanAnomaly),
+            stoppingCondition,
+            100,
+            eccentricAnomaly,
+            numberOfIterations);
+        benchmark::DoNotOptimize(eccentricAnomaly);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK_TEMPLATE(benchmarkFindRootOfKeplerEquation, NewtonRaphsonScheme)
+    ->Apply(applyOrbitRegimes);
+BENCHMARK_TEMPLATE(benchmarkFindRootOfKeplerEquation, HalleyScheme)->Apply(applyOrbitRegimes);
+BENCHMARK_TEMPLATE(benchmarkFindRootOfKeplerEquation, LaguerreScheme<>)->Apply(applyOrbitRegimes);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+//! Earth gravitational parameter [m^3 s^-2].
+const double earthGravitationalParameter = 3.986004415e14;
+
+//! Earth equatorial radius [m].
+const double earthEquatorialRadius = 6378.1363e3;
+
+//! Orbit regimes used to generate realistic benchmark inputs.
+enum OrbitRegime
+{
+    lowEarthOrbitRegime,
+    geostationaryOrbitRegime,
+    highlyEllipticalOrbitRegime,
+    fullEccentricityRangeRegime,
+    numberOfOrbitRegimes
+};
+
+//! Get name of orbit regime, used to label benchmark results.
+inline const char* getOrbitRegimeName(const OrbitRegime regime)
+{
+    switch (regime)
+    {
+        case lowEarthOrbitRegime:           return "LEO";
+        case geostationaryOrbitRegime:      return "GEO";
+        case highlyEllipticalOrbitRegime:   return "HEO";
+        default:                            return "e=[0,0.99]";
+    }
+}
+
+//! Generate sample of Keplerian elements for given orbit regime.
+/*!
+ * Generates a sample of Keplerian elements (around the Earth), drawn from uniform distributions
+ * that are representative for the given orbit regime:
+ *
+ *  - LEO: perigee altitude 300-2000 km, eccentricity 0-0.01, all inclinations
+ *  - GEO: semi-major axis 42164 +/- 50 km, eccentricity 0-0.001, inclination 0-0.1 rad
+ *  - HEO: perigee altitude 200-1000 km, apogee altitude 20000-45000 km (GTO, Molniya),
+ *         inclination 0-1.2 rad
+ *  - Full eccentricity range: eccentricity 0-0.99, perigee altitude 200-2000 km, all
+ *         inclinations
+ *
+ * The argument of periapsis, longitude of ascending node and true anomaly are uniformly
+ * distributed over [0, 2pi). The sample is generated with a fixed seed, such that benchmark
+ * inputs are reproducible.
+ *
+ * @tparam     Real              Real type
+ * @param[in]  regime            Orbit regime
+ * @param[in]  numberOfSamples   Number of samples
+ * @return                       Keplerian elements, ordered using KeplerianElementIndices
+ *                                                                              [m, -, rad]
+ */
+template <typename Real>
+std::vector<std::array<Real, 6> > generateKeplerianElements(const OrbitRegime regime,
+                                                           const std::size_t numberOfSamples)
+{
+    const Real pi = 3.14159265358979323846;
+    const Real radius = earthEquatorialRadius;
+
+    std::mt19937 generator(12345u + static_cast<unsigned int>(regime));
+    std::uniform_real_distribution<Real> unit(0.0, 1.0);
+
+    std::vector<std::array<Real, 6> > samples(numberOfSamples);
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        Real semiMajorAxis = 0.0;
+        Real eccentricity = 0.0;
+        Real inclination = pi * unit(generator);
+
+        switch (regime)
+        {
+            case lowEarthOrbitRegime:
+            {
+                eccentricity = 0.01 * unit(generator);
+                const Real perigeeRadius = radius + 300.0e3 + 1700.0e3 * unit(generator);
+                semiMajorAxis = perigeeRadius / (1.0 - eccentricity);
+                break;
+            }
+
+            case geostationaryOrbitRegime:
+            {
+                eccentricity = 0.001 * unit(generator);
+                semiMajorAxis = 42164.0e3 + 100.0e3 * (unit(generator) - 0.5);
+                inclination = 0.1 * unit(generator);
+                break;
+            }
+
+            case highlyEllipticalOrbitRegime:
+            {
+                const Real perigeeRadius = radius + 200.0e3 + 800.0e3 * unit(generator);
+                const Real apogeeRadius = radius + 20000.0e3 + 25000.0e3 * unit(generator);
+                semiMajorAxis = 0.5 * (perigeeRadius + apogeeRadius);
+                eccentricity = (apogeeRadius - perigeeRadius) / (apogeeRadius + perigeeRadius);
+                inclination = 1.2 * unit(generator);
+                break;
+            }
+
+            default:
+            {
+                eccentricity = 0.99 * unit(generator);
+                const Real perigeeRadius = radius + 200.0e3 + 1800.0e3 * unit(generator);
+                semiMajorAxis = perigeeRadius / (1.0 - eccentricity);
+                break;
+            }
+        }
+
+        samples[i][semiMajorAxisIndex] = semiMajorAxis;
+        samples[i][eccentricityIndex] = eccentricity;
+        samples[i][inclinationIndex] = inclination;
+        samples[i][argumentOfPeriapsisIndex] = 2.0 * pi * unit(generator);
+        samples[i][longitudeOfAscendingNodeIndex] = 2.0 * pi * unit(generator);
+        samples[i][trueAnomalyIndex] = 2.0 * pi * unit(generator);
+    }
+
+    return samples;
+}
+
+//! Generate sample of Cartesian elements for given orbit regime.
+/*!
+ * @sa generateKeplerianElements
+ * @tparam     Real              Real type
+ * @param[in]  regime            Orbit regime
+ * @param[in]  numberOfSamples   Number of samples
+ * @return                       Cartesian elements, ordered using CartesianElementIndices
+ *                                                                              [m, m/s]
+ */
+template <typename Real>
+std::vector<std::array<Real, 6> > generateCartesianElements(const OrbitRegime regime,
+                                                           const std::size_t numberOfSamples)
+{
+    std::vector<std::array<Real, 6> > samples
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        samples[i] = convertKeplerianToCartesianElements(
+            samples[i], static_cast<Real>(earthGravitationalParameter));
+    }
+    return samples;
+}
+
+//! Add orbit regimes as (last) argument of benchmark.
+inline void applyOrbitRegimes(benchmark::internal::Benchmark* family)
+{
+    for (int regime = 0; regime < numberOfOrbitRegimes; ++regime)
+    {
+        family->Arg(regime);
+    }
+}
+
+//! Add batch sizes and orbit regimes as arguments of benchmark.
+inline void applyBatchSizesAndOrbitRegimes(benchmark::internal::Benchmark* family)
+{
+    const int batchSizes[2] = {1024, 65536};
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int regime = 0; regime < numberOfOrbitRegimes; ++regime)
+        {
+            family->Args({batchSizes[i], regime});
+        }
+    }
+}
+
+} // namespace benchmarks
+} // namespace astro
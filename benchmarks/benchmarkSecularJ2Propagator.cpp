@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/secularJ2Propagator.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+// Set Earth J2-coefficient [-].
+const Real earthJ2 = 1.082626925638815e-3;
+
+// Set time step of sweep [s] (one day) and number of steps (about 10 years).
+const Real secularJ2SweepTimeStep = 86400.0;
+const std::size_t numberOfSecularJ2SweepSteps = 3653;
+
+//! Propagate constellation with secular J2 propagators, over daily epochs of 10 years.
+void benchmarkSecularJ2PropagatorSweep(benchmark::State& state)
+{
+    const std::size_t numberOfOrbits = 64;
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+
+    const std::vector<std::array<Real, 6> > samples
+        = generateKeplerianElements<Real>(regime, numberOfOrbits);
+    std::vector<SecularJ2Propagator<Real, Vector> > propagators;
+    for (std::size_t i = 0; i < numberOfOrbits; ++i)
+    {
+        propagators.push_back(SecularJ2Propagator<Real, Vector>(
+            Vector(samples[i].begin(), samples[i].end()),
+            earthGravitationalParameter,
+            earthEquatorialRadius,
+            earthJ2));
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t j = 0; j < numberOfSecularJ2SweepSteps; ++j)
+        {
+            const Real timeOfFlight = secularJ2SweepTimeStep * static_cast<Real>(j);
+            for (std::size_t i = 0; i < numberOfOrbits; ++i)
+            {
+                Vector elements = propagators[i].propagate(timeOfFlight);
+                benchmark::DoNotOptimize(elements);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfOrbits * numberOfSecularJ2SweepSteps);
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkSecularJ2PropagatorSweep)->Apply(applyOrbitRegimes);
+
+//! Propagate constellation with secular J2 propagators to multiple epochs, over 10 years.
+void benchmarkSecularJ2PropagatorEpochsSweep(benchmark::State& state)
+{
+    const std::size_t numberOfOrbits = 64;
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+
+    const std::vector<std::array<Real, 6> > samples
+        = generateKeplerianElements<Real>(regime, numberOfOrbits);
+    std::vector<SecularJ2Propagator<Real, Vector> > propagators;
+    for (std::size_t i = 0; i < numberOfOrbits; ++i)
+    {
+        propagators.push_back(SecularJ2Propagator<Real, Vector>(
+            Vector(samples[i].begin(), samples[i].end()),
+            earthGravitationalParameter,
+            earthEquatorialRadius,
+            earthJ2));
+    }
+
+    Vector timesOfFlight(numberOfSecularJ2SweepSteps);
+    for (std::size_t j = 0; j < numberOfSecularJ2SweepSteps; ++j)
+    {
+        timesOfFlight[j] = secularJ2SweepTimeStep * static_cast<Real>(j);
+    }
+
+    std::vector<Vector> elementColumns(6, Vector(numberOfSecularJ2SweepSteps));
+    Real* elements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        elements[k] = elementColumns[k].data();
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < numberOfOrbits; ++i)
+        {
+            propagators[i].propagate(timesOfFlight.data(), elements, numberOfSecularJ2SweepSteps);
+            benchmark::DoNotOptimize(elements[0][0]);
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfOrbits * numberOfSecularJ2SweepSteps);
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkSecularJ2PropagatorEpochsSweep)->Apply(applyOrbitRegimes);
+
+//! Propagate catalog of orbits to a single epoch with batch secular J2 propagation.
+void benchmarkPropagateSecularJ2Batch(benchmark::State& state)
+{
+    const std::size_t numberOfOrbits = static_cast<std::size_t>(state.range(0));
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(1));
+
+    const std::vector<std::array<Real, 6> > samples
+        = generateKeplerianElements<Real>(regime, numberOfOrbits);
+    std::vector<Vector> initialColumns(6, Vector(numberOfOrbits));
+    std::vector<Vector> propagatedColumns(6, Vector(numberOfOrbits));
+    const Real* initialElements[6];
+    Real* propagatedElements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        for (std::size_t i = 0; i < numberOfOrbits; ++i)
+        {
+            initialColumns[k][i] = samples[i][k];
+        }
+        initialElements[k] = initialColumns[k].data();
+        propagatedElements[k] = propagatedColumns[k].data();
+    }
+
+    for (auto _ : state)
+    {
+        propagateSecularJ2(initialElements,
+                           numberOfOrbits,
+                           secularJ2SweepTimeStep * static_cast<Real>(numberOfSecularJ2SweepSteps),
+                           earthGravitationalParameter,
+                           earthEquatorialRadius,
+                           earthJ2,
+                           propagatedElements);
+        benchmark::DoNotOptimize(propagatedElements[0][0]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkPropagateSecularJ2Batch)->Apply(applyBatchSizesAndOrbitRegimes);
+
+} // namespace benchmarks
+} // namespace astro
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/sphericalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+typedef std::vector<Real> Vector;
+typedef SphericalHarmonicsGravityField<Real> GravityField;
+
+// Set Earth gravitational parameter [m^3 s^-2] and equatorial radius [m].
+const Real earthGravitationalParameter = 3.986004415e14;
+const Real earthEquatorialRadius = 6378.1363e3;
+
+//! Make gravity field with pseudo-random coefficients, decaying with degree (Kaula's rule).
+GravityField makeGravityField(const std::size_t maximumDegree)
+{
+    const std::size_t numberOfCoefficients
+        = GravityField::getTriangularIndex(maximumDegree + 1, 0);
+    Vector cosineCoefficients(numberOfCoefficients, 0.0);
+    Vector sineCoefficients(numberOfCoefficients, 0.0);
+    cosineCoefficients[0] = 1.0;
+    for (std::size_t n = 2; n <= maximumDegree; ++n)
+    {
+        for (std::size_t m = 0; m <= n; ++m)
+        {
+            const std::size_t index = GravityField::getTriangularIndex(n, m);
+            cosineCoefficients[index] = 1.0e-5 * std::sin(1.0 + 3.0 * index) / (n * n);
+            sineCoefficients[index] = m == 0 ? 0.0 : 1.0e-5 * std::cos(2.0 + 5.0 * index) / (n * n);
+        }
+    }
+
+    return GravityField(earthGravitationalParameter, earthEquatorialRadius, maximumDegree,
+                        cosineCoefficients.data(), sineCoefficients.data());
+}
+
+void benchmarkSphericalHarmonicsAcceleration(benchmark::State& state)
+{
+    const std::size_t degree = static_cast<std::size_t>(state.range(0));
+
+    const GravityField gravityField = makeGravityField(70);
+    SphericalHarmonicsAccelerationModel<Real> model(gravityField);
+
+    Vector3 position = {{3.75e6, 4.24e6, -1.39e6}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        Vector3 acceleration = model.computeAcceleration(position, degree, degree);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK(benchmarkSphericalHarmonicsAcceleration)->Arg(8)->Arg(20)->Arg(70);
+
+} // namespace benchmarks
+} // namespace astro
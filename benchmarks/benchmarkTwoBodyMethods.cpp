@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/stateVectorIndices.hpp"
+#include "astro/twoBodyMethods.hpp"
+
+#include "benchmarkSamples.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 6> Array6;
+
+void benchmarkComputeKeplerMeanMotion(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real meanMotion = computeKeplerMeanMotion(
+            keplerianElements[i][semiMajorAxisIndex], earthGravitationalParameter);
+        benchmark::DoNotOptimize(meanMotion);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkComputeKeplerMeanMotion)->Apply(applyOrbitRegimes);
+
+void benchmarkComputeKeplerOrbitalPeriod(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real orbitalPeriod = computeKeplerOrbitalPeriod(
+            keplerianElements[i][semiMajorAxisIndex], earthGravitationalParameter);
+        benchmark::DoNotOptimize(orbitalPeriod);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkComputeKeplerOrbitalPeriod)->Apply(applyOrbitRegimes);
+
+void benchmarkComputeCircularVelocity(benchmark::State& state)
+{
+    const OrbitRegime regime = static_cast<OrbitRegime>(state.range(0));
+    const std::size_t numberOfSamples = 1024;
+    const std::vector<Array6> keplerianElements
+        = generateKeplerianElements<Real>(regime, numberOfSamples);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        Real circularVelocity = computeCircularVelocity(
+            keplerianElements[i][semiMajorAxisIndex], earthGravitationalParameter);
+        benchmark::DoNotOptimize(circularVelocity);
+        i = (i + 1) % numberOfSamples;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getOrbitRegimeName(regime));
+}
+BENCHMARK(benchmarkComputeCircularVelocity)->Apply(applyOrbitRegimes);
+
+} // namespace benchmarks
+} // namespace astro
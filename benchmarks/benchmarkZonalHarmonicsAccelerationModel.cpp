@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace benchmarks
+{
+
+typedef double Real;
+typedef std::array<Real, 3> Vector3;
+
+// Set Earth gravitational parameter [m^3 s^-2] and equatorial radius [m].
+const Real earthGravitationalParameter = 3.986004415e14;
+const Real earthEquatorialRadius = 6378.1363e3;
+
+// Set unnormalized zonal coefficients J2-J6 (EGM-96) [-].
+const std::array<Real, 5> earthZonalCoefficients
+    = {{1.0826266835531513e-3,
+        -2.5326564853322355e-6,
+        -1.6196215913670001e-6,
+        -2.2729608286349703e-7,
+        5.4068117008370002e-7}};
+
+template <std::size_t Degree>
+void benchmarkZonalHarmonicsAcceleration(benchmark::State& state)
+{
+    Vector3 position = {{3.75e6, 4.24e6, -1.39e6}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(position);
+        Vector3 acceleration = computeZonalHarmonicsAcceleration<Degree>(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthZonalCoefficients);
+        benchmark::DoNotOptimize(acceleration);
+    }
+}
+BENCHMARK_TEMPLATE(benchmarkZonalHarmonicsAcceleration, 2);
+BENCHMARK_TEMPLATE(benchmarkZonalHarmonicsAcceleration, 4);
+BENCHMARK_TEMPLATE(benchmarkZonalHarmonicsAcceleration, 6);
+
+} // namespace benchmarks
+} // namespace astro
@@ -7,9 +7,29 @@
 #pragma once
 
 #include "astro/constants.hpp"
+#include "astro/cartesianDynamics.hpp"
+#include "astro/catalogFile.hpp"
 #include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/chebyshevEphemeris.hpp"
+#include "astro/conjunctionScreening.hpp"
+#include "astro/constexprMath.hpp"
+#include "astro/hostDevice.hpp"
+#include "astro/instrumentation.hpp"
+#include "astro/integrators.hpp"
 #include "astro/j2AccelerationModel.hpp"
+#include "astro/keplerianOrbit.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/lambertSolver.hpp"
+#include "astro/modifiedEquinoctialElementConversions.hpp"
+#include "astro/monteCarloEnsemble.hpp"
 #include "astro/orbitalElementConversions.hpp"
+#include "astro/parallelCatalog.hpp"
 #include "astro/radiationPressureAccelerationModel.hpp"
+#include "astro/rootFinders.hpp"
+#include "astro/secularJ2Propagator.hpp"
+#include "astro/shadowModel.hpp"
+#include "astro/sphericalHarmonicsAccelerationModel.hpp"
 #include "astro/twoBodyMethods.hpp"
+#include "astro/vectorTraits.hpp"
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
 #include "astro/stateVectorIndices.hpp"
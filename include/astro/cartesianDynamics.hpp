@@ -0,0 +1,723 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "astro/constants.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+
+//! Cartesian state quantities.
+/*!
+ * Quantities derived from the Cartesian state of a body that are shared between acceleration
+ * models. The quantities are computed once per evaluation of CartesianDynamics and passed to each
+ * acceleration model, so that the position norm and its (inverse) powers are not recomputed by
+ * every model.
+ *
+ * Acceleration models have the following member function, which adds the acceleration of the
+ * model to the given acceleration vector:
+ *
+ * \code
+ *      void addAcceleration(const Real time,
+ *                           const CartesianStateQuantities<Real>& quantities,
+ *                           Real acceleration[3]) const
+ * \endcode
+ *
+ * Acceleration models that depend on position only can also provide the following member
+ * function, which adds the acceleration and its gradient with respect to position to the given
+ * acceleration vector and gradient matrix, for use with CartesianVariationalDynamics:
+ *
+ * \code
+ *      void addAccelerationAndGradient(const Real time,
+ *                                      const CartesianStateQuantities<Real>& quantities,
+ *                                      Real acceleration[3],
+ *                                      Real gradient[3][3]) const
+ * \endcode
+ *
+ * @sa CartesianDynamics, CartesianVariationalDynamics
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct CartesianStateQuantities
+{
+    //! Compute Cartesian state quantities.
+    /*!
+     * @param[in] position  Position vector  [m]
+     * @param[in] velocity  Velocity vector  [m s^-1]
+     */
+    CartesianStateQuantities(const Real position[3], const Real velocity[3])
+        : position(position),
+          velocity(velocity),
+          positionNormSquared(position[0] * position[0]
+                              + position[1] * position[1]
+                              + position[2] * position[2]),
+          positionNorm(std::sqrt(positionNormSquared)),
+          inversePositionNorm(Real(1.0) / positionNorm),
+          inversePositionNormSquared(inversePositionNorm * inversePositionNorm),
+          inversePositionNormCubed(inversePositionNormSquared * inversePositionNorm)
+    { }
+
+    //! Position vector [m].
+    const Real* position;
+
+    //! Velocity vector [m s^-1].
+    const Real* velocity;
+
+    //! Squared norm of position vector, |r|^2 [m^2].
+    const Real positionNormSquared;
+
+    //! Norm of position vector, |r| [m].
+    const Real positionNorm;
+
+    //! Inverse of norm of position vector, 1/|r| [m^-1].
+    const Real inversePositionNorm;
+
+    //! Inverse of squared norm of position vector, 1/|r|^2 [m^-2].
+    const Real inversePositionNormSquared;
+
+    //! Inverse of cubed norm of position vector, 1/|r|^3 [m^-3].
+    const Real inversePositionNormCubed;
+};
+
+//! Central body acceleration model.
+/*!
+ * Acceleration model for use with CartesianDynamics that computes the same acceleration as
+ * computeCentralBodyAcceleration, using the shared Cartesian state quantities.
+ *
+ * @sa computeCentralBodyAcceleration, CartesianDynamics
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class CentralBodyAccelerationModel
+{
+public:
+
+    //! Construct central body acceleration model.
+    /*!
+     * @param[in] gravitationalParameter  Gravitational parameter of central body  [m^3 s^-2]
+     */
+    explicit CentralBodyAccelerationModel(const Real gravitationalParameter)
+        : gravitationalParameter(gravitationalParameter)
+    { }
+
+    //! Add acceleration.
+    /*!
+     * @param[in]     time          Time                           [s]
+     * @param[in]     quantities    Cartesian state quantities     [-]
+     * @param[in,out] acceleration  Acceleration vector            [m s^-2]
+     */
+    void addAcceleration(const Real time,
+                         const CartesianStateQuantities<Real>& quantities,
+                         Real acceleration[3]) const
+    {
+        static_cast<void>(time);
+
+        const Real preMultiplier = -gravitationalParameter * quantities.inversePositionNormCubed;
+
+        acceleration[0] += preMultiplier * quantities.position[0];
+        acceleration[1] += preMultiplier * quantities.position[1];
+        acceleration[2] += preMultiplier * quantities.position[2];
+    }
+
+    //! Add acceleration and gradient of acceleration with respect to position.
+    /*!
+     * @sa computeCentralBodyAccelerationGradient
+     * @param[in]     time          Time                                           [s]
+     * @param[in]     quantities    Cartesian state quantities                     [-]
+     * @param[in,out] acceleration  Acceleration vector                            [m s^-2]
+     * @param[in,out] gradient      Gradient of acceleration wrt position          [s^-2]
+     */
+    void addAccelerationAndGradient(const Real time,
+                                    const CartesianStateQuantities<Real>& quantities,
+                                    Real acceleration[3],
+                                    Real gradient[3][3]) const
+    {
+        static_cast<void>(time);
+
+        const Real* const position = quantities.position;
+        const Real preMultiplier = -gravitationalParameter * quantities.inversePositionNormCubed;
+        const Real gradientPreMultiplier
+            = Real(-3.0) * preMultiplier * quantities.inversePositionNormSquared;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            acceleration[i] += preMultiplier * position[i];
+            for (int j = 0; j < 3; ++j)
+            {
+                gradient[i][j] += gradientPreMultiplier * position[i] * position[j];
+            }
+            gradient[i][i] += preMultiplier;
+        }
+    }
+
+private:
+
+    //! Gravitational parameter of central body [m^3 s^-2].
+    const Real gravitationalParameter;
+};
+
+//! J2 acceleration model.
+/*!
+ * Acceleration model for use with CartesianDynamics that computes the same acceleration as
+ * computeJ2Acceleration, using the shared Cartesian state quantities.
+ *
+ * @sa computeJ2Acceleration, CartesianDynamics
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class J2AccelerationModel
+{
+public:
+
+    //! Construct J2 acceleration model.
+    /*!
+     * @param[in] gravitationalParameter  Gravitational parameter of central body  [m^3 s^-2]
+     * @param[in] equatorialRadius        Equatorial radius of central body        [m]
+     * @param[in] j2Coefficient           Unnormalized J2-coefficient              [-]
+     */
+    J2AccelerationModel(const Real gravitationalParameter,
+                        const Real equatorialRadius,
+                        const Real j2Coefficient)
+        : coefficient(-Real(1.5) * gravitationalParameter
+                      * j2Coefficient * equatorialRadius * equatorialRadius)
+    { }
+
+    //! Add acceleration.
+    /*!
+     * @param[in]     time          Time                           [s]
+     * @param[in]     quantities    Cartesian state quantities     [-]
+     * @param[in,out] acceleration  Acceleration vector            [m s^-2]
+     */
+    void addAcceleration(const Real time,
+                         const CartesianStateQuantities<Real>& quantities,
+                         Real acceleration[3]) const
+    {
+        static_cast<void>(time);
+
+        const Real* const position = quantities.position;
+        const Real fiveScaledZSquared
+            = Real(5.0) * position[2] * position[2] * quantities.inversePositionNormSquared;
+        // The pre-multiplier is formed from powers of the inverse position norm rather than from
+        // |r|^5, since |r|^5 overflows single precision beyond |r| ~ 5e7 m (and its inverse then
+        // flushes to zero).
+        const Real preMultiplier = coefficient * quantities.inversePositionNormCubed
+                                   * quantities.inversePositionNormSquared;
+
+        acceleration[0] += preMultiplier * position[0] * (Real(1.0) - fiveScaledZSquared);
+        acceleration[1] += preMultiplier * position[1] * (Real(1.0) - fiveScaledZSquared);
+        acceleration[2] += preMultiplier * position[2] * (Real(3.0) - fiveScaledZSquared);
+    }
+
+    //! Add acceleration and gradient of acceleration with respect to position.
+    /*!
+     * @sa computeJ2AccelerationGradient
+     * @param[in]     time          Time                                           [s]
+     * @param[in]     quantities    Cartesian state quantities                     [-]
+     * @param[in,out] acceleration  Acceleration vector                            [m s^-2]
+     * @param[in,out] gradient      Gradient of acceleration wrt position          [s^-2]
+     */
+    void addAccelerationAndGradient(const Real time,
+                                    const CartesianStateQuantities<Real>& quantities,
+                                    Real acceleration[3],
+                                    Real gradient[3][3]) const
+    {
+        static_cast<void>(time);
+
+        const Real* const position = quantities.position;
+        const Real inverseNormSquared = quantities.inversePositionNormSquared;
+        const Real fiveScaledZSquared
+            = Real(5.0) * position[2] * position[2] * inverseNormSquared;
+        const Real preMultiplier
+            = coefficient * quantities.inversePositionNormCubed * inverseNormSquared;
+
+        const Real g[3] = {Real(1.0) - fiveScaledZSquared,
+                           Real(1.0) - fiveScaledZSquared,
+                           Real(3.0) - fiveScaledZSquared};
+
+        for (int i = 0; i < 3; ++i)
+        {
+            acceleration[i] += preMultiplier * position[i] * g[i];
+
+            const Real scaledPosition = preMultiplier * position[i] * inverseNormSquared;
+            const Real factor
+                = scaledPosition * (Real(2.0) * fiveScaledZSquared - Real(5.0) * g[i]);
+            for (int j = 0; j < 3; ++j)
+            {
+                gradient[i][j] += factor * position[j];
+            }
+            gradient[i][i] += preMultiplier * g[i];
+            gradient[i][2] -= Real(10.0) * scaledPosition * position[2];
+        }
+    }
+
+private:
+
+    //! Constant coefficient of J2 acceleration, -3/2 mu J2 R^2 [m^5 s^-2].
+    const Real coefficient;
+};
+
+//! Cannonball radiation pressure acceleration model.
+/*!
+ * Acceleration model for use with CartesianDynamics that computes the same acceleration as
+ * computeCannonballRadiationPressureAcceleration, using the shared Cartesian state quantities.
+ * The radiation source (e.g., the Sun) is located at the origin of the reference frame. The
+ * radiation pressure is scaled with the inverse-square of the distance to the source, as in
+ * computeRadiationPressure.
+ *
+ * @sa computeCannonballRadiationPressureAcceleration, computeRadiationPressure, CartesianDynamics
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class CannonballRadiationPressureAccelerationModel
+{
+public:
+
+    //! Construct cannonball radiation pressure acceleration model.
+    /*!
+     * @param[in] referenceRadiationPressure    Radiation pressure at reference distance  [N m^-2]
+     * @param[in] referenceDistance             Reference distance to source              [m]
+     * @param[in] radiationPressureCoefficient  Radiation pressure coefficient            [-]
+     * @param[in] radius                        Radius of cannonball                      [m]
+     * @param[in] bulkDensity                   Bulk density of cannonball                [kg m^-3]
+     */
+    CannonballRadiationPressureAccelerationModel(const Real referenceRadiationPressure,
+                                                 const Real referenceDistance,
+                                                 const Real radiationPressureCoefficient,
+                                                 const Real radius,
+                                                 const Real bulkDensity)
+        : coefficient(referenceRadiationPressure * referenceDistance * referenceDistance
+                      * radiationPressureCoefficient * Real(0.75) / (radius * bulkDensity))
+    { }
+
+    //! Add acceleration.
+    /*!
+     * @param[in]     time          Time                                           [s]
+     * @param[in]     quantities    Cartesian state quantities, with respect to
+     *                              radiation source                               [-]
+     * @param[in,out] acceleration  Acceleration vector                            [m s^-2]
+     */
+    void addAcceleration(const Real time,
+                         const CartesianStateQuantities<Real>& quantities,
+                         Real acceleration[3]) const
+    {
+        static_cast<void>(time);
+
+        // The unit vector to the source is -r/|r| and the radiation pressure scales with 1/|r|^2.
+        const Real preMultiplier = coefficient * quantities.inversePositionNormCubed;
+
+        acceleration[0] += preMultiplier * quantities.position[0];
+        acceleration[1] += preMultiplier * quantities.position[1];
+        acceleration[2] += preMultiplier * quantities.position[2];
+    }
+
+    //! Add acceleration and gradient of acceleration with respect to position.
+    /*!
+     * @sa computeCannonballRadiationPressureAccelerationGradient
+     * @param[in]     time          Time                                           [s]
+     * @param[in]     quantities    Cartesian state quantities, with respect to
+     *                              radiation source                               [-]
+     * @param[in,out] acceleration  Acceleration vector                            [m s^-2]
+     * @param[in,out] gradient      Gradient of acceleration wrt position          [s^-2]
+     */
+    void addAccelerationAndGradient(const Real time,
+                                    const CartesianStateQuantities<Real>& quantities,
+                                    Real acceleration[3],
+                                    Real gradient[3][3]) const
+    {
+        static_cast<void>(time);
+
+        const Real* const position = quantities.position;
+        const Real preMultiplier = coefficient * quantities.inversePositionNormCubed;
+        const Real gradientPreMultiplier
+            = Real(-3.0) * preMultiplier * quantities.inversePositionNormSquared;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            acceleration[i] += preMultiplier * position[i];
+            for (int j = 0; j < 3; ++j)
+            {
+                gradient[i][j] += gradientPreMultiplier * position[i] * position[j];
+            }
+            gradient[i][i] += preMultiplier;
+        }
+    }
+
+private:
+
+    //! Constant coefficient of radiation pressure acceleration, 3 P_ref d_ref^2 C_R / (4 r rho)
+    //! [m^3 s^-2].
+    const Real coefficient;
+};
+
+//! Cannonball Poynting-Robertson drag acceleration model.
+/*!
+ * Acceleration model for use with CartesianDynamics that computes the same acceleration as
+ * computeCannonballPoyntingRobertsonDragAcceleration, using the shared Cartesian state
+ * quantities. The radiation source (e.g., the Sun) is located at the origin of the reference
+ * frame. The radiation pressure is scaled with the inverse-square of the distance to the source,
+ * as in computeRadiationPressure.
+ *
+ * @sa computeCannonballPoyntingRobertsonDragAcceleration, computeRadiationPressure,
+ *     CartesianDynamics
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class CannonballPoyntingRobertsonDragAccelerationModel
+{
+public:
+
+    //! Construct cannonball Poynting-Robertson drag acceleration model.
+    /*!
+     * @param[in] referenceRadiationPressure    Radiation pressure at reference distance  [N m^-2]
+     * @param[in] referenceDistance             Reference distance to source              [m]
+     * @param[in] radiationPressureCoefficient  Radiation pressure coefficient            [-]
+     * @param[in] radius                        Radius of cannonball                      [m]
+     * @param[in] bulkDensity                   Bulk density of cannonball                [kg m^-3]
+     */
+    CannonballPoyntingRobertsonDragAccelerationModel(const Real referenceRadiationPressure,
+                                                     const Real referenceDistance,
+                                                     const Real radiationPressureCoefficient,
+                                                     const Real radius,
+                                                     const Real bulkDensity)
+        : coefficient(referenceRadiationPressure * referenceDistance * referenceDistance
+                      * radiationPressureCoefficient * Real(0.75)
+                      / (radius * bulkDensity * PhysicalConstants<Real>::speedOfLight))
+    { }
+
+    //! Add acceleration.
+    /*!
+     * @param[in]     time          Time                                           [s]
+     * @param[in]     quantities    Cartesian state quantities, with respect to
+     *                              radiation source                               [-]
+     * @param[in,out] acceleration  Acceleration vector                            [m s^-2]
+     */
+    void addAcceleration(const Real time,
+                         const CartesianStateQuantities<Real>& quantities,
+                         Real acceleration[3]) const
+    {
+        static_cast<void>(time);
+
+        const Real* const position = quantities.position;
+        const Real* const velocity = quantities.velocity;
+        const Real inverseNormSquared = quantities.inversePositionNormSquared;
+        const Real preMultiplier = coefficient * inverseNormSquared;
+
+        acceleration[0] += preMultiplier
+                           * (position[0] * position[0] * inverseNormSquared + Real(1.0))
+                           * velocity[0];
+        acceleration[1] += preMultiplier
+                           * (position[1] * position[1] * inverseNormSquared + Real(1.0))
+                           * velocity[1];
+        acceleration[2] += preMultiplier
+                           * (position[2] * position[2] * inverseNormSquared + Real(1.0))
+                           * velocity[2];
+    }
+
+private:
+
+    //! Constant coefficient of Poynting-Robertson drag acceleration,
+    //! 3 P_ref d_ref^2 C_R / (4 r rho c) [m^2 s^-1].
+    const Real coefficient;
+};
+
+//! Cartesian dynamics.
+/*!
+ * Dynamics functor for the Cartesian state (position and velocity) of a body, subject to the sum
+ * of a set of acceleration models, for use with the integrators in integrators.hpp:
+ *
+ * \f[
+ *      \frac{d}{dt} \begin{pmatrix} \vec{r} \\ \vec{V} \end{pmatrix}
+ *      = \begin{pmatrix} \vec{V} \\ \sum_{k} \vec{a}_{k}(t, \vec{r}, \vec{V}) \end{pmatrix}
+ * \f]
+ *
+ * The acceleration models are stored by value and summed using compile-time recursion, i.e.,
+ * without virtual dispatch or memory allocation. The Cartesian state quantities that are shared
+ * between the models (e.g., the position norm and its inverse powers) are computed once per
+ * evaluation and passed to each model, which adds its contribution to the total acceleration.
+ *
+ * @sa makeCartesianDynamics, RungeKutta4Integrator, EmbeddedRungeKuttaIntegrator
+ * @tparam Real    Real type
+ * @tparam Models  Acceleration model types
+ */
+template <typename Real, typename... Models>
+class CartesianDynamics
+{
+public:
+
+    //! Dimension of state vector.
+    static const std::size_t dimension = 6;
+
+    //! Construct Cartesian dynamics.
+    /*!
+     * @param[in] models  Acceleration models
+     */
+    explicit CartesianDynamics(const Models&... models)
+        : models(models...)
+    { }
+
+    //! Compute state derivative.
+    /*!
+     * @param[in]  time             Time                                           [s]
+     * @param[in]  state            Cartesian state, indexed by
+     *                              CartesianElementIndices                        [m, m s^-1]
+     * @param[out] stateDerivative  Cartesian state derivative                     [m s^-1, m s^-2]
+     */
+    void operator()(const Real time, const Real* state, Real* stateDerivative) const
+    {
+        const CartesianStateQuantities<Real> quantities(state + xPositionIndex,
+                                                        state + xVelocityIndex);
+
+        Real acceleration[3] = {0.0, 0.0, 0.0};
+        addAccelerations<0>(time, quantities, acceleration);
+
+        stateDerivative[xPositionIndex] = state[xVelocityIndex];
+        stateDerivative[yPositionIndex] = state[yVelocityIndex];
+        stateDerivative[zPositionIndex] = state[zVelocityIndex];
+        stateDerivative[xVelocityIndex] = acceleration[0];
+        stateDerivative[yVelocityIndex] = acceleration[1];
+        stateDerivative[zVelocityIndex] = acceleration[2];
+    }
+
+    //! Compute total acceleration.
+    /*!
+     * @param[in]  time          Time                   [s]
+     * @param[in]  position      Position vector        [m]
+     * @param[in]  velocity      Velocity vector        [m s^-1]
+     * @param[out] acceleration  Acceleration vector    [m s^-2]
+     */
+    void operator()(const Real time,
+                    const Real position[3],
+                    const Real velocity[3],
+                    Real acceleration[3]) const
+    {
+        const CartesianStateQuantities<Real> quantities(position, velocity);
+
+        acceleration[0] = 0.0;
+        acceleration[1] = 0.0;
+        acceleration[2] = 0.0;
+        addAccelerations<0>(time, quantities, acceleration);
+    }
+
+private:
+
+    //! Add acceleration of model at given index and subsequent models.
+    template <std::size_t Index>
+    typename std::enable_if<(Index < sizeof...(Models))>::type
+    addAccelerations(const Real time,
+                     const CartesianStateQuantities<Real>& quantities,
+                     Real acceleration[3]) const
+    {
+        std::get<Index>(models).addAcceleration(time, quantities, acceleration);
+        addAccelerations<Index + 1>(time, quantities, acceleration);
+    }
+
+    //! End recursion over acceleration models.
+    template <std::size_t Index>
+    typename std::enable_if<(Index == sizeof...(Models))>::type
+    addAccelerations(const Real, const CartesianStateQuantities<Real>&, Real[3]) const
+    { }
+
+    //! Acceleration models.
+    const std::tuple<Models...> models;
+};
+
+//! Make Cartesian dynamics.
+/*!
+ * Makes Cartesian dynamics functor for given set of acceleration models, deducing the model types.
+ *
+ * @sa CartesianDynamics
+ * @tparam    Real    Real type
+ * @tparam    Models  Acceleration model types
+ * @param[in] models  Acceleration models
+ * @return            Cartesian dynamics functor
+ */
+template <typename Real, typename... Models>
+CartesianDynamics<Real, Models...> makeCartesianDynamics(const Models&... models)
+{
+    return CartesianDynamics<Real, Models...>(models...);
+}
+
+
+//! Cartesian variational dynamics.
+/*!
+ * Dynamics functor for the Cartesian state (position and velocity) of a body together with its
+ * state transition matrix (STM),
+ * \f$\Phi(t, t_{0}) = \partial \vec{x}(t) / \partial \vec{x}(t_{0})\f$, for use with the
+ * integrators in integrators.hpp. The STM is propagated using the variational equations
+ * (Montenbruck, 2000):
+ *
+ * \f[
+ *      \dot{\Phi} = \begin{pmatrix} 0 & I \\ G & 0 \end{pmatrix} \Phi, \quad
+ *      G = \sum_{k} \frac{\partial \vec{a}_{k}}{\partial \vec{r}}
+ * \f]
+ *
+ * where \f$G\f$ is the gradient of the total acceleration with respect to position. The
+ * acceleration models provide addAccelerationAndGradient (see CartesianStateQuantities), which
+ * computes the acceleration and its analytical gradient in a single pass, sharing the Cartesian
+ * state quantities. An evaluation of the variational dynamics therefore costs about as much as an
+ * evaluation of the acceleration plus the 6x6 matrix product, instead of the six additional
+ * evaluations of the acceleration required to compute the gradient by finite differences. Only
+ * acceleration models that depend on position are supported, such that the gradient with respect
+ * to velocity is zero.
+ *
+ * The state is stored in an array of fixed size dimension = 42: the Cartesian state, indexed by
+ * CartesianElementIndices, followed by the STM, stored row-major, i.e., element (i, j) of the STM
+ * is stored at index stateTransitionMatrixIndex + 6 * i + j. The initial state is set using
+ * initializeCartesianVariationalState.
+ *
+ * @sa CartesianDynamics, initializeCartesianVariationalState, RungeKutta4Integrator,
+ *     EmbeddedRungeKuttaIntegrator
+ * @tparam Real    Real type
+ * @tparam Models  Acceleration model types
+ */
+template <typename Real, typename... Models>
+class CartesianVariationalDynamics
+{
+public:
+
+    //! Dimension of state vector (Cartesian state and 6x6 state transition matrix).
+    static const std::size_t dimension = 42;
+
+    //! Index of first element of state transition matrix in state vector.
+    static const std::size_t stateTransitionMatrixIndex = 6;
+
+    //! Construct Cartesian variational dynamics.
+    /*!
+     * @param[in] models  Acceleration models
+     */
+    explicit CartesianVariationalDynamics(const Models&... models)
+        : models(models...)
+    { }
+
+    //! Compute state derivative.
+    /*!
+     * @param[in]  time             Time                                           [s]
+     * @param[in]  state            Cartesian state and state transition matrix    [m, m s^-1, -]
+     * @param[out] stateDerivative  Derivative of Cartesian state and state
+     *                              transition matrix                              [m s^-1, m s^-2,
+     *                                                                              s^-1]
+     */
+    void operator()(const Real time, const Real* state, Real* stateDerivative) const
+    {
+        const CartesianStateQuantities<Real> quantities(state + xPositionIndex,
+                                                        state + xVelocityIndex);
+
+        Real acceleration[3] = {0.0, 0.0, 0.0};
+        Real gradient[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+        addAccelerationsAndGradients<0>(time, quantities, acceleration, gradient);
+
+        stateDerivative[xPositionIndex] = state[xVelocityIndex];
+        stateDerivative[yPositionIndex] = state[yVelocityIndex];
+        stateDerivative[zPositionIndex] = state[zVelocityIndex];
+        stateDerivative[xVelocityIndex] = acceleration[0];
+        stateDerivative[yVelocityIndex] = acceleration[1];
+        stateDerivative[zVelocityIndex] = acceleration[2];
+
+        // The upper rows of the STM derivative are the lower rows of the STM, and the lower rows
+        // are the product of the acceleration gradient and the upper rows of the STM.
+        const Real* const matrix = state + stateTransitionMatrixIndex;
+        Real* const matrixDerivative = stateDerivative + stateTransitionMatrixIndex;
+        for (std::size_t j = 0; j < 18; ++j)
+        {
+            matrixDerivative[j] = matrix[j + 18];
+        }
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            for (std::size_t j = 0; j < 6; ++j)
+            {
+                matrixDerivative[18 + 6 * i + j] = gradient[i][0] * matrix[j]
+                                                   + gradient[i][1] * matrix[6 + j]
+                                                   + gradient[i][2] * matrix[12 + j];
+            }
+        }
+    }
+
+private:
+
+    //! Add acceleration and gradient of model at given index and subsequent models.
+    template <std::size_t Index>
+    typename std::enable_if<(Index < sizeof...(Models))>::type
+    addAccelerationsAndGradients(const Real time,
+                                 const CartesianStateQuantities<Real>& quantities,
+                                 Real acceleration[3],
+                                 Real gradient[3][3]) const
+    {
+        std::get<Index>(models).addAccelerationAndGradient(
+            time, quantities, acceleration, gradient);
+        addAccelerationsAndGradients<Index + 1>(time, quantities, acceleration, gradient);
+    }
+
+    //! End recursion over acceleration models.
+    template <std::size_t Index>
+    typename std::enable_if<(Index == sizeof...(Models))>::type
+    addAccelerationsAndGradients(const Real,
+                                 const CartesianStateQuantities<Real>&,
+                                 Real[3],
+                                 Real[3][3]) const
+    { }
+
+    //! Acceleration models.
+    const std::tuple<Models...> models;
+};
+
+//! Make Cartesian variational dynamics.
+/*!
+ * Makes Cartesian variational dynamics functor for given set of acceleration models, deducing the
+ * model types.
+ *
+ * @sa CartesianVariationalDynamics
+ * @tparam    Real    Real type
+ * @tparam    Models  Acceleration model types
+ * @param[in] models  Acceleration models
+ * @return            Cartesian variational dynamics functor
+ */
+template <typename Real, typename... Models>
+CartesianVariationalDynamics<Real, Models...> makeCartesianVariationalDynamics(
+    const Models&... models)
+{
+    return CartesianVariationalDynamics<Real, Models...>(models...);
+}
+
+//! Initialize Cartesian variational state.
+/*!
+ * Initializes the state vector of CartesianVariationalDynamics with the given Cartesian state and
+ * the identity matrix as state transition matrix, i.e., \f$\Phi(t_{0}, t_{0}) = I\f$.
+ *
+ * @sa CartesianVariationalDynamics
+ * @tparam     Real              Real type
+ * @param[in]  cartesianState    Cartesian state, indexed by CartesianElementIndices  [m, m s^-1]
+ * @param[out] variationalState  Cartesian state and state transition matrix, of size
+ *                               CartesianVariationalDynamics::dimension              [m, m s^-1, -]
+ */
+template <typename Real>
+void initializeCartesianVariationalState(const Real* cartesianState, Real* variationalState)
+{
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        variationalState[i] = cartesianState[i];
+    }
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            variationalState[6 + 6 * i + j] = i == j ? Real(1.0) : Real(0.0);
+        }
+    }
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications. Springer, 2000.
+ */
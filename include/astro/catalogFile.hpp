@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ASTRO_CATALOG_FILE_USE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace astro
+{
+
+//! Type of elements stored in catalog file.
+enum CatalogElementType
+{
+    cartesianCatalogElements = 0,
+    keplerianCatalogElements = 1,
+    modifiedEquinoctialCatalogElements = 2
+};
+
+//! Default number of objects per chunk of catalog file.
+/*!
+ * Each chunk stores 6 columns of this many elements, i.e., 3 MB per chunk in double precision,
+ * which is large enough to stream at memory bandwidth and small enough for the writer to buffer
+ * a chunk in memory.
+ */
+const std::size_t defaultCatalogFileChunkCapacity = 65536;
+
+//! Header of catalog file.
+/*!
+ * The catalog file is a compact binary structure-of-arrays format for catalogs of states or
+ * elements, consisting of a header of 64 bytes, followed by a sequence of chunks. Each chunk
+ * stores up to chunkCapacity objects as 6 contiguous columns of chunkCapacity elements each,
+ * ordered using CartesianElementIndices, KeplerianElementIndices or
+ * ModifiedEquinoctialElementIndices, depending on the element type. The last chunk is padded with
+ * zeros. All values are stored in the native byte order of the machine that wrote the file.
+ *
+ * Since the header is 64 bytes and the chunk capacity is a multiple of 16 elements, each column
+ * is aligned to 64 bytes (a cache line) if the file is mapped to a page-aligned address, and the
+ * offset of each column in the file is computed in constant time. Storing the file in chunks
+ * allows the writer to stream an arbitrary number of objects without knowing the size of the
+ * catalog in advance, and allows a reader to process the catalog chunk by chunk, e.g., in
+ * parallel, by passing the columns of each chunk to the batch element conversions without copies.
+ *
+ * @sa CatalogFileWriter, MappedCatalogFile
+ */
+struct CatalogFileHeader
+{
+    //! Magic string identifying the file format.
+    char magic[8];
+
+    //! Version of the file format.
+    std::uint32_t version;
+
+    //! Type of elements, given by CatalogElementType.
+    std::uint32_t elementType;
+
+    //! Size of each stored value (4 for float, 8 for double) [bytes].
+    std::uint32_t scalarSize;
+
+    //! Number of elements per object (6).
+    std::uint32_t numberOfElements;
+
+    //! Number of objects in catalog.
+    std::uint64_t numberOfObjects;
+
+    //! Number of objects per chunk.
+    std::uint64_t chunkCapacity;
+
+    //! Padding to 64 bytes (reserved, zero).
+    char reserved[24];
+};
+
+static_assert(sizeof(CatalogFileHeader) == 64, "Catalog file header must be 64 bytes.");
+
+//! Magic string identifying the catalog file format.
+const char catalogFileMagic[8] = {'A', 'S', 'T', 'R', 'O', 'S', 'O', 'A'};
+
+//! Version of the catalog file format.
+const std::uint32_t catalogFileVersion = 1;
+
+//! Streaming writer for catalog files.
+/*!
+ * Writes a catalog of states or elements to a catalog file (see CatalogFileHeader), one chunk
+ * at a time. Objects are appended to an in-memory chunk buffer, which is written to the file once
+ * it is full, such that the memory use of the writer is independent of the size of the catalog.
+ * The number of objects is written to the header when the writer is closed.
+ *
+ * If the file cannot be opened or written, a runtime exception is thrown.
+ *
+ * @sa CatalogFileHeader, MappedCatalogFile
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class CatalogFileWriter
+{
+public:
+
+    //! Construct writer and open catalog file.
+    /*!
+     * @param[in] fileName       Name of catalog file (overwritten if it exists)
+     * @param[in] elementType    Type of elements stored in catalog
+     * @param[in] chunkCapacity  Number of objects per chunk (multiple of 16)          [-]
+     */
+    CatalogFileWriter(const std::string& fileName,
+                      const CatalogElementType elementType,
+                      const std::size_t chunkCapacity = defaultCatalogFileChunkCapacity)
+        : file(std::fopen(fileName.c_str(), "wb")),
+          elementType(elementType),
+          chunkCapacity(chunkCapacity),
+          chunkBuffer(6 * chunkCapacity),
+          chunkSize(0),
+          numberOfObjects(0)
+    {
+        assert(chunkCapacity > 0 && chunkCapacity % 16 == 0);
+
+        if (file == nullptr)
+        {
+            throw std::runtime_error("ERROR: Could not open catalog file " + fileName + "!");
+        }
+
+        // Write placeholder header, which is overwritten when the writer is closed. The destructor
+        // is not called if the constructor throws, so the file is closed here.
+        try
+        {
+            writeHeader();
+        }
+        catch (...)
+        {
+            std::fclose(file);
+            throw;
+        }
+    }
+
+    //! Destruct writer, closing the catalog file (if not closed).
+    ~CatalogFileWriter()
+    {
+        if (file != nullptr)
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+                // close() resets the file before closing it, such that the file is only closed
+                // here if writing failed before.
+                if (file != nullptr)
+                {
+                    std::fclose(file);
+                }
+            }
+        }
+    }
+
+    CatalogFileWriter(const CatalogFileWriter&) = delete;
+    CatalogFileWriter& operator=(const CatalogFileWriter&) = delete;
+
+    //! Append batch of objects.
+    /*!
+     * @param[in] elements         Array of pointers to element arrays, ordered using the indices
+     *                             of the element type of the catalog
+     * @param[in] numberOfObjects  Number of objects stored in each array                [-]
+     */
+    void append(const Real* const elements[6], const std::size_t numberOfObjects)
+    {
+        std::size_t objectIndex = 0;
+        while (objectIndex < numberOfObjects)
+        {
+            const std::size_t count
+                = std::min(chunkCapacity - chunkSize, numberOfObjects - objectIndex);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                std::copy(elements[k] + objectIndex,
+                          elements[k] + objectIndex + count,
+                          chunkBuffer.begin() + k * chunkCapacity + chunkSize);
+            }
+            chunkSize += count;
+            objectIndex += count;
+
+            if (chunkSize == chunkCapacity)
+            {
+                writeChunk();
+            }
+        }
+    }
+
+    //! Append single object.
+    /*!
+     * @tparam    Vector6  6-vector type
+     * @param[in] state    State or elements, ordered using the indices of the element type of
+     *                     the catalog
+     */
+    template <typename Vector6>
+    void appendState(const Vector6& state)
+    {
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            chunkBuffer[k * chunkCapacity + chunkSize] = state[k];
+        }
+        ++chunkSize;
+
+        if (chunkSize == chunkCapacity)
+        {
+            writeChunk();
+        }
+    }
+
+    //! Close catalog file.
+    /*!
+     * Writes the last (partial) chunk, padded with zeros, and the final header, and closes the
+     * catalog file. No objects can be appended after the writer is closed.
+     */
+    void close()
+    {
+        assert(file != nullptr);
+
+        if (chunkSize > 0)
+        {
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                std::fill(chunkBuffer.begin() + k * chunkCapacity + chunkSize,
+                          chunkBuffer.begin() + (k + 1) * chunkCapacity,
+                          Real(0.0));
+            }
+            writeChunk();
+        }
+
+        if (std::fseek(file, 0, SEEK_SET) != 0)
+        {
+            throw std::runtime_error("ERROR: Could not write catalog file header!");
+        }
+        writeHeader();
+
+        std::FILE* const closedFile = file;
+        file = nullptr;
+        if (std::fclose(closedFile) != 0)
+        {
+            throw std::runtime_error("ERROR: Could not close catalog file!");
+        }
+    }
+
+    //! Get number of objects appended.
+    /*!
+     * @return Number of objects appended  [-]
+     */
+    std::size_t getNumberOfObjects() const { return numberOfObjects + chunkSize; }
+
+private:
+
+    //! Write header.
+    void writeHeader()
+    {
+        CatalogFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, catalogFileMagic, sizeof(header.magic));
+        header.version = catalogFileVersion;
+        header.elementType = static_cast<std::uint32_t>(elementType);
+        header.scalarSize = static_cast<std::uint32_t>(sizeof(Real));
+        header.numberOfElements = 6;
+        header.numberOfObjects = static_cast<std::uint64_t>(numberOfObjects);
+        header.chunkCapacity = static_cast<std::uint64_t>(chunkCapacity);
+
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1)
+        {
+            throw std::runtime_error("ERROR: Could not write catalog file header!");
+        }
+    }
+
+    //! Write chunk buffer and reset it.
+    void writeChunk()
+    {
+        if (std::fwrite(chunkBuffer.data(), sizeof(Real), chunkBuffer.size(), file)
+            != chunkBuffer.size())
+        {
+            throw std::runtime_error("ERROR: Could not write chunk to catalog file!");
+        }
+        numberOfObjects += chunkSize;
+        chunkSize = 0;
+    }
+
+    //! Catalog file (null pointer once closed).
+    std::FILE* file;
+
+    //! Type of elements stored in catalog.
+    const CatalogElementType elementType;
+
+    //! Number of objects per chunk.
+    const std::size_t chunkCapacity;
+
+    //! Buffer of current chunk, storing 6 columns of chunkCapacity elements.
+    std::vector<Real> chunkBuffer;
+
+    //! Number of objects in current chunk.
+    std::size_t chunkSize;
+
+    //! Number of objects written to file in completed chunks.
+    std::size_t numberOfObjects;
+};
+
+//! Memory-mapped catalog file.
+/*!
+ * Maps a catalog file (see CatalogFileHeader) into memory, such that the columns of each chunk
+ * can be passed directly to the batch element conversions and propagation, without parsing or
+ * copying the catalog. Pages of the file are loaded by the operating system as they are accessed,
+ * such that a single pass over a catalog that is much larger than memory streams the file at the
+ * bandwidth of the storage device (or of memory, if the file is cached).
+ *
+ * If the file is mapped as writable, the columns can be modified in place, e.g., to convert a
+ * catalog of Cartesian elements to Keplerian elements chunk by chunk, after which the element
+ * type is updated using setElementType. Modifications are written back to the file by the
+ * operating system.
+ *
+ * Memory mapping is used on POSIX systems. On other systems, the file is read into memory
+ * instead, and modifications are written back when the mapping is destroyed.
+ *
+ * If the file cannot be opened or mapped, or is not a valid catalog file for the given real type,
+ * a runtime exception is thrown.
+ *
+ * @sa CatalogFileHeader, CatalogFileWriter
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class MappedCatalogFile
+{
+public:
+
+    //! Construct mapping of catalog file.
+    /*!
+     * @param[in] fileName    Name of catalog file
+     * @param[in] isWritable  Flag indicating if the mapping is writable
+     */
+    explicit MappedCatalogFile(const std::string& fileName, const bool isWritable = false)
+        : fileName(fileName),
+          isWritable(isWritable),
+          data(nullptr),
+          fileSize(0)
+    {
+        map();
+
+        if (fileSize < sizeof(CatalogFileHeader))
+        {
+            unmap();
+            throw std::runtime_error("ERROR: Catalog file " + fileName + " is truncated!");
+        }
+
+        // The sizes are validated by division, such that corrupt headers cannot overflow the
+        // computation of the required file size.
+        const CatalogFileHeader& header = getHeader();
+        const std::uint64_t chunkCapacity = header.chunkCapacity;
+        const std::uint64_t columnSize = 6 * sizeof(Real);
+        const std::uint64_t dataSize = fileSize - sizeof(CatalogFileHeader);
+
+        const char* error = nullptr;
+        if (std::memcmp(header.magic, catalogFileMagic, sizeof(header.magic)) != 0)
+        {
+            error = " is not a catalog file!";
+        }
+        else if (header.version != catalogFileVersion)
+        {
+            error = " has an unsupported version!";
+        }
+        else if (header.scalarSize != sizeof(Real) || header.numberOfElements != 6)
+        {
+            error = " does not match the real type!";
+        }
+        else if (chunkCapacity == 0 || chunkCapacity % 16 != 0
+                 || chunkCapacity > dataSize / columnSize
+                 || header.numberOfObjects / chunkCapacity
+                        + (header.numberOfObjects % chunkCapacity != 0)
+                    > dataSize / (columnSize * chunkCapacity))
+        {
+            error = " is truncated!";
+        }
+
+        if (error != nullptr)
+        {
+            unmap();
+            throw std::runtime_error("ERROR: Catalog file " + fileName + error);
+        }
+    }
+
+    //! Destruct mapping of catalog file.
+    ~MappedCatalogFile()
+    {
+        unmap();
+    }
+
+    MappedCatalogFile(const MappedCatalogFile&) = delete;
+    MappedCatalogFile& operator=(const MappedCatalogFile&) = delete;
+
+    //! Get type of elements stored in catalog.
+    /*!
+     * @return Type of elements
+     */
+    CatalogElementType getElementType() const
+    {
+        return static_cast<CatalogElementType>(getHeader().elementType);
+    }
+
+    //! Set type of elements stored in catalog (requires writable mapping).
+    /*!
+     * @param[in] elementType  Type of elements
+     */
+    void setElementType(const CatalogElementType elementType)
+    {
+        assert(isWritable);
+        CatalogFileHeader header = getHeader();
+        header.elementType = static_cast<std::uint32_t>(elementType);
+        std::memcpy(data, &header, sizeof(header));
+    }
+
+    //! Get number of objects in catalog.
+    /*!
+     * @return Number of objects  [-]
+     */
+    std::size_t getNumberOfObjects() const
+    {
+        return static_cast<std::size_t>(getHeader().numberOfObjects);
+    }
+
+    //! Get number of objects per chunk.
+    /*!
+     * @return Number of objects per chunk  [-]
+     */
+    std::size_t getChunkCapacity() const
+    {
+        return static_cast<std::size_t>(getHeader().chunkCapacity);
+    }
+
+    //! Get number of chunks.
+    /*!
+     * @return Number of chunks  [-]
+     */
+    std::size_t getNumberOfChunks() const
+    {
+        return getNumberOfObjects() / getChunkCapacity()
+               + (getNumberOfObjects() % getChunkCapacity() != 0);
+    }
+
+    //! Get columns of chunk.
+    /*!
+     * @param[in]  chunkIndex  Index of chunk                                           [-]
+     * @param[out] elements    Array of pointers to element arrays of chunk
+     * @return                 Number of objects in chunk                               [-]
+     */
+    std::size_t getChunk(const std::size_t chunkIndex, const Real* elements[6]) const
+    {
+        assert(chunkIndex < getNumberOfChunks());
+        const std::size_t chunkCapacity = getChunkCapacity();
+        const Real* const chunk = getChunkData(chunkIndex);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            elements[k] = chunk + k * chunkCapacity;
+        }
+        return std::min(chunkCapacity, getNumberOfObjects() - chunkIndex * chunkCapacity);
+    }
+
+    //! Get writable columns of chunk (requires writable mapping).
+    /*!
+     * @param[in]  chunkIndex  Index of chunk                                           [-]
+     * @param[out] elements    Array of pointers to element arrays of chunk
+     * @return                 Number of objects in chunk                               [-]
+     */
+    std::size_t getChunk(const std::size_t chunkIndex, Real* elements[6])
+    {
+        assert(isWritable);
+        assert(chunkIndex < getNumberOfChunks());
+        const std::size_t chunkCapacity = getChunkCapacity();
+        Real* const chunk = const_cast<Real*>(getChunkData(chunkIndex));
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            elements[k] = chunk + k * chunkCapacity;
+        }
+        return std::min(chunkCapacity, getNumberOfObjects() - chunkIndex * chunkCapacity);
+    }
+
+private:
+
+    //! Get header.
+    const CatalogFileHeader& getHeader() const
+    {
+        return *reinterpret_cast<const CatalogFileHeader*>(data);
+    }
+
+    //! Get pointer to first element of chunk.
+    const Real* getChunkData(const std::size_t chunkIndex) const
+    {
+        return reinterpret_cast<const Real*>(data + sizeof(CatalogFileHeader))
+               + chunkIndex * 6 * getChunkCapacity();
+    }
+
+#if defined(ASTRO_CATALOG_FILE_USE_MMAP)
+
+    //! Map file into memory.
+    void map()
+    {
+        const int descriptor = ::open(fileName.c_str(), isWritable ? O_RDWR : O_RDONLY);
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("ERROR: Could not open catalog file " + fileName + "!");
+        }
+
+        struct stat status;
+        if (::fstat(descriptor, &status) != 0 || status.st_size <= 0)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("ERROR: Could not map catalog file " + fileName + "!");
+        }
+        fileSize = static_cast<std::size_t>(status.st_size);
+
+        void* const address = ::mmap(nullptr,
+                                     fileSize,
+                                     isWritable ? PROT_READ | PROT_WRITE : PROT_READ,
+                                     MAP_SHARED,
+                                     descriptor,
+                                     0);
+
+        // The mapping remains valid after the file descriptor is closed.
+        ::close(descriptor);
+        if (address == MAP_FAILED)
+        {
+            throw std::runtime_error("ERROR: Could not map catalog file " + fileName + "!");
+        }
+        data = static_cast<char*>(address);
+
+        // Catalog files are typically processed in a single sequential pass.
+        ::madvise(address, fileSize, MADV_SEQUENTIAL);
+    }
+
+    //! Unmap file.
+    void unmap()
+    {
+        if (data != nullptr)
+        {
+            ::munmap(data, fileSize);
+            data = nullptr;
+        }
+    }
+
+#else
+
+    //! Read file into memory.
+    void map()
+    {
+        std::FILE* const file = std::fopen(fileName.c_str(), "rb");
+        if (file == nullptr)
+        {
+            throw std::runtime_error("ERROR: Could not open catalog file " + fileName + "!");
+        }
+
+        std::vector<char> contents;
+        char readBuffer[65536];
+        std::size_t count = 0;
+        while ((count = std::fread(readBuffer, 1, sizeof(readBuffer), file)) > 0)
+        {
+            contents.insert(contents.end(), readBuffer, readBuffer + count);
+        }
+        std::fclose(file);
+
+        // The buffer is allocated with the alignment of the real type, such that the columns
+        // are aligned.
+        fileSize = contents.size();
+        buffer.resize((fileSize + sizeof(Real) - 1) / sizeof(Real) + 1);
+        std::memcpy(buffer.data(), contents.data(), fileSize);
+        data = reinterpret_cast<char*>(buffer.data());
+    }
+
+    //! Write modifications back to file and release memory.
+    void unmap()
+    {
+        if (data != nullptr && isWritable)
+        {
+            std::FILE* const file = std::fopen(fileName.c_str(), "r+b");
+            if (file != nullptr)
+            {
+                std::fwrite(data, 1, fileSize, file);
+                std::fclose(file);
+            }
+        }
+        data = nullptr;
+        buffer.clear();
+    }
+
+    //! Buffer storing contents of file.
+    std::vector<Real> buffer;
+
+#endif
+
+    //! Name of catalog file.
+    const std::string fileName;
+
+    //! Flag indicating if mapping is writable.
+    const bool isWritable;
+
+    //! Pointer to start of mapped file.
+    char* data;
+
+    //! Size of mapped file [bytes].
+    std::size_t fileSize;
+};
+
+} // namespace astro
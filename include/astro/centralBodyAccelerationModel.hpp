@@ -10,10 +10,51 @@
 #pragma once
 
 #include <cmath>
+#include <type_traits>
+
+#include "astro/hostDevice.hpp"
+#include "astro/vectorTraits.hpp"
 
 namespace astro
 {
 
+//! Compute the central body acceleration, writing into given output vector.
+/*!
+ * Computes the acceleration of a point mass body orbiting a uniform central body, identical to the
+ * computation that returns the acceleration vector, but writes into a caller-provided output
+ * vector. The position and acceleration vectors can be of any type whose elements are accessed
+ * with operator[] (see IsVector), e.g., std::vector, std::array, Eigen fixed-size vectors and
+ * maps and raw pointers. The position is read before the acceleration is written, such that the
+ * acceleration can be written in-place, i.e., the output can be the input.
+ *
+ * @sa IsVector
+ * @tparam     Real                    Real type
+ * @tparam     InputVector3            3-vector type of position
+ * @tparam     OutputVector3           3-vector type of acceleration
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body [km^3 s^-2]
+ * @param[in]  position                Position vector of the orbiting body    [km]
+ * @param[out] acceleration            Acceleration vector                     [km s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+ASTRO_HOST_DEVICE
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeCentralBodyAcceleration(const Real          gravitationalParameter,
+                               const InputVector3& position,
+                               OutputVector3&&     acceleration)
+{
+    const Real x = position[0];
+    const Real y = position[1];
+    const Real z = position[2];
+
+    const Real positionNorm = std::sqrt(x * x + y * y + z * z);
+    const Real preMultiplier = -gravitationalParameter
+                               / (positionNorm * positionNorm * positionNorm);
+
+    acceleration[0] = preMultiplier * x;
+    acceleration[1] = preMultiplier * y;
+    acceleration[2] = preMultiplier * z;
+}
+
 //! Compute the acceleration of a point mass body orbiting a uniform central body.
 /*!
  * Computes the acceleration of a point mass body orbiting a uniform central body based on Newton's
@@ -42,18 +83,56 @@ Vector3 computeCentralBodyAcceleration(const Real gravitationalParameter,
                                        const Vector3& position)
 {
     Vector3 acceleration = position;
+    computeCentralBodyAcceleration(gravitationalParameter, position, acceleration);
+    return acceleration;
+}
 
-    const Real positionNorm = std::sqrt(position[0] * position[0]
-                                         + position[1] * position[1]
-                                         + position[2] * position[2]);
-    const Real preMultiplier = -gravitationalParameter
-                               / (positionNorm * positionNorm * positionNorm);
-
-    acceleration[0] = preMultiplier * position[0];
-    acceleration[1] = preMultiplier * position[1];
-    acceleration[2] = preMultiplier * position[2];
+//! Compute the gradient of the central body acceleration with respect to position.
+/*!
+ * Computes the gradient (Jacobian) of the acceleration of a point mass body orbiting a uniform
+ * central body, computeCentralBodyAcceleration, with respect to the position vector:
+ *
+ * \f[
+ *      \frac{\partial \vec{a}_{gravity}}{\partial \vec{r}}
+ *          = -\frac{\mu}{r^{3}} \left( I - 3 \frac{\vec{r} \vec{r}^{T}}{r^{2}} \right)
+ * \f]
+ *
+ * The gradient is used to compute the state transition matrix from the variational equations,
+ * at the cost of about one evaluation of the acceleration, instead of the six additional
+ * evaluations required to compute it by central differences.
+ *
+ * @sa computeCentralBodyAcceleration, CartesianVariationalDynamics
+ * @tparam     Real                    Real type
+ * @tparam     Vector3                 3-vector type
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body [km^3 s^-2]
+ * @param[in]  position                Position vector of the orbiting body    [km]
+ * @param[out] gradient                Gradient of acceleration wrt position,
+ *                                     stored row-major, i.e., gradient[i][j]
+ *                                     = d a_i / d r_j                         [s^-2]
+ */
+template <typename Real, typename Vector3>
+ASTRO_HOST_DEVICE
+void computeCentralBodyAccelerationGradient(const Real     gravitationalParameter,
+                                            const Vector3& position,
+                                            Real           gradient[3][3])
+{
+    const Real positionNormSquared = position[0] * position[0]
+                                     + position[1] * position[1]
+                                     + position[2] * position[2];
+    const Real inversePositionNormSquared = Real(1.0) / positionNormSquared;
+    const Real preMultiplier = -gravitationalParameter * inversePositionNormSquared
+                               * std::sqrt(inversePositionNormSquared);
+    const Real threeInversePositionNormSquared = Real(3.0) * inversePositionNormSquared;
 
-    return acceleration;
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            gradient[i][j] = -preMultiplier * threeInversePositionNormSquared
+                             * position[i] * position[j];
+        }
+        gradient[i][i] += preMultiplier;
+    }
 }
 
 } // namespace astro
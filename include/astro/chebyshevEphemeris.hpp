@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace astro
+{
+
+//! Evaluate Chebyshev series and its derivative using the Clenshaw recurrence.
+/*!
+ * Evaluates the Chebyshev series \f$f(x) = \sum_{k=0}^{N} c_{k} T_{k}(x)\f$ and its derivative
+ * with respect to \f$x\f$ using the Clenshaw recurrence (Press et al., 2007):
+ *
+ * \f[
+ *      b_{k} = c_{k} + 2 x b_{k+1} - b_{k+2}, \quad
+ *      b'_{k} = 2 b_{k+1} + 2 x b'_{k+1} - b'_{k+2}
+ * \f]
+ *
+ * with \f$b_{N+1} = b_{N+2} = 0\f$, such that \f$f(x) = c_{0} + x b_{1} - b_{2}\f$ and
+ * \f$f'(x) = b_{1} + x b'_{1} - b'_{2}\f$. For degree \f$N\f$, this costs about \f$6N\f$ flops
+ * and requires no evaluations of trigonometric functions.
+ *
+ * @tparam     Real          Real type
+ * @param[in]  coefficients  Chebyshev coefficients \f$c_{0}, \ldots, c_{N}\f$
+ * @param[in]  degree        Degree \f$N\f$ of Chebyshev series                   [-]
+ * @param[in]  x             Argument, in the interval [-1, 1]                     [-]
+ * @param[out] derivative    Derivative of Chebyshev series wrt x                  [-]
+ * @return                   Value of Chebyshev series                             [-]
+ */
+template <typename Real>
+Real evaluateChebyshevSeries(const Real* const coefficients,
+                             const std::size_t degree,
+                             const Real x,
+                             Real& derivative)
+{
+    const Real twoX = Real(2.0) * x;
+
+    Real b1 = Real(0.0);
+    Real b2 = Real(0.0);
+    Real db1 = Real(0.0);
+    Real db2 = Real(0.0);
+    for (std::size_t k = degree; k > 0; --k)
+    {
+        const Real b = (coefficients[k] - b2) + twoX * b1;
+        const Real db = (Real(2.0) * b1 - db2) + twoX * db1;
+        b2 = b1;
+        b1 = b;
+        db2 = db1;
+        db1 = db;
+    }
+
+    derivative = b1 + x * db1 - db2;
+    return coefficients[0] + x * b1 - b2;
+}
+
+//! Piecewise Chebyshev ephemeris.
+/*!
+ * Compressed representation of a trajectory, i.e., of the position of a body as function of
+ * epoch, as piecewise Chebyshev polynomials, similar to the format of the JPL planetary
+ * ephemerides (Newhall, 1989). Once fitted, the position and velocity are evaluated at any epoch
+ * with a Clenshaw recurrence (see evaluateChebyshevSeries) in a few dozen flops, instead of the
+ * chain of element conversions and the solution of Kepler's equation (or the numerical
+ * integration) needed to propagate the trajectory.
+ *
+ * The interval between the start and end epochs is divided into segments of equal duration, such
+ * that the segment containing a given epoch is found in constant time. On each segment, each
+ * position component is interpolated by a Chebyshev series of fixed degree at the Chebyshev nodes
+ * of the segment. The number of segments is doubled until the position error in each segment,
+ * measured at the points halfway between the nodes and at the segment boundaries, is below the
+ * given tolerance. The velocity is obtained by differentiating the Chebyshev series, such that the
+ * velocity error is typically a few orders of magnitude larger than the position error, divided
+ * by the segment duration.
+ *
+ * Segments that meet the tolerance are not sampled again when the number of segments is doubled.
+ * Instead, their Chebyshev series are re-expanded on each half, which is exact and costs
+ * O(degree^2) flops per segment, and they keep the error measured when they were fitted. The
+ * position function is therefore only sampled again where the tolerance is not met, e.g., around
+ * periapsis of eccentric orbits. Since the segments are of equal duration, the number of stored
+ * segments is still set by the hardest part of the trajectory.
+ *
+ * Each segment stores 3 (degree + 1) coefficients. For a degree of 12 and a tolerance of 1 mm, a
+ * low Earth orbit requires about 4 segments per revolution, i.e., about 50 coefficients per
+ * revolution per component, which is far less than needed to interpolate a densely sampled
+ * trajectory to the same accuracy.
+ *
+ * The trajectory is given by a position function, which is called as:
+ *
+ *      positionFunction(epoch, position);
+ *
+ * where epoch is of type Real and position is an array of 3 Reals, which the function sets
+ * to the position of the body at the given epoch. The position function is typically a wrapper
+ * around the propagate function of a KeplerPropagator or an integration of CartesianDynamics.
+ *
+ * If the tolerance is not met with the maximum number of segments, a runtime exception is thrown.
+ *
+ * @sa evaluateChebyshevSeries, KeplerPropagator
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class ChebyshevEphemeris
+{
+public:
+
+    //! Fit Chebyshev ephemeris.
+    /*!
+     * @tparam    PositionFunction         Position function type
+     * @param     positionFunction         Position function (see above)
+     * @param     startEpoch               Start epoch of ephemeris                      [s]
+     * @param     endEpoch                 End epoch of ephemeris                        [s]
+     * @param     tolerance                Maximum position error                        [m]
+     * @param     degree                   Degree of Chebyshev series per segment        [-]
+     * @param     maximumNumberOfSegments  Maximum number of segments                    [-]
+     */
+    template <typename PositionFunction>
+    ChebyshevEphemeris(const PositionFunction& positionFunction,
+                       const Real              startEpoch,
+                       const Real              endEpoch,
+                       const Real              tolerance,
+                       const std::size_t       degree = 12,
+                       const std::size_t       maximumNumberOfSegments = 1048576)
+        : startEpoch(startEpoch),
+          endEpoch(endEpoch),
+          degree(degree),
+          numberOfSegments(1),
+          maximumError(Real(0.0))
+    {
+        assert(endEpoch > startEpoch);
+        assert(tolerance > Real(0.0));
+        assert(degree > 0);
+
+        const Real pi = Real(3.14159265358979323846);
+        const std::size_t numberOfNodes = degree + 1;
+
+        // Compute Chebyshev nodes and the values of the Chebyshev polynomials at the nodes, which
+        // are the same for all segments.
+        std::vector<Real> nodes(numberOfNodes);
+        std::vector<Real> polynomials(numberOfNodes * numberOfNodes);
+        for (std::size_t j = 0; j < numberOfNodes; ++j)
+        {
+            const Real angle = pi * (static_cast<Real>(j) + Real(0.5))
+                               / static_cast<Real>(numberOfNodes);
+            nodes[j] = std::cos(angle);
+            for (std::size_t k = 0; k < numberOfNodes; ++k)
+            {
+                polynomials[k * numberOfNodes + j] = std::cos(static_cast<Real>(k) * angle);
+            }
+        }
+
+        // Check points halfway between the nodes (in angle) and at the segment boundaries, where
+        // the interpolation error is largest.
+        std::vector<Real> checkPoints(1, Real(1.0));
+        for (std::size_t j = 1; j < numberOfNodes; ++j)
+        {
+            checkPoints.push_back(
+                std::cos(pi * static_cast<Real>(j) / static_cast<Real>(numberOfNodes)));
+        }
+        checkPoints.push_back(Real(-1.0));
+
+        // The fit starts with a single segment and the number of segments is doubled until all
+        // segments are converged. Converged segments are kept: they are split by re-expanding
+        // their Chebyshev series on each half, which is exact, such that the position function is
+        // only sampled again for segments that did not meet the tolerance.
+        std::vector<char> isSegmentConverged(1, false);
+        std::vector<Real> segmentErrors(1, Real(0.0));
+        coefficients.assign(3 * numberOfNodes, Real(0.0));
+
+        std::vector<Real> nodePositions(3 * numberOfNodes);
+        while (true)
+        {
+            segmentDuration = (endEpoch - startEpoch) / static_cast<Real>(numberOfSegments);
+            inverseSegmentDuration = Real(1.0) / segmentDuration;
+
+            // Fit segments that are not converged, in order, until the first one that fails.
+            bool isConverged = true;
+            for (std::size_t segment = 0; segment < numberOfSegments && isConverged; ++segment)
+            {
+                if (isSegmentConverged[segment])
+                {
+                    continue;
+                }
+
+                const Real segmentMidpoint
+                    = startEpoch + (static_cast<Real>(segment) + Real(0.5)) * segmentDuration;
+
+                // Nodes are sampled in order of increasing epoch.
+                for (std::size_t j = numberOfNodes; j > 0; --j)
+                {
+                    Real position[3];
+                    positionFunction(
+                        segmentMidpoint + Real(0.5) * segmentDuration * nodes[j - 1], position);
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        nodePositions[i * numberOfNodes + j - 1] = position[i];
+                    }
+                }
+
+                Real* const segmentCoefficients
+                    = coefficients.data() + segment * 3 * numberOfNodes;
+                computeCoefficients(nodePositions.data(), polynomials, segmentCoefficients);
+
+                Real segmentError = Real(0.0);
+                for (std::size_t j = checkPoints.size(); j > 0; --j)
+                {
+                    Real position[3];
+                    positionFunction(
+                        segmentMidpoint + Real(0.5) * segmentDuration * checkPoints[j - 1],
+                        position);
+
+                    Real errorSquared = Real(0.0);
+                    for (std::size_t i = 0; i < 3; ++i)
+                    {
+                        Real derivative;
+                        const Real error
+                            = evaluateChebyshevSeries(segmentCoefficients + i * numberOfNodes,
+                                                      degree,
+                                                      checkPoints[j - 1],
+                                                      derivative)
+                              - position[i];
+                        errorSquared += error * error;
+                    }
+                    segmentError = std::max(segmentError, std::sqrt(errorSquared));
+                }
+
+                segmentErrors[segment] = segmentError;
+                isSegmentConverged[segment] = segmentError <= tolerance;
+                isConverged = isSegmentConverged[segment] != 0;
+            }
+
+            if (isConverged)
+            {
+                break;
+            }
+
+            if (2 * numberOfSegments > maximumNumberOfSegments)
+            {
+                throw std::runtime_error(
+                    "ERROR: Chebyshev ephemeris tolerance not met with maximum number of "
+                    "segments!");
+            }
+
+            // Split each segment in two halves. The Chebyshev series of a converged segment is
+            // re-expanded on each half by interpolating it at the nodes of the half, which is
+            // exact since the series is a polynomial of the same degree.
+            std::vector<Real> splitCoefficients(2 * coefficients.size(), Real(0.0));
+            std::vector<char> isSplitSegmentConverged(2 * numberOfSegments, false);
+            std::vector<Real> splitSegmentErrors(2 * numberOfSegments, Real(0.0));
+            for (std::size_t segment = 0; segment < numberOfSegments; ++segment)
+            {
+                if (!isSegmentConverged[segment])
+                {
+                    continue;
+                }
+
+                const Real* const segmentCoefficients
+                    = coefficients.data() + segment * 3 * numberOfNodes;
+                for (std::size_t half = 0; half < 2; ++half)
+                {
+                    const std::size_t splitSegment = 2 * segment + half;
+                    const Real offset = half == 0 ? Real(-1.0) : Real(1.0);
+                    for (std::size_t j = 0; j < numberOfNodes; ++j)
+                    {
+                        for (std::size_t i = 0; i < 3; ++i)
+                        {
+                            Real derivative;
+                            nodePositions[i * numberOfNodes + j]
+                                = evaluateChebyshevSeries(segmentCoefficients + i * numberOfNodes,
+                                                          degree,
+                                                          Real(0.5) * (nodes[j] + offset),
+                                                          derivative);
+                        }
+                    }
+
+                    computeCoefficients(nodePositions.data(),
+                                        polynomials,
+                                        splitCoefficients.data()
+                                            + splitSegment * 3 * numberOfNodes);
+                    isSplitSegmentConverged[splitSegment] = true;
+                    splitSegmentErrors[splitSegment] = segmentErrors[segment];
+                }
+            }
+
+            coefficients.swap(splitCoefficients);
+            isSegmentConverged.swap(isSplitSegmentConverged);
+            segmentErrors.swap(splitSegmentErrors);
+            numberOfSegments *= 2;
+        }
+
+        maximumError = *std::max_element(segmentErrors.begin(), segmentErrors.end());
+    }
+
+    //! Evaluate position.
+    /*!
+     * @param[in]  epoch     Epoch, between start and end epochs of ephemeris  [s]
+     * @param[out] position  Position                                          [m]
+     */
+    void evaluatePosition(const Real epoch, Real position[3]) const
+    {
+        Real x;
+        const Real* const segmentCoefficients = findSegment(epoch, x);
+        Real velocity[3];
+        evaluateSegment(segmentCoefficients, x, position, velocity);
+    }
+
+    //! Evaluate position and velocity.
+    /*!
+     * @param[in]  epoch  Epoch, between start and end epochs of ephemeris           [s]
+     * @param[out] state  Cartesian state, ordered using CartesianElementIndices      [m, m/s]
+     */
+    void evaluateState(const Real epoch, Real state[6]) const
+    {
+        Real x;
+        const Real* const segmentCoefficients = findSegment(epoch, x);
+        Real derivatives[3];
+        evaluateSegment(segmentCoefficients, x, state, derivatives);
+
+        const Real derivativeScale = Real(2.0) * inverseSegmentDuration;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            state[i + 3] = derivativeScale * derivatives[i];
+        }
+    }
+
+    //! Evaluate positions at multiple epochs.
+    /*!
+     * Evaluates the positions at each of the given epochs and stores them in structure-of-arrays
+     * layout, similar to the batch element conversions.
+     *
+     * @param[in]  epochs          Array of epochs                                     [s]
+     * @param[in]  numberOfEpochs  Number of epochs                                    [-]
+     * @param[out] positions       Arrays of position components                      [m]
+     */
+    void evaluatePositions(const Real* const epochs,
+                           const std::size_t numberOfEpochs,
+                           Real* const       positions[3]) const
+    {
+        for (std::size_t n = 0; n < numberOfEpochs; ++n)
+        {
+            Real position[3];
+            evaluatePosition(epochs[n], position);
+            positions[0][n] = position[0];
+            positions[1][n] = position[1];
+            positions[2][n] = position[2];
+        }
+    }
+
+    //! Get start epoch of ephemeris.
+    /*!
+     * @return Start epoch  [s]
+     */
+    Real getStartEpoch() const { return startEpoch; }
+
+    //! Get end epoch of ephemeris.
+    /*!
+     * @return End epoch  [s]
+     */
+    Real getEndEpoch() const { return endEpoch; }
+
+    //! Get degree of Chebyshev series per segment.
+    /*!
+     * @return Degree  [-]
+     */
+    std::size_t getDegree() const { return degree; }
+
+    //! Get number of segments.
+    /*!
+     * @return Number of segments  [-]
+     */
+    std::size_t getNumberOfSegments() const { return numberOfSegments; }
+
+    //! Get duration of segments.
+    /*!
+     * @return Segment duration  [s]
+     */
+    Real getSegmentDuration() const { return segmentDuration; }
+
+    //! Get maximum position error at check points of fit.
+    /*!
+     * @return Maximum position error  [m]
+     */
+    Real getMaximumError() const { return maximumError; }
+
+    //! Get Chebyshev coefficients.
+    /*!
+     * The coefficients are stored per segment and, within each segment, per position component,
+     * such that coefficient k of component i in segment s is stored at index
+     * (3 s + i) (degree + 1) + k.
+     *
+     * @return Chebyshev coefficients  [m]
+     */
+    const std::vector<Real>& getCoefficients() const { return coefficients; }
+
+private:
+
+    //! Compute Chebyshev coefficients of a segment from the positions at the nodes.
+    /*!
+     * Computes the coefficients of the Chebyshev series that interpolate the 3 position
+     * components at the Chebyshev nodes of a segment, using the discrete orthogonality of the
+     * Chebyshev polynomials at the nodes (Press et al., 2007).
+     *
+     * @param[in]  nodePositions        Position components at nodes, stored per component  [m]
+     * @param[in]  polynomials          Chebyshev polynomials at nodes, stored per degree   [-]
+     * @param[out] segmentCoefficients  Pointer to coefficients of segment                  [m]
+     */
+    void computeCoefficients(const Real* const        nodePositions,
+                             const std::vector<Real>& polynomials,
+                             Real* const              segmentCoefficients) const
+    {
+        const std::size_t numberOfNodes = degree + 1;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            for (std::size_t k = 0; k < numberOfNodes; ++k)
+            {
+                Real sum = Real(0.0);
+                for (std::size_t j = 0; j < numberOfNodes; ++j)
+                {
+                    sum += nodePositions[i * numberOfNodes + j]
+                           * polynomials[k * numberOfNodes + j];
+                }
+                segmentCoefficients[i * numberOfNodes + k]
+                    = (k == 0 ? Real(1.0) : Real(2.0)) * sum / static_cast<Real>(numberOfNodes);
+            }
+        }
+    }
+
+    //! Evaluate Chebyshev series of the 3 position components of a segment.
+    /*!
+     * Evaluates the Clenshaw recurrence (see evaluateChebyshevSeries) of the 3 position
+     * components in a single loop, such that the 3 independent recurrences are interleaved. The
+     * terms that do not depend on the previous iteration are summed first, which shortens the
+     * chain of dependent operations per iteration to a single multiply-add.
+     *
+     * @param[in]  segmentCoefficients  Pointer to coefficients of segment
+     * @param[in]  x                    Scaled epoch within segment                 [-]
+     * @param[out] values               Values of Chebyshev series                  [m]
+     * @param[out] derivatives          Derivatives of Chebyshev series wrt x       [m]
+     */
+    void evaluateSegment(const Real* const segmentCoefficients,
+                         const Real        x,
+                         Real              values[3],
+                         Real              derivatives[3]) const
+    {
+        const Real* const cx = segmentCoefficients;
+        const Real* const cy = segmentCoefficients + (degree + 1);
+        const Real* const cz = segmentCoefficients + 2 * (degree + 1);
+        const Real twoX = Real(2.0) * x;
+
+        Real bx1 = Real(0.0), bx2 = Real(0.0), dbx1 = Real(0.0), dbx2 = Real(0.0);
+        Real by1 = Real(0.0), by2 = Real(0.0), dby1 = Real(0.0), dby2 = Real(0.0);
+        Real bz1 = Real(0.0), bz2 = Real(0.0), dbz1 = Real(0.0), dbz2 = Real(0.0);
+        for (std::size_t k = degree; k > 0; --k)
+        {
+            const Real dbx = (Real(2.0) * bx1 - dbx2) + twoX * dbx1;
+            const Real dby = (Real(2.0) * by1 - dby2) + twoX * dby1;
+            const Real dbz = (Real(2.0) * bz1 - dbz2) + twoX * dbz1;
+            const Real bx = (cx[k] - bx2) + twoX * bx1;
+            const Real by = (cy[k] - by2) + twoX * by1;
+            const Real bz = (cz[k] - bz2) + twoX * bz1;
+            dbx2 = dbx1;
+            dby2 = dby1;
+            dbz2 = dbz1;
+            dbx1 = dbx;
+            dby1 = dby;
+            dbz1 = dbz;
+            bx2 = bx1;
+            by2 = by1;
+            bz2 = bz1;
+            bx1 = bx;
+            by1 = by;
+            bz1 = bz;
+        }
+
+        values[0] = cx[0] + x * bx1 - bx2;
+        values[1] = cy[0] + x * by1 - by2;
+        values[2] = cz[0] + x * bz1 - bz2;
+        derivatives[0] = bx1 + x * dbx1 - dbx2;
+        derivatives[1] = by1 + x * dby1 - dby2;
+        derivatives[2] = bz1 + x * dbz1 - dbz2;
+    }
+
+    //! Find segment containing epoch.
+    /*!
+     * @param[in]  epoch  Epoch                                                      [s]
+     * @param[out] x      Scaled epoch within segment, in the interval [-1, 1]       [-]
+     * @return            Pointer to coefficients of segment
+     */
+    const Real* findSegment(const Real epoch, Real& x) const
+    {
+        assert(epoch >= startEpoch && epoch <= endEpoch);
+
+        const Real scaledEpoch = (epoch - startEpoch) * inverseSegmentDuration;
+        const std::size_t segment = std::min(
+            static_cast<std::size_t>(std::max(scaledEpoch, Real(0.0))), numberOfSegments - 1);
+        x = Real(2.0) * (scaledEpoch - static_cast<Real>(segment)) - Real(1.0);
+        return coefficients.data() + segment * 3 * (degree + 1);
+    }
+
+    //! Start epoch of ephemeris.
+    const Real startEpoch;
+
+    //! End epoch of ephemeris.
+    const Real endEpoch;
+
+    //! Degree of Chebyshev series per segment.
+    const std::size_t degree;
+
+    //! Number of segments.
+    std::size_t numberOfSegments;
+
+    //! Duration of segments.
+    Real segmentDuration;
+
+    //! Inverse of duration of segments.
+    Real inverseSegmentDuration;
+
+    //! Maximum position error at check points of fit.
+    Real maximumError;
+
+    //! Chebyshev coefficients, stored per segment and position component.
+    std::vector<Real> coefficients;
+};
+
+} // namespace astro
+
+/*!
+ * References
+ *  Newhall, X.X. Numerical representation of planetary ephemerides. Celestial Mechanics, 45(1),
+ *      305-310, 1989.
+ *  Press, W.H., et al. Numerical Recipes: The Art of Scientific Computing. Third Edition,
+ *      Cambridge University Press, 2007.
+ */
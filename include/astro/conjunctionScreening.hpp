@@ -0,0 +1,652 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/parallelCatalog.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+
+//! Conjunction (close approach) between two objects.
+/*!
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct Conjunction
+{
+    //! Index of first object in catalog (smaller than index of second object).
+    std::size_t firstObjectIndex;
+
+    //! Index of second object in catalog.
+    std::size_t secondObjectIndex;
+
+    //! Time of closest approach (TCA), wrt epoch of catalog [s].
+    Real timeOfClosestApproach;
+
+    //! Miss distance, i.e., distance between objects at TCA [m].
+    Real missDistance;
+
+    //! Relative speed of objects at TCA [m/s].
+    Real relativeSpeed;
+};
+
+//! Check if two orbits pass the perigee/apogee filter.
+/*!
+ * Checks if two orbits can come within the given distance of each other, by checking if the
+ * radial shells between the perigee and apogee radii of the orbits, extended by the distance,
+ * overlap (Hoots et al., 1984):
+ *
+ * \f[
+ *      \max(r_{p,1}, r_{p,2}) - \min(r_{a,1}, r_{a,2}) \leq d
+ * \f]
+ *
+ * If the filter is not passed, the objects cannot have a conjunction, regardless of the
+ * orientation of their orbits and their positions along their orbits. For open orbits, the
+ * apogee radius is infinite.
+ *
+ * @tparam    Real           Real type
+ * @param     firstPerigee   Perigee radius of first orbit             [m]
+ * @param     firstApogee    Apogee radius of first orbit              [m]
+ * @param     secondPerigee  Perigee radius of second orbit            [m]
+ * @param     secondApogee   Apogee radius of second orbit             [m]
+ * @param     distance       Screening distance                        [m]
+ * @return                   True if the orbits pass the filter
+ */
+template <typename Real>
+bool isPassingPerigeeApogeeFilter(const Real firstPerigee,
+                                  const Real firstApogee,
+                                  const Real secondPerigee,
+                                  const Real secondApogee,
+                                  const Real distance)
+{
+    return std::max(firstPerigee, secondPerigee) - std::min(firstApogee, secondApogee)
+           <= distance;
+}
+
+//! Refine time of closest approach of two objects.
+/*!
+ * Computes the time of closest approach (TCA) of two objects in Kepler orbits within the given
+ * interval, i.e., the epoch at which the range rate \f$f(t) = \vec{r} \cdot \vec{v}\f$ of the
+ * relative position \f$\vec{r}\f$ and velocity \f$\vec{v}\f$ changes sign from negative to
+ * positive.
+ * The root is found using the Newton-Raphson method, with derivative
+ * \f$f'(t) = \vec{v} \cdot \vec{v} + \vec{r} \cdot \vec{a}\f$, where \f$\vec{a}\f$ is the relative
+ * two-body acceleration, safeguarded by bisection (Press et al., 2007). If the range rate does not
+ * change sign in the interval, the TCA is the bound of the interval with the smallest distance.
+ *
+ * If the Kepler propagation does not converge, a runtime exception is thrown.
+ *
+ * @tparam     Real                    Real type
+ * @tparam     Vector6                 6-vector type
+ * @param      firstPropagator         Kepler propagator of first object
+ * @param      secondPropagator        Kepler propagator of second object
+ * @param      gravitationalParameter  Gravitational parameter of central body     [m^3 s^-2]
+ * @param      initialGuess            Initial guess for TCA                       [s]
+ * @param      lowerBound              Lower bound of interval                     [s]
+ * @param      upperBound              Upper bound of interval                     [s]
+ * @param      timeTolerance           Tolerance on TCA                            [s]
+ * @param      maximumIterations       Maximum number of iterations                [-]
+ * @return                             Conjunction at TCA (object indices not set)
+ */
+template <typename Real, typename Vector6>
+Conjunction<Real> refineTimeOfClosestApproach(
+    const KeplerPropagator<Real, Vector6>& firstPropagator,
+    const KeplerPropagator<Real, Vector6>& secondPropagator,
+    const Real                             gravitationalParameter,
+    const Real                             initialGuess,
+    Real                                   lowerBound,
+    Real                                   upperBound,
+    const Real                             timeTolerance = Real(1.0e-6),
+    const int                              maximumIterations = 50)
+{
+    assert(lowerBound <= upperBound);
+
+    // Compute the range rate (relative position dotted with relative velocity), its derivative,
+    // the squared distance and the squared relative speed at the given epoch.
+    const auto computeRangeRate = [&](const Real epoch,
+                                      Real& derivative,
+                                      Real& distanceSquared,
+                                      Real& relativeSpeedSquared)
+    {
+        const Vector6 firstState = firstPropagator.propagate(epoch);
+        const Vector6 secondState = secondPropagator.propagate(epoch);
+
+        Real firstRadiusSquared = Real(0.0);
+        Real secondRadiusSquared = Real(0.0);
+        for (int i = 0; i < 3; ++i)
+        {
+            firstRadiusSquared += firstState[i] * firstState[i];
+            secondRadiusSquared += secondState[i] * secondState[i];
+        }
+        const Real firstFactor
+            = gravitationalParameter / (firstRadiusSquared * std::sqrt(firstRadiusSquared));
+        const Real secondFactor
+            = gravitationalParameter / (secondRadiusSquared * std::sqrt(secondRadiusSquared));
+
+        Real rangeRate = Real(0.0);
+        Real positionDotAcceleration = Real(0.0);
+        distanceSquared = Real(0.0);
+        relativeSpeedSquared = Real(0.0);
+        for (int i = 0; i < 3; ++i)
+        {
+            const Real position = firstState[i] - secondState[i];
+            const Real velocity = firstState[i + 3] - secondState[i + 3];
+            const Real acceleration = secondFactor * secondState[i] - firstFactor * firstState[i];
+            rangeRate += position * velocity;
+            positionDotAcceleration += position * acceleration;
+            distanceSquared += position * position;
+            relativeSpeedSquared += velocity * velocity;
+        }
+        derivative = relativeSpeedSquared + positionDotAcceleration;
+        return rangeRate;
+    };
+
+    Real derivative = Real(0.0);
+    Real distanceSquared = Real(0.0);
+    Real relativeSpeedSquared = Real(0.0);
+    Real epoch = initialGuess;
+
+    const Real lowerRangeRate
+        = computeRangeRate(lowerBound, derivative, distanceSquared, relativeSpeedSquared);
+    const Real lowerDistanceSquared = distanceSquared;
+    const Real lowerRelativeSpeedSquared = relativeSpeedSquared;
+    const Real upperRangeRate
+        = computeRangeRate(upperBound, derivative, distanceSquared, relativeSpeedSquared);
+
+    if (lowerRangeRate >= Real(0.0) || upperRangeRate <= Real(0.0))
+    {
+        // The range rate does not change sign from negative to positive, such that the distance
+        // is smallest at one of the bounds.
+        const bool isLowerBound = lowerRangeRate >= Real(0.0)
+                                  && (upperRangeRate >= Real(0.0)
+                                      || lowerDistanceSquared <= distanceSquared);
+        Conjunction<Real> conjunction;
+        conjunction.firstObjectIndex = 0;
+        conjunction.secondObjectIndex = 0;
+        conjunction.timeOfClosestApproach = isLowerBound ? lowerBound : upperBound;
+        conjunction.missDistance
+            = std::sqrt(isLowerBound ? lowerDistanceSquared : distanceSquared);
+        conjunction.relativeSpeed
+            = std::sqrt(isLowerBound ? lowerRelativeSpeedSquared : relativeSpeedSquared);
+        return conjunction;
+    }
+
+    epoch = std::min(std::max(epoch, lowerBound), upperBound);
+    for (int iteration = 0; iteration < maximumIterations; ++iteration)
+    {
+        const Real rangeRate
+            = computeRangeRate(epoch, derivative, distanceSquared, relativeSpeedSquared);
+
+        // Shrink the bracket of the root.
+        if (rangeRate < Real(0.0))
+        {
+            lowerBound = epoch;
+        }
+        else
+        {
+            upperBound = epoch;
+        }
+
+        Real nextEpoch = epoch - rangeRate / derivative;
+        if (!(derivative > Real(0.0)) || nextEpoch <= lowerBound || nextEpoch >= upperBound)
+        {
+            nextEpoch = Real(0.5) * (lowerBound + upperBound);
+        }
+
+        const bool isConverged = std::fabs(nextEpoch - epoch) <= timeTolerance;
+        epoch = nextEpoch;
+        if (isConverged)
+        {
+            break;
+        }
+    }
+
+    computeRangeRate(epoch, derivative, distanceSquared, relativeSpeedSquared);
+
+    Conjunction<Real> conjunction;
+    conjunction.firstObjectIndex = 0;
+    conjunction.secondObjectIndex = 0;
+    conjunction.timeOfClosestApproach = epoch;
+    conjunction.missDistance = std::sqrt(distanceSquared);
+    conjunction.relativeSpeed = std::sqrt(relativeSpeedSquared);
+    return conjunction;
+}
+
+//! Merge conjunctions of the same pair of objects.
+/*!
+ * Sorts the given conjunctions by pair of objects and TCA, and merges the conjunctions of each
+ * pair whose TCAs lie within the merge interval of the TCA of the first conjunction of a group,
+ * keeping the conjunction with the smallest miss distance. Since the groups are anchored at their
+ * first TCA, chains of conjunctions that are each within the merge interval of the previous one
+ * are split into multiple groups, instead of being merged into a single conjunction.
+ *
+ * This is used by screenConjunctions to merge the conjunctions of the same pair found from
+ * consecutive steps, with the step duration as merge interval.
+ *
+ * @sa screenConjunctions
+ * @tparam    Real           Real type
+ * @param     conjunctions   Conjunctions (sorted in-place)                  [-]
+ * @param     mergeInterval  Maximum interval between TCAs of a group        [s]
+ * @return                   Merged conjunctions, sorted by pair and TCA     [-]
+ */
+template <typename Real>
+std::vector<Conjunction<Real> > mergeConjunctions(std::vector<Conjunction<Real> >& conjunctions,
+                                                  const Real                       mergeInterval)
+{
+    std::sort(conjunctions.begin(),
+              conjunctions.end(),
+              [](const Conjunction<Real>& first, const Conjunction<Real>& second)
+              {
+                  return first.firstObjectIndex != second.firstObjectIndex
+                      ? first.firstObjectIndex < second.firstObjectIndex
+                      : first.secondObjectIndex != second.secondObjectIndex
+                          ? first.secondObjectIndex < second.secondObjectIndex
+                          : first.timeOfClosestApproach < second.timeOfClosestApproach;
+              });
+
+    // Conjunctions are grouped by the TCA of the first conjunction of each group, rather than by
+    // the TCA of the conjunction kept for the group (which is replaced by conjunctions with a
+    // smaller miss distance), such that a group never spans more than the merge interval.
+    std::vector<Conjunction<Real> > mergedConjunctions;
+    Real groupTimeOfClosestApproach = Real(0.0);
+    for (std::size_t n = 0; n < conjunctions.size(); ++n)
+    {
+        if (!mergedConjunctions.empty()
+            && mergedConjunctions.back().firstObjectIndex == conjunctions[n].firstObjectIndex
+            && mergedConjunctions.back().secondObjectIndex == conjunctions[n].secondObjectIndex
+            && conjunctions[n].timeOfClosestApproach - groupTimeOfClosestApproach
+                   <= mergeInterval)
+        {
+            if (conjunctions[n].missDistance < mergedConjunctions.back().missDistance)
+            {
+                mergedConjunctions.back() = conjunctions[n];
+            }
+            continue;
+        }
+        mergedConjunctions.push_back(conjunctions[n]);
+        groupTimeOfClosestApproach = conjunctions[n].timeOfClosestApproach;
+    }
+
+    return mergedConjunctions;
+}
+
+//! Screen catalog for conjunctions.
+/*!
+ * Finds all conjunctions, i.e., close approaches with a miss distance below the screening
+ * distance, between the objects in a catalog within a time window, without evaluating all
+ * \f$N (N - 1) / 2\f$ pairs of objects at each epoch. The objects are propagated in Kepler
+ * orbits, using KeplerPropagator. The screening consists of the following stages:
+ *
+ *  1. Perigee/apogee filter: the perigee and apogee radii of each object are computed from its
+ *     Keplerian elements, computed using convertCartesianToKeplerianElements. Pairs of objects
+ *     that do not pass isPassingPerigeeApogeeFilter are discarded.
+ *  2. Time-bucketed spatial grid: the window is divided into steps of the given duration. At the
+ *     epoch \f$t_{k}\f$ of each step, the positions of all objects are hashed into a uniform grid
+ *     of cubic cells, such that candidate pairs are found by checking the objects in the 27
+ *     neighbouring cells of each object. Since the relative speed of two objects is bounded by the
+ *     sum of their maximum (perigee) speeds, \f$v_{max}\f$, two objects with a TCA within half a
+ *     step of \f$t_{k}\f$ are at most \f$d + v_{max} \Delta t / 2\f$ apart at \f$t_{k}\f$, which
+ *     sets the cell size. Candidate pairs are also discarded if their distance, extrapolated
+ *     linearly over a step, does not come within the screening distance plus a margin for the
+ *     curvature of the relative motion.
+ *  3. TCA refinement: the TCA of each candidate pair is computed using
+ *     refineTimeOfClosestApproach within a step of \f$t_{k}\f$, and the pair is reported if the
+ *     miss distance is below the screening distance. Conjunctions of the same pair found within
+ *     a step of the first conjunction of a group are merged, keeping the smallest miss distance.
+ *
+ * The cost of each step is linear in the number of objects (propagation and hashing) plus the
+ * number of candidate pairs, instead of quadratic in the number of objects. The steps are
+ * independent, such that they are distributed over the threads using executeInParallel, in a few
+ * chunks of steps per thread that reuse the same work arrays, followed by the TCA refinement of
+ * the candidate pairs. Smaller steps reduce the number of candidate pairs, but increase the number
+ * of propagations.
+ *
+ * Conjunctions at the bounds of the window, i.e., for which the distance is smallest at the start
+ * or end of the window, are reported with the TCA set to the bound.
+ *
+ * If the Kepler propagation of an object does not converge, a runtime exception is thrown.
+ *
+ * @sa isPassingPerigeeApogeeFilter, refineTimeOfClosestApproach, mergeConjunctions,
+ *     KeplerPropagator, executeInParallel
+ * @tparam    Real                    Real type
+ * @param     states                  Array of pointers to Cartesian element arrays of catalog,
+ *                                    ordered using CartesianElementIndices            [m, m/s]
+ * @param     numberOfObjects         Number of objects in catalog                     [-]
+ * @param     gravitationalParameter  Gravitational parameter of central body          [m^3 s^-2]
+ * @param     windowDuration          Duration of screening window, starting at epoch
+ *                                    of catalog                                       [s]
+ * @param     screeningDistance       Screening distance                               [m]
+ * @param     stepDuration            Duration of steps of spatial grid                [s]
+ * @param     numberOfThreads         Number of threads (0 for hardware concurrency)   [-]
+ * @return                            Conjunctions, sorted by object indices and TCA
+ */
+template <typename Real>
+std::vector<Conjunction<Real> > screenConjunctions(const Real* const  states[6],
+                                                   const std::size_t  numberOfObjects,
+                                                   const Real         gravitationalParameter,
+                                                   const Real         windowDuration,
+                                                   const Real         screeningDistance,
+                                                   const Real         stepDuration,
+                                                   const std::size_t  numberOfThreads = 0)
+{
+    typedef std::array<Real, 6> Vector6;
+    typedef std::vector<Real> Vector;
+
+    assert(gravitationalParameter > Real(0.0));
+    assert(windowDuration >= Real(0.0));
+    assert(screeningDistance > Real(0.0));
+    assert(stepDuration > Real(0.0));
+
+    std::vector<Conjunction<Real> > conjunctions;
+    if (numberOfObjects < 2)
+    {
+        return conjunctions;
+    }
+
+    // Compute the perigee and apogee radii, the maximum (perigee) speed and the maximum (perigee)
+    // gravitational acceleration of each object.
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfObjects));
+    Real* keplerianElements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        keplerianElements[k] = keplerianColumns[k].data();
+    }
+    convertCartesianToKeplerianElements(
+        states, keplerianElements, numberOfObjects, gravitationalParameter);
+
+    const Real parabolicTolerance = Real(10.0) * std::numeric_limits<Real>::epsilon();
+    Vector perigees(numberOfObjects);
+    Vector apogees(numberOfObjects);
+    Vector maximumSpeeds(numberOfObjects);
+    Vector maximumAccelerations(numberOfObjects);
+    std::vector<KeplerPropagator<Real, Vector6> > propagators;
+    propagators.reserve(numberOfObjects);
+    Real maximumSpeed = Real(0.0);
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        const Real semiMajorAxis = keplerianElements[semiMajorAxisIndex][i];
+        const Real eccentricity = keplerianElements[eccentricityIndex][i];
+
+        // For parabolic orbits, the semi-latus rectum is stored instead of the semi-major axis.
+        const bool isParabolic = std::fabs(eccentricity - Real(1.0)) <= parabolicTolerance;
+        perigees[i] = isParabolic ? Real(0.5) * semiMajorAxis
+                                  : semiMajorAxis * (Real(1.0) - eccentricity);
+        apogees[i] = eccentricity < Real(1.0) && !isParabolic
+                         ? semiMajorAxis * (Real(1.0) + eccentricity)
+                         : std::numeric_limits<Real>::infinity();
+        maximumSpeeds[i] = std::sqrt(gravitationalParameter
+                                     * (Real(2.0) / perigees[i]
+                                        - (isParabolic ? Real(0.0)
+                                                       : Real(1.0) / semiMajorAxis)));
+        maximumAccelerations[i] = gravitationalParameter / (perigees[i] * perigees[i]);
+        maximumSpeed = std::max(maximumSpeed, maximumSpeeds[i]);
+
+        Vector6 state;
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            state[k] = states[k][i];
+        }
+        propagators.push_back(KeplerPropagator<Real, Vector6>(state, gravitationalParameter));
+    }
+
+    const std::size_t numberOfSteps
+        = static_cast<std::size_t>(std::ceil(windowDuration / stepDuration)) + 1;
+    const Real cellSize = screeningDistance + maximumSpeed * stepDuration;
+    const Real inverseCellSize = Real(1.0) / cellSize;
+
+    // Candidate pairs, given by the object indices and the index of the step.
+    struct Candidate
+    {
+        std::size_t firstObjectIndex;
+        std::size_t secondObjectIndex;
+        std::size_t stepIndex;
+    };
+    std::vector<Candidate> candidates;
+    std::mutex candidatesMutex;
+
+    // Hash of the cell with the given (integer) coordinates.
+    const auto computeCellKey = [](const std::int64_t x, const std::int64_t y, const std::int64_t z)
+    {
+        return static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ULL
+               ^ static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4FULL
+               ^ static_cast<std::uint64_t>(z) * 0x165667B19E3779F9ULL;
+    };
+
+    // The work arrays below are allocated once per chunk of steps and reused for each step in the
+    // chunk. The steps are therefore split into a few chunks per thread, which amortizes the
+    // allocations while still balancing the load between the threads.
+    const std::size_t stepChunkSize = std::max(
+        numberOfSteps / (4 * getNumberOfThreads(numberOfThreads)), static_cast<std::size_t>(1));
+
+    executeInParallel(
+        numberOfSteps,
+        [&](const std::size_t beginStep, const std::size_t endStep)
+        {
+            std::vector<Vector> stepStates(6, Vector(numberOfObjects));
+            std::vector<std::int64_t> cells(3 * numberOfObjects);
+            std::vector<std::pair<std::uint64_t, std::size_t> > sortedKeys(numberOfObjects);
+            std::vector<Candidate> stepCandidates;
+
+            // Open-addressing hash table, mapping cell key to the range of objects in the cell
+            // in sortedKeys.
+            std::size_t tableSize = 1;
+            while (tableSize < 2 * numberOfObjects)
+            {
+                tableSize *= 2;
+            }
+            const std::size_t tableMask = tableSize - 1;
+            std::vector<std::size_t> table(tableSize);
+            const std::size_t emptySlot = std::numeric_limits<std::size_t>::max();
+
+            for (std::size_t step = beginStep; step < endStep; ++step)
+            {
+                const Real epoch = std::min(static_cast<Real>(step) * stepDuration, windowDuration);
+
+                for (std::size_t i = 0; i < numberOfObjects; ++i)
+                {
+                    const Vector6 state = propagators[i].propagate(epoch);
+                    for (std::size_t k = 0; k < 6; ++k)
+                    {
+                        stepStates[k][i] = state[k];
+                    }
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        cells[3 * i + k]
+                            = static_cast<std::int64_t>(std::floor(state[k] * inverseCellSize));
+                    }
+                    sortedKeys[i] = std::make_pair(
+                        computeCellKey(cells[3 * i], cells[3 * i + 1], cells[3 * i + 2]), i);
+                }
+                std::sort(sortedKeys.begin(), sortedKeys.end());
+
+                std::fill(table.begin(), table.end(), emptySlot);
+                for (std::size_t n = 0; n < numberOfObjects; ++n)
+                {
+                    if (n > 0 && sortedKeys[n].first == sortedKeys[n - 1].first)
+                    {
+                        continue;
+                    }
+                    std::size_t slot = static_cast<std::size_t>(
+                        sortedKeys[n].first ^ (sortedKeys[n].first >> 32)) & tableMask;
+                    while (table[slot] != emptySlot)
+                    {
+                        slot = (slot + 1) & tableMask;
+                    }
+                    table[slot] = n;
+                }
+
+                for (std::size_t i = 0; i < numberOfObjects; ++i)
+                {
+                    for (std::int64_t dx = -1; dx <= 1; ++dx)
+                    {
+                        for (std::int64_t dy = -1; dy <= 1; ++dy)
+                        {
+                            for (std::int64_t dz = -1; dz <= 1; ++dz)
+                            {
+                                const std::uint64_t key = computeCellKey(cells[3 * i] + dx,
+                                                                         cells[3 * i + 1] + dy,
+                                                                         cells[3 * i + 2] + dz);
+                                std::size_t slot
+                                    = static_cast<std::size_t>(key ^ (key >> 32)) & tableMask;
+                                while (table[slot] != emptySlot
+                                       && sortedKeys[table[slot]].first != key)
+                                {
+                                    slot = (slot + 1) & tableMask;
+                                }
+                                if (table[slot] == emptySlot)
+                                {
+                                    continue;
+                                }
+
+                                for (std::size_t n = table[slot];
+                                     n < numberOfObjects && sortedKeys[n].first == key;
+                                     ++n)
+                                {
+                                    const std::size_t j = sortedKeys[n].second;
+                                    if (j <= i
+                                        || !isPassingPerigeeApogeeFilter(perigees[i],
+                                                                         apogees[i],
+                                                                         perigees[j],
+                                                                         apogees[j],
+                                                                         screeningDistance))
+                                    {
+                                        continue;
+                                    }
+
+                                    Real position[3];
+                                    Real velocity[3];
+                                    for (std::size_t k = 0; k < 3; ++k)
+                                    {
+                                        position[k] = stepStates[k][j] - stepStates[k][i];
+                                        velocity[k] = stepStates[k + 3][j] - stepStates[k + 3][i];
+                                    }
+                                    const Real distanceSquared = position[0] * position[0]
+                                                                 + position[1] * position[1]
+                                                                 + position[2] * position[2];
+                                    const Real distanceBound
+                                        = screeningDistance + Real(0.5) * stepDuration
+                                          * (maximumSpeeds[i] + maximumSpeeds[j]);
+                                    if (distanceSquared > distanceBound * distanceBound)
+                                    {
+                                        continue;
+                                    }
+
+                                    // Distance at the closest approach of the linearly
+                                    // extrapolated relative motion, within a step of the epoch
+                                    // and within the window.
+                                    const Real speedSquared = velocity[0] * velocity[0]
+                                                              + velocity[1] * velocity[1]
+                                                              + velocity[2] * velocity[2];
+                                    const Real rangeRate = position[0] * velocity[0]
+                                                           + position[1] * velocity[1]
+                                                           + position[2] * velocity[2];
+                                    const Real linearTime = std::min(
+                                        std::max(speedSquared > Real(0.0)
+                                                     ? -rangeRate / speedSquared : Real(0.0),
+                                                 std::max(-stepDuration, -epoch)),
+                                        std::min(stepDuration, windowDuration - epoch));
+                                    const Real linearDistanceSquared
+                                        = distanceSquared + Real(2.0) * linearTime * rangeRate
+                                          + linearTime * linearTime * speedSquared;
+                                    const Real linearDistanceBound
+                                        = screeningDistance + Real(0.5) * stepDuration
+                                          * stepDuration
+                                          * (maximumAccelerations[i] + maximumAccelerations[j]);
+                                    if (linearDistanceSquared
+                                        > linearDistanceBound * linearDistanceBound)
+                                    {
+                                        continue;
+                                    }
+
+                                    Candidate candidate;
+                                    candidate.firstObjectIndex = i;
+                                    candidate.secondObjectIndex = j;
+                                    candidate.stepIndex = step;
+                                    stepCandidates.push_back(candidate);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(candidatesMutex);
+            candidates.insert(candidates.end(), stepCandidates.begin(), stepCandidates.end());
+        },
+        numberOfThreads,
+        stepChunkSize);
+
+    // Refine the TCA of each candidate pair within a step of the epoch of its step.
+    std::vector<Conjunction<Real> > refinedConjunctions(candidates.size());
+    executeInParallel(
+        candidates.size(),
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t n = begin; n < end; ++n)
+            {
+                const Candidate& candidate = candidates[n];
+                const Real epoch = std::min(
+                    static_cast<Real>(candidate.stepIndex) * stepDuration, windowDuration);
+                const Real lowerBound = std::max(epoch - stepDuration, Real(0.0));
+                const Real upperBound = std::min(epoch + stepDuration, windowDuration);
+                refinedConjunctions[n] = refineTimeOfClosestApproach(
+                    propagators[candidate.firstObjectIndex],
+                    propagators[candidate.secondObjectIndex],
+                    gravitationalParameter,
+                    epoch,
+                    lowerBound,
+                    upperBound);
+                refinedConjunctions[n].firstObjectIndex = candidate.firstObjectIndex;
+                refinedConjunctions[n].secondObjectIndex = candidate.secondObjectIndex;
+
+                // If the distance is smallest at a bound of the interval that is not a bound of
+                // the window, the TCA lies outside the interval and is found from another step.
+                const Real timeOfClosestApproach = refinedConjunctions[n].timeOfClosestApproach;
+                if ((timeOfClosestApproach == lowerBound && lowerBound > Real(0.0))
+                    || (timeOfClosestApproach == upperBound && upperBound < windowDuration))
+                {
+                    refinedConjunctions[n].missDistance = std::numeric_limits<Real>::infinity();
+                }
+            }
+        },
+        numberOfThreads,
+        16);
+
+    for (std::size_t n = 0; n < refinedConjunctions.size(); ++n)
+    {
+        if (refinedConjunctions[n].missDistance <= screeningDistance)
+        {
+            conjunctions.push_back(refinedConjunctions[n]);
+        }
+    }
+
+    // Merge conjunctions of the same pair of objects found in consecutive steps.
+    return mergeConjunctions(conjunctions, stepDuration);
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Hoots, F.R., Crawford, L.L., Roehrich, R.L. An analytic method to determine future close
+ *      approaches between satellites. Celestial Mechanics, 33(2), 143-158, 1984.
+ *  Press, W.H., et al. Numerical Recipes: The Art of Scientific Computing. Third Edition,
+ *      Cambridge University Press, 2007.
+ */
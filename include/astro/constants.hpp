@@ -12,26 +12,69 @@
 namespace astro
 {
 
+//! Physical constants.
+/*!
+ * Physical constants, templated on the real type. The constants are constexpr static data members
+ * of a class template, such that they can be used in constant expressions (e.g., to compute
+ * mission parameters at compile time), are available in single precision without promotion to
+ * double and have a single definition that is shared by all translation units.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct PhysicalConstants
+{
+    //! Gravitational constant [m^3 kg^-1 s^-2] (Standish, 1995).
+    static constexpr Real gravitationalConstant = Real(6.67259e-11);
+
+    //! Julian day in seconds (NASA, 2012).
+    static constexpr Real julianDayInSeconds = Real(86400.0);
+
+    //! Julian year in days (NASA, 2012).
+    static constexpr Real julianYearInDays = Real(365.25);
+
+    //! Julian year in seconds.
+    static constexpr Real julianYearInSeconds = Real(3.15576e7);
+
+    //! Astronautical Unit in km (NASA, 2012).
+    static constexpr Real astronomicalUnitInKilometers = Real(149597870.7);
+
+    //! Start of Gregorian epoch in Julian days (Ramsey, 2016).
+    static constexpr Real gregorianEpochInJulianDays = Real(1721425.5);
+
+    //! Speed of light [m s^-1] (Wikipedia, 2018).
+    static constexpr Real speedOfLight = Real(299792458.0);
+};
+
+template <typename Real> constexpr Real PhysicalConstants<Real>::gravitationalConstant;
+template <typename Real> constexpr Real PhysicalConstants<Real>::julianDayInSeconds;
+template <typename Real> constexpr Real PhysicalConstants<Real>::julianYearInDays;
+template <typename Real> constexpr Real PhysicalConstants<Real>::julianYearInSeconds;
+template <typename Real> constexpr Real PhysicalConstants<Real>::astronomicalUnitInKilometers;
+template <typename Real> constexpr Real PhysicalConstants<Real>::gregorianEpochInJulianDays;
+template <typename Real> constexpr Real PhysicalConstants<Real>::speedOfLight;
+
 //! Gravitational constant [m^3 s^-2] (Standish, 1995).
-const static double ASTRO_GRAVITATIONAL_CONSTANT = 6.67259e-11;
+constexpr double ASTRO_GRAVITATIONAL_CONSTANT = PhysicalConstants<double>::gravitationalConstant;
 
 //! Julian day in seconds (NASA, 2012).
-const static double ASTRO_JULIAN_DAY_IN_SECONDS = 86400.0;
+constexpr double ASTRO_JULIAN_DAY_IN_SECONDS = PhysicalConstants<double>::julianDayInSeconds;
 
 //! Julian year in days (NASA, 2012).
-const static double ASTRO_JULIAN_YEAR_IN_DAYS = 365.25;
+constexpr double ASTRO_JULIAN_YEAR_IN_DAYS = PhysicalConstants<double>::julianYearInDays;
 
 //! Julian year in seconds.
-const static double ASTRO_JULIAN_YEAR_IN_SECONDS = 3.15576e7;
+constexpr double ASTRO_JULIAN_YEAR_IN_SECONDS = PhysicalConstants<double>::julianYearInSeconds;
 
 //! Astronautical Unit in km (NASA, 2012).
-const static double ASTRO_AU_IN_KM = 149597870.7;
+constexpr double ASTRO_AU_IN_KM = PhysicalConstants<double>::astronomicalUnitInKilometers;
 
 //! Start of Gregorian epoch in Julian days (Ramsey, 2016).
-const static double ASTRO_GREGORIAN_EPOCH_IN_JULIAN_DAYS = 1721425.5;
+constexpr double ASTRO_GREGORIAN_EPOCH_IN_JULIAN_DAYS
+    = PhysicalConstants<double>::gregorianEpochInJulianDays;
 
 //! Speed of light [m s^-1] (Wikipedia, 2018).
-const static double ASTRO_SPEED_OF_LIGHT = 299792458.0;
+constexpr double ASTRO_SPEED_OF_LIGHT = PhysicalConstants<double>::speedOfLight;
 
 } // namespace astro
 
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <limits>
+
+namespace astro
+{
+
+//! Iterate Newton-Raphson algorithm for square root at compile time.
+/*!
+ * Iterates the Newton-Raphson algorithm for the square root, starting from an estimate that is
+ * larger than or equal to the square root. The iterates decrease monotonically in exact
+ * arithmetic, such that the iteration is stopped as soon as an iterate does not decrease (which
+ * guarantees termination in floating-point arithmetic).
+ *
+ * @sa computeConstexprSquareRoot
+ * @tparam Real      Real type
+ * @param  value     Value to compute square root of
+ * @param  estimate  Current estimate of square root
+ * @return           Square root of value
+ */
+template <typename Real>
+constexpr Real iterateConstexprSquareRoot(const Real value, const Real estimate)
+{
+    return Real(0.5) * (estimate + value / estimate) < estimate
+        ? iterateConstexprSquareRoot(value, Real(0.5) * (estimate + value / estimate))
+        : estimate;
+}
+
+//! Compute square root at compile time.
+/*!
+ * Computes the square root of a value in a constant expression, using the Newton-Raphson
+ * algorithm (C++11 constexpr functions cannot call std::sqrt). The result is accurate to within
+ * one unit in the last place. The initial estimate is max(value, 1), such that the number of
+ * iterations grows with the magnitude of the (base-2) exponent of the value; for the magnitudes
+ * encountered in astrodynamics, the recursion depth is well within the limits of compilers.
+ *
+ * This function is intended for use in constant expressions. At runtime, use std::sqrt instead.
+ *
+ * @tparam Real   Real type
+ * @param  value  Value to compute square root of
+ * @return        Square root of value (NaN if value is negative, NaN or infinite)
+ */
+template <typename Real>
+constexpr Real computeConstexprSquareRoot(const Real value)
+{
+    return value == Real(0.0)
+        ? value
+        : (value > Real(0.0) && value < std::numeric_limits<Real>::infinity()
+            ? iterateConstexprSquareRoot(value, value > Real(1.0) ? value : Real(1.0))
+            : std::numeric_limits<Real>::quiet_NaN());
+}
+
+} // namespace astro
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+// This header must be compiled with nvcc, using the --expt-relaxed-constexpr flag (see
+// ASTRO_HOST_DEVICE). It is therefore not included by astroAll.hpp.
+#ifndef __CUDACC__
+#error "astro/cudaBackend.hpp requires a CUDA compiler (nvcc)."
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "astro/hostDevice.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+namespace astro
+{
+
+//! Number of threads per block of the device kernels.
+const unsigned int deviceBlockSize = 256;
+
+//! Maximum number of blocks of the grid of the device kernels.
+/*!
+ * The kernels process the elements with grid-stride loops, such that a grid of this size covers
+ * catalogs of any size.
+ */
+const unsigned int maximumDeviceGridSize = 65535;
+
+//! Check CUDA error.
+/*!
+ * @param[in] error  CUDA error code
+ */
+inline void checkCudaError(const cudaError_t error)
+{
+    if (error != cudaSuccess)
+    {
+        throw std::runtime_error(std::string("ERROR: CUDA runtime error: ")
+                                 + cudaGetErrorString(error));
+    }
+}
+
+//! Compute number of blocks of grid of device kernels.
+/*!
+ * @param[in] numberOfElements  Number of elements to process
+ * @return                      Number of blocks of grid
+ */
+inline unsigned int computeDeviceGridSize(const std::size_t numberOfElements)
+{
+    const std::size_t numberOfBlocks = (numberOfElements + deviceBlockSize - 1) / deviceBlockSize;
+    return static_cast<unsigned int>(
+        std::max<std::size_t>(std::min<std::size_t>(numberOfBlocks, maximumDeviceGridSize), 1));
+}
+
+//! Columns of elements in device memory.
+/*!
+ * Structure-of-arrays layout of 6-element states (see, e.g.,
+ * convertCatalogCartesianToKeplerianElements), where column i holds element i of all states. The
+ * structure is passed to the kernels by value, since arrays of pointers cannot be passed as
+ * kernel parameters.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct DeviceElementColumns
+{
+    //! Pointers to columns in device memory.
+    Real* columns[6];
+};
+
+//! Arrays of elements in device memory.
+/*!
+ * Owns 6 columns of elements in device memory (see DeviceElementColumns), which are allocated on
+ * construction and freed on destruction. The columns are transferred from and to host memory
+ * with copyFromHost() and copyToHost(). The arrays can be reused across kernel launches, e.g.,
+ * for the batches of a Monte Carlo analysis, to avoid repeated device allocations.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class DeviceElementArrays
+{
+public:
+
+    //! Allocate arrays of elements in device memory.
+    /*!
+     * @param[in] numberOfElements  Number of elements per column
+     */
+    explicit DeviceElementArrays(const std::size_t numberOfElements)
+        : numberOfElements(numberOfElements)
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            deviceColumns.columns[i] = 0;
+        }
+
+        for (int i = 0; i < 6; ++i)
+        {
+            const cudaError_t error
+                = cudaMalloc(reinterpret_cast<void**>(&deviceColumns.columns[i]),
+                             numberOfElements * sizeof(Real));
+            if (error != cudaSuccess)
+            {
+                freeColumns();
+                checkCudaError(error);
+            }
+        }
+    }
+
+    //! Free arrays of elements in device memory.
+    ~DeviceElementArrays()
+    {
+        freeColumns();
+    }
+
+    DeviceElementArrays(const DeviceElementArrays&) = delete;
+    DeviceElementArrays& operator=(const DeviceElementArrays&) = delete;
+
+    //! Copy columns of elements from host memory.
+    /*!
+     * @param[in] hostElements  Arrays of 6 columns of elements in host memory
+     */
+    void copyFromHost(const Real* const hostElements[6])
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            checkCudaError(cudaMemcpy(deviceColumns.columns[i],
+                                      hostElements[i],
+                                      numberOfElements * sizeof(Real),
+                                      cudaMemcpyHostToDevice));
+        }
+    }
+
+    //! Copy columns of elements to host memory.
+    /*!
+     * @param[out] hostElements  Arrays of 6 columns of elements in host memory
+     */
+    void copyToHost(Real* const hostElements[6]) const
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            checkCudaError(cudaMemcpy(hostElements[i],
+                                      deviceColumns.columns[i],
+                                      numberOfElements * sizeof(Real),
+                                      cudaMemcpyDeviceToHost));
+        }
+    }
+
+    //! Get columns of elements in device memory.
+    /*!
+     * @return  Pointers to columns in device memory
+     */
+    DeviceElementColumns<Real> getColumns() const { return deviceColumns; }
+
+    //! Get number of elements per column.
+    /*!
+     * @return  Number of elements per column
+     */
+    std::size_t getNumberOfElements() const { return numberOfElements; }
+
+private:
+
+    //! Free columns in device memory.
+    void freeColumns()
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            if (deviceColumns.columns[i] != 0)
+            {
+                cudaFree(deviceColumns.columns[i]);
+                deviceColumns.columns[i] = 0;
+            }
+        }
+    }
+
+    //! Number of elements per column.
+    const std::size_t numberOfElements;
+
+    //! Columns in device memory.
+    DeviceElementColumns<Real> deviceColumns;
+};
+
+//! Kernel to convert columns of Cartesian elements to Keplerian elements.
+/*!
+ * @sa convertCartesianToKeplerianElements
+ * @tparam     Real                    Real type
+ * @param[in]  cartesianElements       Columns of Cartesian elements                [m, m/s]
+ * @param[out] keplerianElements       Columns of Keplerian elements                [m, -, rad]
+ * @param[in]  numberOfElements        Number of elements per column
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body      [m^3 s^-2]
+ * @param[in]  tolerance               Tolerance for limit cases                    [-]
+ */
+template <typename Real>
+__global__ void convertCartesianToKeplerianElementsKernel(
+    const DeviceElementColumns<Real> cartesianElements,
+    const DeviceElementColumns<Real> keplerianElements,
+    const std::size_t numberOfElements,
+    const Real gravitationalParameter,
+    const Real tolerance)
+{
+    const std::size_t stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+    for (std::size_t j = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+         j < numberOfElements;
+         j += stride)
+    {
+        Real cartesianState[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            cartesianState[i] = cartesianElements.columns[i][j];
+        }
+
+        Real keplerianState[6];
+        convertCartesianToKeplerianElements(
+            cartesianState, gravitationalParameter, keplerianState, tolerance);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            keplerianElements.columns[i][j] = keplerianState[i];
+        }
+    }
+}
+
+//! Kernel to convert columns of Keplerian elements to Cartesian elements.
+/*!
+ * @sa convertKeplerianToCartesianElements
+ * @tparam     Real                    Real type
+ * @param[in]  keplerianElements       Columns of Keplerian elements                [m, -, rad]
+ * @param[out] cartesianElements       Columns of Cartesian elements                [m, m/s]
+ * @param[in]  numberOfElements        Number of elements per column
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body      [m^3 s^-2]
+ * @param[in]  tolerance               Tolerance for parabolic orbits               [-]
+ */
+template <typename Real>
+__global__ void convertKeplerianToCartesianElementsKernel(
+    const DeviceElementColumns<Real> keplerianElements,
+    const DeviceElementColumns<Real> cartesianElements,
+    const std::size_t numberOfElements,
+    const Real gravitationalParameter,
+    const Real tolerance)
+{
+    const std::size_t stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+    for (std::size_t j = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+         j < numberOfElements;
+         j += stride)
+    {
+        Real keplerianState[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            keplerianState[i] = keplerianElements.columns[i][j];
+        }
+
+        Real cartesianState[6];
+        convertKeplerianToCartesianElements(
+            keplerianState, gravitationalParameter, cartesianState, tolerance);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            cartesianElements.columns[i][j] = cartesianState[i];
+        }
+    }
+}
+
+//! Kernel to propagate columns of Keplerian elements and convert them to Cartesian elements.
+/*!
+ * @sa propagateKeplerianElements
+ * @tparam     Real                    Real type
+ * @param[in]  keplerianElements       Columns of Keplerian elements of elliptical orbits
+ *                                                                                  [m, -, rad]
+ * @param[out] cartesianElements       Columns of propagated Cartesian elements     [m, m/s]
+ * @param[in]  numberOfElements        Number of elements per column
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body      [m^3 s^-2]
+ * @param[in]  timeOfFlight            Time-of-flight                               [s]
+ */
+template <typename Real>
+__global__ void propagateKeplerianToCartesianElementsKernel(
+    const DeviceElementColumns<Real> keplerianElements,
+    const DeviceElementColumns<Real> cartesianElements,
+    const std::size_t numberOfElements,
+    const Real gravitationalParameter,
+    const Real timeOfFlight)
+{
+    const std::size_t stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+    for (std::size_t j = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+         j < numberOfElements;
+         j += stride)
+    {
+        Real keplerianState[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            keplerianState[i] = keplerianElements.columns[i][j];
+        }
+
+        propagateKeplerianElements(
+            keplerianState, gravitationalParameter, timeOfFlight, keplerianState);
+
+        Real cartesianState[6];
+        convertKeplerianToCartesianElements(
+            keplerianState, gravitationalParameter, cartesianState);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            cartesianElements.columns[i][j] = cartesianState[i];
+        }
+    }
+}
+
+//! Convert catalog of Cartesian elements to Keplerian elements on device.
+/*!
+ * Converts a catalog of Cartesian elements in device memory to Keplerian elements, using one
+ * device thread per object. The kernel is launched asynchronously on the given stream; launch
+ * errors are reported by throwing a runtime exception.
+ *
+ * @sa convertCatalogCartesianToKeplerianElements, DeviceElementArrays
+ * @tparam     Real                    Real type
+ * @param[in]  cartesianElements       Columns of Cartesian elements in device memory  [m, m/s]
+ * @param[out] keplerianElements       Columns of Keplerian elements in device memory  [m, -, rad]
+ * @param[in]  numberOfObjects         Number of objects in catalog
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body         [m^3 s^-2]
+ * @param[in]  stream                  CUDA stream to launch kernel on
+ * @param[in]  tolerance               Tolerance for limit cases                       [-]
+ */
+template <typename Real>
+void convertCatalogCartesianToKeplerianElementsOnDevice(
+    const DeviceElementColumns<Real>& cartesianElements,
+    const DeviceElementColumns<Real>& keplerianElements,
+    const std::size_t numberOfObjects,
+    const Real gravitationalParameter,
+    const cudaStream_t stream = 0,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    if (numberOfObjects == 0)
+    {
+        return;
+    }
+
+    convertCartesianToKeplerianElementsKernel<Real>
+        <<<computeDeviceGridSize(numberOfObjects), deviceBlockSize, 0, stream>>>(
+            cartesianElements, keplerianElements, numberOfObjects, gravitationalParameter,
+            tolerance);
+    checkCudaError(cudaGetLastError());
+}
+
+//! Convert catalog of Keplerian elements to Cartesian elements on device.
+/*!
+ * Converts a catalog of Keplerian elements in device memory to Cartesian elements, using one
+ * device thread per object. The kernel is launched asynchronously on the given stream; launch
+ * errors are reported by throwing a runtime exception.
+ *
+ * @sa convertCatalogKeplerianToCartesianElements, DeviceElementArrays
+ * @tparam     Real                    Real type
+ * @param[in]  keplerianElements       Columns of Keplerian elements in device memory  [m, -, rad]
+ * @param[out] cartesianElements       Columns of Cartesian elements in device memory  [m, m/s]
+ * @param[in]  numberOfObjects         Number of objects in catalog
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body         [m^3 s^-2]
+ * @param[in]  stream                  CUDA stream to launch kernel on
+ * @param[in]  tolerance               Tolerance for parabolic orbits                  [-]
+ */
+template <typename Real>
+void convertCatalogKeplerianToCartesianElementsOnDevice(
+    const DeviceElementColumns<Real>& keplerianElements,
+    const DeviceElementColumns<Real>& cartesianElements,
+    const std::size_t numberOfObjects,
+    const Real gravitationalParameter,
+    const cudaStream_t stream = 0,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    if (numberOfObjects == 0)
+    {
+        return;
+    }
+
+    convertKeplerianToCartesianElementsKernel<Real>
+        <<<computeDeviceGridSize(numberOfObjects), deviceBlockSize, 0, stream>>>(
+            keplerianElements, cartesianElements, numberOfObjects, gravitationalParameter,
+            tolerance);
+    checkCudaError(cudaGetLastError());
+}
+
+//! Propagate ensemble of Keplerian elements to Cartesian elements on device.
+/*!
+ * Propagates an ensemble of Keplerian elements of elliptical orbits in device memory (e.g., the
+ * dispersed samples of a Monte Carlo analysis) by a given time-of-flight and converts the
+ * propagated elements to Cartesian elements, using one device thread per sample (see
+ * propagateKeplerianElements). The kernel is launched asynchronously on the given stream; launch
+ * errors are reported by throwing a runtime exception.
+ *
+ * @sa propagateKeplerianElements, DeviceElementArrays
+ * @tparam     Real                    Real type
+ * @param[in]  keplerianElements       Columns of Keplerian elements in device memory  [m, -, rad]
+ * @param[out] cartesianElements       Columns of propagated Cartesian elements in device
+ *                                     memory                                          [m, m/s]
+ * @param[in]  numberOfSamples         Number of samples in ensemble
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body         [m^3 s^-2]
+ * @param[in]  timeOfFlight            Time-of-flight                                  [s]
+ * @param[in]  stream                  CUDA stream to launch kernel on
+ */
+template <typename Real>
+void propagateEnsembleOnDevice(const DeviceElementColumns<Real>& keplerianElements,
+                               const DeviceElementColumns<Real>& cartesianElements,
+                               const std::size_t                 numberOfSamples,
+                               const Real                        gravitationalParameter,
+                               const Real                        timeOfFlight,
+                               const cudaStream_t                stream = 0)
+{
+    if (numberOfSamples == 0)
+    {
+        return;
+    }
+
+    propagateKeplerianToCartesianElementsKernel<Real>
+        <<<computeDeviceGridSize(numberOfSamples), deviceBlockSize, 0, stream>>>(
+            keplerianElements, cartesianElements, numberOfSamples, gravitationalParameter,
+            timeOfFlight);
+    checkCudaError(cudaGetLastError());
+}
+
+} // namespace astro
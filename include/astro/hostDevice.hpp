@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+//! Mark function as callable from both host and device code.
+/*!
+ * Expands to __host__ __device__ when the headers are compiled by a CUDA or HIP compiler, and to
+ * nothing otherwise, such that host-only builds are unaffected.
+ *
+ * The functions that are marked with this macro form the device-compatible subset of the library:
+ * the output-vector overloads of the element conversions and acceleration models, the anomaly
+ * conversions, the root-finders and the Keplerian element propagator (propagateKeplerianElements).
+ * These functions do not allocate memory, do not throw exceptions and only check their
+ * preconditions with assert, which is supported in device code. Their instrumentation hooks are
+ * discarded in device code (see ASTRO_INSTRUMENT).
+ *
+ * The marked functions call std::numeric_limits, std::min and std::max, which are constexpr
+ * functions of the standard library. Device builds therefore require the
+ * --expt-relaxed-constexpr flag of nvcc.
+ *
+ * The functions that return newly constructed vectors, or that throw exceptions (e.g., the scalar
+ * Newton-Raphson solvers of Kepler's equation), are not marked and remain host-only.
+ */
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define ASTRO_HOST_DEVICE __host__ __device__
+#else
+#define ASTRO_HOST_DEVICE
+#endif
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef ASTRO_ENABLE_INSTRUMENTATION
+#include <mutex>
+#include <vector>
+#endif
+
+//! Execute instrumentation statement(s), if instrumentation is enabled.
+/*!
+ * Instrumentation is enabled by defining ASTRO_ENABLE_INSTRUMENTATION before including any of the
+ * headers (typically as a compiler flag, i.e., -DASTRO_ENABLE_INSTRUMENTATION). If it is not
+ * defined, the statements are discarded by the preprocessor, such that instrumentation has no
+ * run-time cost and does not affect the vectorization of the batch kernels.
+ *
+ * Since the definition changes the instrumented functions, it must be the same for all
+ * translation units of a program. The statements are always discarded in device code (see
+ * ASTRO_HOST_DEVICE), since the counters are thread-local host variables.
+ */
+#if defined(ASTRO_ENABLE_INSTRUMENTATION) && !defined(__CUDA_ARCH__) \
+    && !defined(__HIP_DEVICE_COMPILE__)
+#define ASTRO_INSTRUMENT(...) do { __VA_ARGS__; } while (false)
+#else
+#define ASTRO_INSTRUMENT(...) do { } while (false)
+#endif
+
+namespace astro
+{
+
+//! Flag indicating if instrumentation is enabled.
+#ifdef ASTRO_ENABLE_INSTRUMENTATION
+const bool isInstrumentationEnabled = true;
+#else
+const bool isInstrumentationEnabled = false;
+#endif
+
+//! Number of bins of iteration histograms.
+/*!
+ * Bin i counts the solves that took i iterations, except for the last bin, which counts all
+ * solves that took numberOfIterationHistogramBins - 1 iterations or more.
+ */
+const std::size_t numberOfIterationHistogramBins = 32;
+
+//! Instrumentation counters of a root-finding solver.
+/*!
+ * For scalar solvers a solve is a single call. For batch solvers a solve is a block of elements
+ * that is iterated until all of its elements have converged, so that the number of iterations of
+ * a solve is the number of passes of the (masked) update over the block, which is set by the
+ * slowest element. The number of non-convergences counts the elements that did not converge
+ * within the maximum number of iterations.
+ */
+struct SolverCounters
+{
+    //! Number of solves.
+    std::uint64_t numberOfSolves;
+
+    //! Total number of iterations of all solves.
+    std::uint64_t numberOfIterations;
+
+    //! Number of elements that did not converge.
+    std::uint64_t numberOfNonConvergences;
+
+    //! Histogram of number of iterations per solve.
+    std::uint64_t iterationHistogram[numberOfIterationHistogramBins];
+
+    //! Record solve.
+    /*!
+     * @param[in] iterations       Number of iterations of solve
+     * @param[in] nonConvergences  Number of elements of solve that did not converge
+     */
+    void recordSolve(const std::size_t iterations, const std::size_t nonConvergences)
+    {
+        ++numberOfSolves;
+        numberOfIterations += iterations;
+        numberOfNonConvergences += nonConvergences;
+        ++iterationHistogram[std::min(iterations, numberOfIterationHistogramBins - 1)];
+    }
+
+    //! Add counters of other solver.
+    SolverCounters& operator+=(const SolverCounters& counters)
+    {
+        numberOfSolves += counters.numberOfSolves;
+        numberOfIterations += counters.numberOfIterations;
+        numberOfNonConvergences += counters.numberOfNonConvergences;
+        for (std::size_t i = 0; i < numberOfIterationHistogramBins; ++i)
+        {
+            iterationHistogram[i] += counters.iterationHistogram[i];
+        }
+        return *this;
+    }
+};
+
+//! Instrumentation counters of the limit cases of the Cartesian to Keplerian element conversion.
+/*!
+ * Counts the conversions (scalar and batch, per element) and how often each of the limit cases
+ * occurs, for which the undefined elements are set to NaN or to zero (see
+ * convertCartesianToKeplerianElements).
+ */
+struct CartesianToKeplerianElementCounters
+{
+    //! Number of conversions.
+    std::uint64_t numberOfConversions;
+
+    //! Number of parabolic orbits.
+    std::uint64_t numberOfParabolicOrbits;
+
+    //! Number of elliptical (non-circular) equatorial orbits.
+    std::uint64_t numberOfEllipticalEquatorialOrbits;
+
+    //! Number of circular inclined orbits.
+    std::uint64_t numberOfCircularInclinedOrbits;
+
+    //! Number of circular equatorial orbits.
+    std::uint64_t numberOfCircularEquatorialOrbits;
+
+    //! Add counters of other conversions.
+    CartesianToKeplerianElementCounters& operator+=(
+        const CartesianToKeplerianElementCounters& counters)
+    {
+        numberOfConversions += counters.numberOfConversions;
+        numberOfParabolicOrbits += counters.numberOfParabolicOrbits;
+        numberOfEllipticalEquatorialOrbits += counters.numberOfEllipticalEquatorialOrbits;
+        numberOfCircularInclinedOrbits += counters.numberOfCircularInclinedOrbits;
+        numberOfCircularEquatorialOrbits += counters.numberOfCircularEquatorialOrbits;
+        return *this;
+    }
+};
+
+//! Instrumentation counters.
+/*!
+ * Plain aggregate of all instrumentation counters, which value-initializes to zero, e.g.,
+ * InstrumentationCounters counters = InstrumentationCounters(). This is the type of the snapshot
+ * returned by collectInstrumentationCounters(), which can be exported to a metrics system.
+ */
+struct InstrumentationCounters
+{
+    //! Counters of scalar elliptical mean to eccentric anomaly conversion.
+    SolverCounters ellipticalKeplerSolver;
+
+    //! Counters of batch elliptical mean to eccentric anomaly conversion.
+    SolverCounters ellipticalKeplerBatchSolver;
+
+    //! Counters of scalar hyperbolic mean to hyperbolic eccentric anomaly conversion.
+    SolverCounters hyperbolicKeplerSolver;
+
+    //! Counters of batch hyperbolic mean to hyperbolic eccentric anomaly conversion.
+    SolverCounters hyperbolicKeplerBatchSolver;
+
+    //! Counters of universal Kepler equation solver of Kepler propagator.
+    SolverCounters universalKeplerSolver;
+
+    //! Counters of limit cases of Cartesian to Keplerian element conversion.
+    CartesianToKeplerianElementCounters cartesianToKeplerianElements;
+
+    //! Add counters of other thread.
+    InstrumentationCounters& operator+=(const InstrumentationCounters& counters)
+    {
+        ellipticalKeplerSolver += counters.ellipticalKeplerSolver;
+        ellipticalKeplerBatchSolver += counters.ellipticalKeplerBatchSolver;
+        hyperbolicKeplerSolver += counters.hyperbolicKeplerSolver;
+        hyperbolicKeplerBatchSolver += counters.hyperbolicKeplerBatchSolver;
+        universalKeplerSolver += counters.universalKeplerSolver;
+        cartesianToKeplerianElements += counters.cartesianToKeplerianElements;
+        return *this;
+    }
+};
+
+#ifdef ASTRO_ENABLE_INSTRUMENTATION
+
+//! Registry of instrumentation counters of all threads.
+/*!
+ * Keeps track of the counters of the running threads, and accumulates the counters of threads
+ * that have exited (e.g., the worker threads of executeInParallel()).
+ */
+struct InstrumentationRegistry
+{
+    //! Mutex guarding registry.
+    std::mutex mutex;
+
+    //! Counters of running threads.
+    std::vector<InstrumentationCounters*> threadCounters;
+
+    //! Accumulated counters of exited threads.
+    InstrumentationCounters exitedThreadCounters;
+};
+
+//! Get registry of instrumentation counters.
+inline InstrumentationRegistry& getInstrumentationRegistry()
+{
+    static InstrumentationRegistry registry;
+    return registry;
+}
+
+//! Thread-local instrumentation counters, which register themselves with the registry.
+struct ThreadInstrumentationCounters
+{
+    //! Counters of thread.
+    InstrumentationCounters counters;
+
+    //! Register counters of thread.
+    ThreadInstrumentationCounters()
+        : counters()
+    {
+        InstrumentationRegistry& registry = getInstrumentationRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threadCounters.push_back(&counters);
+    }
+
+    //! Deregister counters of thread and add them to counters of exited threads.
+    ~ThreadInstrumentationCounters()
+    {
+        InstrumentationRegistry& registry = getInstrumentationRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.exitedThreadCounters += counters;
+        registry.threadCounters.erase(std::find(
+            registry.threadCounters.begin(), registry.threadCounters.end(), &counters));
+    }
+};
+
+//! Get instrumentation counters of calling thread.
+/*!
+ * Returns the thread-local counters that are updated by the instrumented functions. Since each
+ * thread updates its own counters, the hot paths do not require any synchronization.
+ *
+ * @return  Instrumentation counters of calling thread
+ */
+inline InstrumentationCounters& getThreadInstrumentationCounters()
+{
+    static thread_local ThreadInstrumentationCounters threadCounters;
+    return threadCounters.counters;
+}
+
+#endif // ASTRO_ENABLE_INSTRUMENTATION
+
+//! Collect instrumentation counters of all threads.
+/*!
+ * Returns the sum of the counters of all threads that have executed instrumented functions,
+ * including threads that have exited. The counters of running threads are read without
+ * synchronization, so this function must only be called when no other thread is executing
+ * instrumented functions, e.g., after a parallel batch has completed. If instrumentation is
+ * disabled, all counters are zero.
+ *
+ * @return  Sum of instrumentation counters of all threads
+ */
+inline InstrumentationCounters collectInstrumentationCounters()
+{
+    InstrumentationCounters counters = InstrumentationCounters();
+#ifdef ASTRO_ENABLE_INSTRUMENTATION
+    InstrumentationRegistry& registry = getInstrumentationRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    counters += registry.exitedThreadCounters;
+    for (std::size_t i = 0; i < registry.threadCounters.size(); ++i)
+    {
+        counters += *registry.threadCounters[i];
+    }
+#endif
+    return counters;
+}
+
+//! Reset instrumentation counters of all threads.
+/*!
+ * Sets the counters of all threads to zero, including the accumulated counters of threads that
+ * have exited. The same restriction as for collectInstrumentationCounters() applies.
+ */
+inline void resetInstrumentationCounters()
+{
+#ifdef ASTRO_ENABLE_INSTRUMENTATION
+    InstrumentationRegistry& registry = getInstrumentationRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.exitedThreadCounters = InstrumentationCounters();
+    for (std::size_t i = 0; i < registry.threadCounters.size(); ++i)
+    {
+        *registry.threadCounters[i] = InstrumentationCounters();
+    }
+#endif
+}
+
+} // namespace astro
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace astro
+{
+
+//! Butcher tableau for Dormand-Prince 5(4) embedded Runge-Kutta method.
+/*!
+ * Butcher tableau for the 7-stage Dormand-Prince 5(4) embedded Runge-Kutta method
+ * (Dormand and Prince, 1980). The solution is propagated using the 5th-order weights and the
+ * 4th-order weights are used to estimate the local truncation error.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct DormandPrince54Tableau
+{
+    //! Number of stages.
+    static const std::size_t numberOfStages = 7;
+
+    //! Order of embedded solution used for error estimate.
+    static const int lowerOrder = 4;
+
+    //! Nodes.
+    static const Real c[numberOfStages];
+
+    //! Runge-Kutta matrix (strictly lower-triangular).
+    static const Real a[numberOfStages][numberOfStages];
+
+    //! Weights of propagated (higher-order) solution.
+    static const Real b[numberOfStages];
+
+    //! Difference between weights of propagated and embedded solutions.
+    static const Real bError[numberOfStages];
+};
+
+template <typename Real>
+const Real DormandPrince54Tableau<Real>::c[7]
+    = {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0};
+
+template <typename Real>
+const Real DormandPrince54Tableau<Real>::a[7][7]
+    = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+       {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0},
+       {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0,
+        0.0, 0.0},
+       {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0}};
+
+template <typename Real>
+const Real DormandPrince54Tableau<Real>::b[7]
+    = {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0};
+
+template <typename Real>
+const Real DormandPrince54Tableau<Real>::bError[7]
+    = {35.0 / 384.0 - 5179.0 / 57600.0,
+       0.0,
+       500.0 / 1113.0 - 7571.0 / 16695.0,
+       125.0 / 192.0 - 393.0 / 640.0,
+       -2187.0 / 6784.0 + 92097.0 / 339200.0,
+       11.0 / 84.0 - 187.0 / 2100.0,
+       -1.0 / 40.0};
+
+//! Butcher tableau for Runge-Kutta-Fehlberg 7(8) embedded Runge-Kutta method.
+/*!
+ * Butcher tableau for the 13-stage Runge-Kutta-Fehlberg 7(8) embedded Runge-Kutta method
+ * (Fehlberg, 1968). The solution is propagated using the 8th-order weights (local extrapolation)
+ * and the 7th-order weights are used to estimate the local truncation error.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct RungeKuttaFehlberg78Tableau
+{
+    //! Number of stages.
+    static const std::size_t numberOfStages = 13;
+
+    //! Order of embedded solution used for error estimate.
+    static const int lowerOrder = 7;
+
+    //! Nodes.
+    static const Real c[numberOfStages];
+
+    //! Runge-Kutta matrix (strictly lower-triangular).
+    static const Real a[numberOfStages][numberOfStages];
+
+    //! Weights of propagated (higher-order) solution.
+    static const Real b[numberOfStages];
+
+    //! Difference between weights of propagated and embedded solutions.
+    static const Real bError[numberOfStages];
+};
+
+template <typename Real>
+const Real RungeKuttaFehlberg78Tableau<Real>::c[13]
+    = {0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0,
+       2.0 / 3.0, 1.0 / 3.0, 1.0, 0.0, 1.0};
+
+template <typename Real>
+const Real RungeKuttaFehlberg78Tableau<Real>::a[13][13]
+    = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {2.0 / 27.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 36.0, 1.0 / 12.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 24.0, 0.0, 1.0 / 8.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+       {-25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 0.0},
+       {31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0},
+       {2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0, 0.0, 0.0, 0.0,
+        0.0, 0.0},
+       {-91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0,
+        17.0 / 6.0, -1.0 / 12.0, 0.0, 0.0, 0.0, 0.0},
+       {2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0,
+        2133.0 / 4100.0, 45.0 / 82.0, 45.0 / 164.0, 18.0 / 41.0, 0.0, 0.0, 0.0},
+       {3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0, 3.0 / 41.0,
+        6.0 / 41.0, 0.0, 0.0, 0.0},
+       {-1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0,
+        2193.0 / 4100.0, 51.0 / 82.0, 33.0 / 164.0, 12.0 / 41.0, 0.0, 1.0, 0.0}};
+
+template <typename Real>
+const Real RungeKuttaFehlberg78Tableau<Real>::b[13]
+    = {0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0,
+       0.0, 41.0 / 840.0, 41.0 / 840.0};
+
+template <typename Real>
+const Real RungeKuttaFehlberg78Tableau<Real>::bError[13]
+    = {-41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -41.0 / 840.0, 41.0 / 840.0,
+       41.0 / 840.0};
+
+//! Classical 4th-order Runge-Kutta integrator.
+/*!
+ * Fixed-step integrator based on the classical 4th-order Runge-Kutta method.
+ *
+ * The dynamics are given by a functor with the following call signature:
+ *
+ * \code
+ *      void operator()(const Real time, const Real* state, Real* stateDerivative) const
+ * \endcode
+ *
+ * where state and stateDerivative point to arrays of length Dimension. The stage buffers are
+ * members of the integrator, i.e., no memory is allocated during integration. The functor is
+ * passed as a template parameter, such that calls to the dynamics are resolved at compile-time.
+ *
+ * States are passed as any type that provides operator[] (e.g., std::vector, std::array, raw
+ * arrays).
+ *
+ * @tparam Real       Real type
+ * @tparam Dimension  Dimension of state vector
+ */
+template <typename Real, std::size_t Dimension>
+class RungeKutta4Integrator
+{
+public:
+
+    //! Execute integration step.
+    /*!
+     * Executes a single integration step and updates the time and state.
+     *
+     * @tparam        Dynamics  Dynamics functor type
+     * @tparam        State     State vector type
+     * @param[in]     dynamics  Dynamics functor
+     * @param[in,out] time      Time, updated to end of step                          [s]
+     * @param[in,out] state     State vector, updated to end of step                  [-]
+     * @param[in]     stepSize  Step size (negative for backward integration)         [s]
+     */
+    template <typename Dynamics, typename State>
+    void step(const Dynamics& dynamics, Real& time, State& state, const Real stepSize)
+    {
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            initialState[i] = state[i];
+        }
+
+        dynamics(time, initialState, stageDerivatives[0]);
+
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            stageState[i] = initialState[i] + Real(0.5) * stepSize * stageDerivatives[0][i];
+        }
+        dynamics(time + Real(0.5) * stepSize, stageState, stageDerivatives[1]);
+
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            stageState[i] = initialState[i] + Real(0.5) * stepSize * stageDerivatives[1][i];
+        }
+        dynamics(time + Real(0.5) * stepSize, stageState, stageDerivatives[2]);
+
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            stageState[i] = initialState[i] + stepSize * stageDerivatives[2][i];
+        }
+        dynamics(time + stepSize, stageState, stageDerivatives[3]);
+
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            state[i] = initialState[i]
+                       + stepSize / Real(6.0) * (stageDerivatives[0][i]
+                                                 + Real(2.0) * stageDerivatives[1][i]
+                                                 + Real(2.0) * stageDerivatives[2][i]
+                                                 + stageDerivatives[3][i]);
+        }
+
+        time += stepSize;
+    }
+
+    //! Integrate to end time.
+    /*!
+     * Integrates from the given time to the end time using fixed steps. The last step is
+     * shortened if required to end exactly at the end time.
+     *
+     * @tparam        Dynamics  Dynamics functor type
+     * @tparam        State     State vector type
+     * @param[in]     dynamics  Dynamics functor
+     * @param[in,out] time      Time, updated to end time                             [s]
+     * @param[in,out] state     State vector, updated to end time                     [-]
+     * @param[in]     endTime   End time                                              [s]
+     * @param[in]     stepSize  Step size (magnitude)                                 [s]
+     */
+    template <typename Dynamics, typename State>
+    void integrate(const Dynamics& dynamics,
+                   Real& time,
+                   State& state,
+                   const Real endTime,
+                   const Real stepSize)
+    {
+        assert(stepSize > Real(0.0));
+
+        const Real direction = endTime < time ? Real(-1.0) : Real(1.0);
+        while (direction * (endTime - time) > Real(0.0))
+        {
+            const Real remainingTime = direction * (endTime - time);
+            const bool isLastStep = remainingTime <= stepSize;
+            step(dynamics, time, state, direction * std::min(stepSize, remainingTime));
+            if (isLastStep)
+            {
+                time = endTime;
+            }
+        }
+    }
+
+private:
+
+    //! State at start of step.
+    Real initialState[Dimension];
+
+    //! State at intermediate stage.
+    Real stageState[Dimension];
+
+    //! State derivatives at stages.
+    Real stageDerivatives[4][Dimension];
+};
+
+//! Embedded Runge-Kutta integrator with adaptive step size control.
+/*!
+ * Variable-step integrator based on an embedded Runge-Kutta method, e.g., Dormand-Prince 5(4)
+ * (DormandPrince54Tableau) or Runge-Kutta-Fehlberg 7(8) (RungeKuttaFehlberg78Tableau).
+ *
+ * The local truncation error is estimated as the difference between the propagated and embedded
+ * solutions. A step is accepted if the scaled error norm,
+ *
+ * \f[
+ *      \epsilon = \max_{i} \frac{|e_{i}|}{\epsilon_{abs} + \epsilon_{rel} \max(|y_{i}|, |y'_{i}|)}
+ * \f]
+ *
+ * does not exceed 1. The next step size is computed as
+ * \f$h' = h \min(f_{max}, \max(f_{min}, s \epsilon^{-1/(q + 1)}))\f$, where \f$q\f$ is the order of
+ * the embedded solution and \f$s\f$ is a safety factor (Hairer et al., 1993).
+ *
+ * The dynamics functor has the same call signature as for RungeKutta4Integrator. The stage buffers
+ * are members of the integrator, i.e., no memory is allocated during integration.
+ *
+ * @sa RungeKutta4Integrator
+ * @tparam Real       Real type
+ * @tparam Dimension  Dimension of state vector
+ * @tparam Tableau    Butcher tableau of embedded Runge-Kutta method
+ */
+template <typename Real, std::size_t Dimension, typename Tableau>
+class EmbeddedRungeKuttaIntegrator
+{
+public:
+
+    //! Construct embedded Runge-Kutta integrator.
+    /*!
+     * Constructs embedded Runge-Kutta integrator with given error tolerances and step size limits.
+     *
+     * @param[in] relativeTolerance  Relative error tolerance                          [-]
+     * @param[in] absoluteTolerance  Absolute error tolerance                          [-]
+     * @param[in] minimumStepSize    Minimum step size (magnitude)                     [s]
+     * @param[in] maximumStepSize    Maximum step size (magnitude)                     [s]
+     * @param[in] safetyFactor       Safety factor for step size control               [-]
+     */
+    EmbeddedRungeKuttaIntegrator(const Real relativeTolerance = Real(1.0e-12),
+                                 const Real absoluteTolerance = Real(1.0e-12),
+                                 const Real minimumStepSize = Real(1.0e-10),
+                                 const Real maximumStepSize = std::numeric_limits<Real>::max(),
+                                 const Real safetyFactor = Real(0.9))
+        : relativeTolerance(relativeTolerance),
+          absoluteTolerance(absoluteTolerance),
+          minimumStepSize(minimumStepSize),
+          maximumStepSize(maximumStepSize),
+          safetyFactor(safetyFactor)
+    {
+        assert(relativeTolerance > Real(0.0) || absoluteTolerance > Real(0.0));
+        assert(minimumStepSize > Real(0.0) && maximumStepSize >= minimumStepSize);
+    }
+
+    //! Attempt integration step.
+    /*!
+     * Attempts a single integration step. If the step is accepted, the time and state are updated.
+     * In both cases, the step size is updated to the step size proposed for the next step.
+     *
+     * @tparam        Dynamics  Dynamics functor type
+     * @tparam        State     State vector type
+     * @param[in]     dynamics  Dynamics functor
+     * @param[in,out] time      Time, updated to end of step if accepted              [s]
+     * @param[in,out] state     State vector, updated to end of step if accepted      [-]
+     * @param[in,out] stepSize  Step size, updated to proposed step size              [s]
+     * @return                  Flag indicating if step was accepted                  [-]
+     */
+    template <typename Dynamics, typename State>
+    bool step(const Dynamics& dynamics, Real& time, State& state, Real& stepSize)
+    {
+        const std::size_t numberOfStages = Tableau::numberOfStages;
+
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            initialState[i] = state[i];
+        }
+
+        // Compute stage derivatives.
+        dynamics(time, initialState, stageDerivatives[0]);
+        for (std::size_t stage = 1; stage < numberOfStages; ++stage)
+        {
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+                Real increment = Real(0.0);
+                for (std::size_t j = 0; j < stage; ++j)
+                {
+                    increment += Tableau::a[stage][j] * stageDerivatives[j][i];
+                }
+                stageState[i] = initialState[i] + stepSize * increment;
+            }
+            dynamics(time + Tableau::c[stage] * stepSize, stageState, stageDerivatives[stage]);
+        }
+
+        // Compute propagated solution and scaled error norm.
+        Real errorNorm = Real(0.0);
+        for (std::size_t i = 0; i < Dimension; ++i)
+        {
+            Real increment = Real(0.0);
+            Real error = Real(0.0);
+            for (std::size_t j = 0; j < numberOfStages; ++j)
+            {
+                increment += Tableau::b[j] * stageDerivatives[j][i];
+                error += Tableau::bError[j] * stageDerivatives[j][i];
+            }
+            stageState[i] = initialState[i] + stepSize * increment;
+
+            const Real scale = absoluteTolerance
+                               + relativeTolerance * std::max(std::fabs(initialState[i]),
+                                                              std::fabs(stageState[i]));
+            errorNorm = std::max(errorNorm, std::fabs(stepSize * error) / scale);
+        }
+
+        const bool isAccepted = errorNorm <= Real(1.0);
+        if (isAccepted)
+        {
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+                state[i] = stageState[i];
+            }
+            time += stepSize;
+        }
+
+        // Compute proposed step size.
+        const Real maximumFactor = Real(5.0);
+        const Real minimumFactor = Real(0.2);
+        const Real factor
+            = errorNorm > Real(0.0)
+              ? std::min(maximumFactor,
+                         std::max(minimumFactor,
+                                  safetyFactor
+                                  * std::pow(errorNorm, Real(-1) / Real(Tableau::lowerOrder + 1))))
+              : maximumFactor;
+        const Real direction = stepSize < Real(0.0) ? Real(-1.0) : Real(1.0);
+        stepSize = direction * std::min(maximumStepSize, std::fabs(stepSize) * factor);
+
+        return isAccepted;
+    }
+
+    //! Integrate to end time.
+    /*!
+     * Integrates from the given time to the end time using adaptive steps. The last step is
+     * shortened if required to end exactly at the end time.
+     *
+     * If the proposed step size drops below the minimum step size, a runtime exception is thrown.
+     *
+     * @tparam        Dynamics  Dynamics functor type
+     * @tparam        State     State vector type
+     * @param[in]     dynamics  Dynamics functor
+     * @param[in,out] time      Time, updated to end time                             [s]
+     * @param[in,out] state     State vector, updated to end time                     [-]
+     * @param[in]     endTime   End time                                              [s]
+     * @param[in,out] stepSize  Initial step size (magnitude), updated to last proposed
+     *                          step size                                             [s]
+     */
+    template <typename Dynamics, typename State>
+    void integrate(const Dynamics& dynamics,
+                   Real& time,
+                   State& state,
+                   const Real endTime,
+                   Real& stepSize)
+    {
+        const Real direction = endTime < time ? Real(-1.0) : Real(1.0);
+        stepSize = direction * std::fabs(stepSize);
+
+        while (direction * (endTime - time) > Real(0.0))
+        {
+            if (std::fabs(stepSize) < minimumStepSize)
+            {
+                throw std::runtime_error(
+                    "ERROR: Step size for embedded Runge-Kutta integrator below minimum!");
+            }
+
+            const Real remainingTime = direction * (endTime - time);
+            const bool isLastStep = remainingTime <= std::fabs(stepSize);
+            Real attemptedStepSize = isLastStep ? direction * remainingTime : stepSize;
+
+            const bool isAccepted = step(dynamics, time, state, attemptedStepSize);
+            if (isAccepted && isLastStep)
+            {
+                time = endTime;
+            }
+
+            // Keep the proposed step size when the last step was shortened and accepted.
+            if (!(isAccepted && isLastStep))
+            {
+                stepSize = attemptedStepSize;
+            }
+        }
+    }
+
+private:
+
+    //! Relative error tolerance.
+    const Real relativeTolerance;
+
+    //! Absolute error tolerance.
+    const Real absoluteTolerance;
+
+    //! Minimum step size (magnitude).
+    const Real minimumStepSize;
+
+    //! Maximum step size (magnitude).
+    const Real maximumStepSize;
+
+    //! Safety factor for step size control.
+    const Real safetyFactor;
+
+    //! State at start of step.
+    Real initialState[Dimension];
+
+    //! State at intermediate stage.
+    Real stageState[Dimension];
+
+    //! State derivatives at stages.
+    Real stageDerivatives[Tableau::numberOfStages][Dimension];
+};
+
+} // namespace astro
+
+/*!
+ * References
+ *  Dormand, J.R., Prince, P.J. A family of embedded Runge-Kutta formulae. Journal of
+ *      Computational and Applied Mathematics, 6(1), 19-26, 1980.
+ *  Fehlberg, E. Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas with
+ *      Stepsize Control. NASA Technical Report R-287, 1968.
+ *  Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I: Nonstiff
+ *      Problems. Second Edition, Springer, 1993.
+ */
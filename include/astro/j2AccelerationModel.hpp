@@ -6,11 +6,67 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "astro/hostDevice.hpp"
+#include "astro/vectorTraits.hpp"
 
 namespace astro
 {
 
+//! Compute gravitational acceleration due to J2, writing into given output vector.
+/*!
+ * Computes the gravitational acceleration due to J2, identical to the computation that returns
+ * the acceleration vector, but writes into a caller-provided output vector. The position and
+ * acceleration vectors can be of any type whose elements are accessed with operator[] (see
+ * IsVector). The acceleration can be written in-place, i.e., the output can be the input.
+ *
+ * @sa IsVector
+ * @tparam     Real                    Real type
+ * @tparam     InputVector3            3-vector type of position
+ * @tparam     OutputVector3           3-vector type of acceleration
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body            [m^3 s^-2]
+ * @param[in]  position                Position vector of body subject to J2-acceleration [m]
+ * @param[in]  equatorialRadius        Equatorial radius of central body, in formulation
+ *                                     of spherical harmonics expansion                   [m]
+ * @param[in]  j2Coefficient           Unnormalized J2-coefficient of spherical harmonics
+ *                                     expansion                                          [-]
+ * @param[out] acceleration            J2 gravitational acceleration                      [m s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+ASTRO_HOST_DEVICE
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeJ2Acceleration(const Real          gravitationalParameter,
+                      const InputVector3& position,
+                      const Real          equatorialRadius,
+                      const Real          j2Coefficient,
+                      OutputVector3&&     acceleration)
+{
+    const Real x = position[0];
+    const Real y = position[1];
+    const Real z = position[2];
+
+    const Real positionNormSquared = x * x + y * y + z * z;
+    const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+    const Real inversePositionNormSquared = inversePositionNorm * inversePositionNorm;
+
+    const Real scaledZSquared = z * z * inversePositionNormSquared;
+
+    // The pre-multiplier is formed from powers of the inverse position norm rather than from
+    // |r|^5, since |r|^5 overflows single precision beyond |r| ~ 5e7 m (and its inverse then
+    // flushes to zero).
+    const Real preMultiplier = -gravitationalParameter * inversePositionNormSquared
+                                * inversePositionNorm * inversePositionNormSquared
+                                * Real(1.5) * j2Coefficient * equatorialRadius * equatorialRadius;
+
+    acceleration[0] = preMultiplier * x * (Real(1.0) - Real(5.0) * scaledZSquared);
+    acceleration[1] = preMultiplier * y * (Real(1.0) - Real(5.0) * scaledZSquared);
+    acceleration[2] = preMultiplier * z * (Real(3.0) - Real(5.0) * scaledZSquared);
+}
+
 //! Compute gravitational acceleration due to J2.
 /*!
  * Compute gravitational acceleration at given position vector subject to an irregular gravity
@@ -50,23 +106,321 @@ Vector3 computeJ2Acceleration(const Real     gravitationalParameter,
                               const Real     j2Coefficient)
 {
     Vector3 acceleration = position;
+    computeJ2Acceleration(
+        gravitationalParameter, position, equatorialRadius, j2Coefficient, acceleration);
+    return acceleration;
+}
+
+//! Compute gradient of gravitational acceleration due to J2 with respect to position.
+/*!
+ * Computes the gradient (Jacobian) of the gravitational acceleration due to J2,
+ * computeJ2Acceleration, with respect to the position vector. Writing the acceleration as
+ * \f$a_{i} = P x_{i} g_{i}\f$, with \f$P = -\frac{3}{2} \mu J_{2} R^{2} / r^{5}\f$,
+ * \f$g_{x} = g_{y} = 1 - 5\hat{z}^{2}\f$ and \f$g_{z} = 3 - 5\hat{z}^{2}\f$, the gradient is given
+ * by:
+ *
+ * \f[
+ *      \frac{\partial a_{i}}{\partial x_{j}} = P \left[ \delta_{ij} g_{i}
+ *          + \frac{x_{i} x_{j}}{r^{2}} \left( 10\hat{z}^{2} - 5 g_{i} \right)
+ *          - 10 \frac{z x_{i}}{r^{2}} \delta_{jz} \right]
+ * \f]
+ *
+ * where \f$\delta_{ij}\f$ is the Kronecker delta. The gradient is symmetric, since the
+ * acceleration is the gradient of a potential.
+ *
+ * Since the acceleration is linear in the J2-coefficient, the partial derivative of the
+ * acceleration with respect to the J2-coefficient (e.g., to estimate it in orbit determination)
+ * is given by computeJ2Acceleration, evaluated with a J2-coefficient of 1.
+ *
+ * @sa computeJ2Acceleration, CartesianVariationalDynamics
+ * @tparam     Real                    Real type
+ * @tparam     Vector3                 3-vector type
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body      [m^3 s^-2]
+ * @param[in]  position                Position vector of body subject to
+ *                                     J2-acceleration                              [m]
+ * @param[in]  equatorialRadius        Equatorial radius of central body, in
+ *                                     formulation of spherical harmonics expansion [m]
+ * @param[in]  j2Coefficient           Unnormalized J2-coefficient of spherical
+ *                                     harmonics expansion                          [-]
+ * @param[out] gradient                Gradient of J2 acceleration wrt position,
+ *                                     stored row-major, i.e., gradient[i][j]
+ *                                     = d a_i / d r_j                              [s^-2]
+ */
+template <typename Real, typename Vector3>
+ASTRO_HOST_DEVICE
+void computeJ2AccelerationGradient(const Real     gravitationalParameter,
+                                   const Vector3& position,
+                                   const Real     equatorialRadius,
+                                   const Real     j2Coefficient,
+                                   Real           gradient[3][3])
+{
+    const Real positionNormSquared = position[0] * position[0]
+                                     + position[1] * position[1]
+                                     + position[2] * position[2];
+    const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+    const Real inversePositionNormSquared = inversePositionNorm * inversePositionNorm;
+
+    const Real scaledZSquared = position[2] * position[2] * inversePositionNormSquared;
+    const Real preMultiplier = -gravitationalParameter * inversePositionNormSquared
+                                * inversePositionNorm * inversePositionNormSquared
+                                * Real(1.5) * j2Coefficient * equatorialRadius * equatorialRadius;
+
+    const Real g[3] = {Real(1.0) - Real(5.0) * scaledZSquared,
+                       Real(1.0) - Real(5.0) * scaledZSquared,
+                       Real(3.0) - Real(5.0) * scaledZSquared};
 
+    for (int i = 0; i < 3; ++i)
+    {
+        const Real scaledPosition = preMultiplier * position[i] * inversePositionNormSquared;
+        const Real factor = scaledPosition * (Real(10.0) * scaledZSquared - Real(5.0) * g[i]);
+        for (int j = 0; j < 3; ++j)
+        {
+            gradient[i][j] = factor * position[j];
+        }
+        gradient[i][i] += preMultiplier * g[i];
+        gradient[i][2] -= Real(10.0) * scaledPosition * position[2];
+    }
+}
+
+//! Compute gravitational acceleration due to central body and J2.
+/*!
+ * Computes the sum of the central body acceleration (computeCentralBodyAcceleration) and the
+ * acceleration due to J2 (computeJ2Acceleration), and each of the two contributions. The kernel
+ * is fused, i.e., the quantities that are shared by the two models (\f$r^{2}\f$,
+ * \f$\frac{1}{r^{3}}\f$, \f$\frac{1}{r^{5}}\f$ and \f$\hat{z}^{2}\f$) are computed once, using a
+ * single square root and a single division:
+ *
+ * \f{eqnarray*}{
+ *      \vec{a}_{central} &=& -\frac{\mu}{r^{3}}\vec{r}  \\
+ *      \vec{a}_{J_{2}} &=& -\frac{3}{2} J_{2} \frac{\mu R^{2}}{r^{5}}
+ *                         \begin{pmatrix} x (1 - 5\hat{z}^{2}) \\ y (1 - 5\hat{z}^{2}) \\
+ *                                         z (3 - 5\hat{z}^{2}) \end{pmatrix}
+ * \f}
+ *
+ * @sa computeCentralBodyAcceleration, computeJ2Acceleration
+ * @tparam     Real                     Real type
+ * @tparam     Vector3                  3-vector type
+ * @param[in]  gravitationalParameter   Gravitational parameter of central body      [m^3 s^-2]
+ * @param[in]  position                 Position vector of orbiting body             [m]
+ * @param[in]  equatorialRadius         Equatorial radius of central body, in
+ *                                      formulation of spherical harmonics expansion [m]
+ * @param[in]  j2Coefficient            Unnormalized J2-coefficient of spherical
+ *                                      harmonics expansion                          [-]
+ * @param[out] centralBodyAcceleration  Central body acceleration                    [m s^-2]
+ * @param[out] j2Acceleration           J2 gravitational acceleration                [m s^-2]
+ * @return                              Sum of central body and J2 accelerations     [m s^-2]
+ */
+template <typename Real, typename Vector3>
+Vector3 computeCentralBodyAndJ2Acceleration(const Real     gravitationalParameter,
+                                            const Vector3& position,
+                                            const Real     equatorialRadius,
+                                            const Real     j2Coefficient,
+                                            Vector3&       centralBodyAcceleration,
+                                            Vector3&       j2Acceleration)
+{
     const Real positionNormSquared = position[0] * position[0]
                                      + position[1] * position[1]
                                      + position[2] * position[2];
-    const Real positionNorm = std::sqrt(positionNormSquared);
+    const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+    const Real inversePositionNormSquared = inversePositionNorm * inversePositionNorm;
+
+    const Real centralBodyPreMultiplier
+        = -gravitationalParameter * inversePositionNormSquared * inversePositionNorm;
+    const Real j2PreMultiplier = centralBodyPreMultiplier * inversePositionNormSquared
+                                 * Real(1.5) * j2Coefficient * equatorialRadius * equatorialRadius;
+    const Real fiveScaledZSquared
+        = Real(5.0) * position[2] * position[2] * inversePositionNormSquared;
+    const Real j2HorizontalPreMultiplier = j2PreMultiplier * (Real(1.0) - fiveScaledZSquared);
+
+    centralBodyAcceleration = position;
+    centralBodyAcceleration[0] = centralBodyPreMultiplier * position[0];
+    centralBodyAcceleration[1] = centralBodyPreMultiplier * position[1];
+    centralBodyAcceleration[2] = centralBodyPreMultiplier * position[2];
+
+    j2Acceleration = position;
+    j2Acceleration[0] = j2HorizontalPreMultiplier * position[0];
+    j2Acceleration[1] = j2HorizontalPreMultiplier * position[1];
+    j2Acceleration[2] = j2PreMultiplier * (Real(3.0) - fiveScaledZSquared) * position[2];
+
+    Vector3 acceleration = position;
+    acceleration[0] = centralBodyAcceleration[0] + j2Acceleration[0];
+    acceleration[1] = centralBodyAcceleration[1] + j2Acceleration[1];
+    acceleration[2] = centralBodyAcceleration[2] + j2Acceleration[2];
+
+    return acceleration;
+}
 
-    const Real scaledZSquared = position[2] * position[2] / positionNormSquared;
+//! Compute gravitational acceleration due to central body and J2, writing into given output vector.
+/*!
+ * Computes the sum of the central body acceleration and the acceleration due to J2, identical to
+ * the computation that returns the acceleration vector, but writes into a caller-provided output
+ * vector. The position and acceleration vectors can be of any type whose elements are accessed
+ * with operator[] (see IsVector). The acceleration can be written in-place, i.e., the output can
+ * be the input.
+ *
+ * @sa IsVector, computeCentralBodyAndJ2Acceleration
+ * @tparam     Real                    Real type
+ * @tparam     InputVector3            3-vector type of position
+ * @tparam     OutputVector3           3-vector type of acceleration
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param[in]  position                Position vector of orbiting body              [m]
+ * @param[in]  equatorialRadius        Equatorial radius of central body, in
+ *                                     formulation of spherical harmonics expansion  [m]
+ * @param[in]  j2Coefficient           Unnormalized J2-coefficient of spherical
+ *                                     harmonics expansion                           [-]
+ * @param[out] acceleration            Sum of central body and J2 accelerations      [m s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+ASTRO_HOST_DEVICE
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeCentralBodyAndJ2Acceleration(const Real          gravitationalParameter,
+                                    const InputVector3& position,
+                                    const Real          equatorialRadius,
+                                    const Real          j2Coefficient,
+                                    OutputVector3&&     acceleration)
+{
+    const Real x = position[0];
+    const Real y = position[1];
+    const Real z = position[2];
 
-    const Real preMultiplier = -gravitationalParameter
-                                / (positionNormSquared * positionNormSquared * positionNorm)
-                                * 1.5 * j2Coefficient * equatorialRadius * equatorialRadius;
+    const Real positionNormSquared = x * x + y * y + z * z;
+    const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+    const Real inversePositionNormSquared = inversePositionNorm * inversePositionNorm;
 
-    acceleration[0] = preMultiplier * position[0] * (1.0 - 5.0 * scaledZSquared);
-    acceleration[1] = preMultiplier * position[1] * (1.0 - 5.0 * scaledZSquared);
-    acceleration[2] = preMultiplier * position[2] * (3.0 - 5.0 * scaledZSquared);
+    const Real preMultiplier
+        = -gravitationalParameter * inversePositionNormSquared * inversePositionNorm;
+    const Real scaledJ2 = Real(1.5) * j2Coefficient * equatorialRadius * equatorialRadius
+                          * inversePositionNormSquared;
+    const Real fiveScaledZSquared = Real(5.0) * z * z * inversePositionNormSquared;
+    const Real horizontalPreMultiplier
+        = preMultiplier * (Real(1.0) + scaledJ2 * (Real(1.0) - fiveScaledZSquared));
 
+    acceleration[0] = horizontalPreMultiplier * x;
+    acceleration[1] = horizontalPreMultiplier * y;
+    acceleration[2] = preMultiplier * (Real(1.0) + scaledJ2 * (Real(3.0) - fiveScaledZSquared)) * z;
+}
+
+//! Compute gravitational acceleration due to central body and J2.
+/*!
+ * Computes the sum of the central body acceleration and the acceleration due to J2, using a fused
+ * kernel with a single square root and a single division.
+ *
+ * \f[
+ *      \vec{a} = -\frac{\mu}{r^{3}}
+ *                \begin{pmatrix} x (1 + k (1 - 5\hat{z}^{2})) \\ y (1 + k (1 - 5\hat{z}^{2})) \\
+ *                                z (1 + k (3 - 5\hat{z}^{2})) \end{pmatrix},
+ *      \qquad k = \frac{3}{2} J_{2} \left(\frac{R}{r}\right)^{2}
+ * \f]
+ *
+ * @sa computeCentralBodyAcceleration, computeJ2Acceleration
+ * @tparam    Real                    Real type
+ * @tparam    Vector3                 3-vector type
+ * @param[in] gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param[in] position                Position vector of orbiting body              [m]
+ * @param[in] equatorialRadius        Equatorial radius of central body, in
+ *                                    formulation of spherical harmonics expansion  [m]
+ * @param[in] j2Coefficient           Unnormalized J2-coefficient of spherical
+ *                                    harmonics expansion                           [-]
+ * @return                            Sum of central body and J2 accelerations      [m s^-2]
+ */
+template <typename Real, typename Vector3>
+Vector3 computeCentralBodyAndJ2Acceleration(const Real     gravitationalParameter,
+                                            const Vector3& position,
+                                            const Real     equatorialRadius,
+                                            const Real     j2Coefficient)
+{
+    Vector3 acceleration = position;
+    computeCentralBodyAndJ2Acceleration(
+        gravitationalParameter, position, equatorialRadius, j2Coefficient, acceleration);
     return acceleration;
 }
 
+//! Compute gravitational acceleration due to central body and J2 for batch of positions.
+/*!
+ * Computes the sum of the central body acceleration and the acceleration due to J2 for a batch of
+ * positions, stored as a structure-of-arrays (one array per component), e.g., for a set of
+ * satellites orbiting the same central body. The fused kernel is identical to that of the
+ * single-position computation. The loop body is free of data-dependent control flow, such that
+ * it can be vectorized by the compiler. Note that on GCC, vectorization of the square root
+ * requires -fno-math-errno (implied by -ffast-math).
+ *
+ * The computation can be performed in-place, i.e., the acceleration arrays can be the position
+ * arrays.
+ *
+ * @sa computeCentralBodyAndJ2Acceleration
+ * @tparam     Real                    Real type
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param[in]  positions               Array of pointers to arrays of x-, y- and
+ *                                     z-components of position vectors              [m]
+ * @param[in]  equatorialRadius        Equatorial radius of central body, in
+ *                                     formulation of spherical harmonics expansion  [m]
+ * @param[in]  j2Coefficient           Unnormalized J2-coefficient of spherical
+ *                                     harmonics expansion                           [-]
+ * @param[out] accelerations           Array of pointers to arrays of x-, y- and
+ *                                     z-components of sum of central body and J2
+ *                                     accelerations                                 [m s^-2]
+ * @param[in]  numberOfPositions       Number of positions stored in each array
+ */
+template <typename Real>
+void computeCentralBodyAndJ2Acceleration(const Real        gravitationalParameter,
+                                         const Real* const positions[3],
+                                         const Real        equatorialRadius,
+                                         const Real        j2Coefficient,
+                                         Real* const       accelerations[3],
+                                         const std::size_t numberOfPositions)
+{
+    const Real scaledJ2Coefficient
+        = Real(1.5) * j2Coefficient * equatorialRadius * equatorialRadius;
+
+    // The batch is processed in blocks that are staged in local arrays, which guarantees to the
+    // compiler that the inputs and outputs in the loop kernel do not alias.
+    const std::size_t blockSize = 64;
+    Real position[3][blockSize];
+    Real acceleration[3][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfPositions; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfPositions - blockStart);
+
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            for (std::size_t i = 0; i < blockLength; ++i)
+            {
+                position[k][i] = positions[k][blockStart + i];
+            }
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const Real positionNormSquared = position[0][i] * position[0][i]
+                                             + position[1][i] * position[1][i]
+                                             + position[2][i] * position[2][i];
+            const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+            const Real inversePositionNormSquared = inversePositionNorm * inversePositionNorm;
+
+            const Real preMultiplier
+                = -gravitationalParameter * inversePositionNormSquared * inversePositionNorm;
+            const Real scaledJ2 = scaledJ2Coefficient * inversePositionNormSquared;
+            const Real fiveScaledZSquared
+                = Real(5.0) * position[2][i] * position[2][i] * inversePositionNormSquared;
+            const Real horizontalPreMultiplier
+                = preMultiplier * (Real(1.0) + scaledJ2 * (Real(1.0) - fiveScaledZSquared));
+
+            acceleration[0][i] = horizontalPreMultiplier * position[0][i];
+            acceleration[1][i] = horizontalPreMultiplier * position[1][i];
+            acceleration[2][i]
+                = preMultiplier * (Real(1.0) + scaledJ2 * (Real(3.0) - fiveScaledZSquared))
+                  * position[2][i];
+        }
+
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            for (std::size_t i = 0; i < blockLength; ++i)
+            {
+                accelerations[k][blockStart + i] = acceleration[k][i];
+            }
+        }
+    }
+}
+
 } // namespace astro
@@ -0,0 +1,670 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include "astro/hostDevice.hpp"
+#include "astro/instrumentation.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/rootFinders.hpp"
+#include "astro/stateVectorIndices.hpp"
+#include "astro/vectorTraits.hpp"
+
+namespace astro
+{
+
+//! Compute Stumpff function c2.
+/*!
+ * Computes the Stumpff function \f$c_{2}(\psi)\f$, given as:
+ *
+ * \f[
+ *      c_{2}(\psi) = \sum_{k=0}^{\infty} \frac{(-\psi)^{k}}{(2k + 2)!}
+ *                  = \frac{1 - \cos\sqrt{\psi}}{\psi}
+ * \f]
+ *
+ * where \f$\psi\f$ is the square of the universal variable scaled by the reciprocal of the
+ * semi-major axis. The series is used for \f$|\psi| < 1\f$ to avoid loss of precision and the
+ * closed-form expressions (trigonometric for \f$\psi > 0\f$, hyperbolic for \f$\psi < 0\f$) are
+ * used otherwise (Vallado, 2007).
+ *
+ * @sa computeStumpffFunctionC3
+ * @tparam    Real  Real type
+ * @param     psi   Argument of Stumpff function  [-]
+ * @return          Stumpff function c2           [-]
+ */
+template <typename Real>
+Real computeStumpffFunctionC2(const Real psi)
+{
+    if (std::fabs(psi) < Real(1.0))
+    {
+        Real term = Real(0.5);
+        Real sum = term;
+        for (int k = 1; k < 10; ++k)
+        {
+            term *= -psi / ((Real(2.0) * k + Real(1.0)) * (Real(2.0) * k + Real(2.0)));
+            sum += term;
+        }
+        return sum;
+    }
+
+    if (psi > Real(0.0))
+    {
+        const Real sineHalfAngle = std::sin(Real(0.5) * std::sqrt(psi));
+        return Real(2.0) * sineHalfAngle * sineHalfAngle / psi;
+    }
+
+    return (std::cosh(std::sqrt(-psi)) - Real(1.0)) / (-psi);
+}
+
+//! Compute Stumpff function c3.
+/*!
+ * Computes the Stumpff function \f$c_{3}(\psi)\f$, given as:
+ *
+ * \f[
+ *      c_{3}(\psi) = \sum_{k=0}^{\infty} \frac{(-\psi)^{k}}{(2k + 3)!}
+ *                  = \frac{\sqrt{\psi} - \sin\sqrt{\psi}}{\sqrt{\psi^{3}}}
+ * \f]
+ *
+ * where \f$\psi\f$ is the square of the universal variable scaled by the reciprocal of the
+ * semi-major axis. The series is used for \f$|\psi| < 1\f$ to avoid loss of precision and the
+ * closed-form expressions (trigonometric for \f$\psi > 0\f$, hyperbolic for \f$\psi < 0\f$) are
+ * used otherwise (Vallado, 2007).
+ *
+ * @sa computeStumpffFunctionC2
+ * @tparam    Real  Real type
+ * @param     psi   Argument of Stumpff function  [-]
+ * @return          Stumpff function c3           [-]
+ */
+template <typename Real>
+Real computeStumpffFunctionC3(const Real psi)
+{
+    if (std::fabs(psi) < Real(1.0))
+    {
+        Real term = Real(1.0) / Real(6.0);
+        Real sum = term;
+        for (int k = 1; k < 10; ++k)
+        {
+            term *= -psi / ((Real(2.0) * k + Real(2.0)) * (Real(2.0) * k + Real(3.0)));
+            sum += term;
+        }
+        return sum;
+    }
+
+    if (psi > Real(0.0))
+    {
+        const Real squareRootPsi = std::sqrt(psi);
+        return (squareRootPsi - std::sin(squareRootPsi)) / (psi * squareRootPsi);
+    }
+
+    const Real squareRootMinusPsi = std::sqrt(-psi);
+    return (std::sinh(squareRootMinusPsi) - squareRootMinusPsi)
+           / (-psi * squareRootMinusPsi);
+}
+
+//! Universal Kepler function, including derivatives.
+/*!
+ * Function object that evaluates the universal Kepler function (Vallado, 2007):
+ *
+ * \f[
+ *      F(\chi) = \chi^{3} c_{3}(\psi) + \sigma_{0} \chi^{2} c_{2}(\psi)
+ *                + r_{0} \chi (1 - \psi c_{3}(\psi)) - \sqrt{\mu} \Delta t
+ * \f]
+ *
+ * and its first and second derivatives with respect to the universal variable \f$\chi\f$, where
+ * \f$\psi = \alpha \chi^{2}\f$, \f$\alpha\f$ is the reciprocal of the semi-major axis,
+ * \f$\sigma_{0}\f$ is the dot product of the initial position and velocity divided by
+ * \f$\sqrt{\mu}\f$ and \f$r_{0}\f$ is the initial radius. The first derivative is the radius.
+ *
+ * Since the universal Kepler function increases monotonically with the universal variable, each
+ * evaluation narrows the bracket of the root. The function object also acts as the safeguard of
+ * findRoot: iterates that leave the bracket are replaced by a bisection step and, as long as the
+ * root is not bracketed, the growth of the iterates is limited, since the Newton-Raphson step can
+ * overshoot by orders of magnitude for hyperbolic orbits.
+ *
+ * @sa KeplerPropagator, findRoot
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class UniversalKeplerFunction
+{
+public:
+
+    //! Construct function.
+    /*!
+     * @param scaledRadialVelocity     Dot product of initial position and velocity, divided by
+     *                                 square root of gravitational parameter            [m^0.5]
+     * @param initialRadius            Initial radius                                    [m]
+     * @param semiMajorAxisReciprocal  Reciprocal of semi-major axis                     [m^-1]
+     * @param scaledTimeOfFlight       Time-of-flight, multiplied by square root of
+     *                                 gravitational parameter                           [m^1.5]
+     * @param lowerBound               Lower bound of universal variable                 [m^0.5]
+     * @param upperBound               Upper bound of universal variable                 [m^0.5]
+     */
+    ASTRO_HOST_DEVICE
+    UniversalKeplerFunction(const Real scaledRadialVelocity,
+                            const Real initialRadius,
+                            const Real semiMajorAxisReciprocal,
+                            const Real scaledTimeOfFlight,
+                            const Real lowerBound,
+                            const Real upperBound)
+        : scaledRadialVelocity(scaledRadialVelocity),
+          initialRadius(initialRadius),
+          semiMajorAxisReciprocal(semiMajorAxisReciprocal),
+          scaledTimeOfFlight(scaledTimeOfFlight),
+          lowerBound(lowerBound),
+          upperBound(upperBound)
+    { }
+
+    //! Evaluate function and derivatives, and narrow bracket of root.
+    /*!
+     * @param[in]  universalVariable  Universal variable                             [m^0.5]
+     * @param[out] function           Universal Kepler function                      [m^1.5]
+     * @param[out] firstDerivative    First derivative of universal Kepler function  [m]
+     * @param[out] secondDerivative   Second derivative of universal Kepler function [m^0.5]
+     */
+    ASTRO_HOST_DEVICE
+    void operator()(const Real universalVariable,
+                    Real& function,
+                    Real& firstDerivative,
+                    Real& secondDerivative) const
+    {
+        const Real universalVariableSquared = universalVariable * universalVariable;
+        const Real psi = universalVariableSquared * semiMajorAxisReciprocal;
+        const Real c2 = computeStumpffFunctionC2(psi);
+        const Real c3 = computeStumpffFunctionC3(psi);
+
+        function = universalVariableSquared * universalVariable * c3
+                   + scaledRadialVelocity * universalVariableSquared * c2
+                   + initialRadius * universalVariable * (Real(1.0) - psi * c3)
+                   - scaledTimeOfFlight;
+        firstDerivative = universalVariableSquared * c2
+                          + scaledRadialVelocity * universalVariable * (Real(1.0) - psi * c3)
+                          + initialRadius * (Real(1.0) - psi * c2);
+        secondDerivative = scaledRadialVelocity * (Real(1.0) - psi * c2)
+                           + (Real(1.0) - semiMajorAxisReciprocal * initialRadius)
+                             * universalVariable * (Real(1.0) - psi * c3);
+
+        if (function < Real(0.0))
+        {
+            lowerBound = universalVariable;
+        }
+        else
+        {
+            upperBound = universalVariable;
+        }
+    }
+
+    //! Constrain next iterate to bracket of root.
+    /*!
+     * @param  universalVariable      Current universal variable              [m^0.5]
+     * @param  nextUniversalVariable  Next universal variable                 [m^0.5]
+     * @return                        Constrained next universal variable     [m^0.5]
+     */
+    ASTRO_HOST_DEVICE
+    Real operator()(const Real universalVariable, Real nextUniversalVariable) const
+    {
+        const Real maximumUniversalVariableMagnitude
+            = Real(2.0) * std::fabs(universalVariable)
+              + std::fabs(scaledTimeOfFlight) / initialRadius;
+        if (upperBound == std::numeric_limits<Real>::max())
+        {
+            nextUniversalVariable
+                = std::min(nextUniversalVariable, maximumUniversalVariableMagnitude);
+        }
+        if (lowerBound == -std::numeric_limits<Real>::max())
+        {
+            nextUniversalVariable
+                = std::max(nextUniversalVariable, -maximumUniversalVariableMagnitude);
+        }
+        if (!(nextUniversalVariable >= lowerBound && nextUniversalVariable <= upperBound))
+        {
+            nextUniversalVariable = Real(0.5) * (lowerBound + upperBound);
+        }
+        return nextUniversalVariable;
+    }
+
+private:
+
+    //! Dot product of initial position and velocity, divided by the square root of the
+    //! gravitational parameter.
+    const Real scaledRadialVelocity;
+
+    //! Initial radius.
+    const Real initialRadius;
+
+    //! Reciprocal of semi-major axis.
+    const Real semiMajorAxisReciprocal;
+
+    //! Time-of-flight, multiplied by the square root of the gravitational parameter.
+    const Real scaledTimeOfFlight;
+
+    //! Lower bound of universal variable, narrowed by each evaluation.
+    mutable Real lowerBound;
+
+    //! Upper bound of universal variable, narrowed by each evaluation.
+    mutable Real upperBound;
+};
+
+//! Universal-variable Kepler propagator.
+/*!
+ * Propagates a Cartesian state in a Kepler (two-body) orbit by a given time-of-flight using the
+ * universal-variable formulation with Stumpff functions (Vallado, 2007). This formulation is valid
+ * for elliptical, parabolic and hyperbolic orbits alike and avoids the chain of conversions through
+ * Keplerian elements and anomalies.
+ *
+ * The per-orbit invariants (initial position and velocity, initial radius, radial velocity
+ * term, reciprocal of the semi-major axis, semi-latus rectum, orbital period) are computed once on
+ * construction.
+ * Each propagation to a new epoch then costs a single Newton-Raphson solve of the universal
+ * Kepler equation, followed by the evaluation of the Lagrange coefficients f, g, fdot and gdot,
+ * which map the initial position and velocity to the propagated state.
+ *
+ * The time-of-flight may be negative (backward propagation).
+ *
+ * @tparam    Real     Real type
+ * @tparam    Vector6  6-vector type
+ */
+template <typename Real, typename Vector6>
+class KeplerPropagator
+{
+public:
+
+    //! Construct Kepler propagator.
+    /*!
+     * Constructs Kepler propagator for the orbit through the given initial Cartesian state.
+     *
+     * @param     initialState            Initial Cartesian state                       [m, m/s]
+     * @param     gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+     * @param     rootFindingTolerance    Relative stopping condition tolerance for
+     *                                    Newton-Raphson algorithm                      [-]
+     * @param     maximumIterations       Maximum iteration for Newton-Raphson
+     *                                    algorithm                                     [-]
+     */
+    KeplerPropagator(const Vector6&    initialState,
+                     const Real        gravitationalParameter,
+                     const Real        rootFindingTolerance
+                                        = Real(10.0) * std::numeric_limits<Real>::epsilon(),
+                     const int         maximumIterations = 100)
+        : initialState(initialState),
+          squareRootGravitationalParameter(std::sqrt(gravitationalParameter)),
+          rootFindingTolerance(rootFindingTolerance),
+          maximumIterations(maximumIterations)
+    {
+        assert(gravitationalParameter > Real(0.0));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            initialPosition[i] = initialState[xPositionIndex + i];
+            initialVelocity[i] = initialState[xVelocityIndex + i];
+        }
+
+        initialRadius = std::sqrt(initialPosition[0] * initialPosition[0]
+                                  + initialPosition[1] * initialPosition[1]
+                                  + initialPosition[2] * initialPosition[2]);
+        assert(initialRadius > Real(0.0));
+
+        const Real initialSpeedSquared = initialVelocity[0] * initialVelocity[0]
+                                         + initialVelocity[1] * initialVelocity[1]
+                                         + initialVelocity[2] * initialVelocity[2];
+
+        scaledRadialVelocity = (initialPosition[0] * initialVelocity[0]
+                                + initialPosition[1] * initialVelocity[1]
+                                + initialPosition[2] * initialVelocity[2])
+                               / squareRootGravitationalParameter;
+
+        semiMajorAxisReciprocal
+            = Real(2.0) / initialRadius - initialSpeedSquared / gravitationalParameter;
+
+        const Real angularMomentum[3]
+            = {initialPosition[1] * initialVelocity[2] - initialPosition[2] * initialVelocity[1],
+               initialPosition[2] * initialVelocity[0] - initialPosition[0] * initialVelocity[2],
+               initialPosition[0] * initialVelocity[1] - initialPosition[1] * initialVelocity[0]};
+
+        semiLatusRectum = (angularMomentum[0] * angularMomentum[0]
+                           + angularMomentum[1] * angularMomentum[1]
+                           + angularMomentum[2] * angularMomentum[2])
+                          / gravitationalParameter;
+
+        orbitalPeriod = semiMajorAxisReciprocal > Real(0.0)
+            ? Real(2.0) * Real(3.14159265358979323846)
+              / (squareRootGravitationalParameter * semiMajorAxisReciprocal
+                 * std::sqrt(semiMajorAxisReciprocal))
+            : std::numeric_limits<Real>::infinity();
+    }
+
+    //! Propagate state.
+    /*!
+     * Propagates the initial state by the given time-of-flight.
+     *
+     * If the Newton-Raphson solver for the universal variable does not converge within the maximum
+     * number of iterations, a runtime exception is thrown.
+     *
+     * @param     timeOfFlight  Time-of-flight from initial epoch  [s]
+     * @return                  Propagated Cartesian state         [m, m/s]
+     */
+    Vector6 propagate(const Real timeOfFlight) const
+    {
+        Vector6 state = initialState;
+
+        Real position[3];
+        Real velocity[3];
+        computePositionAndVelocity(timeOfFlight, position, velocity);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            state[xPositionIndex + i] = position[i];
+            state[xVelocityIndex + i] = velocity[i];
+        }
+
+        return state;
+    }
+
+    //! Propagate state to multiple epochs.
+    /*!
+     * Propagates the initial state by each of the given times-of-flight and stores the propagated
+     * states in structure-of-arrays layout, i.e., as 6 arrays indexed by CartesianElementIndices,
+     * similar to the batch element conversions.
+     *
+     * If the Newton-Raphson solver for the universal variable does not converge within the maximum
+     * number of iterations, a runtime exception is thrown.
+     *
+     * @sa convertKeplerianToCartesianElements
+     * @param     timesOfFlight   Array of times-of-flight from initial epoch        [s]
+     * @param     states          Arrays of propagated Cartesian elements (output)   [m, m/s]
+     * @param     numberOfEpochs  Number of epochs                                   [-]
+     */
+    void propagate(const Real* const   timesOfFlight,
+                   Real* const         states[6],
+                   const std::size_t   numberOfEpochs) const
+    {
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            Real position[3];
+            Real velocity[3];
+            computePositionAndVelocity(timesOfFlight[j], position, velocity);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                states[xPositionIndex + i][j] = position[i];
+                states[xVelocityIndex + i][j] = velocity[i];
+            }
+        }
+    }
+
+    //! Get reciprocal of semi-major axis.
+    /*!
+     * Returns the reciprocal of the semi-major axis (positive for elliptical orbits, zero for
+     * parabolic orbits and negative for hyperbolic orbits).
+     *
+     * @return  Reciprocal of semi-major axis  [m^-1]
+     */
+    Real getSemiMajorAxisReciprocal() const { return semiMajorAxisReciprocal; }
+
+    //! Get semi-latus rectum.
+    /*!
+     * Returns the semi-latus rectum of the orbit.
+     *
+     * @return  Semi-latus rectum  [m]
+     */
+    Real getSemiLatusRectum() const { return semiLatusRectum; }
+
+private:
+
+    //! Compute propagated position and velocity.
+    /*!
+     * Solves the universal Kepler equation for the given time-of-flight and evaluates the Lagrange
+     * coefficients to compute the propagated position and velocity.
+     *
+     * @param     timeOfFlight  Time-of-flight from initial epoch  [s]
+     * @param     position      Propagated position (output)       [m]
+     * @param     velocity      Propagated velocity (output)       [m/s]
+     */
+    void computePositionAndVelocity(const Real timeOfFlight,
+                                    Real position[3],
+                                    Real velocity[3]) const
+    {
+        // Reduce the time-of-flight to a single orbital period for elliptical orbits, such that
+        // the universal variable is bracketed.
+        const Real pi = Real(3.14159265358979323846);
+        Real lowerBound = timeOfFlight < Real(0.0) ? -std::numeric_limits<Real>::max() : Real(0.0);
+        Real upperBound = timeOfFlight < Real(0.0) ? Real(0.0) : std::numeric_limits<Real>::max();
+        Real reducedTimeOfFlight = timeOfFlight;
+        if (semiMajorAxisReciprocal > Real(0.0))
+        {
+            reducedTimeOfFlight = std::fmod(timeOfFlight, orbitalPeriod);
+            if (reducedTimeOfFlight < Real(0.0))
+            {
+                reducedTimeOfFlight += orbitalPeriod;
+            }
+            lowerBound = Real(0.0);
+            upperBound = Real(2.0) * pi / std::sqrt(semiMajorAxisReciprocal);
+        }
+
+        const Real scaledTimeOfFlight = squareRootGravitationalParameter * reducedTimeOfFlight;
+
+        // Set the initial guess for the universal variable (Vallado, 2007).
+        Real universalVariable = scaledTimeOfFlight / initialRadius;
+        const Real dimensionlessEnergy = semiMajorAxisReciprocal * initialRadius;
+        if (dimensionlessEnergy > Real(1.0e-6))
+        {
+            universalVariable = scaledTimeOfFlight * semiMajorAxisReciprocal;
+        }
+        else if (dimensionlessEnergy < -Real(1.0e-6))
+        {
+            const Real semiMajorAxis = Real(1.0) / semiMajorAxisReciprocal;
+            const Real timeOfFlightSign = timeOfFlight < Real(0.0) ? -Real(1.0) : Real(1.0);
+            const Real hyperbolicGuess
+                = timeOfFlightSign * std::sqrt(-semiMajorAxis)
+                  * std::log(-Real(2.0) * semiMajorAxisReciprocal * scaledTimeOfFlight
+                             / (scaledRadialVelocity
+                                + timeOfFlightSign * std::sqrt(-semiMajorAxis)
+                                  * (Real(1.0) - initialRadius * semiMajorAxisReciprocal)));
+            if (std::isfinite(hyperbolicGuess))
+            {
+                universalVariable = hyperbolicGuess;
+            }
+        }
+        else
+        {
+            const Real parabolicMeanMotion
+                = Real(3.0)
+                  * std::sqrt(Real(1.0) / (semiLatusRectum * semiLatusRectum * semiLatusRectum))
+                  * std::fabs(scaledTimeOfFlight);
+            const Real s = Real(0.5) * std::atan(Real(1.0) / parabolicMeanMotion);
+            const Real w = std::atan(std::cbrt(std::tan(s)));
+            universalVariable = std::sqrt(semiLatusRectum) * Real(2.0) / std::tan(Real(2.0) * w);
+            if (timeOfFlight < Real(0.0))
+            {
+                universalVariable = -universalVariable;
+            }
+        }
+        universalVariable = std::min(std::max(universalVariable, lowerBound), upperBound);
+
+        // Execute Newton-Raphson root-finding algorithm for the universal Kepler equation, keeping
+        // the iterates within the bracket of the root.
+        const UniversalKeplerFunction<Real> universalKeplerFunction(scaledRadialVelocity,
+                                                                    initialRadius,
+                                                                    semiMajorAxisReciprocal,
+                                                                    scaledTimeOfFlight,
+                                                                    lowerBound,
+                                                                    upperBound);
+        const RelativeStepStoppingCondition<Real> stoppingCondition(rootFindingTolerance);
+        int numberOfIterations = 0;
+        const bool isConverged
+            = findRoot<NewtonRaphsonScheme>(universalKeplerFunction,
+                                            stoppingCondition,
+                                            maximumIterations,
+                                            universalVariable,
+                                            numberOfIterations,
+                                            universalKeplerFunction);
+        ASTRO_INSTRUMENT(getThreadInstrumentationCounters().universalKeplerSolver.recordSolve(
+            static_cast<std::size_t>(numberOfIterations), isConverged ? 0 : 1));
+        if (!isConverged)
+        {
+            throw std::runtime_error(
+                "ERROR: Maximum iterations for Newton-Raphson root-finding exceeded!");
+        }
+
+        // Compute the Stumpff functions and radius for the converged universal variable.
+        const Real universalVariableSquared = universalVariable * universalVariable;
+        const Real psi = universalVariableSquared * semiMajorAxisReciprocal;
+        const Real c2 = computeStumpffFunctionC2(psi);
+        const Real c3 = computeStumpffFunctionC3(psi);
+        const Real radius = universalVariableSquared * c2
+                 + scaledRadialVelocity * universalVariable * (Real(1.0) - psi * c3)
+                 + initialRadius * (Real(1.0) - psi * c2);
+
+        // Compute Lagrange coefficients.
+        const Real f = Real(1.0) - universalVariableSquared * c2 / initialRadius;
+        const Real g = reducedTimeOfFlight
+                       - universalVariableSquared * universalVariable * c3
+                         / squareRootGravitationalParameter;
+        const Real fDot = squareRootGravitationalParameter * universalVariable
+                          * (psi * c3 - Real(1.0)) / (radius * initialRadius);
+        const Real gDot = Real(1.0) - universalVariableSquared * c2 / radius;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            position[i] = f * initialPosition[i] + g * initialVelocity[i];
+            velocity[i] = fDot * initialPosition[i] + gDot * initialVelocity[i];
+        }
+    }
+
+    //! Initial Cartesian state.
+    const Vector6 initialState;
+
+    //! Initial position.
+    Real initialPosition[3];
+
+    //! Initial velocity.
+    Real initialVelocity[3];
+
+    //! Initial radius.
+    Real initialRadius;
+
+    //! Dot product of initial position and velocity, divided by the square root of the
+    //! gravitational parameter.
+    Real scaledRadialVelocity;
+
+    //! Reciprocal of semi-major axis.
+    Real semiMajorAxisReciprocal;
+
+    //! Semi-latus rectum.
+    Real semiLatusRectum;
+
+    //! Orbital period (infinite for parabolic and hyperbolic orbits).
+    Real orbitalPeriod;
+
+    //! Square root of gravitational parameter.
+    const Real squareRootGravitationalParameter;
+
+    //! Relative stopping condition tolerance for Newton-Raphson algorithm.
+    const Real rootFindingTolerance;
+
+    //! Maximum iteration for Newton-Raphson algorithm.
+    const int maximumIterations;
+};
+
+//! Propagate Kepler orbit.
+/*!
+ * Propagates a Cartesian state in a Kepler (two-body) orbit by a given time-of-flight using the
+ * universal-variable formulation. This is a convenience function for one-off propagations; to
+ * propagate the same orbit to many epochs, construct a KeplerPropagator once and reuse it.
+ *
+ * @sa KeplerPropagator
+ * @tparam    Real                    Real type
+ * @tparam    Vector6                 6-vector type
+ * @param     state                   Cartesian state                                  [m, m/s]
+ * @param     gravitationalParameter  Gravitational parameter of central body          [m^3 s^-2]
+ * @param     timeOfFlight            Time-of-flight                                   [s]
+ * @return                            Propagated Cartesian state                       [m, m/s]
+ */
+template <typename Real, typename Vector6>
+Vector6 propagateKeplerOrbit(const Vector6& state,
+                             const Real gravitationalParameter,
+                             const Real timeOfFlight)
+{
+    return KeplerPropagator<Real, Vector6>(state, gravitationalParameter).propagate(timeOfFlight);
+}
+
+//! Propagate Keplerian elements of elliptical orbit.
+/*!
+ * Propagates the Keplerian elements of an elliptical orbit (0 <= eccentricity < 1) in a Kepler
+ * (two-body) orbit by a given time-of-flight, by advancing the mean anomaly with the mean motion
+ * and converting it back to true anomaly with Markley's non-iterative method (see
+ * convertEllipticalMeanAnomalyToEccentricAnomalyMarkley). All elements, except for the true
+ * anomaly, are constant. For circular and equatorial orbits, for which the element conversions
+ * store the argument of latitude or true longitude in place of the true anomaly (see
+ * convertCartesianToKeplerianElements), the stored angle is advanced instead.
+ *
+ * In contrast to KeplerPropagator, the cost of each call is fixed, and no memory is allocated
+ * and no exception can be thrown, such that this function can also be called from device code
+ * (see ASTRO_HOST_DEVICE). The output vector can be the same as the input vector, to propagate
+ * the elements in-place.
+ *
+ * @sa KeplerPropagator, convertKeplerianToCartesianElements
+ * @tparam     Real                         Real type
+ * @tparam     InputVector6                 6-vector type of input elements
+ * @tparam     OutputVector6                6-vector type of output elements
+ * @param[in]  keplerianElements            Keplerian elements                       [m, -, rad]
+ * @param[in]  gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ * @param[in]  timeOfFlight                 Time-of-flight                           [s]
+ * @param[out] propagatedKeplerianElements  Propagated Keplerian elements            [m, -, rad]
+ */
+template <typename Real, typename InputVector6, typename OutputVector6>
+ASTRO_HOST_DEVICE
+void propagateKeplerianElements(const InputVector6& keplerianElements,
+                                const Real          gravitationalParameter,
+                                const Real          timeOfFlight,
+                                OutputVector6&&     propagatedKeplerianElements)
+{
+    assert(hasVectorSize(keplerianElements, 6));
+    assert(hasVectorSize(propagatedKeplerianElements, 6));
+    assert(gravitationalParameter > Real(0.0));
+
+    const Real pi = Real(3.14159265358979323846);
+
+    const Real semiMajorAxis = keplerianElements[semiMajorAxisIndex];
+    const Real eccentricity = keplerianElements[eccentricityIndex];
+    const Real trueAnomaly = keplerianElements[trueAnomalyIndex];
+    assert(semiMajorAxis > Real(0.0));
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
+
+    const Real meanMotion = std::sqrt(
+        gravitationalParameter / (semiMajorAxis * semiMajorAxis * semiMajorAxis));
+    const Real meanAnomaly = convertTrueAnomalyToEllipticalMeanAnomaly(trueAnomaly, eccentricity)
+                             + meanMotion * timeOfFlight;
+    const Real eccentricAnomaly
+        = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(eccentricity, meanAnomaly);
+    Real propagatedTrueAnomaly
+        = convertEllipticalEccentricAnomalyToTrueAnomaly(eccentricAnomaly, eccentricity);
+    if (propagatedTrueAnomaly < Real(0.0))
+    {
+        propagatedTrueAnomaly += Real(2.0) * pi;
+    }
+
+    // All inputs have been read, such that the output can alias the input.
+    for (int i = 0; i < 5; ++i)
+    {
+        propagatedKeplerianElements[i] = keplerianElements[i];
+    }
+    propagatedKeplerianElements[trueAnomalyIndex] = propagatedTrueAnomaly;
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A.. Fundamentals of Astrodynamics and Applications. Third Edition, Microcosm Press,
+ *      2007.
+ */
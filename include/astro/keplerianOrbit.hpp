@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+
+//! Keplerian orbit with precomputed perifocal-to-inertial rotation.
+/*!
+ * Describes a fixed Kepler orbit, given by its Keplerian elements, along which Cartesian elements
+ * are evaluated repeatedly for different anomalies (e.g., to generate an ephemeris).
+ *
+ * The per-orbit invariants (the six components of the rotation matrix from the perifocal to the
+ * inertial frame, the semi-latus rectum and \f$\sqrt{\mu/p}\f$) are computed once on
+ * construction. Each evaluation then costs a single sine/cosine pair of the true anomaly, instead
+ * of the eight trigonometric function calls of convertKeplerianToCartesianElements.
+ *
+ * For a given mean anomaly, Kepler's equation is solved for the eccentric anomaly and the position
+ * and velocity are computed directly from the eccentric anomaly (Vallado, 2007):
+ *
+ * \f{eqnarray*}{
+ *      x_{p} &=& a (\cos E - e),                       \quad
+ *      y_{p}  =  a \sqrt{1 - e^{2}} \sin E \\
+ *      \dot{x}_{p} &=& -\frac{\sqrt{\mu / a}}{1 - e \cos E} \sin E,  \quad
+ *      \dot{y}_{p}  =  \frac{\sqrt{\mu / a}}{1 - e \cos E} \sqrt{1 - e^{2}} \cos E
+ * \f}
+ *
+ * for elliptical orbits and analogously, with the hyperbolic eccentric anomaly, for hyperbolic
+ * orbits. As a result, the conversion to true anomaly is avoided and only a single sine/cosine
+ * (hyperbolic sine/cosine) pair is evaluated once the eccentric anomaly is known.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements[0] = semi-latus rectum, since the orbit is parabolic. Evaluation for
+ *          a given mean anomaly is not available for parabolic orbits.
+ *
+ * @sa convertKeplerianToCartesianElements
+ * @tparam    Real     Real type
+ * @tparam    Vector6  6-vector type
+ */
+template <typename Real, typename Vector6>
+class KeplerianOrbit
+{
+public:
+
+    //! Construct Keplerian orbit.
+    /*!
+     * Constructs Keplerian orbit from the given Keplerian elements. The true anomaly stored in the
+     * Keplerian elements is ignored.
+     *
+     * @param     keplerianElements       Keplerian elements, ordered using
+     *                                    KeplerianElementIndices                   [m, -, rad]
+     * @param     gravitationalParameter  Gravitational parameter of central body   [m^3 s^-2]
+     * @param     tolerance               Tolerance used to check for limit case of eccentricity
+     */
+    KeplerianOrbit(const Vector6&  keplerianElements,
+                   const Real      gravitationalParameter,
+                   const Real      tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+        : templateState(keplerianElements),
+          semiMajorAxis(keplerianElements[semiMajorAxisIndex]),
+          eccentricity(keplerianElements[eccentricityIndex]),
+          isParabolic(std::fabs(keplerianElements[eccentricityIndex] - Real(1.0)) <= tolerance)
+    {
+        assert(gravitationalParameter > Real(0.0));
+        assert(eccentricity >= Real(0.0));
+
+        const Real inclination                  = keplerianElements[inclinationIndex];
+        const Real argumentOfPeriapsis          = keplerianElements[argumentOfPeriapsisIndex];
+        const Real longitudeOfAscendingNode
+            = keplerianElements[longitudeOfAscendingNodeIndex];
+
+        const Real cosineOfInclination              = std::cos(inclination);
+        const Real sineOfInclination                = std::sin(inclination);
+        const Real cosineOfArgumentOfPeriapsis      = std::cos(argumentOfPeriapsis);
+        const Real sineOfArgumentOfPeriapsis        = std::sin(argumentOfPeriapsis);
+        const Real cosineOfLongitudeOfAscendingNode = std::cos(longitudeOfAscendingNode);
+        const Real sineOfLongitudeOfAscendingNode   = std::sin(longitudeOfAscendingNode);
+
+        rotationMatrixComponent11
+            = cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+              - sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+        rotationMatrixComponent12
+            = -cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+              - sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination;
+        rotationMatrixComponent21
+            = sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+              + cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+        rotationMatrixComponent22
+            = -sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+              + cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+                * cosineOfInclination;
+        rotationMatrixComponent31 = sineOfArgumentOfPeriapsis * sineOfInclination;
+        rotationMatrixComponent32 = cosineOfArgumentOfPeriapsis * sineOfInclination;
+
+        semiLatusRectum = isParabolic
+            ? keplerianElements[semiMajorAxisIndex]
+            : semiMajorAxis * (Real(1.0) - eccentricity * eccentricity);
+        assert(semiLatusRectum > Real(0.0));
+
+        squareRootGravitationalParameterOverSemiLatusRectum
+            = std::sqrt(gravitationalParameter / semiLatusRectum);
+
+        // Invariants of the eccentric-anomaly formulation. For hyperbolic orbits, the semi-major
+        // axis is negative.
+        squareRootOneMinusEccentricitySquared
+            = std::sqrt(std::fabs(Real(1.0) - eccentricity * eccentricity));
+        squareRootGravitationalParameterOverSemiMajorAxis
+            = isParabolic
+                ? Real(0.0) : std::sqrt(gravitationalParameter / std::fabs(semiMajorAxis));
+    }
+
+    //! Compute Cartesian elements for given true anomaly.
+    /*!
+     * @param     trueAnomaly  True anomaly                                     [rad]
+     * @return                 Cartesian elements, ordered using
+     *                         CartesianElementIndices                          [m, m/s]
+     */
+    Vector6 computeCartesianElements(const Real trueAnomaly) const
+    {
+        Vector6 cartesianElements = templateState;
+
+        Real state[6];
+        computeStateFromTrueAnomaly(trueAnomaly, state);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            cartesianElements[i] = state[i];
+        }
+
+        return cartesianElements;
+    }
+
+    //! Compute Cartesian elements for multiple true anomalies.
+    /*!
+     * Computes the Cartesian elements for each of the given true anomalies and stores them in
+     * structure-of-arrays layout, i.e., as 6 arrays indexed by CartesianElementIndices, similar to
+     * the batch element conversions. The loop body is free of branches, such that it can be
+     * vectorized by the compiler.
+     *
+     * The array of true anomalies may coincide with one of the output arrays.
+     *
+     * @param     trueAnomalies      Array of true anomalies                        [rad]
+     * @param     cartesianElements  Arrays of Cartesian elements (output)          [m, m/s]
+     * @param     numberOfAnomalies  Number of anomalies                            [-]
+     */
+    void computeCartesianElements(const Real* const  trueAnomalies,
+                                  Real* const        cartesianElements[6],
+                                  const std::size_t  numberOfAnomalies) const
+    {
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            Real state[6];
+            computeStateFromTrueAnomaly(trueAnomalies[j], state);
+
+            for (int i = 0; i < 6; ++i)
+            {
+                cartesianElements[i][j] = state[i];
+            }
+        }
+    }
+
+    //! Compute Cartesian elements for given mean anomaly.
+    /*!
+     * Solves Kepler's equation for the eccentric anomaly and computes the Cartesian elements from
+     * the eccentric anomaly. Not available for parabolic orbits.
+     *
+     * If the Newton-Raphson solver for Kepler's equation does not converge within the maximum
+     * number of iterations, a runtime exception is thrown.
+     *
+     * @sa convertEllipticalMeanAnomalyToEccentricAnomaly,
+     *     convertHyperbolicMeanAnomalyToEccentricAnomaly
+     * @param     meanAnomaly  Mean anomaly                                     [rad]
+     * @return                 Cartesian elements, ordered using
+     *                         CartesianElementIndices                          [m, m/s]
+     */
+    Vector6 computeCartesianElementsFromMeanAnomaly(const Real meanAnomaly) const
+    {
+        Vector6 cartesianElements = templateState;
+
+        Real state[6];
+        computeStateFromMeanAnomaly(meanAnomaly, state);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            cartesianElements[i] = state[i];
+        }
+
+        return cartesianElements;
+    }
+
+    //! Compute Cartesian elements for multiple mean anomalies.
+    /*!
+     * Computes the Cartesian elements for each of the given mean anomalies and stores them in
+     * structure-of-arrays layout, i.e., as 6 arrays indexed by CartesianElementIndices. Not
+     * available for parabolic orbits.
+     *
+     * If the Newton-Raphson solver for Kepler's equation does not converge within the maximum
+     * number of iterations, a runtime exception is thrown.
+     *
+     * The array of mean anomalies may coincide with one of the output arrays.
+     *
+     * @sa computeCartesianElementsFromMeanAnomaly
+     * @param     meanAnomalies      Array of mean anomalies                        [rad]
+     * @param     cartesianElements  Arrays of Cartesian elements (output)          [m, m/s]
+     * @param     numberOfAnomalies  Number of anomalies                            [-]
+     */
+    void computeCartesianElementsFromMeanAnomaly(const Real* const  meanAnomalies,
+                                                 Real* const        cartesianElements[6],
+                                                 const std::size_t  numberOfAnomalies) const
+    {
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            Real state[6];
+            computeStateFromMeanAnomaly(meanAnomalies[j], state);
+
+            for (int i = 0; i < 6; ++i)
+            {
+                cartesianElements[i][j] = state[i];
+            }
+        }
+    }
+
+    //! Get semi-latus rectum.
+    /*!
+     * Returns the semi-latus rectum of the orbit.
+     *
+     * @return  Semi-latus rectum  [m]
+     */
+    Real getSemiLatusRectum() const { return semiLatusRectum; }
+
+private:
+
+    //! Rotate perifocal position and velocity to the inertial frame.
+    /*!
+     * @param     xPositionPerifocal  x-position in perifocal frame          [m]
+     * @param     yPositionPerifocal  y-position in perifocal frame          [m]
+     * @param     xVelocityPerifocal  x-velocity in perifocal frame          [m/s]
+     * @param     yVelocityPerifocal  y-velocity in perifocal frame          [m/s]
+     * @param     state               Cartesian elements (output)            [m, m/s]
+     */
+    void rotatePerifocalState(const Real xPositionPerifocal,
+                              const Real yPositionPerifocal,
+                              const Real xVelocityPerifocal,
+                              const Real yVelocityPerifocal,
+                              Real state[6]) const
+    {
+        state[xPositionIndex] = rotationMatrixComponent11 * xPositionPerifocal
+                                + rotationMatrixComponent12 * yPositionPerifocal;
+        state[yPositionIndex] = rotationMatrixComponent21 * xPositionPerifocal
+                                + rotationMatrixComponent22 * yPositionPerifocal;
+        state[zPositionIndex] = rotationMatrixComponent31 * xPositionPerifocal
+                                + rotationMatrixComponent32 * yPositionPerifocal;
+        state[xVelocityIndex] = rotationMatrixComponent11 * xVelocityPerifocal
+                                + rotationMatrixComponent12 * yVelocityPerifocal;
+        state[yVelocityIndex] = rotationMatrixComponent21 * xVelocityPerifocal
+                                + rotationMatrixComponent22 * yVelocityPerifocal;
+        state[zVelocityIndex] = rotationMatrixComponent31 * xVelocityPerifocal
+                                + rotationMatrixComponent32 * yVelocityPerifocal;
+    }
+
+    //! Compute Cartesian elements from true anomaly.
+    /*!
+     * @param     trueAnomaly  True anomaly                                 [rad]
+     * @param     state        Cartesian elements (output)                  [m, m/s]
+     */
+    void computeStateFromTrueAnomaly(const Real trueAnomaly, Real state[6]) const
+    {
+        const Real cosineOfTrueAnomaly = std::cos(trueAnomaly);
+        const Real sineOfTrueAnomaly = std::sin(trueAnomaly);
+
+        const Real radiusMagnitude
+            = semiLatusRectum / (Real(1.0) + eccentricity * cosineOfTrueAnomaly);
+
+        rotatePerifocalState(
+            radiusMagnitude * cosineOfTrueAnomaly,
+            radiusMagnitude * sineOfTrueAnomaly,
+            -squareRootGravitationalParameterOverSemiLatusRectum * sineOfTrueAnomaly,
+            squareRootGravitationalParameterOverSemiLatusRectum
+                * (eccentricity + cosineOfTrueAnomaly),
+            state);
+    }
+
+    //! Compute Cartesian elements from mean anomaly.
+    /*!
+     * @param     meanAnomaly  Mean anomaly                                 [rad]
+     * @param     state        Cartesian elements (output)                  [m, m/s]
+     */
+    void computeStateFromMeanAnomaly(const Real meanAnomaly, Real state[6]) const
+    {
+        assert(!isParabolic);
+
+        if (eccentricity < Real(1.0))
+        {
+            const Real eccentricAnomaly
+                = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, int>(eccentricity,
+                                                                            meanAnomaly);
+            const Real cosineOfEccentricAnomaly = std::cos(eccentricAnomaly);
+            const Real sineOfEccentricAnomaly = std::sin(eccentricAnomaly);
+
+            const Real velocityFactor = squareRootGravitationalParameterOverSemiMajorAxis
+                                        / (Real(1.0) - eccentricity * cosineOfEccentricAnomaly);
+
+            rotatePerifocalState(
+                semiMajorAxis * (cosineOfEccentricAnomaly - eccentricity),
+                semiMajorAxis * squareRootOneMinusEccentricitySquared * sineOfEccentricAnomaly,
+                -velocityFactor * sineOfEccentricAnomaly,
+                velocityFactor * squareRootOneMinusEccentricitySquared * cosineOfEccentricAnomaly,
+                state);
+        }
+        else
+        {
+            const Real hyperbolicEccentricAnomaly
+                = convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, int>(eccentricity,
+                                                                            meanAnomaly);
+            const Real hyperbolicCosineOfEccentricAnomaly = std::cosh(hyperbolicEccentricAnomaly);
+            const Real hyperbolicSineOfEccentricAnomaly = std::sinh(hyperbolicEccentricAnomaly);
+
+            const Real velocityFactor
+                = squareRootGravitationalParameterOverSemiMajorAxis
+                  / (eccentricity * hyperbolicCosineOfEccentricAnomaly - Real(1.0));
+
+            // The semi-major axis is negative for hyperbolic orbits.
+            rotatePerifocalState(
+                semiMajorAxis * (hyperbolicCosineOfEccentricAnomaly - eccentricity),
+                -semiMajorAxis * squareRootOneMinusEccentricitySquared
+                    * hyperbolicSineOfEccentricAnomaly,
+                -velocityFactor * hyperbolicSineOfEccentricAnomaly,
+                velocityFactor * squareRootOneMinusEccentricitySquared
+                    * hyperbolicCosineOfEccentricAnomaly,
+                state);
+        }
+    }
+
+    //! Keplerian elements, used as template for the returned Cartesian elements.
+    const Vector6 templateState;
+
+    //! Semi-major axis (negative for hyperbolic orbits).
+    const Real semiMajorAxis;
+
+    //! Eccentricity.
+    const Real eccentricity;
+
+    //! Flag indicating if the orbit is parabolic.
+    const bool isParabolic;
+
+    //! Components of rotation matrix from perifocal to inertial frame.
+    Real rotationMatrixComponent11;
+    Real rotationMatrixComponent12;
+    Real rotationMatrixComponent21;
+    Real rotationMatrixComponent22;
+    Real rotationMatrixComponent31;
+    Real rotationMatrixComponent32;
+
+    //! Semi-latus rectum.
+    Real semiLatusRectum;
+
+    //! Square root of gravitational parameter over semi-latus rectum.
+    Real squareRootGravitationalParameterOverSemiLatusRectum;
+
+    //! Square root of |1 - e^2|.
+    Real squareRootOneMinusEccentricitySquared;
+
+    //! Square root of gravitational parameter over magnitude of semi-major axis.
+    Real squareRootGravitationalParameterOverSemiMajorAxis;
+};
+
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A.. Fundamentals of Astrodynamics and Applications. Third Edition, Microcosm Press,
+ *      2007.
+ *  Chobotov, V.A. Orbital Mechanics, Third Edition, AIAA Education Series, VA, 2002.
+ */
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include "astro/parallelCatalog.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+
+//! Compute non-dimensional time-of-flight of Lambert problem.
+/*!
+ * Computes the non-dimensional time-of-flight \f$T(x)\f$ of a zero-revolution transfer as function
+ * of Izzo's variable \f$x\f$ and the Lambert parameter \f$\lambda\f$ (Izzo, 2015). Depending on the
+ * distance of \f$x\f$ to 1 (parabolic transfer), Battin's hypergeometric series, Lagrange's
+ * expression or Lancaster's expression is used, to retain accuracy close to the parabolic case.
+ *
+ * @sa solveLambertProblem
+ * @tparam Real    Real type
+ * @param  x       Izzo's variable (-1 < x < 1 for elliptical transfers)     [-]
+ * @param  lambda  Lambert parameter                                         [-]
+ * @return         Non-dimensional time-of-flight                            [-]
+ */
+template <typename Real>
+Real computeLambertTimeOfFlight(const Real x, const Real lambda)
+{
+    const Real battinThreshold = Real(0.01);
+    const Real lagrangeThreshold = Real(0.2);
+    const Real distance = std::fabs(x - Real(1.0));
+
+    if (distance >= battinThreshold && distance < lagrangeThreshold)
+    {
+        // Lagrange's expression, in terms of the semi-major axis.
+        const Real a = Real(1.0) / (Real(1.0) - x * x);
+        if (a > Real(0.0))
+        {
+            const Real alpha = Real(2.0) * std::acos(x);
+            const Real beta = std::copysign(
+                Real(2.0) * std::asin(std::sqrt(lambda * lambda / a)), lambda);
+            return a * std::sqrt(a) * ((alpha - std::sin(alpha)) - (beta - std::sin(beta)))
+                   * Real(0.5);
+        }
+
+        const Real alpha = Real(2.0) * std::acosh(x);
+        const Real beta = std::copysign(
+            Real(2.0) * std::asinh(std::sqrt(-lambda * lambda / a)), lambda);
+        return -a * std::sqrt(-a) * ((beta - std::sinh(beta)) - (alpha - std::sinh(alpha)))
+               * Real(0.5);
+    }
+
+    const Real e = x * x - Real(1.0);
+    const Real z = std::sqrt(Real(1.0) + lambda * lambda * e);
+
+    if (distance < battinThreshold)
+    {
+        // Battin's series, in terms of the hypergeometric function 2F1(3, 1; 5/2; s).
+        const Real eta = z - lambda * x;
+        const Real s = Real(0.5) * (Real(1.0) - lambda - x * eta);
+        Real sum = Real(1.0);
+        Real term = Real(1.0);
+        for (int j = 0; std::fabs(term) > std::numeric_limits<Real>::epsilon() && j < 100; ++j)
+        {
+            const Real k = static_cast<Real>(j);
+            term *= (Real(3.0) + k) * (Real(1.0) + k) / (Real(2.5) + k) * s / (k + Real(1.0));
+            sum += term;
+        }
+        const Real q = Real(4.0) / Real(3.0) * sum;
+        return (eta * eta * eta * q + Real(4.0) * lambda * eta) * Real(0.5);
+    }
+
+    // Lancaster's expression.
+    const Real y = std::sqrt(std::fabs(e));
+    const Real g = x * z - lambda * e;
+    const Real d = e < Real(0.0) ? std::acos(g) : std::log(y * (z - lambda * x) + g);
+    return (x - lambda * z - d / y) / e;
+}
+
+//! Solve Lambert problem.
+/*!
+ * Solves Lambert's problem, i.e., computes the velocities at departure and arrival of the
+ * zero-revolution Kepler orbit that connects the given departure and arrival positions in the
+ * given time-of-flight, using Izzo's algorithm (Izzo, 2015). The problem is reduced to the
+ * solution of the non-dimensional time-of-flight equation \f$T(x) = T\f$ for Izzo's variable
+ * \f$x\f$, starting from an initial guess that is accurate to a few percent, using Householder
+ * iterations of third order:
+ *
+ * \f[
+ *      x_{n+1} = x_{n} - f \frac{f'^{2} - f f'' / 2}{f' (f'^{2} - f f'') + f''' f^{2} / 6},
+ *      \quad f = T(x_{n}) - T
+ * \f]
+ *
+ * where the derivatives of \f$T(x)\f$ are given analytically. This typically converges in 2-3
+ * iterations, with a single evaluation of \f$T(x)\f$ (see computeLambertTimeOfFlight) per
+ * iteration, which makes the solver suitable for large sweeps, e.g., porkchop plots
+ * (see computePorkchopGrid).
+ *
+ * The transfer is prograde (counter-clockwise when viewed from the positive z-axis) by default.
+ * If the departure and arrival positions are collinear, the transfer plane is undefined and the
+ * computed velocities are not finite.
+ *
+ * The iterations stop once the Householder step falls below the tolerance. Since the step is
+ * applied before the check and the iteration converges cubically, the default tolerance of
+ * \f$\sqrt{\epsilon}\f$ leaves \f$x\f$ at working precision, whereas a tolerance near
+ * \f$\epsilon\f$ can stall on round-off in \f$T(x)\f$.
+ *
+ * If the Householder iterations do not converge within the maximum number of iterations, a
+ * runtime exception is thrown.
+ *
+ * @tparam     Real                    Real type
+ * @tparam     Vector3                 3-vector type
+ * @param[in]  departurePosition       Position at departure                          [m]
+ * @param[in]  arrivalPosition         Position at arrival                            [m]
+ * @param[in]  timeOfFlight            Time-of-flight                                 [s]
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body        [m^3 s^-2]
+ * @param[out] departureVelocity       Velocity at departure                          [m/s]
+ * @param[out] arrivalVelocity         Velocity at arrival                            [m/s]
+ * @param[in]  isRetrograde            Flag indicating if transfer is retrograde
+ * @param[in]  tolerance               Tolerance on Izzo's variable                   [-]
+ * @param[in]  maximumIterations       Maximum number of Householder iterations       [-]
+ */
+template <typename Real, typename Vector3>
+void solveLambertProblem(const Vector3& departurePosition,
+                         const Vector3& arrivalPosition,
+                         const Real     timeOfFlight,
+                         const Real     gravitationalParameter,
+                         Vector3&       departureVelocity,
+                         Vector3&       arrivalVelocity,
+                         const bool     isRetrograde = false,
+                         const Real     tolerance
+                                        = std::sqrt(std::numeric_limits<Real>::epsilon()),
+                         const int      maximumIterations = 15)
+{
+    assert(timeOfFlight > Real(0.0));
+    assert(gravitationalParameter > Real(0.0));
+
+    const Real r1[3] = {departurePosition[0], departurePosition[1], departurePosition[2]};
+    const Real r2[3] = {arrivalPosition[0], arrivalPosition[1], arrivalPosition[2]};
+
+    const Real chordVector[3] = {r2[0] - r1[0], r2[1] - r1[1], r2[2] - r1[2]};
+    const Real chord = std::sqrt(chordVector[0] * chordVector[0]
+                                 + chordVector[1] * chordVector[1]
+                                 + chordVector[2] * chordVector[2]);
+    const Real r1Norm = std::sqrt(r1[0] * r1[0] + r1[1] * r1[1] + r1[2] * r1[2]);
+    const Real r2Norm = std::sqrt(r2[0] * r2[0] + r2[1] * r2[1] + r2[2] * r2[2]);
+    const Real semiPerimeter = Real(0.5) * (r1Norm + r2Norm + chord);
+
+    const Real ir1[3] = {r1[0] / r1Norm, r1[1] / r1Norm, r1[2] / r1Norm};
+    const Real ir2[3] = {r2[0] / r2Norm, r2[1] / r2Norm, r2[2] / r2Norm};
+    Real ih[3] = {ir1[1] * ir2[2] - ir1[2] * ir2[1],
+                  ir1[2] * ir2[0] - ir1[0] * ir2[2],
+                  ir1[0] * ir2[1] - ir1[1] * ir2[0]};
+    const Real ihNorm = std::sqrt(ih[0] * ih[0] + ih[1] * ih[1] + ih[2] * ih[2]);
+    for (int i = 0; i < 3; ++i)
+    {
+        ih[i] /= ihNorm;
+    }
+
+    // The transfer angle exceeds pi if the angular momentum of the short-way transfer opposes the
+    // direction of motion, in which case the sign of lambda and of the tangential directions
+    // is flipped.
+    Real lambda = std::sqrt(std::max(Real(1.0) - chord / semiPerimeter, Real(0.0)));
+    Real it1[3] = {ih[1] * ir1[2] - ih[2] * ir1[1],
+                   ih[2] * ir1[0] - ih[0] * ir1[2],
+                   ih[0] * ir1[1] - ih[1] * ir1[0]};
+    Real it2[3] = {ih[1] * ir2[2] - ih[2] * ir2[1],
+                   ih[2] * ir2[0] - ih[0] * ir2[2],
+                   ih[0] * ir2[1] - ih[1] * ir2[0]};
+    const Real sign = ((ih[2] < Real(0.0)) != isRetrograde) ? Real(-1.0) : Real(1.0);
+    lambda *= sign;
+    for (int i = 0; i < 3; ++i)
+    {
+        it1[i] *= sign;
+        it2[i] *= sign;
+    }
+
+    const Real lambdaSquared = lambda * lambda;
+    const Real lambdaCubed = lambdaSquared * lambda;
+    const Real nonDimensionalTimeOfFlight
+        = std::sqrt(Real(2.0) * gravitationalParameter
+                    / (semiPerimeter * semiPerimeter * semiPerimeter))
+          * timeOfFlight;
+
+    // Initial guess (Izzo, 2015), based on the times-of-flight of the minimum-energy (x = 0) and
+    // parabolic (x = 1) transfers.
+    const Real minimumEnergyTimeOfFlight
+        = std::acos(lambda) + lambda * std::sqrt(Real(1.0) - lambdaSquared);
+    const Real parabolicTimeOfFlight = Real(2.0) / Real(3.0) * (Real(1.0) - lambdaCubed);
+    Real x;
+    if (nonDimensionalTimeOfFlight >= minimumEnergyTimeOfFlight)
+    {
+        x = -(nonDimensionalTimeOfFlight - minimumEnergyTimeOfFlight)
+            / (nonDimensionalTimeOfFlight - minimumEnergyTimeOfFlight + Real(4.0));
+    }
+    else if (nonDimensionalTimeOfFlight <= parabolicTimeOfFlight)
+    {
+        x = Real(2.5) * parabolicTimeOfFlight / nonDimensionalTimeOfFlight
+            * (parabolicTimeOfFlight - nonDimensionalTimeOfFlight)
+            / (Real(1.0) - lambdaSquared * lambdaCubed)
+            + Real(1.0);
+    }
+    else
+    {
+        x = std::pow(nonDimensionalTimeOfFlight / minimumEnergyTimeOfFlight,
+                     std::log(Real(2.0))
+                     / std::log(parabolicTimeOfFlight / minimumEnergyTimeOfFlight))
+            - Real(1.0);
+    }
+
+    // Householder iterations.
+    int iteration = 0;
+    for (; iteration < maximumIterations; ++iteration)
+    {
+        const Real t = computeLambertTimeOfFlight(x, lambda);
+        const Real oneMinusXSquared = Real(1.0) - x * x;
+        const Real y = std::sqrt(Real(1.0) - lambdaSquared * oneMinusXSquared);
+        const Real yCubed = y * y * y;
+
+        const Real dt = (Real(3.0) * t * x - Real(2.0) + Real(2.0) * lambdaCubed * x / y)
+                        / oneMinusXSquared;
+        const Real ddt = (Real(3.0) * t + Real(5.0) * x * dt
+                          + Real(2.0) * (Real(1.0) - lambdaSquared) * lambdaCubed / yCubed)
+                         / oneMinusXSquared;
+        const Real dddt = (Real(7.0) * x * ddt + Real(8.0) * dt
+                           - Real(6.0) * (Real(1.0) - lambdaSquared) * lambdaSquared * lambdaCubed
+                             * x / (yCubed * y * y))
+                          / oneMinusXSquared;
+
+        const Real delta = t - nonDimensionalTimeOfFlight;
+        const Real dtSquared = dt * dt;
+        const Real step = delta * (dtSquared - delta * ddt * Real(0.5))
+                          / (dt * (dtSquared - delta * ddt) + dddt * delta * delta / Real(6.0));
+        x -= step;
+
+        if (std::fabs(step) <= tolerance)
+        {
+            break;
+        }
+    }
+
+    if (iteration == maximumIterations)
+    {
+        throw std::runtime_error("ERROR: Lambert solver did not converge!");
+    }
+
+    // Reconstruct the velocities from the radial and tangential components.
+    const Real gamma = std::sqrt(gravitationalParameter * semiPerimeter * Real(0.5));
+    const Real rho = (r1Norm - r2Norm) / chord;
+    const Real sigma = std::sqrt(Real(1.0) - rho * rho);
+    const Real y = std::sqrt(Real(1.0) - lambdaSquared + lambdaSquared * x * x);
+    const Real radialVelocity1 = gamma * ((lambda * y - x) - rho * (lambda * y + x)) / r1Norm;
+    const Real radialVelocity2 = -gamma * ((lambda * y - x) + rho * (lambda * y + x)) / r2Norm;
+    const Real tangentialVelocity = gamma * sigma * (y + lambda * x);
+    const Real tangentialVelocity1 = tangentialVelocity / r1Norm;
+    const Real tangentialVelocity2 = tangentialVelocity / r2Norm;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        departureVelocity[i] = radialVelocity1 * ir1[i] + tangentialVelocity1 * it1[i];
+        arrivalVelocity[i] = radialVelocity2 * ir2[i] + tangentialVelocity2 * it2[i];
+    }
+}
+
+//! Compute porkchop grid.
+/*!
+ * Solves the Lambert problem (see solveLambertProblem) for all combinations of the given departure
+ * and arrival epochs, and computes the excess velocities at departure and arrival, i.e., the
+ * magnitudes of the differences between the velocities of the transfer and the velocities of the
+ * departure and arrival bodies. The squared departure excess velocity is the characteristic
+ * energy C3 that is typically shown in porkchop plots.
+ *
+ * The grid is divided into square tiles of departure and arrival epochs, which are distributed
+ * over the threads using executeInParallel, such that the states of the bodies used by a tile and
+ * the grid rows written by it remain in cache.
+ *
+ * The excess velocities are stored row-major, i.e., the values for departure epoch i and arrival
+ * epoch j are stored at index i * numberOfArrivalEpochs + j. For combinations in which the arrival
+ * epoch does not follow the departure epoch, the excess velocities are set to NaN.
+ *
+ * If the Lambert solver does not converge, a runtime exception is thrown.
+ *
+ * @sa solveLambertProblem, executeInParallel
+ * @tparam     Real                       Real type
+ * @param[in]  departureEpochs            Array of departure epochs                       [s]
+ * @param[in]  departureStates            Array of pointers to Cartesian element arrays of
+ *                                        departure body at departure epochs, ordered using
+ *                                        CartesianElementIndices                         [m, m/s]
+ * @param[in]  numberOfDepartureEpochs    Number of departure epochs                      [-]
+ * @param[in]  arrivalEpochs              Array of arrival epochs                         [s]
+ * @param[in]  arrivalStates              Array of pointers to Cartesian element arrays of
+ *                                        arrival body at arrival epochs, ordered using
+ *                                        CartesianElementIndices                         [m, m/s]
+ * @param[in]  numberOfArrivalEpochs      Number of arrival epochs                        [-]
+ * @param[in]  gravitationalParameter     Gravitational parameter of central body         [m^3 s^-2]
+ * @param[out] departureExcessVelocities  Excess velocities at departure                  [m/s]
+ * @param[out] arrivalExcessVelocities    Excess velocities at arrival                    [m/s]
+ * @param[in]  numberOfThreads            Number of threads (0 for hardware concurrency)  [-]
+ */
+template <typename Real>
+void computePorkchopGrid(const Real* const  departureEpochs,
+                         const Real* const  departureStates[6],
+                         const std::size_t  numberOfDepartureEpochs,
+                         const Real* const  arrivalEpochs,
+                         const Real* const  arrivalStates[6],
+                         const std::size_t  numberOfArrivalEpochs,
+                         const Real         gravitationalParameter,
+                         Real* const        departureExcessVelocities,
+                         Real* const        arrivalExcessVelocities,
+                         const std::size_t  numberOfThreads = 0)
+{
+    typedef std::array<Real, 3> Vector3;
+
+    const std::size_t tileSize = 64;
+    const std::size_t numberOfDepartureTiles = (numberOfDepartureEpochs + tileSize - 1) / tileSize;
+    const std::size_t numberOfArrivalTiles = (numberOfArrivalEpochs + tileSize - 1) / tileSize;
+
+    executeInParallel(
+        numberOfDepartureTiles * numberOfArrivalTiles,
+        [&](const std::size_t beginTile, const std::size_t endTile)
+        {
+            for (std::size_t tile = beginTile; tile < endTile; ++tile)
+            {
+                const std::size_t beginDeparture = (tile / numberOfArrivalTiles) * tileSize;
+                const std::size_t endDeparture
+                    = std::min(beginDeparture + tileSize, numberOfDepartureEpochs);
+                const std::size_t beginArrival = (tile % numberOfArrivalTiles) * tileSize;
+                const std::size_t endArrival
+                    = std::min(beginArrival + tileSize, numberOfArrivalEpochs);
+
+                for (std::size_t i = beginDeparture; i < endDeparture; ++i)
+                {
+                    const Vector3 departurePosition = {{departureStates[xPositionIndex][i],
+                                                        departureStates[yPositionIndex][i],
+                                                        departureStates[zPositionIndex][i]}};
+                    for (std::size_t j = beginArrival; j < endArrival; ++j)
+                    {
+                        const std::size_t index = i * numberOfArrivalEpochs + j;
+                        const Real timeOfFlight = arrivalEpochs[j] - departureEpochs[i];
+                        if (!(timeOfFlight > Real(0.0)))
+                        {
+                            departureExcessVelocities[index]
+                                = std::numeric_limits<Real>::quiet_NaN();
+                            arrivalExcessVelocities[index]
+                                = std::numeric_limits<Real>::quiet_NaN();
+                            continue;
+                        }
+
+                        const Vector3 arrivalPosition = {{arrivalStates[xPositionIndex][j],
+                                                          arrivalStates[yPositionIndex][j],
+                                                          arrivalStates[zPositionIndex][j]}};
+                        Vector3 departureVelocity;
+                        Vector3 arrivalVelocity;
+                        solveLambertProblem(departurePosition,
+                                            arrivalPosition,
+                                            timeOfFlight,
+                                            gravitationalParameter,
+                                            departureVelocity,
+                                            arrivalVelocity);
+
+                        Real departureExcessVelocitySquared = Real(0.0);
+                        Real arrivalExcessVelocitySquared = Real(0.0);
+                        for (std::size_t k = 0; k < 3; ++k)
+                        {
+                            const Real departureDifference
+                                = departureVelocity[k] - departureStates[xVelocityIndex + k][i];
+                            const Real arrivalDifference
+                                = arrivalVelocity[k] - arrivalStates[xVelocityIndex + k][j];
+                            departureExcessVelocitySquared
+                                += departureDifference * departureDifference;
+                            arrivalExcessVelocitySquared += arrivalDifference * arrivalDifference;
+                        }
+                        departureExcessVelocities[index]
+                            = std::sqrt(departureExcessVelocitySquared);
+                        arrivalExcessVelocities[index] = std::sqrt(arrivalExcessVelocitySquared);
+                    }
+                }
+            }
+        },
+        numberOfThreads,
+        1);
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Izzo, D. Revisiting Lambert's problem. Celestial Mechanics and Dynamical Astronomy, 121(1),
+ *      1-15, 2015.
+ */
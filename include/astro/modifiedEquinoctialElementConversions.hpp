@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "astro/stateVectorIndices.hpp"
+#include "astro/vectorTraits.hpp"
+
+namespace astro
+{
+
+//! Convert Cartesian elements to modified equinoctial elements, writing into given output vector.
+/*!
+ * Converts a given set of Cartesian elements to modified equinoctial elements, identical to the
+ * conversion that returns a vector of modified equinoctial elements, but writes into a
+ * caller-provided output vector. The input and output vectors can be of any type whose elements
+ * are accessed with operator[] (see IsVector). The conversion can be performed in-place, i.e., the
+ * output can be the input.
+ *
+ * @sa IsVector
+ * @tparam     Real                         Real type
+ * @tparam     InputVector6                 6-vector type of input
+ * @tparam     OutputVector6                6-vector type of output
+ * @param[in]  cartesianElements            Cartesian elements, ordered using
+ *                                          CartesianElementIndices                  [m, m/s]
+ * @param[in]  gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ * @param[out] modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                          ModifiedEquinoctialElementIndices        [m, -, rad]
+ */
+template <typename Real, typename InputVector6, typename OutputVector6>
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertCartesianToModifiedEquinoctialElements(const InputVector6& cartesianElements,
+                                              const Real          gravitationalParameter,
+                                              OutputVector6&&     modifiedEquinoctialElements)
+{
+    assert(hasVectorSize(cartesianElements, 6));
+    assert(hasVectorSize(modifiedEquinoctialElements, 6));
+    assert(gravitationalParameter > Real(0.0));
+
+    const Real pi = Real(3.14159265358979323846);
+
+    const Real position[3] = {cartesianElements[xPositionIndex],
+                              cartesianElements[yPositionIndex],
+                              cartesianElements[zPositionIndex]};
+    const Real velocity[3] = {cartesianElements[xVelocityIndex],
+                              cartesianElements[yVelocityIndex],
+                              cartesianElements[zVelocityIndex]};
+
+    const Real positionNorm = std::sqrt(position[0] * position[0]
+                                        + position[1] * position[1]
+                                        + position[2] * position[2]);
+
+    // Compute angular momentum vector and its norm.
+    const Real angularMomentum[3]
+        = {position[1] * velocity[2] - position[2] * velocity[1],
+           position[2] * velocity[0] - position[0] * velocity[2],
+           position[0] * velocity[1] - position[1] * velocity[0]};
+    const Real angularMomentumNormSquared = angularMomentum[0] * angularMomentum[0]
+                                            + angularMomentum[1] * angularMomentum[1]
+                                            + angularMomentum[2] * angularMomentum[2];
+    const Real angularMomentumNorm = std::sqrt(angularMomentumNormSquared);
+
+    // Compute h and k from the unit angular momentum vector, using
+    // tan(i/2) = sin(i) / (1 + cos(i)).
+    const Real hkDenominator = angularMomentumNorm + angularMomentum[2];
+    const Real h = -angularMomentum[1] / hkDenominator;
+    const Real k = angularMomentum[0] / hkDenominator;
+
+    // Compute unit vectors of the equinoctial frame.
+    const Real hSquared = h * h;
+    const Real kSquared = k * k;
+    const Real sSquaredInverse = Real(1.0) / (Real(1.0) + hSquared + kSquared);
+    const Real fUnitVector[3] = {(Real(1.0) - kSquared + hSquared) * sSquaredInverse,
+                                 Real(2.0) * h * k * sSquaredInverse,
+                                 -Real(2.0) * k * sSquaredInverse};
+    const Real gUnitVector[3] = {Real(2.0) * h * k * sSquaredInverse,
+                                 (Real(1.0) + kSquared - hSquared) * sSquaredInverse,
+                                 Real(2.0) * h * sSquaredInverse};
+
+    // Compute eccentricity vector, e = (v x H) / mu - r / |r|.
+    const Real gravitationalParameterInverse = Real(1.0) / gravitationalParameter;
+    const Real positionNormInverse = Real(1.0) / positionNorm;
+    const Real eccentricityVector[3]
+        = {(velocity[1] * angularMomentum[2] - velocity[2] * angularMomentum[1])
+               * gravitationalParameterInverse - position[0] * positionNormInverse,
+           (velocity[2] * angularMomentum[0] - velocity[0] * angularMomentum[2])
+               * gravitationalParameterInverse - position[1] * positionNormInverse,
+           (velocity[0] * angularMomentum[1] - velocity[1] * angularMomentum[0])
+               * gravitationalParameterInverse - position[2] * positionNormInverse};
+
+    // Compute true longitude from the position vector in the equinoctial frame.
+    const Real trueLongitudeAngle
+        = std::atan2(position[0] * gUnitVector[0]
+                     + position[1] * gUnitVector[1]
+                     + position[2] * gUnitVector[2],
+                     position[0] * fUnitVector[0]
+                     + position[1] * fUnitVector[1]
+                     + position[2] * fUnitVector[2]);
+
+    modifiedEquinoctialElements[semiLatusRectumEquinoctialIndex]
+        = angularMomentumNormSquared * gravitationalParameterInverse;
+    modifiedEquinoctialElements[fEquinoctialIndex]
+        = eccentricityVector[0] * fUnitVector[0]
+          + eccentricityVector[1] * fUnitVector[1]
+          + eccentricityVector[2] * fUnitVector[2];
+    modifiedEquinoctialElements[gEquinoctialIndex]
+        = eccentricityVector[0] * gUnitVector[0]
+          + eccentricityVector[1] * gUnitVector[1]
+          + eccentricityVector[2] * gUnitVector[2];
+    modifiedEquinoctialElements[hEquinoctialIndex] = h;
+    modifiedEquinoctialElements[kEquinoctialIndex] = k;
+    modifiedEquinoctialElements[trueLongitudeEquinoctialIndex]
+        = trueLongitudeAngle < Real(0.0) ? trueLongitudeAngle + Real(2.0) * pi : trueLongitudeAngle;
+}
+
+//! Convert Cartesian elements to modified equinoctial elements.
+/*!
+ * Converts a given set of Cartesian elements (position, velocity) to modified equinoctial elements
+ * (MEE), given by (Walker et al., 1985):
+ *
+ * \f{eqnarray*}{
+ *      p &=& a (1 - e^{2}) \\
+ *      f &=& e \cos(\omega + \Omega), \quad g = e \sin(\omega + \Omega) \\
+ *      h &=& \tan(i / 2) \cos\Omega, \quad k = \tan(i / 2) \sin\Omega \\
+ *      L &=& \Omega + \omega + \nu
+ * \f}
+ *
+ * The elements are computed from the angular momentum and eccentricity vectors, projected onto
+ * the equinoctial frame (Betts, 2010). In contrast to the conversion to Keplerian elements, the
+ * MEE are non-singular for circular and equatorial orbits, such that no limit cases need to be
+ * treated and the conversion is free of branches. The MEE are singular for retrograde equatorial
+ * orbits (inclination = pi).
+ *
+ * The true longitude is returned in the range [0, 2pi).
+ *
+ * @sa convertModifiedEquinoctialToCartesianElements, convertCartesianToKeplerianElements
+ * @tparam  Real                    Real type
+ * @tparam  Vector6                 6-vector type
+ * @param   cartesianElements       Cartesian elements, ordered using
+ *                                  CartesianElementIndices                       [m, m/s]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @return                          Modified equinoctial elements, ordered using
+ *                                  ModifiedEquinoctialElementIndices             [m, -, rad]
+ */
+template <typename Real, typename Vector6>
+Vector6 convertCartesianToModifiedEquinoctialElements(const Vector6& cartesianElements,
+                                                      const Real    gravitationalParameter)
+{
+    Vector6 modifiedEquinoctialElements = cartesianElements;
+    convertCartesianToModifiedEquinoctialElements(
+        cartesianElements, gravitationalParameter, modifiedEquinoctialElements);
+    return modifiedEquinoctialElements;
+}
+
+//! Convert modified equinoctial elements to Cartesian elements, writing into given output vector.
+/*!
+ * Converts a given set of modified equinoctial elements to Cartesian elements, identical to the
+ * conversion that returns a vector of Cartesian elements, but writes into a caller-provided output
+ * vector. The input and output vectors can be of any type whose elements are accessed with
+ * operator[] (see IsVector). The conversion can be performed in-place, i.e., the output can be the
+ * input.
+ *
+ * @sa IsVector
+ * @tparam     Real                         Real type
+ * @tparam     InputVector6                 6-vector type of input
+ * @tparam     OutputVector6                6-vector type of output
+ * @param[in]  modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                          ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param[in]  gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ * @param[out] cartesianElements            Cartesian elements, ordered using
+ *                                          CartesianElementIndices                  [m, m/s]
+ */
+template <typename Real, typename InputVector6, typename OutputVector6>
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertModifiedEquinoctialToCartesianElements(const InputVector6& modifiedEquinoctialElements,
+                                              const Real          gravitationalParameter,
+                                              OutputVector6&&     cartesianElements)
+{
+    assert(hasVectorSize(modifiedEquinoctialElements, 6));
+    assert(hasVectorSize(cartesianElements, 6));
+    assert(gravitationalParameter > Real(0.0));
+
+    const Real semiLatusRectum = modifiedEquinoctialElements[semiLatusRectumEquinoctialIndex];
+    const Real f = modifiedEquinoctialElements[fEquinoctialIndex];
+    const Real g = modifiedEquinoctialElements[gEquinoctialIndex];
+    const Real h = modifiedEquinoctialElements[hEquinoctialIndex];
+    const Real k = modifiedEquinoctialElements[kEquinoctialIndex];
+    const Real trueLongitude = modifiedEquinoctialElements[trueLongitudeEquinoctialIndex];
+
+    const Real cosineOfTrueLongitude = std::cos(trueLongitude);
+    const Real sineOfTrueLongitude = std::sin(trueLongitude);
+
+    const Real alphaSquared = h * h - k * k;
+    const Real sSquaredInverse = Real(1.0) / (Real(1.0) + h * h + k * k);
+    const Real twoHK = Real(2.0) * h * k;
+
+    const Real radius
+        = semiLatusRectum / (Real(1.0) + f * cosineOfTrueLongitude + g * sineOfTrueLongitude);
+    const Real positionFactor = radius * sSquaredInverse;
+    const Real velocityFactor
+        = std::sqrt(gravitationalParameter / semiLatusRectum) * sSquaredInverse;
+
+    cartesianElements[xPositionIndex]
+        = positionFactor * ((Real(1.0) + alphaSquared) * cosineOfTrueLongitude
+                            + twoHK * sineOfTrueLongitude);
+    cartesianElements[yPositionIndex]
+        = positionFactor * ((Real(1.0) - alphaSquared) * sineOfTrueLongitude
+                            + twoHK * cosineOfTrueLongitude);
+    cartesianElements[zPositionIndex]
+        = Real(2.0) * positionFactor * (h * sineOfTrueLongitude - k * cosineOfTrueLongitude);
+
+    cartesianElements[xVelocityIndex]
+        = -velocityFactor * ((Real(1.0) + alphaSquared) * (sineOfTrueLongitude + g)
+                             - twoHK * (cosineOfTrueLongitude + f));
+    cartesianElements[yVelocityIndex]
+        = -velocityFactor * ((alphaSquared - Real(1.0)) * (cosineOfTrueLongitude + f)
+                             + twoHK * (sineOfTrueLongitude + g));
+    cartesianElements[zVelocityIndex]
+        = Real(2.0) * velocityFactor
+          * (h * (cosineOfTrueLongitude + f) + k * (sineOfTrueLongitude + g));
+}
+
+//! Convert modified equinoctial elements to Cartesian elements.
+/*!
+ * Converts a given set of modified equinoctial elements (MEE) to Cartesian elements (position,
+ * velocity). The conversion is given by (Betts, 2010):
+ *
+ * \f{eqnarray*}{
+ *      \vec{r} &=& \frac{r}{s^{2}} \left[ \begin{array}{c}
+ *          \cos L + \alpha^{2} \cos L + 2 h k \sin L \\
+ *          \sin L - \alpha^{2} \sin L + 2 h k \cos L \\
+ *          2 (h \sin L - k \cos L)
+ *      \end{array} \right] \\
+ *      \vec{v} &=& -\frac{1}{s^{2}} \sqrt{\frac{\mu}{p}} \left[ \begin{array}{c}
+ *          \sin L + \alpha^{2} \sin L - 2 h k \cos L + g - 2 f h k + \alpha^{2} g \\
+ *          -\cos L + \alpha^{2} \cos L + 2 h k \sin L - f + 2 g h k + \alpha^{2} f \\
+ *          -2 (h \cos L + k \sin L + f h + g k)
+ *      \end{array} \right]
+ * \f}
+ *
+ * where \f$\alpha^{2} = h^{2} - k^{2}\f$, \f$s^{2} = 1 + h^{2} + k^{2}\f$ and
+ * \f$r = p / (1 + f \cos L + g \sin L)\f$. The conversion is valid for all orbits (including
+ * parabolic orbits) and is free of branches.
+ *
+ * @sa convertCartesianToModifiedEquinoctialElements
+ * @tparam  Real                         Real type
+ * @tparam  Vector6                      6-vector type
+ * @param   modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                       ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param   gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ * @return                               Cartesian elements, ordered using
+ *                                       CartesianElementIndices                  [m, m/s]
+ */
+template <typename Real, typename Vector6>
+Vector6 convertModifiedEquinoctialToCartesianElements(const Vector6& modifiedEquinoctialElements,
+                                                      const Real    gravitationalParameter)
+{
+    Vector6 cartesianElements = modifiedEquinoctialElements;
+    convertModifiedEquinoctialToCartesianElements(
+        modifiedEquinoctialElements, gravitationalParameter, cartesianElements);
+    return cartesianElements;
+}
+
+//! Convert Keplerian elements to modified equinoctial elements, writing into given output vector.
+/*!
+ * Converts a given set of Keplerian elements to modified equinoctial elements, identical to the
+ * conversion that returns a vector of modified equinoctial elements, but writes into a
+ * caller-provided output vector. The input and output vectors can be of any type whose elements
+ * are accessed with operator[] (see IsVector). The conversion can be performed in-place, i.e., the
+ * output can be the input.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements[0] = semi-latus rectum, since the orbit is parabolic.
+ *
+ * @sa IsVector
+ * @tparam     InputVector6                 6-vector type of input
+ * @tparam     OutputVector6                6-vector type of output
+ * @tparam     Real                         Real type (defaults to element type of input)
+ * @param[in]  keplerianElements            Keplerian elements, ordered using
+ *                                          KeplerianElementIndices                  [m, -, rad]
+ * @param[out] modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                          ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param[in]  tolerance                    Tolerance used to check for limit case of
+ *                                          eccentricity
+ */
+template <typename InputVector6,
+          typename OutputVector6,
+          typename Real = typename VectorTraits<InputVector6>::ValueType>
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertKeplerianToModifiedEquinoctialElements(
+    const InputVector6& keplerianElements,
+    OutputVector6&& modifiedEquinoctialElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    assert(hasVectorSize(keplerianElements, 6));
+    assert(hasVectorSize(modifiedEquinoctialElements, 6));
+
+    const Real pi = Real(3.14159265358979323846);
+
+    const Real semiMajorAxis            = keplerianElements[semiMajorAxisIndex];
+    const Real eccentricity             = keplerianElements[eccentricityIndex];
+    const Real inclination              = keplerianElements[inclinationIndex];
+    const Real argumentOfPeriapsis      = keplerianElements[argumentOfPeriapsisIndex];
+    const Real longitudeOfAscendingNode = keplerianElements[longitudeOfAscendingNodeIndex];
+    const Real trueAnomaly              = keplerianElements[trueAnomalyIndex];
+
+    const Real longitudeOfPeriapsis = argumentOfPeriapsis + longitudeOfAscendingNode;
+    const Real tangentOfHalfInclination = std::tan(Real(0.5) * inclination);
+
+    const bool isParabolic = std::fabs(eccentricity - Real(1.0)) <= tolerance;
+    modifiedEquinoctialElements[semiLatusRectumEquinoctialIndex]
+        = isParabolic ? semiMajorAxis : semiMajorAxis * (Real(1.0) - eccentricity * eccentricity);
+    modifiedEquinoctialElements[fEquinoctialIndex] = eccentricity * std::cos(longitudeOfPeriapsis);
+    modifiedEquinoctialElements[gEquinoctialIndex] = eccentricity * std::sin(longitudeOfPeriapsis);
+    modifiedEquinoctialElements[hEquinoctialIndex]
+        = tangentOfHalfInclination * std::cos(longitudeOfAscendingNode);
+    modifiedEquinoctialElements[kEquinoctialIndex]
+        = tangentOfHalfInclination * std::sin(longitudeOfAscendingNode);
+
+    const Real trueLongitude = std::fmod(longitudeOfPeriapsis + trueAnomaly, Real(2.0) * pi);
+    modifiedEquinoctialElements[trueLongitudeEquinoctialIndex]
+        = trueLongitude < Real(0.0) ? trueLongitude + Real(2.0) * pi : trueLongitude;
+}
+
+//! Convert Keplerian elements to modified equinoctial elements.
+/*!
+ * Converts a given set of Keplerian (osculating) elements to modified equinoctial elements (MEE).
+ * The definition of the MEE is given in convertCartesianToModifiedEquinoctialElements.
+ *
+ * The true longitude is returned in the range [0, 2pi).
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements[0] = semi-latus rectum, since the orbit is parabolic.
+ *
+ * @sa convertCartesianToModifiedEquinoctialElements
+ * @tparam  Vector6                 6-vector type
+ * @tparam  Real                    Real type (defaults to value type of 6-vector type)
+ * @param   keplerianElements       Keplerian elements, ordered using
+ *                                  KeplerianElementIndices                       [m, -, rad]
+ * @param   tolerance               Tolerance used to check for limit case of eccentricity
+ * @return                          Modified equinoctial elements, ordered using
+ *                                  ModifiedEquinoctialElementIndices             [m, -, rad]
+ */
+template <typename Vector6, typename Real = typename Vector6::value_type>
+typename std::enable_if<!IsVector<Real>::value, Vector6>::type
+convertKeplerianToModifiedEquinoctialElements(
+    const Vector6& keplerianElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    Vector6 modifiedEquinoctialElements = keplerianElements;
+    convertKeplerianToModifiedEquinoctialElements(
+        keplerianElements, modifiedEquinoctialElements, tolerance);
+    return modifiedEquinoctialElements;
+}
+
+//! Convert modified equinoctial elements to Keplerian elements, writing into given output vector.
+/*!
+ * Converts a given set of modified equinoctial elements to Keplerian elements, identical to the
+ * conversion that returns a vector of Keplerian elements, but writes into a caller-provided output
+ * vector. The input and output vectors can be of any type whose elements are accessed with
+ * operator[] (see IsVector). The conversion can be performed in-place, i.e., the output can be the
+ * input.
+ *
+ * The limit cases are treated as described below for the conversion that returns a vector.
+ *
+ * @sa IsVector
+ * @tparam     InputVector6                 6-vector type of input
+ * @tparam     OutputVector6                6-vector type of output
+ * @tparam     Real                         Real type (defaults to element type of input)
+ * @param[in]  modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                          ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param[out] keplerianElements            Keplerian elements, ordered using
+ *                                          KeplerianElementIndices                  [m, -, rad]
+ * @param[in]  tolerance                    Tolerance used to check for limit cases of
+ *                                          eccentricity and inclination
+ */
+template <typename InputVector6,
+          typename OutputVector6,
+          typename Real = typename VectorTraits<InputVector6>::ValueType>
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertModifiedEquinoctialToKeplerianElements(
+    const InputVector6& modifiedEquinoctialElements,
+    OutputVector6&& keplerianElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    assert(hasVectorSize(modifiedEquinoctialElements, 6));
+    assert(hasVectorSize(keplerianElements, 6));
+
+    const Real pi = Real(3.14159265358979323846);
+
+    const Real semiLatusRectum = modifiedEquinoctialElements[semiLatusRectumEquinoctialIndex];
+    const Real f = modifiedEquinoctialElements[fEquinoctialIndex];
+    const Real g = modifiedEquinoctialElements[gEquinoctialIndex];
+    const Real h = modifiedEquinoctialElements[hEquinoctialIndex];
+    const Real k = modifiedEquinoctialElements[kEquinoctialIndex];
+    const Real trueLongitude = modifiedEquinoctialElements[trueLongitudeEquinoctialIndex];
+
+    const Real eccentricitySquared = f * f + g * g;
+    const Real eccentricity = std::sqrt(eccentricitySquared);
+    const Real tangentOfHalfInclination = std::sqrt(h * h + k * k);
+
+    const bool isParabolic = std::fabs(eccentricity - Real(1.0)) <= tolerance;
+    const bool isCircular = eccentricity < tolerance;
+    const bool isEquatorial = tangentOfHalfInclination < tolerance;
+
+    const Real longitudeOfAscendingNode = isEquatorial ? Real(0.0) : std::atan2(k, h);
+    const Real longitudeOfPeriapsis = isCircular ? longitudeOfAscendingNode : std::atan2(g, f);
+
+    const Real argumentOfPeriapsis
+        = std::fmod(longitudeOfPeriapsis - longitudeOfAscendingNode + Real(2.0) * pi,
+                    Real(2.0) * pi);
+    const Real trueAnomaly = std::fmod(trueLongitude - longitudeOfPeriapsis, Real(2.0) * pi);
+
+    keplerianElements[semiMajorAxisIndex]
+        = isParabolic ? semiLatusRectum : semiLatusRectum / (Real(1.0) - eccentricitySquared);
+    keplerianElements[eccentricityIndex] = eccentricity;
+    keplerianElements[inclinationIndex] = Real(2.0) * std::atan(tangentOfHalfInclination);
+    keplerianElements[argumentOfPeriapsisIndex] = argumentOfPeriapsis;
+    keplerianElements[longitudeOfAscendingNodeIndex]
+        = longitudeOfAscendingNode < Real(0.0)
+            ? longitudeOfAscendingNode + Real(2.0) * pi : longitudeOfAscendingNode;
+    keplerianElements[trueAnomalyIndex]
+        = trueAnomaly < Real(0.0) ? trueAnomaly + Real(2.0) * pi : trueAnomaly;
+}
+
+//! Convert modified equinoctial elements to Keplerian elements.
+/*!
+ * Converts a given set of modified equinoctial elements (MEE) to Keplerian (osculating) elements.
+ * The definition of the MEE is given in convertCartesianToModifiedEquinoctialElements.
+ *
+ * The limit cases of the Keplerian elements are selected without branches:
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, keplerianElements[0] = semi-latus rectum,
+ *          since the orbit is parabolic.
+ * WARNING: If eccentricity is 0.0 within tolerance, argument of periapsis is set to 0.0, such that
+ *          keplerianElements[5] = argument of latitude (inclined orbit) or true longitude
+ *          (equatorial orbit).
+ * WARNING: If inclination is 0.0 within tolerance, longitude of ascending node is set to 0.0, such
+ *          that keplerianElements[3] = longitude of periapsis.
+ *
+ * All angles are returned in the range [0, 2pi).
+ *
+ * @sa convertModifiedEquinoctialToCartesianElements
+ * @tparam  Vector6                      6-vector type
+ * @tparam  Real                         Real type (defaults to value type of 6-vector type)
+ * @param   modifiedEquinoctialElements  Modified equinoctial elements, ordered using
+ *                                       ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param   tolerance                    Tolerance used to check for limit cases of eccentricity
+ *                                       and inclination
+ * @return                               Keplerian elements, ordered using
+ *                                       KeplerianElementIndices                  [m, -, rad]
+ */
+template <typename Vector6, typename Real = typename Vector6::value_type>
+typename std::enable_if<!IsVector<Real>::value, Vector6>::type
+convertModifiedEquinoctialToKeplerianElements(
+    const Vector6& modifiedEquinoctialElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    Vector6 keplerianElements = modifiedEquinoctialElements;
+    convertModifiedEquinoctialToKeplerianElements(
+        modifiedEquinoctialElements, keplerianElements, tolerance);
+    return keplerianElements;
+}
+
+//! Convert batch of Cartesian elements to modified equinoctial elements.
+/*!
+ * Converts a batch of Cartesian elements, stored as a structure-of-arrays (one array per element),
+ * to modified equinoctial elements (MEE). The conversion is identical to that of the single-state
+ * conversion. Since the conversion has no limit cases, the loop body is free of branches and can
+ * be vectorized by the compiler (requires a vector math library for atan2, see
+ * convertKeplerianToCartesianElements).
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * @sa convertCartesianToModifiedEquinoctialElements
+ * @tparam  Real                         Real type
+ * @param   cartesianElements            Array of pointers to Cartesian element arrays, ordered
+ *                                       using CartesianElementIndices            [m, m/s]
+ * @param   modifiedEquinoctialElements  Array of pointers to MEE arrays, ordered using
+ *                                       ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param   numberOfStates               Number of states stored in each array
+ * @param   gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ */
+template <typename Real>
+void convertCartesianToModifiedEquinoctialElements(
+    const Real* const cartesianElements[6],
+    Real* const modifiedEquinoctialElements[6],
+    const std::size_t numberOfStates,
+    const Real gravitationalParameter)
+{
+    typedef std::array<Real, 6> State;
+
+    // The batch is processed in blocks that are staged in local arrays, which guarantees to the
+    // compiler that the inputs and outputs in the loop kernel do not alias.
+    const std::size_t blockSize = 64;
+    Real input[6][blockSize];
+    Real output[6][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfStates; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfStates - blockStart);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(cartesianElements[k] + blockStart,
+                      cartesianElements[k] + blockStart + blockLength,
+                      input[k]);
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const State state = {{input[0][i], input[1][i], input[2][i],
+                                  input[3][i], input[4][i], input[5][i]}};
+            const State convertedState
+                = convertCartesianToModifiedEquinoctialElements(state, gravitationalParameter);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                output[k][i] = convertedState[k];
+            }
+        }
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(output[k],
+                      output[k] + blockLength,
+                      modifiedEquinoctialElements[k] + blockStart);
+        }
+    }
+}
+
+//! Convert batch of modified equinoctial elements to Cartesian elements.
+/*!
+ * Converts a batch of modified equinoctial elements (MEE), stored as a structure-of-arrays (one
+ * array per element), to Cartesian elements. The conversion is identical to that of the
+ * single-state conversion. Since the conversion has no limit cases, the loop body is free of
+ * branches and can be vectorized by the compiler (requires a vector math library for sine and
+ * cosine, see convertKeplerianToCartesianElements).
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * @sa convertModifiedEquinoctialToCartesianElements
+ * @tparam  Real                         Real type
+ * @param   modifiedEquinoctialElements  Array of pointers to MEE arrays, ordered using
+ *                                       ModifiedEquinoctialElementIndices        [m, -, rad]
+ * @param   cartesianElements            Array of pointers to Cartesian element arrays, ordered
+ *                                       using CartesianElementIndices            [m, m/s]
+ * @param   numberOfStates               Number of states stored in each array
+ * @param   gravitationalParameter       Gravitational parameter of central body  [m^3 s^-2]
+ */
+template <typename Real>
+void convertModifiedEquinoctialToCartesianElements(
+    const Real* const modifiedEquinoctialElements[6],
+    Real* const cartesianElements[6],
+    const std::size_t numberOfStates,
+    const Real gravitationalParameter)
+{
+    typedef std::array<Real, 6> State;
+
+    // The batch is processed in blocks that are staged in local arrays, which guarantees to the
+    // compiler that the inputs and outputs in the loop kernel do not alias.
+    const std::size_t blockSize = 64;
+    Real input[6][blockSize];
+    Real output[6][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfStates; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfStates - blockStart);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(modifiedEquinoctialElements[k] + blockStart,
+                      modifiedEquinoctialElements[k] + blockStart + blockLength,
+                      input[k]);
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const State state = {{input[0][i], input[1][i], input[2][i],
+                                  input[3][i], input[4][i], input[5][i]}};
+            const State convertedState
+                = convertModifiedEquinoctialToCartesianElements(state, gravitationalParameter);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                output[k][i] = convertedState[k];
+            }
+        }
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(output[k], output[k] + blockLength, cartesianElements[k] + blockStart);
+        }
+    }
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Walker, M.J.H., Ireland, B., Owens, J. A Set of Modified Equinoctial Orbit Elements. Celestial
+ *      Mechanics, 36(4), 409-419, 1985.
+ *  Betts, J.T. Practical Methods for Optimal Control and Estimation Using Nonlinear Programming.
+ *      Second Edition, SIAM, 2010.
+ */
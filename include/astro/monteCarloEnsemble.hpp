@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "astro/hostDevice.hpp"
+#include "astro/integrators.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/parallelCatalog.hpp"
+#include "astro/vectorTraits.hpp"
+
+namespace astro
+{
+
+//! Generate random numbers using the Philox4x32-10 counter-based generator.
+/*!
+ * Generates four 32-bit random numbers for a given 128-bit counter and 64-bit key, using 10
+ * rounds of the Philox4x32 bijection (Salmon et al., 2011). In contrast to sequential generators,
+ * the output is a pure function of the counter and key, such that the random numbers of, e.g.,
+ * the i-th member of an ensemble can be generated independently of all other members, by setting
+ * the counter to i. The results are therefore reproducible, regardless of the order in which the
+ * members are processed and the number of threads used.
+ *
+ * @param[in]  counter        Counter                                                 [-]
+ * @param[in]  key            Key (seed)                                              [-]
+ * @param[out] randomNumbers  Random numbers                                          [-]
+ */
+ASTRO_HOST_DEVICE
+inline void generatePhilox4x32RandomNumbers(const std::uint32_t counter[4],
+                                            const std::uint32_t key[2],
+                                            std::uint32_t       randomNumbers[4])
+{
+    std::uint32_t state[4] = {counter[0], counter[1], counter[2], counter[3]};
+    std::uint32_t roundKey[2] = {key[0], key[1]};
+
+    for (int round = 0; round < 10; ++round)
+    {
+        const std::uint64_t product0 = static_cast<std::uint64_t>(0xD2511F53u) * state[0];
+        const std::uint64_t product1 = static_cast<std::uint64_t>(0xCD9E8D57u) * state[2];
+
+        const std::uint32_t nextState[4]
+            = {static_cast<std::uint32_t>(product1 >> 32) ^ state[1] ^ roundKey[0],
+               static_cast<std::uint32_t>(product1),
+               static_cast<std::uint32_t>(product0 >> 32) ^ state[3] ^ roundKey[1],
+               static_cast<std::uint32_t>(product0)};
+        for (int i = 0; i < 4; ++i)
+        {
+            state[i] = nextState[i];
+        }
+
+        // Bump key using Weyl sequence.
+        roundKey[0] += 0x9E3779B9u;
+        roundKey[1] += 0xBB67AE85u;
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        randomNumbers[i] = state[i];
+    }
+}
+
+//! Convert 32-bit random number to uniformly distributed real number.
+/*!
+ * Maps a 32-bit random number to the center of one of 2^32 equally sized intervals of (0, 1).
+ * In single precision, the largest random numbers are rounded to 1, such that the result is in
+ * (0, 1], which is the domain required by the Box-Muller transform.
+ *
+ * @tparam Real          Real type
+ * @param  randomNumber  32-bit random number                                         [-]
+ * @return               Uniformly distributed real number in (0, 1]                  [-]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real convertRandomNumberToUniform(const std::uint32_t randomNumber)
+{
+    return (static_cast<Real>(randomNumber) + Real(0.5)) * Real(2.3283064365386963e-10);
+}
+
+//! Generate standard normal samples using the Philox4x32-10 generator.
+/*!
+ * Generates four independent samples of the standard normal distribution for a given counter and
+ * key, by applying the Box-Muller transform to the uniformly distributed real numbers obtained
+ * from generatePhilox4x32RandomNumbers.
+ *
+ * @sa generatePhilox4x32RandomNumbers
+ * @tparam     Real     Real type
+ * @param[in]  counter  Counter                                                       [-]
+ * @param[in]  key      Key (seed)                                                    [-]
+ * @param[out] samples  Standard normal samples                                       [-]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+void generateStandardNormalSamples(const std::uint32_t counter[4],
+                                   const std::uint32_t key[2],
+                                   Real                samples[4])
+{
+    const Real pi = Real(3.14159265358979323846);
+
+    std::uint32_t randomNumbers[4];
+    generatePhilox4x32RandomNumbers(counter, key, randomNumbers);
+
+    for (int i = 0; i < 4; i += 2)
+    {
+        const Real uniform0 = convertRandomNumberToUniform<Real>(randomNumbers[i]);
+        const Real uniform1 = convertRandomNumberToUniform<Real>(randomNumbers[i + 1]);
+        const Real radius = std::sqrt(Real(-2.0) * std::log(uniform0));
+        const Real angle = Real(2.0) * pi * uniform1;
+        samples[i] = radius * std::cos(angle);
+        samples[i + 1] = radius * std::sin(angle);
+    }
+}
+
+//! Generate ensemble of dispersed states.
+/*!
+ * Generates an ensemble of states that are normally distributed around a nominal state, with the
+ * covariance given by its (lower-triangular) Cholesky factor L, i.e., the covariance is L L^T.
+ * Each member is given by x_i = x + L z_i, where z_i is a vector of standard normal samples. The
+ * states can be any 6-element states, e.g., Cartesian states or Keplerian elements.
+ *
+ * The ensemble is stored as a structure-of-arrays (one array per element), in the same layout
+ * as the catalogs of, e.g., convertCatalogCartesianToKeplerianElements. The standard normal
+ * samples of member i are generated with the Philox4x32-10 generator, using the seed as key and
+ * the index i as counter (see generateStandardNormalSamples). The ensemble is therefore
+ * reproducible for a given seed, independent of the number of threads, and any subset of members
+ * can be regenerated in isolation.
+ *
+ * @sa generateStandardNormalSamples, executeInParallel
+ * @tparam     Real             Real type
+ * @tparam     Vector6          6-vector type
+ * @param[in]  nominalState     Nominal state                                          [-]
+ * @param[in]  choleskyFactor   Lower-triangular Cholesky factor of covariance; the strictly
+ *                              upper-triangular part is not used                      [-]
+ * @param[in]  seed             Seed of random number generator                        [-]
+ * @param[out] ensembleStates   Array of pointers to arrays of elements of members     [-]
+ * @param[in]  numberOfMembers  Number of members of ensemble                          [-]
+ * @param[in]  numberOfThreads  Number of threads (0 selects the number of hardware threads)
+ */
+template <typename Real, typename Vector6>
+void generateEnsembleDispersions(const Vector6&      nominalState,
+                                 const Real          choleskyFactor[6][6],
+                                 const std::uint64_t seed,
+                                 Real* const         ensembleStates[6],
+                                 const std::size_t   numberOfMembers,
+                                 const std::size_t   numberOfThreads = 0)
+{
+    assert(hasVectorSize(nominalState, 6));
+
+    const std::uint32_t key[2] = {static_cast<std::uint32_t>(seed),
+                                  static_cast<std::uint32_t>(seed >> 32)};
+
+    executeInParallel(
+        numberOfMembers,
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const std::uint64_t index = static_cast<std::uint64_t>(i);
+
+                // Use two counters per member, which yield eight samples, of which six are used.
+                Real samples[8];
+                for (std::uint32_t j = 0; j < 2; ++j)
+                {
+                    const std::uint32_t counter[4] = {static_cast<std::uint32_t>(index),
+                                                      static_cast<std::uint32_t>(index >> 32),
+                                                      j,
+                                                      0};
+                    generateStandardNormalSamples(counter, key, samples + 4 * j);
+                }
+
+                for (std::size_t k = 0; k < 6; ++k)
+                {
+                    Real dispersion = Real(0.0);
+                    for (std::size_t l = 0; l <= k; ++l)
+                    {
+                        dispersion += choleskyFactor[k][l] * samples[l];
+                    }
+                    ensembleStates[k][i] = nominalState[k] + dispersion;
+                }
+            }
+        },
+        numberOfThreads);
+}
+
+//! Compute sample mean and covariance of ensemble.
+/*!
+ * Computes the sample mean and the (unbiased) sample covariance of an ensemble of states, stored
+ * as a structure-of-arrays (see generateEnsembleDispersions), using two passes over the ensemble.
+ *
+ * @tparam     Real             Real type
+ * @param[in]  ensembleStates   Array of pointers to arrays of elements of members     [-]
+ * @param[in]  numberOfMembers  Number of members of ensemble (> 1)                    [-]
+ * @param[out] mean             Sample mean                                            [-]
+ * @param[out] covariance       Sample covariance                                      [-]
+ */
+template <typename Real>
+void computeEnsembleStatistics(const Real* const ensembleStates[6],
+                               const std::size_t numberOfMembers,
+                               Real              mean[6],
+                               Real              covariance[6][6])
+{
+    assert(numberOfMembers > 1);
+
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        Real sum = Real(0.0);
+        for (std::size_t i = 0; i < numberOfMembers; ++i)
+        {
+            sum += ensembleStates[k][i];
+        }
+        mean[k] = sum / static_cast<Real>(numberOfMembers);
+    }
+
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        for (std::size_t l = 0; l <= k; ++l)
+        {
+            Real sum = Real(0.0);
+            for (std::size_t i = 0; i < numberOfMembers; ++i)
+            {
+                sum += (ensembleStates[k][i] - mean[k]) * (ensembleStates[l][i] - mean[l]);
+            }
+            covariance[k][l] = sum / static_cast<Real>(numberOfMembers - 1);
+            covariance[l][k] = covariance[k][l];
+        }
+    }
+}
+
+//! Number of members of an ensemble that are integrated together.
+/*!
+ * Multiple of the block size of the batched acceleration models, equal to the default chunk size
+ * of the catalog functions, such that the block state (six arrays of this size, plus the stage
+ * buffers of the integrator) stays in the L2 cache.
+ */
+const std::size_t ensembleBlockSize = 256;
+
+//! Central body and J2 dynamics of a block of ensemble members.
+/*!
+ * Dynamics functor for RungeKutta4Integrator, whose state is the block of Cartesian states of
+ * NumberOfMembers members, stored as a structure-of-arrays, i.e., element k of member i is stored
+ * at index (k * NumberOfMembers + i). The accelerations of all members are evaluated with a single
+ * call to the batched computeCentralBodyAndJ2Acceleration, such that the force evaluation is
+ * vectorized over the members.
+ *
+ * @tparam Real             Real type
+ * @tparam NumberOfMembers  Number of members in block
+ */
+template <typename Real, std::size_t NumberOfMembers>
+struct EnsembleCentralBodyAndJ2Dynamics
+{
+    //! Construct dynamics.
+    /*!
+     * @param[in] gravitationalParameter  Gravitational parameter of central body     [m^3 s^-2]
+     * @param[in] equatorialRadius        Equatorial radius of central body            [m]
+     * @param[in] j2Coefficient           Unnormalized J2-coefficient                  [-]
+     */
+    EnsembleCentralBodyAndJ2Dynamics(const Real gravitationalParameter,
+                                     const Real equatorialRadius,
+                                     const Real j2Coefficient)
+        : gravitationalParameter(gravitationalParameter),
+          equatorialRadius(equatorialRadius),
+          j2Coefficient(j2Coefficient)
+    { }
+
+    //! Compute state derivative of block of members.
+    /*!
+     * @param[in]  time             Time (not used)                                    [s]
+     * @param[in]  state            Block of Cartesian states                          [m, m/s]
+     * @param[out] stateDerivative  Block of Cartesian state derivatives               [m/s, m s^-2]
+     */
+    void operator()(const Real, const Real* const state, Real* const stateDerivative) const
+    {
+        const std::size_t n = NumberOfMembers;
+
+        for (std::size_t i = 0; i < 3 * n; ++i)
+        {
+            stateDerivative[i] = state[3 * n + i];
+        }
+
+        const Real* const positions[3] = {state, state + n, state + 2 * n};
+        Real* const accelerations[3]
+            = {stateDerivative + 3 * n, stateDerivative + 4 * n, stateDerivative + 5 * n};
+        computeCentralBodyAndJ2Acceleration(
+            gravitationalParameter, positions, equatorialRadius, j2Coefficient, accelerations, n);
+    }
+
+    //! Gravitational parameter of central body.
+    const Real gravitationalParameter;
+
+    //! Equatorial radius of central body.
+    const Real equatorialRadius;
+
+    //! Unnormalized J2-coefficient.
+    const Real j2Coefficient;
+};
+
+//! Propagate ensemble of Cartesian states under central body and J2 accelerations.
+/*!
+ * Propagates an ensemble of Cartesian states, stored as a structure-of-arrays (see
+ * generateEnsembleDispersions), in-place by a given time-of-flight, using the fixed-step RK4
+ * integrator. Instead of integrating each member in turn, blocks of ensembleBlockSize members are
+ * stepped together through the integrator (see EnsembleCentralBodyAndJ2Dynamics), such that both
+ * the integrator updates and the force evaluations are vectorized over the members. The blocks
+ * are distributed over the threads using executeInParallel. The last block is padded with copies
+ * of its last member.
+ *
+ * Since all operations are element-wise over the members, the result for each member is
+ * independent of the blocking and the number of threads. Setting the J2-coefficient to zero
+ * yields the central body (Kepler) dynamics.
+ *
+ * @sa EnsembleCentralBodyAndJ2Dynamics, RungeKutta4Integrator, computeCentralBodyAndJ2Acceleration
+ * @tparam        Real                    Real type
+ * @param[in,out] ensembleStates          Array of pointers to arrays of Cartesian elements of
+ *                                        members, updated to end of propagation    [m, m/s]
+ * @param[in]     numberOfMembers         Number of members of ensemble             [-]
+ * @param[in]     gravitationalParameter  Gravitational parameter of central body   [m^3 s^-2]
+ * @param[in]     equatorialRadius        Equatorial radius of central body         [m]
+ * @param[in]     j2Coefficient           Unnormalized J2-coefficient               [-]
+ * @param[in]     timeOfFlight            Time-of-flight (negative for backward
+ *                                        propagation)                              [s]
+ * @param[in]     stepSize                Step size (magnitude)                     [s]
+ * @param[in]     numberOfThreads         Number of threads (0 selects the number of hardware
+ *                                        threads)
+ */
+template <typename Real>
+void propagateEnsemble(Real* const       ensembleStates[6],
+                       const std::size_t numberOfMembers,
+                       const Real        gravitationalParameter,
+                       const Real        equatorialRadius,
+                       const Real        j2Coefficient,
+                       const Real        timeOfFlight,
+                       const Real        stepSize,
+                       const std::size_t numberOfThreads = 0)
+{
+    typedef EnsembleCentralBodyAndJ2Dynamics<Real, ensembleBlockSize> Dynamics;
+    typedef RungeKutta4Integrator<Real, 6 * ensembleBlockSize> Integrator;
+
+    assert(stepSize > Real(0.0));
+
+    const Dynamics dynamics(gravitationalParameter, equatorialRadius, j2Coefficient);
+
+    executeInParallel(
+        numberOfMembers,
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            // The stage buffers of the integrator are too large to be placed on the stack of the
+            // worker threads.
+            std::unique_ptr<Integrator> integrator(new Integrator());
+            std::vector<Real> blockState(6 * ensembleBlockSize);
+
+            const std::size_t numberOfBlockMembers = end - begin;
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                for (std::size_t i = 0; i < ensembleBlockSize; ++i)
+                {
+                    blockState[k * ensembleBlockSize + i]
+                        = ensembleStates[k][begin + std::min(i, numberOfBlockMembers - 1)];
+                }
+            }
+
+            Real time = Real(0.0);
+            integrator->integrate(dynamics, time, blockState, timeOfFlight, stepSize);
+
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                for (std::size_t i = 0; i < numberOfBlockMembers; ++i)
+                {
+                    ensembleStates[k][begin + i] = blockState[k * ensembleBlockSize + i];
+                }
+            }
+        },
+        numberOfThreads,
+        ensembleBlockSize);
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Salmon, J.K., Moraes, M.A., Dror, R.O., Shaw, D.E. Parallel random numbers: as easy as 1, 2,
+ *      3, Proceedings of the International Conference for High Performance Computing, Networking,
+ *      Storage and Analysis (SC11), 2011.
+ */
@@ -12,116 +12,93 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
-#include <vector>
+#include <type_traits>
 
+#include "astro/hostDevice.hpp"
+#include "astro/instrumentation.hpp"
+#include "astro/rootFinders.hpp"
 #include "astro/stateVectorIndices.hpp"
+#include "astro/vectorTraits.hpp"
 
 namespace astro
 {
 
-//! Convert Cartesian elements to Keplerian elements.
+//! Convert Cartesian elements to Keplerian elements, writing into given output vector.
 /*!
- * Converts a given set of Cartesian elements (position, velocity) to classical (osculating)
- * Keplerian elements. See Vallado (2007) for a derivation of the conversion.
- *
- * The tolerance is set to a default value. It should not be changed unless required for specific
- * scenarios. Below this tolerance value for eccentricity and inclination, the orbit is considered
- * to be a limit case.
+ * Converts a given set of Cartesian elements to Keplerian elements, identical to the conversion
+ * that returns a vector of Keplerian elements (see below for the limit cases), but writes into a
+ * caller-provided output vector. This avoids the copy-construction of the returned vector, which
+ * is a heap allocation for dynamic-size vector types (e.g., std::vector), such that a single
+ * buffer can be reused for repeated conversions.
  *
- * Essentially, special solutions are then used for parabolic, circular inclined,
- * non-circular equatorial, and circular equatorial orbits. These special solutions are
- * required because of singularities in the classical Keplerian elements. If high precision is
- * required near these singularities, users are encouraged to consider using other elements, such
- * as Modified Equinoctial Elements (MEE). It should be noted that MEE also suffer from
- * singularities, but not for zero eccentricity and inclination.
+ * The input and output vectors can be of any type whose elements are accessed with operator[]
+ * (see IsVector), e.g., std::vector, std::array, Eigen fixed-size vectors and maps and raw
+ * pointers, and need not be of the same type. All elements are read before the output is written,
+ * such that the conversion can be performed in-place, i.e., the output can be the input.
  *
- * WARNING: If eccentricity is 1.0 within tolerance, keplerianElements(0) = semi-latus rectum,
- *          since the orbit is parabolic.
- * WARNING: If eccentricity is 0.0 within tolerance, argument of periapsis is set to NaN, since the
- *          orbit is circular.
- * WARNING: If inclination is 0.0 within tolerance, longitude of ascending node is set to NaN, since
- *          since the orbit is equatorial.
- * WARNING: If inclination is 0.0 within tolerance, longitude of ascending node is set to NaN, since
- *          since the orbit is equatorial.
- * WARNING: If eccentricity = 0.0 within tolerance, inclination = non-zero
- *          keplerianElements(5) = argument of latitude
- * WARNING: If eccentricity = non-zero, inclination = 0.0 within tolerance
- *          keplerianElements(5) = true longitude of periapsis
- * WARNING: If eccentricity = 0.0 within tolerance, inclination = 0.0 within tolerance
- *          keplerianElements(5) = true latitude
- *
- * @tparam  Real                    Real type
- * @tparam  Vector                  Vector type
- * @param   cartesianElements       Vector containing Cartesian elements                        <br>
- *                                  N.B.: Order of elements is important!                       <br>
- *                                  cartesianElements(0) = x-position coordinate  [m]           <br>
- *                                  cartesianElements(1) = y-position coordinate  [m]           <br>
- *                                  cartesianElements(2) = z-position coordinate  [m]           <br>
- *                                  cartesianElements(3) = x-velocity coordinate  [m/s]         <br>
- *                                  cartesianElements(4) = y-velocity coordinate  [m/s]         <br>
- *                                  cartesianElements(5) = z-velocity coordinate  [m/s]
- * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
- * @param   tolerance               Tolerance used to check for limit cases
- *                                  (eccentricity, inclination)
- * @return                          Converted vector of Keplerian elements                      <br>
- *                                  N.B.: Order of elements is important!                       <br>
- *                                  keplerianElements(0) = semiMajorAxis          [m]           <br>
- *                                  keplerianElements(1) = eccentricity           [-]           <br>
- *                                  keplerianElements(2) = inclination            [rad]         <br>
- *                                  keplerianElements(3) = argument of periapsis  [rad]         <br>
- *                                  keplerianElements(4) = longitude of
- *                                                         ascending node         [rad]         <br>
- *                                  keplerianElements(5) = true anomaly           [rad]
+ * @sa IsVector
+ * @tparam     Real                    Real type
+ * @tparam     InputVector6            6-vector type of input
+ * @tparam     OutputVector6           6-vector type of output
+ * @param[in]  cartesianElements       Cartesian elements, ordered using
+ *                                     CartesianElementIndices                    [m, m/s]
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body    [m^3 s^-2]
+ * @param[out] keplerianElements       Keplerian elements, ordered using
+ *                                     KeplerianElementIndices                    [m, -, rad]
+ * @param[in]  tolerance               Tolerance used to check for limit cases
+ *                                     (eccentricity, inclination)
  */
-template <typename Real, typename Vector6>
-Vector6 convertCartesianToKeplerianElements(
-    const Vector6& cartesianElements,
+template <typename Real, typename InputVector6, typename OutputVector6>
+ASTRO_HOST_DEVICE
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertCartesianToKeplerianElements(
+    const InputVector6& cartesianElements,
     const Real gravitationalParameter,
-    const Real tolerance = 10.0 * std::numeric_limits<Real>::epsilon())
+    OutputVector6&& keplerianElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
 {
-    assert(cartesianElements.size() == 6);
-    assert(gravitationalParameter > 0.0);
+    assert(hasVectorSize(cartesianElements, 6));
+    assert(hasVectorSize(keplerianElements, 6));
+    assert(gravitationalParameter > Real(0.0));
 
-    const Real pi = 3.14159265358979323846;
-    const Real gravitationalParameterInverse = 1.0 / gravitationalParameter;
+    ASTRO_INSTRUMENT(
+        ++getThreadInstrumentationCounters().cartesianToKeplerianElements.numberOfConversions);
 
-    typedef std::vector<Real> Vector;
-    Vector6 keplerianElements = cartesianElements;
+    const Real pi = Real(3.14159265358979323846);
+    const Real gravitationalParameterInverse = Real(1.0) / gravitationalParameter;
 
     // Cartesian position
-    const Vector position = Vector({cartesianElements[xPositionIndex],
-                                    cartesianElements[yPositionIndex],
-                                    cartesianElements[zPositionIndex]});
+    const Real position[3] = {cartesianElements[xPositionIndex],
+                              cartesianElements[yPositionIndex],
+                              cartesianElements[zPositionIndex]};
     const Real positionNormSquared = position[0] * position[0]
                                      + position[1] * position[1]
                                      + position[2] * position[2];
     const Real positionNorm = std::sqrt(positionNormSquared);
-    const Real positionNormInverse = 1.0 / positionNorm;
+    const Real positionNormInverse = Real(1.0) / positionNorm;
 
     // Cartesian velocity
-    const Vector velocity = Vector({cartesianElements[xVelocityIndex],
-                                    cartesianElements[yVelocityIndex],
-                                    cartesianElements[zVelocityIndex]});
+    const Real velocity[3] = {cartesianElements[xVelocityIndex],
+                              cartesianElements[yVelocityIndex],
+                              cartesianElements[zVelocityIndex]};
     const Real velocityNormSquared = velocity[0] * velocity[0]
                                      + velocity[1] * velocity[1]
                                      + velocity[2] * velocity[2];
-    const Real velocityNorm = std::sqrt(velocityNormSquared);
 
     // Angular momentum
-    const Vector angularMomentum
-        = Vector({position[1] * velocity[2] - position[2] * velocity[1],
-                    position[2] * velocity[0] - position[0] * velocity[2],
-                    position[0] * velocity[1] - position[1] * velocity[0]});
+    const Real angularMomentum[3] = {position[1] * velocity[2] - position[2] * velocity[1],
+                                     position[2] * velocity[0] - position[0] * velocity[2],
+                                     position[0] * velocity[1] - position[1] * velocity[0]};
     const Real angularMomentumNormSquared = angularMomentum[0] * angularMomentum[0]
                                             + angularMomentum[1] * angularMomentum[1]
                                             + angularMomentum[2] * angularMomentum[2];
     const Real angularMomentumNorm = std::sqrt(angularMomentumNormSquared);
-    const Vector angularMomentumUnitVector
-        = Vector({angularMomentum[0] / angularMomentumNorm,
-                  angularMomentum[1] / angularMomentumNorm,
-                  angularMomentum[2] / angularMomentumNorm});
+    const Real angularMomentumUnitVector[3] = {angularMomentum[0] / angularMomentumNorm,
+                                               angularMomentum[1] / angularMomentumNorm,
+                                               angularMomentum[2] / angularMomentumNorm};
 
     // Eccentricity
     const Real eccentricityVectorFirsTermMultiplier
@@ -131,15 +108,13 @@ Vector6 convertCartesianToKeplerianElements(
                                      + position[1] * velocity[1]
                                      + position[2] * velocity[2];
 
-    const Real positionDotVelocityScaled = positionDotVelocity / gravitationalParameter;
-
-    const Vector eccentricityVector
-    = Vector({eccentricityVectorFirsTermMultiplier * position[0]
-                - positionDotVelocity * gravitationalParameterInverse * velocity[0],
-              eccentricityVectorFirsTermMultiplier * position[1]
-                - positionDotVelocity * gravitationalParameterInverse * velocity[1],
-              eccentricityVectorFirsTermMultiplier * position[2]
-                - positionDotVelocity * gravitationalParameterInverse * velocity[2]});
+    const Real eccentricityVector[3]
+        = {eccentricityVectorFirsTermMultiplier * position[0]
+             - positionDotVelocity * gravitationalParameterInverse * velocity[0],
+           eccentricityVectorFirsTermMultiplier * position[1]
+             - positionDotVelocity * gravitationalParameterInverse * velocity[1],
+           eccentricityVectorFirsTermMultiplier * position[2]
+             - positionDotVelocity * gravitationalParameterInverse * velocity[2]};
 
     const Real eccentricityNormSquared = eccentricityVector[0] * eccentricityVector[0]
                                             + eccentricityVector[1] * eccentricityVector[1]
@@ -150,32 +125,33 @@ Vector6 convertCartesianToKeplerianElements(
 
     // Specifc total energy using the vis-viva equation
     const Real specificTotalEnergy
-        = 0.5 * velocityNormSquared - gravitationalParameter / positionNorm;
+        = Real(0.5) * velocityNormSquared - gravitationalParameter / positionNorm;
 
     // Semi-major axis
     Real semiMajorAxis = std::numeric_limits<Real>::quiet_NaN();
     Real semiLatusRectum = std::numeric_limits<Real>::quiet_NaN();
-    if (std::fabs(eccentricity - 1.0) > tolerance)
+    if (std::fabs(eccentricity - Real(1.0)) > tolerance)
     {
-        semiMajorAxis = -0.5 * gravitationalParameter / specificTotalEnergy;
-        semiLatusRectum = semiMajorAxis * (1.0 - eccentricityNormSquared);
+        semiMajorAxis = -Real(0.5) * gravitationalParameter / specificTotalEnergy;
+        semiLatusRectum = semiMajorAxis * (Real(1.0) - eccentricityNormSquared);
         keplerianElements[0] = semiMajorAxis;
     }
     else
     {
+        ASTRO_INSTRUMENT(++getThreadInstrumentationCounters()
+                               .cartesianToKeplerianElements.numberOfParabolicOrbits);
         semiMajorAxis = std::numeric_limits<Real>::infinity();
         semiLatusRectum = angularMomentumNormSquared * gravitationalParameterInverse;
         keplerianElements[0] = semiLatusRectum;
     }
-    assert(semiMajorAxis > 0.0);
+    assert(semiMajorAxis > Real(0.0));
 
     // Inclination
     const Real inclination = std::acos(angularMomentumUnitVector[2]);
     keplerianElements[2] = inclination;
 
     // Ascending node vector
-    const Vector ascendingNodeVector
-        = Vector({-angularMomentum[1], angularMomentum[0], 0.0});
+    const Real ascendingNodeVector[3] = {-angularMomentum[1], angularMomentum[0], 0.0};
 
     const Real ascendingNodeVectorNormSquared
         = ascendingNodeVector[0] * ascendingNodeVector[0]
@@ -184,17 +160,16 @@ Vector6 convertCartesianToKeplerianElements(
 
     const Real ascendingNodeVectorNorm = std::sqrt(ascendingNodeVectorNormSquared);
 
-    const Vector ascendingNodeUnitVector
-        = Vector({ascendingNodeVector[0] / ascendingNodeVectorNorm,
-                    ascendingNodeVector[1] / ascendingNodeVectorNorm,
-                    ascendingNodeVector[2] / ascendingNodeVectorNorm });
+    const Real ascendingNodeUnitVector[3] = {ascendingNodeVector[0] / ascendingNodeVectorNorm,
+                                             ascendingNodeVector[1] / ascendingNodeVectorNorm,
+                                             ascendingNodeVector[2] / ascendingNodeVectorNorm};
 
     // Longitude of ascending node
     Real longitudeOfAscendingNode = std::acos(ascendingNodeUnitVector[0]);
 
-    if (ascendingNodeVector[1] < 0.0)
+    if (ascendingNodeVector[1] < Real(0.0))
     {
-        longitudeOfAscendingNode = 2.0 * pi - longitudeOfAscendingNode;
+        longitudeOfAscendingNode = Real(2.0) * pi - longitudeOfAscendingNode;
     }
 
     keplerianElements[4] = longitudeOfAscendingNode;
@@ -208,9 +183,9 @@ Vector6 convertCartesianToKeplerianElements(
     Real argumentOfPeriapsis = std::acos(ascendingNodeVectorDotEccentricityVector
                                          / (ascendingNodeVectorNorm * eccentricity));
 
-    if (eccentricityVector[2] < 0.0)
+    if (eccentricityVector[2] < Real(0.0))
     {
-        argumentOfPeriapsis = 2.0 * pi - argumentOfPeriapsis;
+        argumentOfPeriapsis = Real(2.0) * pi - argumentOfPeriapsis;
     }
 
     keplerianElements[3] = argumentOfPeriapsis;
@@ -222,9 +197,9 @@ Vector6 convertCartesianToKeplerianElements(
 
     Real trueAnomaly = std::acos(eccentricityVectorDotPosition / (eccentricity * positionNorm));
 
-    if (positionDotVelocity < 0.0)
+    if (positionDotVelocity < Real(0.0))
     {
-        trueAnomaly = 2.0 * pi - trueAnomaly;
+        trueAnomaly = Real(2.0) * pi - trueAnomaly;
     }
 
     keplerianElements[5] = trueAnomaly;
@@ -234,12 +209,15 @@ Vector6 convertCartesianToKeplerianElements(
 
     if (eccentricityVector[1] < tolerance)
     {
-            trueLongitudeOfPeriapsis = 2.0 * pi - trueLongitudeOfPeriapsis;
+            trueLongitudeOfPeriapsis = Real(2.0) * pi - trueLongitudeOfPeriapsis;
     }
 
     // Special case: elliptical, equatorial
     if(std::fabs(eccentricity) > tolerance && std::fabs(inclination) < tolerance)
     {
+            ASTRO_INSTRUMENT(
+                ++getThreadInstrumentationCounters()
+                      .cartesianToKeplerianElements.numberOfEllipticalEquatorialOrbits);
             longitudeOfAscendingNode = std::numeric_limits<Real>::quiet_NaN();
             keplerianElements[4] = trueLongitudeOfPeriapsis;
     }
@@ -252,58 +230,78 @@ Vector6 convertCartesianToKeplerianElements(
     Real argumentOfLatitude = std::acos(ascendingNodeVectorDotPosition
                                         / (ascendingNodeVectorNorm * positionNorm));
 
-    if (position[2] < 0.0)
+    if (position[2] < Real(0.0))
     {
-        argumentOfLatitude = 2.0 * pi - argumentOfLatitude;
+        argumentOfLatitude = Real(2.0) * pi - argumentOfLatitude;
     }
 
     // Special case: circular, inclined
     if(std::fabs(eccentricity) < tolerance && std::fabs(inclination) > tolerance)
     {
+        ASTRO_INSTRUMENT(++getThreadInstrumentationCounters()
+                               .cartesianToKeplerianElements.numberOfCircularInclinedOrbits);
         argumentOfPeriapsis = std::numeric_limits<Real>::quiet_NaN();
         keplerianElements[3] = argumentOfLatitude;
     }
 
     // True longitude
     Real trueLongitude = std::acos(position[0] / positionNorm);
-    if (position[1] < 0.0)
+    if (position[1] < Real(0.0))
     {
-        trueLongitude = 2.0 * pi - trueLongitude;
+        trueLongitude = Real(2.0) * pi - trueLongitude;
     }
 
     // // Special case: circular, equatorial
     if (std::fabs(eccentricity) < tolerance && std::fabs(inclination) < tolerance)
     {
+        ASTRO_INSTRUMENT(++getThreadInstrumentationCounters()
+                               .cartesianToKeplerianElements.numberOfCircularEquatorialOrbits);
         argumentOfPeriapsis = std::numeric_limits<Real>::quiet_NaN();
         longitudeOfAscendingNode = std::numeric_limits<Real>::quiet_NaN();
         keplerianElements[5] = trueLongitude;
     }
-
-    return keplerianElements;
 }
 
-//! Convert Keplerian elements to Cartesian elements.
+//! Convert Cartesian elements to Keplerian elements.
 /*!
- * Converts a given set of Keplerian (osculating) elements to Cartesian elements (position,
- * velocity). See Chobotov (2006) for a full derivation of the conversion.
+ * Converts a given set of Cartesian elements (position, velocity) to classical (osculating)
+ * Keplerian elements. See Vallado (2007) for a derivation of the conversion.
  *
- * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
- *          keplerianElements(0) = semi-latus rectum, since the orbit is parabolic.
+ * The tolerance is set to a default value. It should not be changed unless required for specific
+ * scenarios. Below this tolerance value for eccentricity and inclination, the orbit is considered
+ * to be a limit case.
+ *
+ * Essentially, special solutions are then used for parabolic, circular inclined,
+ * non-circular equatorial, and circular equatorial orbits. These special solutions are
+ * required because of singularities in the classical Keplerian elements. If high precision is
+ * required near these singularities, users are encouraged to consider using other elements, such
+ * as Modified Equinoctial Elements (MEE). It should be noted that MEE also suffer from
+ * singularities, but not for zero eccentricity and inclination.
+ *
+ * All intermediate vectors are stored on the stack, so the only allocation made is the one
+ * required to construct the returned Vector6 object. For fixed-size vector types (e.g.,
+ * std::array<Real, 6>), the conversion does not touch the heap at all. To avoid the allocation for
+ * dynamic-size vector types, use the overload that writes into a given output vector.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, keplerianElements(0) = semi-latus rectum,
+ *          since the orbit is parabolic.
+ * WARNING: If eccentricity is 0.0 within tolerance, argument of periapsis is set to NaN, since the
+ *          orbit is circular.
+ * WARNING: If inclination is 0.0 within tolerance, longitude of ascending node is set to NaN, since
+ *          since the orbit is equatorial.
+ * WARNING: If inclination is 0.0 within tolerance, longitude of ascending node is set to NaN, since
+ *          since the orbit is equatorial.
+ * WARNING: If eccentricity = 0.0 within tolerance, inclination = non-zero
+ *          keplerianElements(5) = argument of latitude
+ * WARNING: If eccentricity = non-zero, inclination = 0.0 within tolerance
+ *          keplerianElements(5) = true longitude of periapsis
+ * WARNING: If eccentricity = 0.0 within tolerance, inclination = 0.0 within tolerance
+ *          keplerianElements(5) = true latitude
  *
+ * @sa convertCartesianToModifiedEquinoctialElements
  * @tparam  Real                    Real type
  * @tparam  Vector                  Vector type
- * @param   keplerianElements       Vector containing Keplerian elemenets                       <br>
- *                                  N.B.: Order of elements is important!                       <br>
- *                                  keplerianElements(0) = semiMajorAxis          [m]           <br>
- *                                  keplerianElements(1) = eccentricity           [-]           <br>
- *                                  keplerianElements(2) = inclination            [rad]         <br>
- *                                  keplerianElements(3) = argument of periapsis  [rad]         <br>
- *                                  keplerianElements(4) = longitude of           [rad]
- *                                                          ascending node        [rad]         <br>
- *                                  keplerianElements(5) = true anomaly           [rad]
- * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
- * @param   tolerance               Tolerance used to check for limit case of eccentricity
- * @return                          Converted vector of Cartesian elements                      <br>
+ * @param   cartesianElements       Vector containing Cartesian elements                        <br>
  *                                  N.B.: Order of elements is important!                       <br>
  *                                  cartesianElements(0) = x-position coordinate  [m]           <br>
  *                                  cartesianElements(1) = y-position coordinate  [m]           <br>
@@ -311,13 +309,263 @@ Vector6 convertCartesianToKeplerianElements(
  *                                  cartesianElements(3) = x-velocity coordinate  [m/s]         <br>
  *                                  cartesianElements(4) = y-velocity coordinate  [m/s]         <br>
  *                                  cartesianElements(5) = z-velocity coordinate  [m/s]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   tolerance               Tolerance used to check for limit cases
+ *                                  (eccentricity, inclination)
+ * @return                          Converted vector of Keplerian elements                      <br>
+ *                                  N.B.: Order of elements is important!                       <br>
+ *                                  keplerianElements(0) = semiMajorAxis          [m]           <br>
+ *                                  keplerianElements(1) = eccentricity           [-]           <br>
+ *                                  keplerianElements(2) = inclination            [rad]         <br>
+ *                                  keplerianElements(3) = argument of periapsis  [rad]         <br>
+ *                                  keplerianElements(4) = longitude of
+ *                                                         ascending node         [rad]         <br>
+ *                                  keplerianElements(5) = true anomaly           [rad]
  */
 template <typename Real, typename Vector6>
-Vector6 convertKeplerianToCartesianElements(
-    const Vector6& keplerianElements, const Real gravitationalParameter,
-    const Real tolerance = 10.0 * std::numeric_limits<Real>::epsilon())
+Vector6 convertCartesianToKeplerianElements(
+    const Vector6& cartesianElements,
+    const Real gravitationalParameter,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
 {
-    Vector6 cartesianElements = keplerianElements;
+    assert(cartesianElements.size() == 6);
+
+    Vector6 keplerianElements = cartesianElements;
+    convertCartesianToKeplerianElements(
+        cartesianElements, gravitationalParameter, keplerianElements, tolerance);
+    return keplerianElements;
+}
+
+//! Convert batch of Cartesian elements to Keplerian elements.
+/*!
+ * Converts a batch of Cartesian elements, stored as a structure-of-arrays (one array per element),
+ * to classical (osculating) Keplerian elements. The conversion and the limit case conventions are
+ * identical to those of the single-state conversion.
+ *
+ * In contrast to the single-state conversion, the limit cases are not handled using branches.
+ * All the special solutions are computed for each state and the result is selected per state.
+ * The loop body is therefore free of data-dependent control flow, such that it can be vectorized
+ * by the compiler. Note that vectorization of the inverse trigonometric functions requires a
+ * vector math library (e.g., libmvec, enabled with -O3 -ffast-math -fno-finite-math-only on GCC)
+ * and a suitable target instruction set (e.g., -march=native).
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * @sa convertCartesianToKeplerianElements
+ * @tparam  Real                    Real type
+ * @param   cartesianElements       Array of pointers to Cartesian element arrays, ordered using
+ *                                  CartesianElementIndices                       [m, m/s]
+ * @param   keplerianElements       Array of pointers to Keplerian element arrays, ordered using
+ *                                  KeplerianElementIndices                       [m, -, rad]
+ * @param   numberOfStates          Number of states stored in each array
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   tolerance               Tolerance used to check for limit cases
+ *                                  (eccentricity, inclination)
+ */
+template <typename Real>
+void convertCartesianToKeplerianElements(
+    const Real* const cartesianElements[6],
+    Real* const keplerianElements[6],
+    const std::size_t numberOfStates,
+    const Real gravitationalParameter,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    assert(gravitationalParameter > Real(0.0));
+
+    const Real pi = Real(3.14159265358979323846);
+    const Real gravitationalParameterInverse = Real(1.0) / gravitationalParameter;
+
+    // The batch is processed in blocks that are staged in local arrays, which guarantees to the
+    // compiler that the inputs and outputs in the loop kernel do not alias.
+    const std::size_t blockSize = 64;
+    Real input[6][blockSize];
+    Real output[6][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfStates; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfStates - blockStart);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(cartesianElements[k] + blockStart,
+                      cartesianElements[k] + blockStart + blockLength,
+                      input[k]);
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const Real position[3] = {input[xPositionIndex][i],
+                                      input[yPositionIndex][i],
+                                      input[zPositionIndex][i]};
+            const Real velocity[3] = {input[xVelocityIndex][i],
+                                      input[yVelocityIndex][i],
+                                      input[zVelocityIndex][i]};
+            const Real positionNorm = std::sqrt(position[0] * position[0]
+                                                + position[1] * position[1]
+                                                + position[2] * position[2]);
+            const Real positionNormInverse = Real(1.0) / positionNorm;
+            const Real velocityNormSquared = velocity[0] * velocity[0]
+                                             + velocity[1] * velocity[1]
+                                             + velocity[2] * velocity[2];
+
+            // Angular momentum
+            const Real angularMomentum[3]
+                = {position[1] * velocity[2] - position[2] * velocity[1],
+                   position[2] * velocity[0] - position[0] * velocity[2],
+                   position[0] * velocity[1] - position[1] * velocity[0]};
+            const Real angularMomentumNormSquared = angularMomentum[0] * angularMomentum[0]
+                                                    + angularMomentum[1] * angularMomentum[1]
+                                                    + angularMomentum[2] * angularMomentum[2];
+            const Real angularMomentumNorm = std::sqrt(angularMomentumNormSquared);
+
+            // Eccentricity
+            const Real eccentricityVectorFirsTermMultiplier
+                = velocityNormSquared * gravitationalParameterInverse - positionNormInverse;
+            const Real positionDotVelocity = position[0] * velocity[0]
+                                             + position[1] * velocity[1]
+                                             + position[2] * velocity[2];
+            const Real eccentricityVector[3]
+                = {eccentricityVectorFirsTermMultiplier * position[0]
+                     - positionDotVelocity * gravitationalParameterInverse * velocity[0],
+                   eccentricityVectorFirsTermMultiplier * position[1]
+                     - positionDotVelocity * gravitationalParameterInverse * velocity[1],
+                   eccentricityVectorFirsTermMultiplier * position[2]
+                     - positionDotVelocity * gravitationalParameterInverse * velocity[2]};
+            const Real eccentricityNormSquared = eccentricityVector[0] * eccentricityVector[0]
+                                                 + eccentricityVector[1] * eccentricityVector[1]
+                                                 + eccentricityVector[2] * eccentricityVector[2];
+            const Real eccentricityNorm = std::sqrt(eccentricityNormSquared);
+
+            // Semi-major axis (semi-latus rectum for parabolic orbits)
+            const Real specificTotalEnergy
+                = Real(0.5) * velocityNormSquared - gravitationalParameter / positionNorm;
+            const bool isParabolic = !(std::fabs(eccentricityNorm - Real(1.0)) > tolerance);
+
+            // Inclination
+            const Real inclinationAngle = std::acos(angularMomentum[2] / angularMomentumNorm);
+
+            // Ascending node vector (z-component is zero)
+            const Real ascendingNodeVector[2] = {-angularMomentum[1], angularMomentum[0]};
+            const Real ascendingNodeVectorNorm
+                = std::sqrt(ascendingNodeVector[0] * ascendingNodeVector[0]
+                            + ascendingNodeVector[1] * ascendingNodeVector[1]);
+
+            // Longitude of ascending node
+            const Real longitudeOfAscendingNodeAngle
+                = std::acos(ascendingNodeVector[0] / ascendingNodeVectorNorm);
+
+            // Argument of periapsis
+            const Real argumentOfPeriapsisAngle
+                = std::acos((ascendingNodeVector[0] * eccentricityVector[0]
+                             + ascendingNodeVector[1] * eccentricityVector[1])
+                            / (ascendingNodeVectorNorm * eccentricityNorm));
+
+            // True anomaly
+            const Real trueAnomalyAngle
+                = std::acos((eccentricityVector[0] * position[0]
+                             + eccentricityVector[1] * position[1]
+                             + eccentricityVector[2] * position[2])
+                            / (eccentricityNorm * positionNorm));
+
+            // True longitude of periapsis
+            const Real trueLongitudeOfPeriapsisAngle
+                = std::acos(eccentricityVector[0] / eccentricityNorm);
+
+            // Argument of latitude
+            const Real argumentOfLatitudeAngle
+                = std::acos((ascendingNodeVector[0] * position[0]
+                             + ascendingNodeVector[1] * position[1])
+                            / (ascendingNodeVectorNorm * positionNorm));
+
+            // True longitude
+            const Real trueLongitudeAngle = std::acos(position[0] / positionNorm);
+
+            // Masks for limit cases
+            const bool isCircular = std::fabs(eccentricityNorm) < tolerance;
+            const bool isNonCircular = std::fabs(eccentricityNorm) > tolerance;
+            const bool isEquatorial = std::fabs(inclinationAngle) < tolerance;
+            const bool isInclined = std::fabs(inclinationAngle) > tolerance;
+
+            ASTRO_INSTRUMENT(
+                CartesianToKeplerianElementCounters& counters
+                    = getThreadInstrumentationCounters().cartesianToKeplerianElements;
+                ++counters.numberOfConversions;
+                counters.numberOfParabolicOrbits += isParabolic ? 1 : 0;
+                counters.numberOfEllipticalEquatorialOrbits
+                    += (isNonCircular && isEquatorial) ? 1 : 0;
+                counters.numberOfCircularInclinedOrbits += (isCircular && isInclined) ? 1 : 0;
+                counters.numberOfCircularEquatorialOrbits += (isCircular && isEquatorial) ? 1 : 0);
+
+            // Resolve quadrants and select special solutions for limit cases.
+            output[semiMajorAxisIndex][i] = isParabolic
+                ? angularMomentumNormSquared * gravitationalParameterInverse
+                : -Real(0.5) * gravitationalParameter / specificTotalEnergy;
+
+            output[eccentricityIndex][i] = eccentricityNorm;
+
+            output[inclinationIndex][i] = inclinationAngle;
+
+            const Real argumentOfPeriapsisResolved = eccentricityVector[2] < Real(0.0)
+                ? Real(2.0) * pi - argumentOfPeriapsisAngle : argumentOfPeriapsisAngle;
+            const Real argumentOfLatitudeResolved = position[2] < Real(0.0)
+                ? Real(2.0) * pi - argumentOfLatitudeAngle : argumentOfLatitudeAngle;
+            output[argumentOfPeriapsisIndex][i] = (isCircular && isInclined)
+                ? argumentOfLatitudeResolved : argumentOfPeriapsisResolved;
+
+            const Real longitudeOfAscendingNodeResolved = ascendingNodeVector[1] < Real(0.0)
+                ? Real(2.0) * pi - longitudeOfAscendingNodeAngle : longitudeOfAscendingNodeAngle;
+            const Real trueLongitudeOfPeriapsisResolved = eccentricityVector[1] < tolerance
+                ? Real(2.0) * pi - trueLongitudeOfPeriapsisAngle : trueLongitudeOfPeriapsisAngle;
+            output[longitudeOfAscendingNodeIndex][i] = (isNonCircular && isEquatorial)
+                ? trueLongitudeOfPeriapsisResolved : longitudeOfAscendingNodeResolved;
+
+            const Real trueAnomalyResolved = positionDotVelocity < Real(0.0)
+                ? Real(2.0) * pi - trueAnomalyAngle : trueAnomalyAngle;
+            const Real trueLongitudeResolved = position[1] < Real(0.0)
+                ? Real(2.0) * pi - trueLongitudeAngle : trueLongitudeAngle;
+            output[trueAnomalyIndex][i] = (isCircular && isEquatorial)
+                ? trueLongitudeResolved : trueAnomalyResolved;
+        }
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(output[k], output[k] + blockLength, keplerianElements[k] + blockStart);
+        }
+    }
+}
+
+//! Convert Keplerian elements to Cartesian elements, writing into given output vector.
+/*!
+ * Converts a given set of Keplerian elements to Cartesian elements, identical to the conversion
+ * that returns a vector of Cartesian elements, but writes into a caller-provided output vector.
+ * The input and output vectors can be of any type whose elements are accessed with operator[]
+ * (see IsVector). The conversion can be performed in-place, i.e., the output can be the input.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements[0] = semi-latus rectum, since the orbit is parabolic.
+ *
+ * @sa IsVector, convertCartesianToKeplerianElements
+ * @tparam     Real                    Real type
+ * @tparam     InputVector6            6-vector type of input
+ * @tparam     OutputVector6           6-vector type of output
+ * @param[in]  keplerianElements       Keplerian elements, ordered using
+ *                                     KeplerianElementIndices                    [m, -, rad]
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body    [m^3 s^-2]
+ * @param[out] cartesianElements       Cartesian elements, ordered using
+ *                                     CartesianElementIndices                    [m, m/s]
+ * @param[in]  tolerance               Tolerance used to check for limit case of eccentricity
+ */
+template <typename Real, typename InputVector6, typename OutputVector6>
+ASTRO_HOST_DEVICE
+typename std::enable_if<IsVector<OutputVector6>::value>::type
+convertKeplerianToCartesianElements(
+    const InputVector6& keplerianElements,
+    const Real gravitationalParameter,
+    OutputVector6&& cartesianElements,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    assert(hasVectorSize(keplerianElements, 6));
+    assert(hasVectorSize(cartesianElements, 6));
 
     const Real semiMajorAxis                    = keplerianElements[semiMajorAxisIndex];
     const Real eccentricity                     = keplerianElements[eccentricityIndex];
@@ -338,9 +586,9 @@ Vector6 convertKeplerianToCartesianElements(
 
     // Compute semi-latus rectum in the case the orbit is not a parabola.
     Real semiLatusRectum = 0.0;
-    if (std::fabs(eccentricity - 1.0) > tolerance)
+    if (std::fabs(eccentricity - Real(1.0)) > tolerance)
     {
-        semiLatusRectum = semiMajorAxis * (1.0 - eccentricity * eccentricity);
+        semiLatusRectum = semiMajorAxis * (Real(1.0) - eccentricity * eccentricity);
     }
 
     // Else set the semi-latus rectum as the first element in the vector of Keplerian elements.
@@ -350,7 +598,7 @@ Vector6 convertKeplerianToCartesianElements(
     }
 
     // Compute the magnitude of the orbital radius, measured from the focal point.
-    const Real radiusMagnitude = semiLatusRectum / (1.0 + eccentricity * cosineOfTrueAnomaly);
+    const Real radiusMagnitude = semiLatusRectum / (Real(1.0) + eccentricity * cosineOfTrueAnomaly);
 
     // Define position and velocity in the perifocal coordinate system.
     const Real xPositionPerifocal = radiusMagnitude * cosineOfTrueAnomaly;
@@ -398,10 +646,198 @@ Vector6 convertKeplerianToCartesianElements(
 
     cartesianElements[zVelocityIndex] = rotationMatrixComponent31 * xVelocityPerifocal
                                           + rotationMatrixComponent32 * yVelocityPerifocal;
+}
 
+//! Convert Keplerian elements to Cartesian elements.
+/*!
+ * Converts a given set of Keplerian (osculating) elements to Cartesian elements (position,
+ * velocity). See Chobotov (2006) for a full derivation of the conversion.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements(0) = semi-latus rectum, since the orbit is parabolic.
+ *
+ * @tparam  Real                    Real type
+ * @tparam  Vector                  Vector type
+ * @param   keplerianElements       Vector containing Keplerian elemenets                       <br>
+ *                                  N.B.: Order of elements is important!                       <br>
+ *                                  keplerianElements(0) = semiMajorAxis          [m]           <br>
+ *                                  keplerianElements(1) = eccentricity           [-]           <br>
+ *                                  keplerianElements(2) = inclination            [rad]         <br>
+ *                                  keplerianElements(3) = argument of periapsis  [rad]         <br>
+ *                                  keplerianElements(4) = longitude of           [rad]
+ *                                                          ascending node        [rad]         <br>
+ *                                  keplerianElements(5) = true anomaly           [rad]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   tolerance               Tolerance used to check for limit case of eccentricity
+ * @return                          Converted vector of Cartesian elements                      <br>
+ *                                  N.B.: Order of elements is important!                       <br>
+ *                                  cartesianElements(0) = x-position coordinate  [m]           <br>
+ *                                  cartesianElements(1) = y-position coordinate  [m]           <br>
+ *                                  cartesianElements(2) = z-position coordinate  [m]           <br>
+ *                                  cartesianElements(3) = x-velocity coordinate  [m/s]         <br>
+ *                                  cartesianElements(4) = y-velocity coordinate  [m/s]         <br>
+ *                                  cartesianElements(5) = z-velocity coordinate  [m/s]
+ */
+template <typename Real, typename Vector6>
+Vector6 convertKeplerianToCartesianElements(
+    const Vector6& keplerianElements, const Real gravitationalParameter,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    Vector6 cartesianElements = keplerianElements;
+    convertKeplerianToCartesianElements(
+        keplerianElements, gravitationalParameter, cartesianElements, tolerance);
     return cartesianElements;
 }
 
+//! Convert batch of Keplerian elements to Cartesian elements.
+/*!
+ * Converts a batch of Keplerian (osculating) elements, stored as a structure-of-arrays (one array
+ * per element), to Cartesian elements (position, velocity). The conversion is identical to that of
+ * the single-state conversion.
+ *
+ * The parabolic limit case is selected per state instead of using a branch, such that the loop
+ * body can be vectorized by the compiler. Note that vectorization of the trigonometric functions
+ * requires a vector math library (e.g., libmvec, enabled with -O3 -ffast-math
+ * -fno-finite-math-only on GCC) and a suitable target instruction set (e.g., -march=native).
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * WARNING: If eccentricity is 1.0 within tolerance, the user should provide
+ *          keplerianElements[0] = semi-latus rectum, since the orbit is parabolic.
+ *
+ * @sa convertKeplerianToCartesianElements
+ * @tparam  Real                    Real type
+ * @param   keplerianElements       Array of pointers to Keplerian element arrays, ordered using
+ *                                  KeplerianElementIndices                       [m, -, rad]
+ * @param   cartesianElements       Array of pointers to Cartesian element arrays, ordered using
+ *                                  CartesianElementIndices                       [m, m/s]
+ * @param   numberOfStates          Number of states stored in each array
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   tolerance               Tolerance used to check for limit case of eccentricity
+ */
+template <typename Real>
+void convertKeplerianToCartesianElements(
+    const Real* const keplerianElements[6],
+    Real* const cartesianElements[6],
+    const std::size_t numberOfStates,
+    const Real gravitationalParameter,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    // The batch is processed in blocks that are staged in local arrays, which guarantees to the
+    // compiler that the inputs and outputs in the loop kernels do not alias.
+    const std::size_t blockSize = 64;
+    Real input[6][blockSize];
+    Real cosines[6][blockSize];
+    Real sines[6][blockSize];
+    Real output[6][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfStates; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfStates - blockStart);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(keplerianElements[k] + blockStart,
+                      keplerianElements[k] + blockStart + blockLength,
+                      input[k]);
+        }
+
+        // Pre-compute sines and cosines of angles in separate loops, since compilers otherwise
+        // tend to fuse them into calls to sincos, for which vectorized versions are not used.
+        for (std::size_t k = inclinationIndex; k < 6; ++k)
+        {
+            for (std::size_t i = 0; i < blockLength; ++i)
+            {
+                cosines[k][i] = std::cos(input[k][i]);
+            }
+        }
+
+        for (std::size_t k = inclinationIndex; k < 6; ++k)
+        {
+            for (std::size_t i = 0; i < blockLength; ++i)
+            {
+                sines[k][i] = std::sin(input[k][i]);
+            }
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const Real semiMajorAxis = input[semiMajorAxisIndex][i];
+            const Real eccentricity  = input[eccentricityIndex][i];
+
+            const Real cosineOfInclination = cosines[inclinationIndex][i];
+            const Real sineOfInclination = sines[inclinationIndex][i];
+            const Real cosineOfArgumentOfPeriapsis = cosines[argumentOfPeriapsisIndex][i];
+            const Real sineOfArgumentOfPeriapsis = sines[argumentOfPeriapsisIndex][i];
+            const Real cosineOfLongitudeOfAscendingNode
+                = cosines[longitudeOfAscendingNodeIndex][i];
+            const Real sineOfLongitudeOfAscendingNode = sines[longitudeOfAscendingNodeIndex][i];
+            const Real cosineOfTrueAnomaly = cosines[trueAnomalyIndex][i];
+            const Real sineOfTrueAnomaly = sines[trueAnomalyIndex][i];
+
+            // Select the semi-latus rectum, which is given directly in the case of a parabola.
+            const Real semiLatusRectum = std::fabs(eccentricity - Real(1.0)) > tolerance
+                ? semiMajorAxis * (Real(1.0) - eccentricity * eccentricity) : semiMajorAxis;
+
+            // Compute the magnitude of the orbital radius, measured from the focal point.
+            const Real radiusMagnitude
+                = semiLatusRectum / (Real(1.0) + eccentricity * cosineOfTrueAnomaly);
+
+            // Define position and velocity in the perifocal coordinate system.
+            const Real xPositionPerifocal = radiusMagnitude * cosineOfTrueAnomaly;
+            const Real yPositionPerifocal = radiusMagnitude * sineOfTrueAnomaly;
+            const Real xVelocityPerifocal
+                = -std::sqrt(gravitationalParameter / semiLatusRectum) * sineOfTrueAnomaly;
+            const Real yVelocityPerifocal
+                = std::sqrt(gravitationalParameter / semiLatusRectum)
+                  * (eccentricity + cosineOfTrueAnomaly);
+
+            // Compute scalar components of rotation matrix to rotate from periforcal to inertial
+            // frame.
+            const Real rotationMatrixComponent11
+                = (cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+                    -sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+                     * cosineOfInclination);
+            const Real rotationMatrixComponent12
+                = (-cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+                    -sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+                     * cosineOfInclination);
+
+            const Real rotationMatrixComponent21
+                = (sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+                    + cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+                      * cosineOfInclination);
+            const Real rotationMatrixComponent22
+                = (-sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis
+                    + cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis
+                      * cosineOfInclination);
+
+            const Real rotationMatrixComponent31 = (sineOfArgumentOfPeriapsis * sineOfInclination);
+            const Real rotationMatrixComponent32
+                = (cosineOfArgumentOfPeriapsis * sineOfInclination);
+
+            // Compute Cartesian position and velocities.
+            output[xPositionIndex][i] = rotationMatrixComponent11 * xPositionPerifocal
+                                        + rotationMatrixComponent12 * yPositionPerifocal;
+            output[yPositionIndex][i] = rotationMatrixComponent21 * xPositionPerifocal
+                                        + rotationMatrixComponent22 * yPositionPerifocal;
+            output[zPositionIndex][i] = rotationMatrixComponent31 * xPositionPerifocal
+                                        + rotationMatrixComponent32 * yPositionPerifocal;
+            output[xVelocityIndex][i] = rotationMatrixComponent11 * xVelocityPerifocal
+                                        + rotationMatrixComponent12 * yVelocityPerifocal;
+            output[yVelocityIndex][i] = rotationMatrixComponent21 * xVelocityPerifocal
+                                        + rotationMatrixComponent22 * yVelocityPerifocal;
+            output[zVelocityIndex][i] = rotationMatrixComponent31 * xVelocityPerifocal
+                                        + rotationMatrixComponent32 * yVelocityPerifocal;
+        }
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            std::copy(output[k], output[k] + blockLength, cartesianElements[k] + blockStart);
+        }
+    }
+}
+
 //! Convert true anomaly to elliptical eccentric anomaly.
 /*!
  * Converts true anomaly to eccentric anomaly for elliptical orbits (0 <= eccentricity < 1.0).
@@ -417,21 +853,21 @@ Vector6 convertKeplerianToCartesianElements(
  * @return               Elliptical eccentric anomaly  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertTrueAnomalyToEllipticalEccentricAnomaly(const Real trueAnomaly,
                                                     const Real eccentricity)
 {
-    assert(eccentricity >= 0.0 && eccentricity < 1.0);
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
 
-    // Compute sine and cosine of eccentric anomaly.
-    const Real sineOfEccentricAnomaly
-        = std::sqrt(1.0 - std::pow(eccentricity, 2.0))
-          * std::sin(trueAnomaly) / (1.0 + eccentricity * std::cos(trueAnomaly));
-    const Real cosineOfEccentricAnomaly
-        = (eccentricity + std::cos(trueAnomaly))
-          / (1.0 + eccentricity * std::cos(trueAnomaly));
-
-    // Return elliptical eccentric anomaly.
-    return std::atan2(sineOfEccentricAnomaly, cosineOfEccentricAnomaly);
+    // Compute sine and cosine of true anomaly once (fused to a single sincos() call by GCC and
+    // Clang).
+    const Real sineOfTrueAnomaly = std::sin(trueAnomaly);
+    const Real cosineOfTrueAnomaly = std::cos(trueAnomaly);
+
+    // The sine and cosine of the eccentric anomaly share the positive denominator
+    // (1 + e cos(trueAnomaly)), which cancels in the four-quadrant inverse tangent.
+    return std::atan2(std::sqrt(Real(1.0) - eccentricity * eccentricity) * sineOfTrueAnomaly,
+                      eccentricity + cosineOfTrueAnomaly);
 }
 
 //! Convert true anomaly to hyperbolic eccentric anomaly.
@@ -450,26 +886,21 @@ Real convertTrueAnomalyToEllipticalEccentricAnomaly(const Real trueAnomaly,
  * @return               Hyperbolic eccentric anomaly  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertTrueAnomalyToHyperbolicEccentricAnomaly(const Real trueAnomaly,
                                                     const Real eccentricity)
 {
-    assert(eccentricity > 1.0);
+    assert(eccentricity > Real(1.0));
 
-    // Compute hyperbolic sine and hyperbolic cosine of hyperbolic eccentric anomaly.
-    const Real hyperbolicSineOfHyperbolicEccentricAnomaly
-        = std::sqrt(std::pow(eccentricity, 2.0) - 1.0)
-          * std::sin(trueAnomaly) / (1.0 + std::cos(trueAnomaly));
-
-    const Real hyperbolicCosineOfHyperbolicEccentricAnomaly
-        = (std::cos(trueAnomaly) + eccentricity) / (1.0 + std::cos(trueAnomaly));
-
-    // Return hyperbolic eccentric anomaly.
-    // The inverse hyperbolic tangent is computed here manually, since the atanh() function is not
-    // available in older C++ compilers.
-    const Real angle
-        = hyperbolicSineOfHyperbolicEccentricAnomaly
-          / hyperbolicCosineOfHyperbolicEccentricAnomaly;
-    return 0.5 * (std::log(1.0 + angle) - std::log(1.0 - angle));
+    // Compute sine and cosine of true anomaly once (fused to a single sincos() call by GCC and
+    // Clang).
+    const Real sineOfTrueAnomaly = std::sin(trueAnomaly);
+    const Real cosineOfTrueAnomaly = std::cos(trueAnomaly);
+
+    // The hyperbolic sine and hyperbolic cosine of the hyperbolic eccentric anomaly share the
+    // denominator (1 + e cos(trueAnomaly)), which cancels in the hyperbolic tangent.
+    return std::atanh(std::sqrt(eccentricity * eccentricity - Real(1.0)) * sineOfTrueAnomaly
+                      / (eccentricity + cosineOfTrueAnomaly));
 }
 
 //! Convert true anomaly to eccentric anomaly.
@@ -492,22 +923,23 @@ Real convertTrueAnomalyToHyperbolicEccentricAnomaly(const Real trueAnomaly,
  * @return               Eccentric anomaly  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertTrueAnomalyToEccentricAnomaly(const Real trueAnomaly, const Real eccentricity)
 {
-    assert(eccentricity >= 0.0
-        && (std::fabs(eccentricity - 1.0) > std::numeric_limits<Real>::epsilon()));
+    assert(eccentricity >= Real(0.0)
+        && (std::fabs(eccentricity - Real(1.0)) > std::numeric_limits<Real>::epsilon()));
 
     Real eccentricAnomaly = 0.0;
 
     // Check if orbit is elliptical and compute eccentric anomaly.
-    if (eccentricity >= 0.0 && eccentricity < 1.0)
+    if (eccentricity >= Real(0.0) && eccentricity < Real(1.0))
     {
         eccentricAnomaly
             = convertTrueAnomalyToEllipticalEccentricAnomaly(trueAnomaly, eccentricity);
    }
 
     // Check if orbit is hyperbolic and compute eccentric anomaly.
-    else if (eccentricity > 1.0)
+    else if (eccentricity > Real(1.0))
     {
         eccentricAnomaly
             = convertTrueAnomalyToHyperbolicEccentricAnomaly(trueAnomaly, eccentricity);
@@ -531,10 +963,11 @@ Real convertTrueAnomalyToEccentricAnomaly(const Real trueAnomaly, const Real ecc
  * @return                             Mean anomaly                  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertEllipticalEccentricAnomalyToMeanAnomaly(const Real ellipticalEccentricAnomaly,
                                                     const Real eccentricity)
 {
-    assert(eccentricity >= 0.0 && eccentricity < 1.0);
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
 
     return ellipticalEccentricAnomaly - eccentricity * std::sin(ellipticalEccentricAnomaly);
 }
@@ -555,10 +988,11 @@ Real convertEllipticalEccentricAnomalyToMeanAnomaly(const Real ellipticalEccentr
  * @return                             Mean anomaly                  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertHyperbolicEccentricAnomalyToMeanAnomaly(
     const Real hyperbolicEccentricAnomaly, const Real eccentricity)
 {
-    assert(eccentricity > 1.0);
+    assert(eccentricity > Real(1.0));
 
     return eccentricity * std::sinh(hyperbolicEccentricAnomaly) - hyperbolicEccentricAnomaly;
 }
@@ -583,23 +1017,24 @@ Real convertHyperbolicEccentricAnomalyToMeanAnomaly(
  * @return                   Mean anomaly       [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertEccentricAnomalyToMeanAnomaly(
     const Real eccentricAnomaly, const Real eccentricity)
 {
-    assert(eccentricity >= 0.0
-        && std::fabs(eccentricity - 1.0) > std::numeric_limits<Real>::epsilon());
+    assert(eccentricity >= Real(0.0)
+        && std::fabs(eccentricity - Real(1.0)) > std::numeric_limits<Real>::epsilon());
 
     Real meanAnomaly = 0.0;
 
     // Check if orbit is elliptical and compute mean anomaly.
-    if (eccentricity >= 0.0 && eccentricity < 1.0)
+    if (eccentricity >= Real(0.0) && eccentricity < Real(1.0))
     {
         meanAnomaly
             = convertEllipticalEccentricAnomalyToMeanAnomaly(eccentricAnomaly, eccentricity);
    }
 
     // Check if orbit is hyperbolic and compute mean anomaly.
-    else if (eccentricity > 1.0)
+    else if (eccentricity > Real(1.0))
     {
         meanAnomaly
             = convertHyperbolicEccentricAnomalyToMeanAnomaly(eccentricAnomaly, eccentricity);
@@ -608,6 +1043,124 @@ Real convertEccentricAnomalyToMeanAnomaly(
     return meanAnomaly;
 }
 
+//! Convert true anomaly to elliptical mean anomaly.
+/*!
+ * Converts true anomaly to mean anomaly for elliptical orbits (0 <= eccentricity < 1.0), without
+ * the intermediate round trip through the eccentric anomaly. The sine of the eccentric anomaly,
+ * required for Kepler's equation, follows from the sine and cosine of the true anomaly
+ * (Chobotov, 2002):
+ *
+ * \f[
+ *      \sin E = \frac{\sqrt{1 - e^{2}} \sin\nu}{1 + e \cos\nu}
+ * \f]
+ *
+ * such that only a sine/cosine pair and an inverse tangent are evaluated.
+ *
+ * @sa convertTrueAnomalyToEllipticalEccentricAnomaly,
+ *     convertEllipticalEccentricAnomalyToMeanAnomaly
+ * @tparam Real          Real type
+ * @param  trueAnomaly   True anomaly  [rad]
+ * @param  eccentricity  Eccentricity  [-]
+ * @return               Mean anomaly  [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real convertTrueAnomalyToEllipticalMeanAnomaly(const Real trueAnomaly, const Real eccentricity)
+{
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
+
+    const Real sineOfTrueAnomaly = std::sin(trueAnomaly);
+    const Real cosineOfTrueAnomaly = std::cos(trueAnomaly);
+
+    const Real scaledSineOfTrueAnomaly
+        = std::sqrt(Real(1.0) - eccentricity * eccentricity) * sineOfTrueAnomaly;
+    const Real eccentricAnomaly
+        = std::atan2(scaledSineOfTrueAnomaly, eccentricity + cosineOfTrueAnomaly);
+    const Real sineOfEccentricAnomaly
+        = scaledSineOfTrueAnomaly / (Real(1.0) + eccentricity * cosineOfTrueAnomaly);
+
+    return eccentricAnomaly - eccentricity * sineOfEccentricAnomaly;
+}
+
+//! Convert true anomaly to hyperbolic mean anomaly.
+/*!
+ * Converts true anomaly to mean anomaly for hyperbolic orbits (eccentricity > 1.0), without the
+ * intermediate round trip through the hyperbolic eccentric anomaly. The hyperbolic sine of the
+ * hyperbolic eccentric anomaly, required for Kepler's equation, follows from the sine and cosine
+ * of the true anomaly (Chobotov, 2002):
+ *
+ * \f[
+ *      \sinh F = \frac{\sqrt{e^{2} - 1} \sin\nu}{1 + e \cos\nu}
+ * \f]
+ *
+ * such that only a sine/cosine pair and an inverse hyperbolic tangent are evaluated.
+ *
+ * @sa convertTrueAnomalyToHyperbolicEccentricAnomaly,
+ *     convertHyperbolicEccentricAnomalyToMeanAnomaly
+ * @tparam Real          Real type
+ * @param  trueAnomaly   True anomaly  [rad]
+ * @param  eccentricity  Eccentricity  [-]
+ * @return               Mean anomaly  [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real convertTrueAnomalyToHyperbolicMeanAnomaly(const Real trueAnomaly, const Real eccentricity)
+{
+    assert(eccentricity > Real(1.0));
+
+    const Real sineOfTrueAnomaly = std::sin(trueAnomaly);
+    const Real cosineOfTrueAnomaly = std::cos(trueAnomaly);
+
+    const Real scaledSineOfTrueAnomaly
+        = std::sqrt(eccentricity * eccentricity - Real(1.0)) * sineOfTrueAnomaly;
+    const Real hyperbolicEccentricAnomaly
+        = std::atanh(scaledSineOfTrueAnomaly / (eccentricity + cosineOfTrueAnomaly));
+    const Real hyperbolicSineOfHyperbolicEccentricAnomaly
+        = scaledSineOfTrueAnomaly / (Real(1.0) + eccentricity * cosineOfTrueAnomaly);
+
+    return eccentricity * hyperbolicSineOfHyperbolicEccentricAnomaly - hyperbolicEccentricAnomaly;
+}
+
+//! Convert true anomaly to mean anomaly.
+/*!
+ * Converts true anomaly to mean anomaly for elliptical and hyperbolic orbits
+ * (eccentricity < 1.0 && eccentricity > 1.0). This function is essentially a wrapper for
+ * functions that treat each case. It should be used in cases where the eccentricity of the orbit
+ * is not known a priori.
+ *
+ * This implementation performs a check on the eccentricity and throws an error for
+ * eccentricity < 0.0 and parabolic orbits, which have not been implemented.
+ *
+ * @sa convertTrueAnomalyToEllipticalMeanAnomaly, convertTrueAnomalyToHyperbolicMeanAnomaly
+ * @tparam Real          Real type
+ * @param  trueAnomaly   True anomaly  [rad]
+ * @param  eccentricity  Eccentricity  [-]
+ * @return               Mean anomaly  [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real convertTrueAnomalyToMeanAnomaly(const Real trueAnomaly, const Real eccentricity)
+{
+    assert(eccentricity >= Real(0.0)
+        && std::fabs(eccentricity - Real(1.0)) > std::numeric_limits<Real>::epsilon());
+
+    Real meanAnomaly = 0.0;
+
+    // Check if orbit is elliptical and compute mean anomaly.
+    if (eccentricity < Real(1.0))
+    {
+        meanAnomaly = convertTrueAnomalyToEllipticalMeanAnomaly(trueAnomaly, eccentricity);
+    }
+
+    // Check if orbit is hyperbolic and compute mean anomaly.
+    else if (eccentricity > Real(1.0))
+    {
+        meanAnomaly = convertTrueAnomalyToHyperbolicMeanAnomaly(trueAnomaly, eccentricity);
+    }
+
+    return meanAnomaly;
+}
+
 //! Convert elliptical eccentric anomaly to true anomaly.
 /*!
  * Converts eccentric anomaly to true anomaly for elliptical orbits (0 <= eccentricity < 1.0).
@@ -619,24 +1172,29 @@ Real convertEccentricAnomalyToMeanAnomaly(
  * @return                            True anomaly                  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertEllipticalEccentricAnomalyToTrueAnomaly(const Real ellipticEccentricAnomaly,
                                                     const Real eccentricity)
 {
-    const Real sineOfTrueAnomaly = std::sqrt(1.0 - eccentricity * eccentricity)
-                                   * std::sin(ellipticEccentricAnomaly)
-                                   / (1.0 - eccentricity * std::cos(ellipticEccentricAnomaly));
-
-    const Real cosineOfTrueAnomaly
-        = (std::cos(ellipticEccentricAnomaly) - eccentricity)
-          / (1.0 - eccentricity * std::cos(ellipticEccentricAnomaly));
-
-    return std::atan2(sineOfTrueAnomaly, cosineOfTrueAnomaly);
+    // Compute sine and cosine of eccentric anomaly once (fused to a single sincos() call by GCC
+    // and Clang).
+    const Real sineOfEccentricAnomaly = std::sin(ellipticEccentricAnomaly);
+    const Real cosineOfEccentricAnomaly = std::cos(ellipticEccentricAnomaly);
+
+    // The sine and cosine of the true anomaly share the positive denominator
+    // (1 - e cos(eccentricAnomaly)), which cancels in the four-quadrant inverse tangent.
+    return std::atan2(std::sqrt(Real(1.0) - eccentricity * eccentricity) * sineOfEccentricAnomaly,
+                      cosineOfEccentricAnomaly - eccentricity);
 }
 
 //! Convert hyperbolic eccentric anomaly to true anomaly.
 /*!
  * Converts hyperbolic eccentric anomaly to true anomaly for hyperbolic orbits
- * (eccentricity > 1.0). The equations used can be found in (Chobotov, 2002).
+ * (eccentricity > 1.0), using the half-angle relation (Vallado, 2007):
+ *
+ * \f[
+ *      \tan\frac{\nu}{2} = \sqrt{\frac{e + 1}{e - 1}} \tanh\frac{F}{2}
+ * \f]
  *
  * @tparam  Real                        Real type
  * @param   hyperbolicEccentricAnomaly  Hyperbolic eccentric anomaly  [rad]
@@ -644,19 +1202,14 @@ Real convertEllipticalEccentricAnomalyToTrueAnomaly(const Real ellipticEccentric
  * @return                              True anomaly                  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertHyperbolicEccentricAnomalyToTrueAnomaly(const Real hyperbolicEccentricAnomaly,
                                                     const Real eccentricity)
 {
-    const Real sineOfTrueAnomaly
-        = std::sqrt(eccentricity * eccentricity - 1.0)
-          * std::sinh(hyperbolicEccentricAnomaly)
-          / (eccentricity * std::cosh(hyperbolicEccentricAnomaly) - 1.0);
-
-    const Real cosineOfTrueAnomaly
-        = (eccentricity - std::cosh(hyperbolicEccentricAnomaly))
-          / (eccentricity * std::cosh(hyperbolicEccentricAnomaly) - 1.0);
-
-    return std::atan2(sineOfTrueAnomaly, cosineOfTrueAnomaly);
+    // Use the half-angle relation, which requires only two transcendental function calls.
+    return Real(2.0)
+           * std::atan(std::sqrt((eccentricity + Real(1.0)) / (eccentricity - Real(1.0)))
+                       * std::tanh(Real(0.5) * hyperbolicEccentricAnomaly));
 }
 
 //! Convert eccentric anomaly to true anomaly.
@@ -679,21 +1232,22 @@ Real convertHyperbolicEccentricAnomalyToTrueAnomaly(const Real hyperbolicEccentr
  * @return                    True anomaly       [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real convertEccentricAnomalyToTrueAnomaly(const Real eccentricAnomaly, const Real eccentricity)
 {
-    assert(eccentricity >= 0.0
-        && std::fabs(eccentricity - 1.0) > std::numeric_limits<Real>::epsilon());
+    assert(eccentricity >= Real(0.0)
+        && std::fabs(eccentricity - Real(1.0)) > std::numeric_limits<Real>::epsilon());
 
     Real trueAnomaly = 0.0;
 
     // Check if orbit is elliptical and compute true anomaly.
-    if (eccentricity < 1.0)
+    if (eccentricity < Real(1.0))
     {
         trueAnomaly = convertEllipticalEccentricAnomalyToTrueAnomaly(eccentricAnomaly,
                                                                      eccentricity);
    }
 
-    else if (eccentricity > 1.0)
+    else if (eccentricity > Real(1.0))
     {
         trueAnomaly = convertHyperbolicEccentricAnomalyToTrueAnomaly(eccentricAnomaly,
                                                                      eccentricity);
@@ -725,6 +1279,7 @@ Real convertEccentricAnomalyToTrueAnomaly(const Real eccentricAnomaly, const Rea
  * @return                      Kepler equation value for given elliptical orbit  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real computeEllipticalKeplerFunction(const Real eccentricAnomaly,
                                      const Real eccentricity,
                                      const Real meanAnomaly)
@@ -751,12 +1306,126 @@ Real computeEllipticalKeplerFunction(const Real eccentricAnomaly,
  * @return                      First-derivative of Kepler's function for elliptical orbits  [rad]
  */
 template <typename Real>
+ASTRO_HOST_DEVICE
 Real computeFirstDerivativeEllipticalKeplerFunction(const Real eccentricAnomaly,
                                                     const Real eccentricity)
 {
-    return 1.0 - eccentricity * std::cos(eccentricAnomaly);
+    return Real(1.0) - eccentricity * std::cos(eccentricAnomaly);
 }
 
+//! Kepler function for elliptical orbits, including derivatives.
+/*!
+ * Function object that evaluates Kepler's function for elliptical orbits and its first and second
+ * derivatives with respect to the eccentric anomaly, sharing the sine of the eccentric anomaly
+ * between the function value and the second derivative. Used to solve Kepler's equation with
+ * findRoot.
+ *
+ * @sa computeEllipticalKeplerFunction, computeFirstDerivativeEllipticalKeplerFunction, findRoot
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct EllipticalKeplerFunction
+{
+    //! Construct function.
+    /*!
+     * @param eccentricity  Eccentricity  [-]
+     * @param meanAnomaly   Mean anomaly  [rad]
+     */
+    ASTRO_HOST_DEVICE
+    EllipticalKeplerFunction(const Real eccentricity, const Real meanAnomaly)
+        : eccentricity(eccentricity),
+          meanAnomaly(meanAnomaly)
+    { }
+
+    //! Evaluate function and derivatives.
+    /*!
+     * @param[in]  eccentricAnomaly  Eccentric anomaly                               [rad]
+     * @param[out] function          Kepler function                                 [rad]
+     * @param[out] firstDerivative   First derivative of Kepler function             [-]
+     * @param[out] secondDerivative  Second derivative of Kepler function            [rad^-1]
+     */
+    ASTRO_HOST_DEVICE
+    void operator()(const Real eccentricAnomaly,
+                    Real& function,
+                    Real& firstDerivative,
+                    Real& secondDerivative) const
+    {
+        secondDerivative = eccentricity * std::sin(eccentricAnomaly);
+        function = eccentricAnomaly - secondDerivative - meanAnomaly;
+        firstDerivative = Real(1.0) - eccentricity * std::cos(eccentricAnomaly);
+    }
+
+    //! Eccentricity.
+    const Real eccentricity;
+
+    //! Mean anomaly.
+    const Real meanAnomaly;
+};
+
+//! Kepler function for block of elliptical orbits, including derivatives.
+/*!
+ * Block function object that evaluates Kepler's function for elliptical orbits and its
+ * derivatives for a block of orbits, with separate loops for the sine and cosine, such that they
+ * can be vectorized. Used to solve Kepler's equation with findRootsOfBlock.
+ *
+ * @sa EllipticalKeplerFunction, findRootsOfBlock
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct EllipticalKeplerBlockFunction
+{
+    //! Construct block function.
+    /*!
+     * @param eccentricities  Array of eccentricities  [-]
+     * @param meanAnomalies   Array of mean anomalies  [rad]
+     */
+    ASTRO_HOST_DEVICE
+    EllipticalKeplerBlockFunction(const Real* const eccentricities,
+                                  const Real* const meanAnomalies)
+        : eccentricities(eccentricities),
+          meanAnomalies(meanAnomalies)
+    { }
+
+    //! Evaluate functions and derivatives for block of orbits.
+    /*!
+     * @param[in]  eccentricAnomalies  Array of eccentric anomalies                  [rad]
+     * @param[out] functions           Array of Kepler functions                     [rad]
+     * @param[out] firstDerivatives    Array of first derivatives                    [-]
+     * @param[out] secondDerivatives   Array of second derivatives                   [rad^-1]
+     * @param[in]  numberOfElements    Number of elements in each array              [-]
+     */
+    ASTRO_HOST_DEVICE
+    void operator()(const Real* const eccentricAnomalies,
+                    Real* const functions,
+                    Real* const firstDerivatives,
+                    Real* const secondDerivatives,
+                    const std::size_t numberOfElements) const
+    {
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            secondDerivatives[i] = std::sin(eccentricAnomalies[i]);
+        }
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            firstDerivatives[i] = std::cos(eccentricAnomalies[i]);
+        }
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            secondDerivatives[i] = eccentricities[i] * secondDerivatives[i];
+            functions[i] = eccentricAnomalies[i] - secondDerivatives[i] - meanAnomalies[i];
+            firstDerivatives[i] = Real(1.0) - eccentricities[i] * firstDerivatives[i];
+        }
+    }
+
+    //! Array of eccentricities.
+    const Real* const eccentricities;
+
+    //! Array of mean anomalies.
+    const Real* const meanAnomalies;
+};
+
 //! Convert elliptical mean anomaly to eccentric anomaly.
 /*!
  * Converts mean anomaly to eccentric anomaly for elliptical orbits,
@@ -771,6 +1440,11 @@ Real computeFirstDerivativeEllipticalKeplerFunction(const Real eccentricAnomaly,
  *
  * Also, note that the mean anomaly is automatically transformed to fit within the 0 to 2.0pi range.
  *
+ * The Newton-Raphson iterations stop when the magnitude of the update step falls below the
+ * root-finding tolerance. Since the default tolerance is below machine precision, the iterations
+ * also stop when the update step reaches round-off level with respect to the eccentric anomaly or
+ * stops decreasing once it is smaller than the square root of machine precision.
+ *
  * @sa computeEllipticalKeplerFunction, computeFirstDerivativeEllipticalKeplerFunction
  * @tparam    Real                  Real number type
  * @tparam    Integer               Integer type
@@ -784,22 +1458,20 @@ template <typename Real, typename Integer>
 Real convertEllipticalMeanAnomalyToEccentricAnomaly(
     const Real      eccentricity,
     const Real      meanAnomaly,
-    const Real      rootFindingTolerance = 1.0e-3 * std::numeric_limits<Real>::epsilon(),
+    const Real      rootFindingTolerance = Real(1.0e-3) * std::numeric_limits<Real>::epsilon(),
     const Integer   maximumIterations = 100)
 {
-    assert(eccentricity >= 0.0 && eccentricity < (1.0 - 1.0e-11));
+    assert(eccentricity >= Real(0.0) && eccentricity < (Real(1.0) - Real(1.0e-11)));
 
-    const Real pi = 3.14159265358979323846;
+    const Real pi = Real(3.14159265358979323846);
 
     // Set mean anomaly to domain between 0 and 2pi.
-    Real meanAnomalyShifted = std::fmod(meanAnomaly, 2.0 * pi);
-    if (meanAnomalyShifted <0.0)
+    Real meanAnomalyShifted = std::fmod(meanAnomaly, Real(2.0) * pi);
+    if (meanAnomalyShifted <Real(0.0))
     {
-        meanAnomalyShifted += 2.0 * pi;
+        meanAnomalyShifted += Real(2.0) * pi;
     }
 
-    Real eccentricAnomaly = std::numeric_limits<Real>::quiet_NaN();
-
     // Set the initial guess for the eccentric anomaly.
     // !!!!!!!!!!!!!     IMPORTANT     !!!!!!!!!!!!!
     // If this scheme is changed, please run a very extensive test suite. The Newton-Raphson
@@ -817,35 +1489,529 @@ Real convertEllipticalMeanAnomalyToEccentricAnomaly(
     }
 
     // Execute Newton-Raphson root-finding algorithm.
-    eccentricAnomaly = initialGuess;
-    for (int i = 0; i < maximumIterations + 1; ++i)
+    Real eccentricAnomaly = initialGuess;
+    Integer numberOfIterations = 0;
+    const bool isConverged
+        = findRoot<NewtonRaphsonScheme>(
+            EllipticalKeplerFunction<Real>(eccentricity, meanAnomalyShifted),
+            AbsoluteStepStoppingCondition<Real>(rootFindingTolerance),
+            maximumIterations,
+            eccentricAnomaly,
+            numberOfIterations);
+
+    ASTRO_INSTRUMENT(getThreadInstrumentationCounters().ellipticalKeplerSolver.recordSolve(
+        static_cast<std::size_t>(numberOfIterations), isConverged ? 0 : 1));
+
+    if (!isConverged)
+    {
+        throw std::runtime_error(
+            "ERROR: Maximum iterations for Newton-Raphson root-finding exceeded!");
+    }
+
+    // Return eccentric anomaly.
+    return eccentricAnomaly;
+}
+
+//! Convert batch of elliptical mean anomalies to eccentric anomalies.
+/*!
+ * Converts a batch of mean anomalies to eccentric anomalies for elliptical orbits, for all
+ * eccentricities >= 0.0 and < (1.0 - tolerance). The initial guess and stopping conditions are
+ * the same as for the scalar conversion.
+ *
+ * The elements are processed in fixed-size blocks. Within each block the Newton-Raphson update is
+ * applied to all elements that have not yet converged, without branching, such that the loops can
+ * be auto-vectorized by the compiler (requires -O3 -ffast-math plus a suitable -march flag for
+ * vectorized sine and cosine). A block is completed as soon as all of its elements have converged.
+ *
+ * In contrast to the scalar conversion, no exception is thrown if the maximum number of iterations
+ * is exceeded. Instead, the convergence flag of each element is set and the eccentric anomaly is
+ * set to the last iterate for each element that did not converge.
+ *
+ * The output array may coincide with one of the input arrays (in-place conversion).
+ *
+ * @sa convertEllipticalMeanAnomalyToEccentricAnomaly
+ * @tparam    Real                  Real number type
+ * @tparam    Integer               Integer type
+ * @param     eccentricities        Array of eccentricities                                 [-]
+ * @param     meanAnomalies         Array of mean anomalies                                 [rad]
+ * @param     eccentricAnomalies    Array of eccentric anomalies (output)                   [rad]
+ * @param     isConverged           Array of convergence flags (output)                     [-]
+ * @param     numberOfElements      Number of elements in each array                        [-]
+ * @param     rootFindingTolerance  Stopping condition tolerance for Newton-Raphson algorithm
+ *                                                                                          [rad]
+ * @param     maximumIterations     Maximum iteration for Newton-Raphson algorithm          [-]
+ */
+template <typename Real, typename Integer>
+void convertEllipticalMeanAnomalyToEccentricAnomaly(
+    const Real* const   eccentricities,
+    const Real* const   meanAnomalies,
+    Real* const         eccentricAnomalies,
+    bool* const         isConverged,
+    const std::size_t   numberOfElements,
+    const Real          rootFindingTolerance = Real(1.0e-3) * std::numeric_limits<Real>::epsilon(),
+    const Integer       maximumIterations = 100)
+{
+    const Real pi = Real(3.14159265358979323846);
+    const AbsoluteStepStoppingCondition<Real> stoppingCondition(rootFindingTolerance);
+
+    const std::size_t blockSize = rootFinderBlockSize;
+    Real eccentricity[blockSize];
+    Real meanAnomaly[blockSize];
+    Real eccentricAnomaly[blockSize];
+    bool isLaneConverged[blockSize];
+    const EllipticalKeplerBlockFunction<Real> function(eccentricity, meanAnomaly);
+
+    for (std::size_t offset = 0; offset < numberOfElements; offset += blockSize)
     {
-        if (i == maximumIterations)
+        const std::size_t n = std::min(blockSize, numberOfElements - offset);
+
+        std::copy(eccentricities + offset, eccentricities + offset + n, eccentricity);
+        std::copy(meanAnomalies + offset, meanAnomalies + offset + n, meanAnomaly);
+
+        // Set mean anomaly to domain between 0 and 2pi and set the initial guess for the
+        // eccentric anomaly (see scalar conversion for details).
+        for (std::size_t i = 0; i < n; ++i)
         {
-            throw std::runtime_error(
-                "ERROR: Maximum iterations for Newton-Raphson root-finding exceeded!");
+            assert(eccentricity[i] >= Real(0.0) && eccentricity[i] < (Real(1.0) - Real(1.0e-11)));
+
+            const Real meanAnomalyRemainder = std::fmod(meanAnomaly[i], Real(2.0) * pi);
+            meanAnomaly[i] = meanAnomalyRemainder < Real(0.0)
+                ? meanAnomalyRemainder + Real(2.0) * pi : meanAnomalyRemainder;
+            eccentricAnomaly[i] = meanAnomaly[i] > pi
+                ? meanAnomaly[i] - eccentricity[i] : meanAnomaly[i] + eccentricity[i];
         }
 
-        const Real nextEccentricAnomaly
-            = eccentricAnomaly
-              - computeEllipticalKeplerFunction(eccentricAnomaly,
-                                                eccentricity,
-                                                meanAnomalyShifted)
-              / computeFirstDerivativeEllipticalKeplerFunction(eccentricAnomaly,
-                                                               eccentricity);
+        // Execute masked Newton-Raphson root-finding algorithm.
+        Integer numberOfIterations = 0;
+        findRootsOfBlock<NewtonRaphsonScheme>(function,
+                                              stoppingCondition,
+                                              maximumIterations,
+                                              n,
+                                              eccentricAnomaly,
+                                              isLaneConverged,
+                                              numberOfIterations);
+
+        ASTRO_INSTRUMENT(getThreadInstrumentationCounters().ellipticalKeplerBatchSolver.recordSolve(
+            static_cast<std::size_t>(numberOfIterations),
+            static_cast<std::size_t>(std::count(isLaneConverged, isLaneConverged + n, false))));
+
+        std::copy(eccentricAnomaly, eccentricAnomaly + n, eccentricAnomalies + offset);
+        std::copy(isLaneConverged, isLaneConverged + n, isConverged + offset);
+    }
+}
+
+//! Convert elliptical mean anomaly to eccentric anomaly using Markley's non-iterative method.
+/*!
+ * Converts mean anomaly to eccentric anomaly for elliptical orbits, for all eccentricities >= 0.0
+ * and < 1.0, using the non-iterative method of Markley (1995). A starter value is obtained by
+ * solving a cubic approximation of Kepler's equation in closed form, and is refined with a single
+ * fifth-order (Halley-type) correction step.
+ *
+ * In contrast to convertEllipticalMeanAnomalyToEccentricAnomaly, the cost of each call is fixed
+ * (one cube root, one square root and one sine-cosine pair) and no exception can be thrown, which
+ * makes this function suitable for latency-sensitive applications. In double precision, the
+ * residual of Kepler's equation is of the order of machine precision over the entire domain.
+ *
+ * The mean anomaly is automatically transformed to fit within the 0 to 2.0pi range and the
+ * eccentric anomaly is returned in the same range.
+ *
+ * @sa convertEllipticalMeanAnomalyToEccentricAnomaly
+ * @tparam    Real          Real number type
+ * @param     eccentricity  Eccentricity                                                   [-]
+ * @param     meanAnomaly   Mean anomaly                                                   [rad]
+ * @return                  Eccentric anomaly                                              [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(const Real eccentricity,
+                                                           const Real meanAnomaly)
+{
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
+
+    const Real pi = Real(3.14159265358979323846);
+
+    // Set mean anomaly to domain between 0 and 2pi.
+    Real meanAnomalyShifted = std::fmod(meanAnomaly, Real(2.0) * pi);
+    if (meanAnomalyShifted < Real(0.0))
+    {
+        meanAnomalyShifted += Real(2.0) * pi;
+    }
+
+    // Map mean anomaly to domain between 0 and pi, using E(2pi - M) = 2pi - E(M).
+    const bool isReflected = meanAnomalyShifted > pi;
+    if (isReflected)
+    {
+        meanAnomalyShifted = Real(2.0) * pi - meanAnomalyShifted;
+    }
+
+    // Compute starter value by solving cubic approximation of Kepler's equation (Markley, 1995).
+    const Real alpha = (Real(3.0) * pi * pi
+                        + Real(1.6) * pi * (pi - meanAnomalyShifted) / (Real(1.0) + eccentricity))
+                       / (pi * pi - Real(6.0));
+    const Real d = Real(3.0) * (Real(1.0) - eccentricity) + alpha * eccentricity;
+    const Real q = Real(2.0) * alpha * d * (Real(1.0) - eccentricity)
+                   - meanAnomalyShifted * meanAnomalyShifted;
+    const Real r = Real(3.0) * alpha * d * (d - Real(1.0) + eccentricity) * meanAnomalyShifted
+                   + meanAnomalyShifted * meanAnomalyShifted * meanAnomalyShifted;
+    const Real wCubeRoot = std::cbrt(std::fabs(r) + std::sqrt(q * q * q + r * r));
+    const Real w = wCubeRoot * wCubeRoot;
+
+    Real eccentricAnomaly = (Real(2.0) * r * w / (w * w + w * q + q * q) + meanAnomalyShifted) / d;
+
+    // Apply fifth-order correction to starter value.
+    const Real eccentricitySine = eccentricity * std::sin(eccentricAnomaly);
+    const Real eccentricityCosine = eccentricity * std::cos(eccentricAnomaly);
+
+    const Real f0 = eccentricAnomaly - eccentricitySine - meanAnomalyShifted;
+    const Real f1 = Real(1.0) - eccentricityCosine;
+    const Real f2 = eccentricitySine;
+    const Real f3 = eccentricityCosine;
+    const Real f4 = -eccentricitySine;
+
+    const Real delta3 = -f0 / (f1 - Real(0.5) * f0 * f2 / f1);
+    const Real delta4 = -f0 / (f1 + Real(0.5) * delta3 * f2 + delta3 * delta3 * f3 / Real(6.0));
+    const Real delta5 = -f0 / (f1 + Real(0.5) * delta4 * f2 + delta4 * delta4 * f3 / Real(6.0)
+                               + delta4 * delta4 * delta4 * f4 / Real(24.0));
+
+    eccentricAnomaly += delta5;
+
+    return isReflected ? Real(2.0) * pi - eccentricAnomaly : eccentricAnomaly;
+}
+
+//! Compute Kepler function for hyperbolic orbits.
+/*!
+ * Computes Kepler function, given as:
+ *
+ * \f[
+ *      f(F) = e * sinh(F) - F - M
+ * \f]
+ *
+ * for hyperbolic orbits, where \f$F\f$ is the hyperbolic eccentric anomaly, \f$e\f$ is the
+ * eccentricity, \f$M\f$ is the mean anomaly.
+ *
+ * This function can be used for root-finding for mean-to-eccentric anomaly conversion.
+ *
+ * All hyperbolic eccentricities > 1.0 are valid.
+ *
+ * @sa convertHyperbolicMeanAnomalyToEccentricAnomaly
+ * @tparam    Real                        Real type
+ * @param     hyperbolicEccentricAnomaly  Hyperbolic eccentric anomaly                      [rad]
+ * @param     eccentricity                Eccentricity                                      [-]
+ * @param     meanAnomaly                 Mean anomaly                                      [rad]
+ * @return                                Kepler equation value for given hyperbolic orbit  [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real computeHyperbolicKeplerFunction(const Real hyperbolicEccentricAnomaly,
+                                     const Real eccentricity,
+                                     const Real meanAnomaly)
+{
+    return eccentricity * std::sinh(hyperbolicEccentricAnomaly) - hyperbolicEccentricAnomaly
+           - meanAnomaly;
+}
+
+//! Compute 1st-derivative of Kepler function for hyperbolic orbits.
+/*!
+ * Computes the 1st-derivative of Kepler function, given as:
+ *
+ * \f[
+ *      \frac{df(F)} {dF} = e * cosh(F) - 1
+ * \f]
+ *
+ * for hyperbolic orbits, where \f$F\f$ is the hyperbolic eccentric anomaly, and \f$e\f$ is the
+ * eccentricity.
+ *
+ * All hyperbolic eccentricities > 1.0 are valid.
+ *
+ * @tparam    Real                        Real type
+ * @param     hyperbolicEccentricAnomaly  Hyperbolic eccentric anomaly                      [rad]
+ * @param     eccentricity                Eccentricity                                      [-]
+ * @return                                First-derivative of Kepler's function for hyperbolic
+ *                                        orbits                                            [rad]
+ */
+template <typename Real>
+ASTRO_HOST_DEVICE
+Real computeFirstDerivativeHyperbolicKeplerFunction(const Real hyperbolicEccentricAnomaly,
+                                                    const Real eccentricity)
+{
+    return eccentricity * std::cosh(hyperbolicEccentricAnomaly) - Real(1.0);
+}
+
+//! Kepler function for hyperbolic orbits, including derivatives.
+/*!
+ * Function object that evaluates Kepler's function for hyperbolic orbits and its first and
+ * second derivatives with respect to the hyperbolic eccentric anomaly, sharing the hyperbolic sine
+ * between the function value and the second derivative. Used to solve Kepler's equation with
+ * findRoot.
+ *
+ * @sa computeHyperbolicKeplerFunction, computeFirstDerivativeHyperbolicKeplerFunction, findRoot
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct HyperbolicKeplerFunction
+{
+    //! Construct function.
+    /*!
+     * @param eccentricity  Eccentricity  [-]
+     * @param meanAnomaly   Mean anomaly  [rad]
+     */
+    ASTRO_HOST_DEVICE
+    HyperbolicKeplerFunction(const Real eccentricity, const Real meanAnomaly)
+        : eccentricity(eccentricity),
+          meanAnomaly(meanAnomaly)
+    { }
+
+    //! Evaluate function and derivatives.
+    /*!
+     * @param[in]  hyperbolicEccentricAnomaly  Hyperbolic eccentric anomaly             [rad]
+     * @param[out] function                    Kepler function                          [rad]
+     * @param[out] firstDerivative             First derivative of Kepler function      [-]
+     * @param[out] secondDerivative            Second derivative of Kepler function     [rad^-1]
+     */
+    ASTRO_HOST_DEVICE
+    void operator()(const Real hyperbolicEccentricAnomaly,
+                    Real& function,
+                    Real& firstDerivative,
+                    Real& secondDerivative) const
+    {
+        secondDerivative = eccentricity * std::sinh(hyperbolicEccentricAnomaly);
+        function = secondDerivative - hyperbolicEccentricAnomaly - meanAnomaly;
+        firstDerivative = eccentricity * std::cosh(hyperbolicEccentricAnomaly) - Real(1.0);
+    }
 
-        const Real eccentricAnomalyDifference = eccentricAnomaly - nextEccentricAnomaly;
+    //! Eccentricity.
+    const Real eccentricity;
+
+    //! Mean anomaly.
+    const Real meanAnomaly;
+};
+
+//! Kepler function for block of hyperbolic orbits, including derivatives.
+/*!
+ * Block function object that evaluates Kepler's function for hyperbolic orbits and its
+ * derivatives for a block of orbits, with separate loops for the hyperbolic sine and cosine, such
+ * that they can be vectorized. Used to solve Kepler's equation with findRootsOfBlock.
+ *
+ * @sa HyperbolicKeplerFunction, findRootsOfBlock
+ * @tparam Real  Real type
+ */
+template <typename Real>
+struct HyperbolicKeplerBlockFunction
+{
+    //! Construct block function.
+    /*!
+     * @param eccentricities  Array of eccentricities  [-]
+     * @param meanAnomalies   Array of mean anomalies  [rad]
+     */
+    ASTRO_HOST_DEVICE
+    HyperbolicKeplerBlockFunction(const Real* const eccentricities,
+                                  const Real* const meanAnomalies)
+        : eccentricities(eccentricities),
+          meanAnomalies(meanAnomalies)
+    { }
+
+    //! Evaluate functions and derivatives for block of orbits.
+    /*!
+     * @param[in]  hyperbolicEccentricAnomalies  Array of hyperbolic eccentric anomalies  [rad]
+     * @param[out] functions                     Array of Kepler functions               [rad]
+     * @param[out] firstDerivatives              Array of first derivatives              [-]
+     * @param[out] secondDerivatives             Array of second derivatives             [rad^-1]
+     * @param[in]  numberOfElements              Number of elements in each array        [-]
+     */
+    ASTRO_HOST_DEVICE
+    void operator()(const Real* const hyperbolicEccentricAnomalies,
+                    Real* const functions,
+                    Real* const firstDerivatives,
+                    Real* const secondDerivatives,
+                    const std::size_t numberOfElements) const
+    {
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            secondDerivatives[i] = std::sinh(hyperbolicEccentricAnomalies[i]);
+        }
 
-        eccentricAnomaly = nextEccentricAnomaly;
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            firstDerivatives[i] = std::cosh(hyperbolicEccentricAnomalies[i]);
+        }
 
-        if (eccentricAnomalyDifference < rootFindingTolerance)
+        for (std::size_t i = 0; i < numberOfElements; ++i)
         {
-            break;
+            secondDerivatives[i] = eccentricities[i] * secondDerivatives[i];
+            functions[i]
+                = secondDerivatives[i] - hyperbolicEccentricAnomalies[i] - meanAnomalies[i];
+            firstDerivatives[i] = eccentricities[i] * firstDerivatives[i] - Real(1.0);
         }
     }
 
-    // Return eccentric anomaly.
-    return eccentricAnomaly;
+    //! Array of eccentricities.
+    const Real* const eccentricities;
+
+    //! Array of mean anomalies.
+    const Real* const meanAnomalies;
+};
+
+//! Convert hyperbolic mean anomaly to eccentric anomaly.
+/*!
+ * Converts mean anomaly to hyperbolic eccentric anomaly for hyperbolic orbits, for all
+ * eccentricities > 1.0.
+ *
+ * If the conversion fails, then a runtime exception is thrown.
+ *
+ * The root-finding problem is solved for the magnitude of the mean anomaly, using the symmetry
+ * F(-M) = -F(M). The initial guess is the smallest of the roots of the linear (small F), cubic
+ * (near-parabolic) and exponential (large F) approximations of Kepler's equation:
+ *
+ * \f[
+ *      F_{0} = \min\left( \frac{M}{e - 1}, \sqrt[3]{\frac{6M}{e}},
+ *                         \ln\left(\frac{2M}{e} + 1.8\right) \right)
+ * \f]
+ *
+ * Since Kepler's function is increasing and convex for F >= 0, the Newton-Raphson iterations
+ * converge for any non-negative initial guess. With this initial guess, the number of iterations
+ * stays low (<= 11 for extensive random tests with 1 + 1.0e-8 <= e <= 1 + 1.0e4) from
+ * near-parabolic to highly hyperbolic orbits. The stopping conditions are the same as for the
+ * elliptical conversion.
+ *
+ * @sa computeHyperbolicKeplerFunction, computeFirstDerivativeHyperbolicKeplerFunction,
+ *     convertEllipticalMeanAnomalyToEccentricAnomaly
+ * @tparam    Real                  Real number type
+ * @tparam    Integer               Integer type
+ * @param     eccentricity          Eccentricity                                               [-]
+ * @param     meanAnomaly           Mean anomaly                                               [rad]
+ * @param     rootFindingTolerance  Stopping condition tolerance for Newton-Raphson algorithm  [rad]
+ * @param     maximumIterations     Maximum iteration for Newton-Raphson algorithm             [-]
+ * @return                          Hyperbolic eccentric anomaly                               [rad]
+ */
+template <typename Real, typename Integer>
+Real convertHyperbolicMeanAnomalyToEccentricAnomaly(
+    const Real      eccentricity,
+    const Real      meanAnomaly,
+    const Real      rootFindingTolerance = Real(1.0e-3) * std::numeric_limits<Real>::epsilon(),
+    const Integer   maximumIterations = 100)
+{
+    assert(eccentricity > Real(1.0));
+
+    const Real meanAnomalyMagnitude = std::fabs(meanAnomaly);
+
+    // Set the initial guess for the hyperbolic eccentric anomaly.
+    Real hyperbolicEccentricAnomaly
+        = std::min(std::min(meanAnomalyMagnitude / (eccentricity - Real(1.0)),
+                            std::cbrt(Real(6.0) * meanAnomalyMagnitude / eccentricity)),
+                   std::log(Real(2.0) * meanAnomalyMagnitude / eccentricity + Real(1.8)));
+
+    // Execute Newton-Raphson root-finding algorithm.
+    Integer numberOfIterations = 0;
+    const bool isConverged
+        = findRoot<NewtonRaphsonScheme>(
+            HyperbolicKeplerFunction<Real>(eccentricity, meanAnomalyMagnitude),
+            AbsoluteStepStoppingCondition<Real>(rootFindingTolerance),
+            maximumIterations,
+            hyperbolicEccentricAnomaly,
+            numberOfIterations);
+
+    ASTRO_INSTRUMENT(getThreadInstrumentationCounters().hyperbolicKeplerSolver.recordSolve(
+        static_cast<std::size_t>(numberOfIterations), isConverged ? 0 : 1));
+
+    if (!isConverged)
+    {
+        throw std::runtime_error(
+            "ERROR: Maximum iterations for Newton-Raphson root-finding exceeded!");
+    }
+
+    // Return hyperbolic eccentric anomaly with the sign of the mean anomaly.
+    return meanAnomaly < Real(0.0) ? -hyperbolicEccentricAnomaly : hyperbolicEccentricAnomaly;
+}
+
+//! Convert batch of hyperbolic mean anomalies to eccentric anomalies.
+/*!
+ * Converts a batch of mean anomalies to hyperbolic eccentric anomalies for hyperbolic orbits, for
+ * all eccentricities > 1.0. The initial guess and stopping conditions are the same as for the
+ * scalar conversion.
+ *
+ * The elements are processed in the same way as the batch conversion for elliptical orbits: the
+ * masked Newton-Raphson update is applied in fixed-size blocks, no exception is thrown if the
+ * maximum number of iterations is exceeded, and the convergence flag of each element is set.
+ *
+ * The output array may coincide with one of the input arrays (in-place conversion).
+ *
+ * @sa convertHyperbolicMeanAnomalyToEccentricAnomaly
+ * @tparam    Real                          Real number type
+ * @tparam    Integer                       Integer type
+ * @param     eccentricities                Array of eccentricities                         [-]
+ * @param     meanAnomalies                 Array of mean anomalies                         [rad]
+ * @param     hyperbolicEccentricAnomalies  Array of hyperbolic eccentric anomalies (output)
+ *                                                                                          [rad]
+ * @param     isConverged                   Array of convergence flags (output)             [-]
+ * @param     numberOfElements              Number of elements in each array                [-]
+ * @param     rootFindingTolerance          Stopping condition tolerance for Newton-Raphson
+ *                                          algorithm                                       [rad]
+ * @param     maximumIterations             Maximum iteration for Newton-Raphson algorithm  [-]
+ */
+template <typename Real, typename Integer>
+void convertHyperbolicMeanAnomalyToEccentricAnomaly(
+    const Real* const   eccentricities,
+    const Real* const   meanAnomalies,
+    Real* const         hyperbolicEccentricAnomalies,
+    bool* const         isConverged,
+    const std::size_t   numberOfElements,
+    const Real          rootFindingTolerance = Real(1.0e-3) * std::numeric_limits<Real>::epsilon(),
+    const Integer       maximumIterations = 100)
+{
+    const AbsoluteStepStoppingCondition<Real> stoppingCondition(rootFindingTolerance);
+
+    const std::size_t blockSize = rootFinderBlockSize;
+    Real eccentricity[blockSize];
+    Real meanAnomaly[blockSize];
+    Real meanAnomalyMagnitude[blockSize];
+    Real eccentricAnomaly[blockSize];
+    bool isLaneConverged[blockSize];
+    const HyperbolicKeplerBlockFunction<Real> function(eccentricity, meanAnomalyMagnitude);
+
+    for (std::size_t offset = 0; offset < numberOfElements; offset += blockSize)
+    {
+        const std::size_t n = std::min(blockSize, numberOfElements - offset);
+
+        std::copy(eccentricities + offset, eccentricities + offset + n, eccentricity);
+        std::copy(meanAnomalies + offset, meanAnomalies + offset + n, meanAnomaly);
+
+        // Set the initial guess for the hyperbolic eccentric anomaly (see scalar conversion for
+        // details).
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            assert(eccentricity[i] > Real(1.0));
+
+            meanAnomalyMagnitude[i] = std::fabs(meanAnomaly[i]);
+            eccentricAnomaly[i]
+                = std::min(
+                    std::min(meanAnomalyMagnitude[i] / (eccentricity[i] - Real(1.0)),
+                             std::cbrt(Real(6.0) * meanAnomalyMagnitude[i] / eccentricity[i])),
+                    std::log(Real(2.0) * meanAnomalyMagnitude[i] / eccentricity[i] + Real(1.8)));
+        }
+
+        // Execute masked Newton-Raphson root-finding algorithm.
+        Integer numberOfIterations = 0;
+        findRootsOfBlock<NewtonRaphsonScheme>(function,
+                                              stoppingCondition,
+                                              maximumIterations,
+                                              n,
+                                              eccentricAnomaly,
+                                              isLaneConverged,
+                                              numberOfIterations);
+
+        ASTRO_INSTRUMENT(getThreadInstrumentationCounters().hyperbolicKeplerBatchSolver.recordSolve(
+            static_cast<std::size_t>(numberOfIterations),
+            static_cast<std::size_t>(std::count(isLaneConverged, isLaneConverged + n, false))));
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            eccentricAnomaly[i]
+                = meanAnomaly[i] < Real(0.0) ? -eccentricAnomaly[i] : eccentricAnomaly[i];
+        }
+
+        std::copy(eccentricAnomaly, eccentricAnomaly + n, hyperbolicEccentricAnomalies + offset);
+        std::copy(isLaneConverged, isLaneConverged + n, isConverged + offset);
+    }
 }
 
 } // namespace astro
@@ -856,4 +2022,6 @@ Real convertEllipticalMeanAnomalyToEccentricAnomaly(
  *      2007.
  *  Musegaas, P. Optimization of Space Trajectories Including Multiple Gravity Assists and Deep
  *      Space Maneuvers. MSc thesis, Delft University of Technology, 2013.
+ *  Markley, F.L. Kepler Equation Solver. Celestial Mechanics and Dynamical Astronomy, 63(1),
+ *      101-111, 1995.
  */
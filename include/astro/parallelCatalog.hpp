@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+
+//! Default number of catalog objects per chunk of work.
+/*!
+ * Multiple of 64, such that the output of each chunk spans whole cache lines (for 64-byte cache
+ * lines and output arrays aligned to 64 bytes) and no cache line is written by more than one
+ * thread. The chunk is also large enough to amortize the cost of fetching it from the shared
+ * counter, and matches the block size of the batch element conversions.
+ */
+const std::size_t defaultCatalogChunkSize = 256;
+
+//! Get number of threads used for parallel execution.
+/*!
+ * @param numberOfThreads  Number of threads (0 selects the number of hardware threads)  [-]
+ * @return                 Number of threads (at least 1)                                [-]
+ */
+inline std::size_t getNumberOfThreads(const std::size_t numberOfThreads)
+{
+    if (numberOfThreads > 0)
+    {
+        return numberOfThreads;
+    }
+    return std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+                    static_cast<std::size_t>(1));
+}
+
+//! Execute function in parallel over a range of items.
+/*!
+ * Splits the range [0, numberOfItems) into chunks of (at most) chunkSize items and executes the
+ * given function for each chunk, as function(begin, end), on a pool of threads. The calling thread
+ * is one of the threads of the pool.
+ *
+ * The chunks are scheduled dynamically: each thread that has finished a chunk fetches the next
+ * unprocessed chunk from a shared atomic counter. As a result, threads that process inexpensive
+ * chunks (e.g., near-circular orbits for which the Kepler solvers converge in few iterations)
+ * take over the remaining work from threads that process expensive chunks, without the need for
+ * a priori partitioning of the work.
+ *
+ * If the function throws an exception, the remaining chunks are skipped and the first exception
+ * that was thrown is rethrown on the calling thread, once all threads have been joined.
+ *
+ * @tparam    Function         Function type, callable as function(std::size_t, std::size_t)
+ * @param     numberOfItems    Number of items                                              [-]
+ * @param     function         Function that processes items in range [begin, end)
+ * @param     numberOfThreads  Number of threads (0 selects the number of hardware threads) [-]
+ * @param     chunkSize        Number of items per chunk                                    [-]
+ */
+template <typename Function>
+void executeInParallel(const std::size_t  numberOfItems,
+                       const Function&    function,
+                       const std::size_t  numberOfThreads = 0,
+                       const std::size_t  chunkSize = defaultCatalogChunkSize)
+{
+    assert(chunkSize > 0);
+
+    const std::size_t numberOfChunks = (numberOfItems + chunkSize - 1) / chunkSize;
+
+    const std::size_t threadCount = std::min(getNumberOfThreads(numberOfThreads), numberOfChunks);
+
+    std::atomic<std::size_t> nextChunk(0);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    const auto worker = [&]()
+    {
+        for (std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+             chunk < numberOfChunks;
+             chunk = nextChunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end = std::min(begin + chunkSize, numberOfItems);
+            try
+            {
+                function(begin, end);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException)
+                {
+                    firstException = std::current_exception();
+                }
+
+                // Skip the remaining chunks.
+                nextChunk.store(numberOfChunks, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    if (threadCount <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (std::size_t i = 0; i < threadCount - 1; ++i)
+        {
+            threads.push_back(std::thread(worker));
+        }
+        worker();
+        for (std::size_t i = 0; i < threads.size(); ++i)
+        {
+            threads[i].join();
+        }
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
+}
+
+//! Convert catalog of Cartesian elements to Keplerian elements in parallel.
+/*!
+ * Converts a catalog of Cartesian elements, stored as a structure-of-arrays (one array per
+ * element), to Keplerian elements, by executing the batch conversion in parallel over chunks of
+ * the catalog.
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * @sa convertCartesianToKeplerianElements, executeInParallel
+ * @tparam  Real                    Real type
+ * @param   cartesianElements       Array of pointers to Cartesian element arrays, ordered using
+ *                                  CartesianElementIndices                       [m, m/s]
+ * @param   keplerianElements       Array of pointers to Keplerian element arrays, ordered using
+ *                                  KeplerianElementIndices (output)              [m, -, rad]
+ * @param   numberOfObjects         Number of objects in catalog                  [-]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   numberOfThreads         Number of threads (0 selects the number of hardware threads)
+ * @param   tolerance               Tolerance used to check for limit cases of eccentricity and
+ *                                  inclination
+ */
+template <typename Real>
+void convertCatalogCartesianToKeplerianElements(
+    const Real* const cartesianElements[6],
+    Real* const keplerianElements[6],
+    const std::size_t numberOfObjects,
+    const Real gravitationalParameter,
+    const std::size_t numberOfThreads = 0,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    executeInParallel(
+        numberOfObjects,
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            const Real* chunkInput[6];
+            Real* chunkOutput[6];
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                chunkInput[k] = cartesianElements[k] + begin;
+                chunkOutput[k] = keplerianElements[k] + begin;
+            }
+            convertCartesianToKeplerianElements(
+                chunkInput, chunkOutput, end - begin, gravitationalParameter, tolerance);
+        },
+        numberOfThreads);
+}
+
+//! Convert catalog of Keplerian elements to Cartesian elements in parallel.
+/*!
+ * Converts a catalog of Keplerian elements, stored as a structure-of-arrays (one array per
+ * element), to Cartesian elements, by executing the batch conversion in parallel over chunks of
+ * the catalog.
+ *
+ * The conversion can be performed in-place, i.e., the output arrays can be the input arrays.
+ *
+ * @sa convertKeplerianToCartesianElements, executeInParallel
+ * @tparam  Real                    Real type
+ * @param   keplerianElements       Array of pointers to Keplerian element arrays, ordered using
+ *                                  KeplerianElementIndices                       [m, -, rad]
+ * @param   cartesianElements       Array of pointers to Cartesian element arrays, ordered using
+ *                                  CartesianElementIndices (output)              [m, m/s]
+ * @param   numberOfObjects         Number of objects in catalog                  [-]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   numberOfThreads         Number of threads (0 selects the number of hardware threads)
+ * @param   tolerance               Tolerance used to check for limit case of eccentricity
+ */
+template <typename Real>
+void convertCatalogKeplerianToCartesianElements(
+    const Real* const keplerianElements[6],
+    Real* const cartesianElements[6],
+    const std::size_t numberOfObjects,
+    const Real gravitationalParameter,
+    const std::size_t numberOfThreads = 0,
+    const Real tolerance = Real(10.0) * std::numeric_limits<Real>::epsilon())
+{
+    executeInParallel(
+        numberOfObjects,
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            const Real* chunkInput[6];
+            Real* chunkOutput[6];
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                chunkInput[k] = keplerianElements[k] + begin;
+                chunkOutput[k] = cartesianElements[k] + begin;
+            }
+            convertKeplerianToCartesianElements(
+                chunkInput, chunkOutput, end - begin, gravitationalParameter, tolerance);
+        },
+        numberOfThreads);
+}
+
+//! Propagate catalog of Cartesian states to multiple epochs in parallel.
+/*!
+ * Propagates each state of a catalog of Cartesian states, stored as a structure-of-arrays (one
+ * array per element), by each of the given times-of-flight using the universal-variable Kepler
+ * propagator. The objects are distributed over the threads in chunks.
+ *
+ * The propagated states are stored object-major, i.e., the state of object i at epoch j is
+ * stored at index (i * numberOfEpochs + j) of the output arrays, such that the output of each
+ * chunk of objects is a contiguous range of each output array and threads can at most share the
+ * cache lines at the boundaries of their chunks.
+ *
+ * If the Newton-Raphson solver for the universal variable does not converge within the maximum
+ * number of iterations for any of the objects, a runtime exception is thrown once all threads
+ * have been joined.
+ *
+ * @sa KeplerPropagator, executeInParallel
+ * @tparam  Real                    Real type
+ * @param   initialStates           Array of pointers to arrays of initial Cartesian elements,
+ *                                  ordered using CartesianElementIndices         [m, m/s]
+ * @param   numberOfObjects         Number of objects in catalog                  [-]
+ * @param   timesOfFlight           Array of times-of-flight from initial epoch   [s]
+ * @param   numberOfEpochs          Number of epochs                              [-]
+ * @param   gravitationalParameter  Gravitational parameter of central body       [m^3 s^-2]
+ * @param   propagatedStates        Array of pointers to arrays of propagated Cartesian elements,
+ *                                  each of size (numberOfObjects * numberOfEpochs)
+ *                                  (output)                                      [m, m/s]
+ * @param   numberOfThreads         Number of threads (0 selects the number of hardware threads)
+ */
+template <typename Real>
+void propagateCatalog(const Real* const  initialStates[6],
+                      const std::size_t  numberOfObjects,
+                      const Real* const  timesOfFlight,
+                      const std::size_t  numberOfEpochs,
+                      const Real         gravitationalParameter,
+                      Real* const        propagatedStates[6],
+                      const std::size_t  numberOfThreads = 0)
+{
+    typedef std::vector<Real> Vector;
+
+    // Each object costs a propagation per epoch, so that the chunks are made smaller as the number
+    // of epochs increases, to retain enough chunks to balance the work over the threads.
+    const std::size_t chunkSize
+        = std::max(defaultCatalogChunkSize / std::max(numberOfEpochs, static_cast<std::size_t>(1)),
+                   static_cast<std::size_t>(1));
+
+    executeInParallel(
+        numberOfObjects,
+        [&](const std::size_t begin, const std::size_t end)
+        {
+            Vector initialState(6);
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                for (std::size_t k = 0; k < 6; ++k)
+                {
+                    initialState[k] = initialStates[k][i];
+                }
+
+                Real* objectStates[6];
+                for (std::size_t k = 0; k < 6; ++k)
+                {
+                    objectStates[k] = propagatedStates[k] + i * numberOfEpochs;
+                }
+
+                const KeplerPropagator<Real, Vector> propagator(initialState,
+                                                                gravitationalParameter);
+                propagator.propagate(timesOfFlight, objectStates, numberOfEpochs);
+            }
+        },
+        numberOfThreads,
+        chunkSize);
+}
+
+} // namespace astro
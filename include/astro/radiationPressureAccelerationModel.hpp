@@ -9,7 +9,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
 #include "astro/constants.hpp"
+#include "astro/shadowModel.hpp"
+#include "astro/vectorTraits.hpp"
 
 namespace astro
 {
@@ -32,7 +39,7 @@ namespace astro
 template <typename Real>
 Real computeAbsorptionRadiationPressure(const Real energyFlux)
 {
-  return energyFlux / ASTRO_SPEED_OF_LIGHT;
+  return energyFlux / PhysicalConstants<Real>::speedOfLight;
 }
 
 //! Compute radiation pressure.
@@ -68,6 +75,44 @@ Real computeRadiationPressure(const Real referenceRadiationPressure,
         * (referenceDistance * referenceDistance / (distance * distance));
 }
 
+//! Compute radiation pressure acceleration for a cannonball, writing into given output vector.
+/*!
+ * Computes the radiation pressure acceleration for a cannonball, identical to the computation that
+ * returns the acceleration vector, but writes into a caller-provided output vector. The unit
+ * vector and acceleration vectors can be of any type whose elements are accessed with operator[]
+ * (see IsVector). The acceleration can be written in-place, i.e., the output can be the input.
+ *
+ * @sa IsVector, computeCannonballRadiationPressureAcceleration
+ * @tparam     Real                          Floating-point type
+ * @tparam     InputVector3                  3-vector type of unit vector to source
+ * @tparam     OutputVector3                 3-vector type of acceleration
+ * @param[in]  radiationPressure             Radiation pressure                        [N m^-2]
+ * @param[in]  radiationPressureCoefficient  Radiation pressure coefficient            [-]
+ * @param[in]  unitVectorToSource            Unit vector pointing to radiation source  [-]
+ * @param[in]  radius                        Radius of cannonball                      [m]
+ * @param[in]  bulkDensity                   Bulk density of cannonball                [kg m^-3]
+ * @param[out] acceleration                  Computed radiation pressure acceleration  [m s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeCannonballRadiationPressureAcceleration(const Real          radiationPressure,
+                                               const Real          radiationPressureCoefficient,
+                                               const InputVector3& unitVectorToSource,
+                                               const Real          radius,
+                                               const Real          bulkDensity,
+                                               OutputVector3&&     acceleration)
+{
+    const Real preMultiplier = -radiationPressure
+                               * radiationPressureCoefficient
+                               * Real(0.75) / (radius * bulkDensity);
+
+    const Real u[3] = {unitVectorToSource[0], unitVectorToSource[1], unitVectorToSource[2]};
+
+    acceleration[0] = preMultiplier * u[0];
+    acceleration[1] = preMultiplier * u[1];
+    acceleration[2] = preMultiplier * u[2];
+}
+
 //! Compute radiation pressure acceleration for a cannonball.
 /*!
  * Compute radiation pressure acceleration for a canonball. The model for the radiation
@@ -105,18 +150,363 @@ Vector3 computeCannonballRadiationPressureAcceleration(const Real     radiationP
                                                        const Real     bulkDensity)
 {
     Vector3 acceleration = unitVectorToSource;
+    computeCannonballRadiationPressureAcceleration(radiationPressure,
+                                                   radiationPressureCoefficient,
+                                                   unitVectorToSource,
+                                                   radius,
+                                                   bulkDensity,
+                                                   acceleration);
+    return acceleration;
+}
 
-    const Real preMultiplier = -radiationPressure
+//! Compute gradient of radiation pressure acceleration for a cannonball with respect to position.
+/*!
+ * Computes the gradient (Jacobian) of the radiation pressure acceleration for a cannonball, with
+ * respect to the position of the cannonball. The radiation pressure is scaled with the
+ * inverse-square of the distance to the source, as in computeRadiationPressure, such that the
+ * acceleration and its gradient are given by:
+ *
+ * \f[
+ *      \vec{a} = C \frac{\vec{r}}{r^{3}}, \quad
+ *      \frac{\partial \vec{a}}{\partial \vec{r}}
+ *          = \frac{C}{r^{3}} \left( I - 3 \frac{\vec{r} \vec{r}^{T}}{r^{2}} \right), \quad
+ *      C = C_{R} \frac{3}{4r\rho} P_{ref} R_{ref}^{2}
+ * \f]
+ *
+ * where \f$\vec{r}\f$ is the position of the cannonball with respect to the source of the
+ * radiation pressure (e.g., the Sun). For a cannonball orbiting another body, e.g., the Earth, the
+ * gradient with respect to the position relative to that body is the same, since the position of
+ * the source is independent of the position of the cannonball. The derivative of the shadow
+ * function is not included, since it is zero in full sunlight and in the umbra.
+ *
+ * Since the acceleration is linear in the radiation pressure coefficient, the partial derivative
+ * of the acceleration with respect to the coefficient (e.g., to estimate it in orbit
+ * determination) is given by the acceleration divided by the coefficient.
+ *
+ * @sa computeCannonballRadiationPressureAcceleration, CartesianVariationalDynamics
+ * @tparam     Real                          Floating-point type
+ * @tparam     Vector3                       3-vector type
+ * @param[in]  referenceRadiationPressure    Radiation pressure at reference distance  [N m^-2]
+ * @param[in]  referenceDistance             Reference distance to source              [m]
+ * @param[in]  radiationPressureCoefficient  Radiation pressure coefficient            [-]
+ * @param[in]  positionWrtSource             Position of cannonball wrt source         [m]
+ * @param[in]  radius                        Radius of cannonball                      [m]
+ * @param[in]  bulkDensity                   Bulk density of cannonball                [kg m^-3]
+ * @param[out] gradient                      Gradient of acceleration wrt position, stored
+ *                                           row-major, i.e., gradient[i][j]
+ *                                           = d a_i / d r_j                           [s^-2]
+ */
+template <typename Real, typename Vector3>
+void computeCannonballRadiationPressureAccelerationGradient(
+    const Real     referenceRadiationPressure,
+    const Real     referenceDistance,
+    const Real     radiationPressureCoefficient,
+    const Vector3& positionWrtSource,
+    const Real     radius,
+    const Real     bulkDensity,
+    Real           gradient[3][3])
+{
+    const Real distanceSquared = positionWrtSource[0] * positionWrtSource[0]
+                                 + positionWrtSource[1] * positionWrtSource[1]
+                                 + positionWrtSource[2] * positionWrtSource[2];
+    const Real inverseDistanceSquared = Real(1.0) / distanceSquared;
+    const Real preMultiplier = referenceRadiationPressure * referenceDistance * referenceDistance
+                               * radiationPressureCoefficient * Real(0.75) / (radius * bulkDensity)
+                               * inverseDistanceSquared * std::sqrt(inverseDistanceSquared);
+    const Real threeInverseDistanceSquared = Real(3.0) * inverseDistanceSquared;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            gradient[i][j] = -preMultiplier * threeInverseDistanceSquared
+                             * positionWrtSource[i] * positionWrtSource[j];
+        }
+        gradient[i][i] += preMultiplier;
+    }
+}
+
+//! Compute shadowed radiation pressure acceleration, writing into given output vector.
+/*!
+ * Computes the radiation pressure acceleration for a cannonball, including the shadow of an
+ * occulting body, identical to the computation that returns the acceleration vector, but writes
+ * into a caller-provided output vector. The position and acceleration vectors can be of any type
+ * whose elements are accessed with operator[] (see IsVector). The acceleration can be written
+ * in-place, i.e., the output can be the position.
+ *
+ * @sa IsVector, computeShadowedCannonballRadiationPressureAcceleration
+ * @tparam     Real                          Floating-point type
+ * @tparam     InputVector3                  3-vector type of positions
+ * @tparam     OutputVector3                 3-vector type of acceleration
+ * @param[in]  referenceRadiationPressure    Radiation pressure at reference distance  [N m^-2]
+ * @param[in]  referenceDistance             Reference distance to Sun                 [m]
+ * @param[in]  radiationPressureCoefficient  Radiation pressure coefficient            [-]
+ * @param[in]  position                      Position of cannonball wrt occulting body [m]
+ * @param[in]  sunPosition                   Position of Sun wrt occulting body        [m]
+ * @param[in]  sunRadius                     Radius of Sun                             [m]
+ * @param[in]  occultingBodyRadius           Radius of occulting body                  [m]
+ * @param[in]  radius                        Radius of cannonball                      [m]
+ * @param[in]  bulkDensity                   Bulk density of cannonball                [kg m^-3]
+ * @param[out] acceleration                  Computed radiation pressure acceleration  [m s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeShadowedCannonballRadiationPressureAcceleration(
+    const Real          referenceRadiationPressure,
+    const Real          referenceDistance,
+    const Real          radiationPressureCoefficient,
+    const InputVector3& position,
+    const InputVector3& sunPosition,
+    const Real          sunRadius,
+    const Real          occultingBodyRadius,
+    const Real          radius,
+    const Real          bulkDensity,
+    OutputVector3&&     acceleration)
+{
+    const Real relativeSunPosition[3] = {sunPosition[0] - position[0],
+                                         sunPosition[1] - position[1],
+                                         sunPosition[2] - position[2]};
+
+    const Real positionNorm = std::sqrt(position[0] * position[0]
+                                        + position[1] * position[1]
+                                        + position[2] * position[2]);
+    const Real sunDistanceSquared = relativeSunPosition[0] * relativeSunPosition[0]
+                                    + relativeSunPosition[1] * relativeSunPosition[1]
+                                    + relativeSunPosition[2] * relativeSunPosition[2];
+    const Real sunDistance = std::sqrt(sunDistanceSquared);
+
+    const Real cosineSeparation = -(position[0] * relativeSunPosition[0]
+                                    + position[1] * relativeSunPosition[1]
+                                    + position[2] * relativeSunPosition[2])
+                                  / (positionNorm * sunDistance);
+
+    const Real shadowFunction = computeConicalShadowFunctionFromApparentRadii(
+        std::asin(sunRadius / sunDistance),
+        std::asin(occultingBodyRadius / positionNorm),
+        std::acos(std::min(std::max(cosineSeparation, Real(-1.0)), Real(1.0))));
+
+    const Real radiationPressure
+        = computeRadiationPressure(referenceRadiationPressure, referenceDistance, sunDistance);
+
+    // The unit vector to the Sun is the relative position of the Sun divided by its norm.
+    const Real preMultiplier = -shadowFunction
+                               * radiationPressure
                                * radiationPressureCoefficient
-                               * 0.75 / (radius * bulkDensity);
+                               * Real(0.75) / (radius * bulkDensity * sunDistance);
 
-    acceleration[0] = preMultiplier * unitVectorToSource[0];
-    acceleration[1] = preMultiplier * unitVectorToSource[1];
-    acceleration[2] = preMultiplier * unitVectorToSource[2];
+    acceleration[0] = preMultiplier * relativeSunPosition[0];
+    acceleration[1] = preMultiplier * relativeSunPosition[1];
+    acceleration[2] = preMultiplier * relativeSunPosition[2];
+}
 
+//! Compute radiation pressure acceleration for a cannonball, including shadow.
+/*!
+ * Computes radiation pressure acceleration for a cannonball, including the shadow of an occulting
+ * body (e.g., the Earth), by fusing computeRadiationPressure, the conical shadow function and
+ * computeCannonballRadiationPressureAcceleration:
+ *
+ * \f[
+ *      a = -\nu C_{R} \frac{3}{4r\rho} P_{ref} \frac{R_{ref}^{2}}{R^{2}} \vec{u}
+ * \f]
+ *
+ * where \f$\nu\f$ is the conical shadow function, \f$R\f$ is the distance from the cannonball to
+ * the Sun, and \f$\vec{u}\f$ is the unit vector pointing from the cannonball to the Sun. The
+ * relative position of the Sun, its norm and the position norm are computed once and shared
+ * between the shadow function and the acceleration.
+ *
+ * @sa computeConicalShadowFunction, computeRadiationPressure,
+ *     computeCannonballRadiationPressureAcceleration
+ * @tparam    Real                          Floating-point type
+ * @tparam    Vector3                       3-vector type
+ * @param[in] referenceRadiationPressure    Radiation pressure at reference distance  [N m^-2]
+ * @param[in] referenceDistance             Reference distance to Sun                 [m]
+ * @param[in] radiationPressureCoefficient  Radiation pressure coefficient            [-]
+ * @param[in] position                      Position of cannonball wrt occulting body [m]
+ * @param[in] sunPosition                   Position of Sun wrt occulting body        [m]
+ * @param[in] sunRadius                     Radius of Sun                             [m]
+ * @param[in] occultingBodyRadius           Radius of occulting body                  [m]
+ * @param[in] radius                        Radius of cannonball                      [m]
+ * @param[in] bulkDensity                   Bulk density of cannonball                [kg m^-3]
+ * @return                                  Computed radiation pressure acceleration  [m s^-2]
+ */
+template <typename Real, typename Vector3>
+Vector3 computeShadowedCannonballRadiationPressureAcceleration(
+    const Real     referenceRadiationPressure,
+    const Real     referenceDistance,
+    const Real     radiationPressureCoefficient,
+    const Vector3& position,
+    const Vector3& sunPosition,
+    const Real     sunRadius,
+    const Real     occultingBodyRadius,
+    const Real     radius,
+    const Real     bulkDensity)
+{
+    Vector3 acceleration = position;
+    computeShadowedCannonballRadiationPressureAcceleration(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           position,
+                                                           sunPosition,
+                                                           sunRadius,
+                                                           occultingBodyRadius,
+                                                           radius,
+                                                           bulkDensity,
+                                                           acceleration);
     return acceleration;
 }
 
+//! Compute radiation pressure accelerations for a batch of cannonballs, including shadow.
+/*!
+ * Computes radiation pressure accelerations and shadow functions for a batch of cannonballs with
+ * the same physical properties (e.g., fragments of a debris cloud), for a single position of the
+ * Sun. The positions and accelerations are stored as a structure-of-arrays (one array per
+ * component). The computation is identical to that of
+ * computeShadowedCannonballRadiationPressureAcceleration, except that the factors that are
+ * common to all cannonballs are computed once, such that the scaling of the radiation pressure
+ * with distance reduces to a division by the cubed distance to the Sun.
+ *
+ * The batch is processed in blocks that are staged in local arrays, and the shadow function is
+ * computed using selects instead of branches, such that the loop body can be vectorized by the
+ * compiler (requires a vector math library for arcsine and arccosine). The accelerations can be
+ * computed in-place, i.e., the acceleration arrays can be the position arrays.
+ *
+ * @sa computeShadowedCannonballRadiationPressureAcceleration
+ * @tparam     Real                          Floating-point type
+ * @tparam     Vector3                       3-vector type
+ * @param[in]  positions                     Array of pointers to arrays of positions of
+ *                                           cannonballs wrt occulting body           [m]
+ * @param[in]  numberOfObjects               Number of cannonballs                    [-]
+ * @param[in]  sunPosition                   Position of Sun wrt occulting body       [m]
+ * @param[in]  referenceRadiationPressure    Radiation pressure at reference distance [N m^-2]
+ * @param[in]  referenceDistance             Reference distance to Sun                [m]
+ * @param[in]  radiationPressureCoefficient  Radiation pressure coefficient           [-]
+ * @param[in]  sunRadius                     Radius of Sun                            [m]
+ * @param[in]  occultingBodyRadius           Radius of occulting body                 [m]
+ * @param[in]  radius                        Radius of cannonballs                    [m]
+ * @param[in]  bulkDensity                   Bulk density of cannonballs              [kg m^-3]
+ * @param[out] accelerations                 Array of pointers to arrays of computed
+ *                                           radiation pressure accelerations         [m s^-2]
+ * @param[out] shadowFunctions               Array of computed shadow functions (ignored if
+ *                                           null pointer)                            [-]
+ */
+template <typename Real, typename Vector3>
+void computeShadowedCannonballRadiationPressureAccelerations(
+    const Real* const positions[3],
+    const std::size_t numberOfObjects,
+    const Vector3& sunPosition,
+    const Real referenceRadiationPressure,
+    const Real referenceDistance,
+    const Real radiationPressureCoefficient,
+    const Real sunRadius,
+    const Real occultingBodyRadius,
+    const Real radius,
+    const Real bulkDensity,
+    Real* const accelerations[3],
+    Real* const shadowFunctions = nullptr)
+{
+    // Constant coefficient of radiation pressure acceleration, 3 P_ref d_ref^2 C_R / (4 r rho)
+    // [m^3 s^-2].
+    const Real coefficient = referenceRadiationPressure * referenceDistance * referenceDistance
+                             * radiationPressureCoefficient * Real(0.75) / (radius * bulkDensity);
+
+    const std::size_t blockSize = 64;
+    Real input[3][blockSize];
+    Real output[4][blockSize];
+
+    for (std::size_t blockStart = 0; blockStart < numberOfObjects; blockStart += blockSize)
+    {
+        const std::size_t blockLength = std::min(blockSize, numberOfObjects - blockStart);
+
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            std::copy(positions[k] + blockStart, positions[k] + blockStart + blockLength, input[k]);
+        }
+
+        for (std::size_t i = 0; i < blockLength; ++i)
+        {
+            const Real x = input[0][i];
+            const Real y = input[1][i];
+            const Real z = input[2][i];
+
+            const Real sunX = sunPosition[0] - x;
+            const Real sunY = sunPosition[1] - y;
+            const Real sunZ = sunPosition[2] - z;
+
+            const Real positionNorm = std::sqrt(x * x + y * y + z * z);
+            const Real sunDistance = std::sqrt(sunX * sunX + sunY * sunY + sunZ * sunZ);
+            const Real cosineSeparation
+                = -(x * sunX + y * sunY + z * sunZ) / (positionNorm * sunDistance);
+
+            const Real shadowFunction = computeConicalShadowFunctionFromApparentRadii(
+                std::asin(sunRadius / sunDistance),
+                std::asin(occultingBodyRadius / positionNorm),
+                std::acos(std::min(std::max(cosineSeparation, Real(-1.0)), Real(1.0))));
+
+            const Real preMultiplier
+                = -coefficient * shadowFunction / (sunDistance * sunDistance * sunDistance);
+
+            output[0][i] = preMultiplier * sunX;
+            output[1][i] = preMultiplier * sunY;
+            output[2][i] = preMultiplier * sunZ;
+            output[3][i] = shadowFunction;
+        }
+
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            std::copy(output[k], output[k] + blockLength, accelerations[k] + blockStart);
+        }
+        if (shadowFunctions != nullptr)
+        {
+            std::copy(output[3], output[3] + blockLength, shadowFunctions + blockStart);
+        }
+    }
+}
+
+//! Compute Poynting-Robertson drag acceleration, writing into given output vector.
+/*!
+ * Computes the Poynting-Robertson drag acceleration for a cannonball, identical to the computation
+ * that returns the acceleration vector, but writes into a caller-provided output vector. The
+ * input and acceleration vectors can be of any type whose elements are accessed with operator[]
+ * (see IsVector). The acceleration can be written in-place, i.e., the output can be one of the
+ * inputs.
+ *
+ * @sa IsVector, computeCannonballPoyntingRobertsonDragAcceleration
+ * @tparam     Real                          Floating-point type
+ * @tparam     InputVector3                  3-vector type of unit vector and velocity
+ * @tparam     OutputVector3                 3-vector type of acceleration
+ * @param[in]  radiationPressure             Radiation pressure                        [N m^-2]
+ * @param[in]  radiationPressureCoefficient  Radiation pressure coefficient            [-]
+ * @param[in]  unitVectorToSource            Unit vector pointing to radiation source  [-]
+ * @param[in]  radius                        Radius of cannonball                      [m]
+ * @param[in]  bulkDensity                   Bulk density of cannonball                [kg m^-3]
+ * @param[in]  velocity                      Total orbital velocity of cannonball wrt
+ *                                           inertial centered at radiation source     [m s^-1]
+ * @param[out] acceleration                  Computed radiation pressure acceleration  [m s^-2]
+ */
+template <typename Real, typename InputVector3, typename OutputVector3>
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeCannonballPoyntingRobertsonDragAcceleration(
+    const Real          radiationPressure,
+    const Real          radiationPressureCoefficient,
+    const InputVector3& unitVectorToSource,
+    const Real          radius,
+    const Real          bulkDensity,
+    const InputVector3& velocity,
+    OutputVector3&&     acceleration)
+{
+    const Real preMultiplier = radiationPressure
+                               * radiationPressureCoefficient
+                               * Real(0.75)
+                               / (radius * bulkDensity * PhysicalConstants<Real>::speedOfLight);
+
+    const Real u[3] = {unitVectorToSource[0], unitVectorToSource[1], unitVectorToSource[2]};
+    const Real v[3] = {velocity[0], velocity[1], velocity[2]};
+
+    acceleration[0] = preMultiplier * (u[0] * u[0] + Real(1.0)) * v[0];
+    acceleration[1] = preMultiplier * (u[1] * u[1] + Real(1.0)) * v[1];
+    acceleration[2] = preMultiplier * (u[2] * u[2] + Real(1.0)) * v[2];
+}
+
 //! Compute Poynting-Roberson drag acceleration for a cannonball.
 /*!
  * Compute Poynting-Roberson (PR) drag acceleration for a cannonball. The model for PR drag
@@ -160,18 +550,13 @@ Vector3 computeCannonballPoyntingRobertsonDragAcceleration(
     const Vector3& velocity)
 {
     Vector3 acceleration = unitVectorToSource;
-
-    const Real preMultiplier = radiationPressure
-                               * radiationPressureCoefficient
-                               * 0.75 / (radius * bulkDensity * ASTRO_SPEED_OF_LIGHT);
-
-    acceleration[0]
-      = preMultiplier * (unitVectorToSource[0] * unitVectorToSource[0] + 1.0) * velocity[0];
-    acceleration[1]
-      = preMultiplier * (unitVectorToSource[1] * unitVectorToSource[1] + 1.0) * velocity[1];
-    acceleration[2]
-      = preMultiplier * (unitVectorToSource[2] * unitVectorToSource[2] + 1.0) * velocity[2];
-
+    computeCannonballPoyntingRobertsonDragAcceleration(radiationPressure,
+                                                       radiationPressureCoefficient,
+                                                       unitVectorToSource,
+                                                       radius,
+                                                       bulkDensity,
+                                                       velocity,
+                                                       acceleration);
     return acceleration;
 }
 
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "astro/hostDevice.hpp"
+
+namespace astro
+{
+
+//! Newton-Raphson iteration scheme.
+/*!
+ * Iteration scheme of the Newton-Raphson method, which converges quadratically:
+ *
+ * \f[
+ *      x_{n+1} = x_{n} - \frac{f}{f'}
+ * \f]
+ *
+ * The second derivative is not used.
+ */
+struct NewtonRaphsonScheme
+{
+    //! Compute step, such that the next iterate is given by the current iterate minus the step.
+    /*!
+     * @tparam Real              Real type
+     * @param  function          Function value at current iterate
+     * @param  firstDerivative   First derivative at current iterate
+     * @return                   Step
+     */
+    template <typename Real>
+    ASTRO_HOST_DEVICE
+    static Real computeStep(const Real function, const Real firstDerivative, const Real)
+    {
+        return function / firstDerivative;
+    }
+};
+
+//! Halley iteration scheme.
+/*!
+ * Iteration scheme of Halley's method, which converges cubically:
+ *
+ * \f[
+ *      x_{n+1} = x_{n} - \frac{2 f f'}{2 f'^{2} - f f''}
+ * \f]
+ */
+struct HalleyScheme
+{
+    //! Compute step, such that the next iterate is given by the current iterate minus the step.
+    /*!
+     * @tparam Real              Real type
+     * @param  function          Function value at current iterate
+     * @param  firstDerivative   First derivative at current iterate
+     * @param  secondDerivative  Second derivative at current iterate
+     * @return                   Step
+     */
+    template <typename Real>
+    ASTRO_HOST_DEVICE
+    static Real computeStep(const Real function,
+                            const Real firstDerivative,
+                            const Real secondDerivative)
+    {
+        return Real(2.0) * function * firstDerivative
+               / (Real(2.0) * firstDerivative * firstDerivative - function * secondDerivative);
+    }
+};
+
+//! Laguerre iteration scheme.
+/*!
+ * Iteration scheme of the Laguerre-Conway method (Conway, 1986), which replaces the degree of the
+ * polynomial in Laguerre's method by a fixed value (5 by default) and takes the absolute value
+ * under the square root:
+ *
+ * \f[
+ *      x_{n+1} = x_{n} - \frac{n f}{f' \pm \sqrt{|(n - 1)^{2} f'^{2} - n (n - 1) f f''|}}
+ * \f]
+ *
+ * where the sign is chosen equal to the sign of \f$f'\f$. The method converges cubically and is
+ * robust against poor initial guesses, e.g., for Kepler's equation at near-parabolic
+ * eccentricities.
+ *
+ * @tparam Degree  Degree used in Laguerre's method
+ */
+template <int Degree = 5>
+struct LaguerreScheme
+{
+    //! Compute step, such that the next iterate is given by the current iterate minus the step.
+    /*!
+     * @tparam Real              Real type
+     * @param  function          Function value at current iterate
+     * @param  firstDerivative   First derivative at current iterate
+     * @param  secondDerivative  Second derivative at current iterate
+     * @return                   Step
+     */
+    template <typename Real>
+    ASTRO_HOST_DEVICE
+    static Real computeStep(const Real function,
+                            const Real firstDerivative,
+                            const Real secondDerivative)
+    {
+        const Real degree = Real(Degree);
+        const Real squareRoot
+            = std::sqrt(std::fabs((degree - Real(1.0)) * (degree - Real(1.0))
+                                  * firstDerivative * firstDerivative
+                                  - degree * (degree - Real(1.0)) * function * secondDerivative));
+        return degree * function
+               / (firstDerivative + (firstDerivative < Real(0.0) ? -squareRoot : squareRoot));
+    }
+};
+
+//! Stopping condition on the absolute step size.
+/*!
+ * Stopping condition that is attainable in finite precision. The iterations are stopped once the
+ * magnitude of the step falls below the tolerance, reaches round-off level with respect to the
+ * iterate, or stops decreasing after the iterations have settled (round-off cycling). This is the
+ * stopping condition of the solvers of Kepler's equation (see
+ * convertEllipticalMeanAnomalyToEccentricAnomaly).
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class AbsoluteStepStoppingCondition
+{
+public:
+
+    //! Construct stopping condition.
+    /*!
+     * @param rootFindingTolerance  Tolerance on absolute step size
+     */
+    ASTRO_HOST_DEVICE
+    explicit AbsoluteStepStoppingCondition(const Real rootFindingTolerance)
+        : rootFindingTolerance(rootFindingTolerance),
+          roundOffFactor(Real(4.0) * std::numeric_limits<Real>::epsilon()),
+          stallThreshold(std::sqrt(std::numeric_limits<Real>::epsilon()))
+    { }
+
+    //! Check if iterations have converged.
+    /*!
+     * @param  stepMagnitude          Magnitude of current step
+     * @param  previousStepMagnitude  Magnitude of previous step
+     * @param  iterate                Next iterate
+     * @return                        True if iterations have converged
+     */
+    ASTRO_HOST_DEVICE
+    bool operator()(const Real stepMagnitude,
+                    const Real previousStepMagnitude,
+                    const Real iterate) const
+    {
+        return stepMagnitude < rootFindingTolerance
+               || stepMagnitude <= roundOffFactor * std::fabs(iterate)
+               || (stepMagnitude >= previousStepMagnitude && stepMagnitude < stallThreshold);
+    }
+
+private:
+
+    //! Tolerance on absolute step size.
+    const Real rootFindingTolerance;
+
+    //! Factor of iterate below which step is at round-off level.
+    const Real roundOffFactor;
+
+    //! Step size below which a non-decreasing step indicates round-off cycling.
+    const Real stallThreshold;
+};
+
+//! Stopping condition on the relative step size.
+/*!
+ * Stopping condition for problems without a natural scale of the root. The iterations are stopped
+ * once the magnitude of the step relative to the iterate falls below the tolerance, or stops
+ * decreasing after the iterations have settled (round-off cycling). This is the stopping
+ * condition of the universal Kepler equation solver of KeplerPropagator.
+ *
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class RelativeStepStoppingCondition
+{
+public:
+
+    //! Construct stopping condition.
+    /*!
+     * @param rootFindingTolerance  Tolerance on relative step size
+     */
+    ASTRO_HOST_DEVICE
+    explicit RelativeStepStoppingCondition(const Real rootFindingTolerance)
+        : rootFindingTolerance(rootFindingTolerance),
+          stallThreshold(std::sqrt(std::numeric_limits<Real>::epsilon()))
+    { }
+
+    //! Check if iterations have converged.
+    /*!
+     * @param  stepMagnitude          Magnitude of current step
+     * @param  previousStepMagnitude  Magnitude of previous step
+     * @param  iterate                Next iterate
+     * @return                        True if iterations have converged
+     */
+    ASTRO_HOST_DEVICE
+    bool operator()(const Real stepMagnitude,
+                    const Real previousStepMagnitude,
+                    const Real iterate) const
+    {
+        return stepMagnitude <= rootFindingTolerance * std::fabs(iterate)
+               || (stepMagnitude >= previousStepMagnitude
+                   && stepMagnitude < stallThreshold * std::fabs(iterate));
+    }
+
+private:
+
+    //! Tolerance on relative step size.
+    const Real rootFindingTolerance;
+
+    //! Relative step size below which a non-decreasing step indicates round-off cycling.
+    const Real stallThreshold;
+};
+
+//! Safeguard that accepts every iterate.
+/*!
+ * Default safeguard of findRoot, which accepts the next iterate computed by the iteration scheme.
+ */
+struct UnconstrainedIterate
+{
+    //! Constrain next iterate.
+    /*!
+     * @tparam Real         Real type
+     * @param  nextIterate  Next iterate computed by iteration scheme
+     * @return              Next iterate
+     */
+    template <typename Real>
+    ASTRO_HOST_DEVICE
+    Real operator()(const Real, const Real nextIterate) const
+    {
+        return nextIterate;
+    }
+};
+
+//! Find root of function.
+/*!
+ * Finds a root of a function using the given iteration scheme (NewtonRaphsonScheme, HalleyScheme
+ * or LaguerreScheme) and stopping condition (AbsoluteStepStoppingCondition or
+ * RelativeStepStoppingCondition), starting from the given initial guess.
+ *
+ * The function is evaluated with a single call per iteration, which computes the function value
+ * and its first and second derivatives together, such that shared terms (e.g., the sine and
+ * cosine of the eccentric anomaly in Kepler's equation) are computed once per iteration. The
+ * second derivative can be left unset if the iteration scheme does not use it. The function must
+ * provide:
+ *
+ * \code
+ *      void operator()(const Real x, Real& function, Real& firstDerivative,
+ *                      Real& secondDerivative) const;
+ * \endcode
+ *
+ * The next iterate computed by the iteration scheme is passed through the safeguard, which is
+ * called as safeguard(iterate, nextIterate) and returns the iterate that is used instead, e.g., to
+ * keep the iterates within a bracket of the root (see UniversalKeplerFunction). By default, every
+ * iterate is accepted (see UnconstrainedIterate).
+ *
+ * No exception is thrown if the maximum number of iterations is exceeded; instead, false is
+ * returned and the root is set to the last iterate, such that the caller can decide how to handle
+ * non-convergence.
+ *
+ * @sa findRootsOfBlock
+ * @tparam         IterationScheme     Iteration scheme
+ * @tparam         Real                Real type
+ * @tparam         Function            Function type
+ * @tparam         StoppingCondition   Stopping condition type
+ * @tparam         Integer             Integer type
+ * @tparam         Safeguard           Safeguard type
+ * @param[in]      function            Function, including derivatives
+ * @param[in]      stoppingCondition   Stopping condition
+ * @param[in]      maximumIterations   Maximum number of iterations
+ * @param[in,out]  root                Initial guess (input) and root (output)
+ * @param[out]     numberOfIterations  Number of iterations executed
+ * @param[in]      safeguard           Safeguard of iterates
+ * @return                             True if iterations have converged
+ */
+template <typename IterationScheme,
+          typename Real,
+          typename Function,
+          typename StoppingCondition,
+          typename Integer,
+          typename Safeguard = UnconstrainedIterate>
+ASTRO_HOST_DEVICE
+bool findRoot(const Function&           function,
+              const StoppingCondition&  stoppingCondition,
+              const Integer             maximumIterations,
+              Real&                     root,
+              Integer&                  numberOfIterations,
+              const Safeguard&          safeguard = Safeguard())
+{
+    Real previousStepMagnitude = std::numeric_limits<Real>::max();
+    for (Integer iteration = 0; iteration < maximumIterations; ++iteration)
+    {
+        Real functionValue = Real(0.0);
+        Real firstDerivative = Real(0.0);
+        Real secondDerivative = Real(0.0);
+        function(root, functionValue, firstDerivative, secondDerivative);
+
+        const Real nextRoot = safeguard(
+            root,
+            root - IterationScheme::computeStep(functionValue, firstDerivative, secondDerivative));
+        const Real stepMagnitude = std::fabs(root - nextRoot);
+        root = nextRoot;
+
+        if (stoppingCondition(stepMagnitude, previousStepMagnitude, root))
+        {
+            numberOfIterations = iteration + 1;
+            return true;
+        }
+
+        previousStepMagnitude = stepMagnitude;
+    }
+
+    numberOfIterations = maximumIterations;
+    return false;
+}
+
+//! Maximum number of elements of a block of roots to find with findRootsOfBlock.
+const std::size_t rootFinderBlockSize = 64;
+
+//! Find roots of block of functions.
+/*!
+ * Finds the roots of a block of (at most rootFinderBlockSize) functions, using the given
+ * iteration scheme and stopping condition (see findRoot). The update is applied to all elements
+ * that have not yet converged, without branching, such that the loops can be auto-vectorized by
+ * the compiler. The iterations are completed as soon as all elements have converged.
+ *
+ * The block function evaluates the function values and derivatives for all elements of the block
+ * with a single call per iteration. By evaluating each transcendental function in a separate
+ * loop (e.g., one loop for the sine and one for the cosine), the block function keeps the loops
+ * vectorizable. The block function must provide:
+ *
+ * \code
+ *      void operator()(const Real* x, Real* functions, Real* firstDerivatives,
+ *                      Real* secondDerivatives, const std::size_t numberOfElements) const;
+ * \endcode
+ *
+ * No exception is thrown if the maximum number of iterations is exceeded. Instead, the
+ * convergence flag of each element is set and the root is set to the last iterate for each
+ * element that did not converge.
+ *
+ * @sa findRoot
+ * @tparam         IterationScheme     Iteration scheme
+ * @tparam         Real                Real type
+ * @tparam         BlockFunction       Block function type
+ * @tparam         StoppingCondition   Stopping condition type
+ * @tparam         Integer             Integer type
+ * @param[in]      function            Block function, including derivatives
+ * @param[in]      stoppingCondition   Stopping condition
+ * @param[in]      maximumIterations   Maximum number of iterations
+ * @param[in]      numberOfElements    Number of elements in block
+ * @param[in,out]  roots               Array of initial guesses (input) and roots (output)
+ * @param[out]     isConverged         Array of convergence flags
+ * @param[out]     numberOfIterations  Number of iterations executed for block
+ */
+template <typename IterationScheme,
+          typename Real,
+          typename BlockFunction,
+          typename StoppingCondition,
+          typename Integer>
+ASTRO_HOST_DEVICE
+void findRootsOfBlock(const BlockFunction&      function,
+                      const StoppingCondition&  stoppingCondition,
+                      const Integer             maximumIterations,
+                      const std::size_t         numberOfElements,
+                      Real* const               roots,
+                      bool* const               isConverged,
+                      Integer&                  numberOfIterations)
+{
+    assert(numberOfElements <= rootFinderBlockSize);
+
+    Real functionValues[rootFinderBlockSize];
+    Real firstDerivatives[rootFinderBlockSize];
+    Real secondDerivatives[rootFinderBlockSize];
+    Real previousStepMagnitudes[rootFinderBlockSize];
+
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        previousStepMagnitudes[i] = std::numeric_limits<Real>::max();
+        isConverged[i] = false;
+    }
+
+    numberOfIterations = 0;
+    for (Integer iteration = 0; iteration < maximumIterations; ++iteration)
+    {
+        function(roots, functionValues, firstDerivatives, secondDerivatives, numberOfElements);
+
+        std::size_t numberOfConvergedElements = 0;
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            const Real nextRoot
+                = roots[i] - IterationScheme::computeStep(functionValues[i],
+                                                          firstDerivatives[i],
+                                                          secondDerivatives[i]);
+            const Real stepMagnitude = std::fabs(roots[i] - nextRoot);
+            const bool hasConverged
+                = stoppingCondition(stepMagnitude, previousStepMagnitudes[i], nextRoot);
+
+            roots[i] = isConverged[i] ? roots[i] : nextRoot;
+            previousStepMagnitudes[i] = isConverged[i] ? previousStepMagnitudes[i] : stepMagnitude;
+            isConverged[i] = isConverged[i] || hasConverged;
+            numberOfConvergedElements += isConverged[i] ? 1 : 0;
+        }
+
+        numberOfIterations = iteration + 1;
+        if (numberOfConvergedElements == numberOfElements)
+        {
+            break;
+        }
+    }
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Conway, B.A. An improved algorithm due to Laguerre for the solution of Kepler's equation,
+ *      Celestial Mechanics, 39(2), 199-211, 1986.
+ */
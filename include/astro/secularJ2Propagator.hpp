@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+#include "astro/twoBodyMethods.hpp"
+
+namespace astro
+{
+
+//! Compute secular rates of Keplerian elements due to J2.
+/*!
+ * Computes the secular (orbit-averaged) rates of the argument of periapsis, the longitude of the
+ * ascending node and the mean anomaly of an elliptical orbit due to the J2-coefficient of the
+ * central body, to first order in J2 (Vallado, 2007):
+ *
+ * \f{eqnarray*}{
+ *      \dot{\Omega} &=& -\frac{3}{2} n J_{2} \left(\frac{R}{p}\right)^{2} \cos i \\
+ *      \dot{\omega} &=& \frac{3}{4} n J_{2} \left(\frac{R}{p}\right)^{2} (5 \cos^{2} i - 1) \\
+ *      \dot{M} &=& n + \frac{3}{4} n J_{2} \left(\frac{R}{p}\right)^{2} \sqrt{1 - e^{2}}
+ *                  (3 \cos^{2} i - 1)
+ * \f}
+ *
+ * where \f$n\f$ is the Kepler mean motion (see computeKeplerMeanMotion) and \f$p = a(1 - e^{2})\f$
+ * is the semi-latus rectum. The semi-major axis, eccentricity and inclination have no secular
+ * rates due to J2. The elements are mean elements, i.e., the short-periodic variations due to J2
+ * are not included.
+ *
+ * @sa SecularJ2Propagator, computeKeplerMeanMotion
+ * @tparam     Real                          Real type
+ * @param[in]  semiMajorAxis                 Semi-major axis                            [m]
+ * @param[in]  eccentricity                  Eccentricity (0 <= e < 1)                  [-]
+ * @param[in]  inclination                   Inclination                                [rad]
+ * @param[in]  gravitationalParameter        Gravitational parameter of central body    [m^3 s^-2]
+ * @param[in]  equatorialRadius              Equatorial radius of central body          [m]
+ * @param[in]  j2Coefficient                 Unnormalized J2-coefficient                [-]
+ * @param[out] argumentOfPeriapsisRate       Secular rate of argument of periapsis      [rad/s]
+ * @param[out] longitudeOfAscendingNodeRate  Secular rate of ascending node longitude   [rad/s]
+ * @param[out] meanAnomalyRate               Secular rate of mean anomaly               [rad/s]
+ */
+template <typename Real>
+void computeSecularJ2Rates(const Real semiMajorAxis,
+                           const Real eccentricity,
+                           const Real inclination,
+                           const Real gravitationalParameter,
+                           const Real equatorialRadius,
+                           const Real j2Coefficient,
+                           Real&      argumentOfPeriapsisRate,
+                           Real&      longitudeOfAscendingNodeRate,
+                           Real&      meanAnomalyRate)
+{
+    assert(semiMajorAxis > Real(0.0));
+    assert(eccentricity >= Real(0.0) && eccentricity < Real(1.0));
+
+    const Real meanMotion
+        = computeKeplerMeanMotion(semiMajorAxis, gravitationalParameter, Real(0.0));
+    const Real oneMinusEccentricitySquared = Real(1.0) - eccentricity * eccentricity;
+    const Real radiusOverSemiLatusRectum
+        = equatorialRadius / (semiMajorAxis * oneMinusEccentricitySquared);
+    const Real factor = Real(0.75) * meanMotion * j2Coefficient
+                        * radiusOverSemiLatusRectum * radiusOverSemiLatusRectum;
+    const Real cosineOfInclination = std::cos(inclination);
+    const Real cosineOfInclinationSquared = cosineOfInclination * cosineOfInclination;
+
+    longitudeOfAscendingNodeRate = Real(-2.0) * factor * cosineOfInclination;
+    argumentOfPeriapsisRate = factor * (Real(5.0) * cosineOfInclinationSquared - Real(1.0));
+    meanAnomalyRate = meanMotion
+                      + factor * std::sqrt(oneMinusEccentricitySquared)
+                        * (Real(3.0) * cosineOfInclinationSquared - Real(1.0));
+}
+
+//! Secular J2 mean-element propagator.
+/*!
+ * Propagates the mean Keplerian elements of an elliptical orbit analytically, by applying the
+ * secular rates due to J2 (see computeSecularJ2Rates) to the argument of periapsis, the longitude
+ * of the ascending node and the mean anomaly. The semi-major axis, eccentricity and inclination
+ * remain constant.
+ *
+ * The rates and the initial mean anomaly are computed once on construction. Each propagation then
+ * costs the solution of Kepler's equation, using
+ * convertEllipticalMeanAnomalyToEccentricAnomalyMarkley (fixed cost, no exceptions), and the
+ * conversion of the eccentric anomaly to the true anomaly, independent of the time-of-flight. For
+ * long horizons (e.g., years) this is orders of magnitude faster than the numerical integration of
+ * computeJ2Acceleration, which requires many steps per orbit.
+ *
+ * Since the short-periodic variations due to J2 are not modelled, the position error with respect
+ * to the osculating orbit oscillates with an amplitude of the order of \f$J_{2} R^{2} / a\f$
+ * (about 10 km in low Earth orbit), without growing secularly if the initial elements are mean
+ * elements. This is adequate for, e.g., coverage analysis of constellations, but not for
+ * conjunction analysis. The secular rates are computed to first order in J2 and neglect the
+ * higher-order zonal harmonics, drag and third-body perturbations.
+ *
+ * @sa computeSecularJ2Rates, propagateSecularJ2
+ * @tparam    Real     Real type
+ * @tparam    Vector6  6-vector type
+ */
+template <typename Real, typename Vector6>
+class SecularJ2Propagator
+{
+public:
+
+    //! Construct secular J2 propagator.
+    /*!
+     * @param     keplerianElements       Mean Keplerian elements at initial epoch, ordered using
+     *                                    KeplerianElementIndices (0 <= e < 1)        [m, -, rad]
+     * @param     gravitationalParameter  Gravitational parameter of central body     [m^3 s^-2]
+     * @param     equatorialRadius        Equatorial radius of central body           [m]
+     * @param     j2Coefficient           Unnormalized J2-coefficient                 [-]
+     */
+    SecularJ2Propagator(const Vector6& keplerianElements,
+                        const Real     gravitationalParameter,
+                        const Real     equatorialRadius,
+                        const Real     j2Coefficient)
+        : initialElements(keplerianElements),
+          initialMeanAnomaly(convertTrueAnomalyToEllipticalMeanAnomaly(
+            keplerianElements[trueAnomalyIndex], keplerianElements[eccentricityIndex]))
+    {
+        computeSecularJ2Rates(keplerianElements[semiMajorAxisIndex],
+                              keplerianElements[eccentricityIndex],
+                              keplerianElements[inclinationIndex],
+                              gravitationalParameter,
+                              equatorialRadius,
+                              j2Coefficient,
+                              argumentOfPeriapsisRate,
+                              longitudeOfAscendingNodeRate,
+                              meanAnomalyRate);
+    }
+
+    //! Propagate mean Keplerian elements.
+    /*!
+     * The argument of periapsis, longitude of ascending node and true anomaly are returned in the
+     * range 0 to 2pi.
+     *
+     * @param     timeOfFlight  Time-of-flight from initial epoch            [s]
+     * @return                  Propagated mean Keplerian elements, ordered
+     *                          using KeplerianElementIndices                [m, -, rad]
+     */
+    Vector6 propagate(const Real timeOfFlight) const
+    {
+        Vector6 elements = initialElements;
+        computeAngles(timeOfFlight,
+                      elements[argumentOfPeriapsisIndex],
+                      elements[longitudeOfAscendingNodeIndex],
+                      elements[trueAnomalyIndex]);
+        return elements;
+    }
+
+    //! Propagate mean Keplerian elements to multiple epochs.
+    /*!
+     * Propagates the initial elements by each of the given times-of-flight and stores the
+     * propagated elements in structure-of-arrays layout, i.e., as 6 arrays indexed by
+     * KeplerianElementIndices, similar to the batch element conversions. Since the secular rates
+     * and the initial mean anomaly are computed on construction, this is the fastest way to sweep
+     * an orbit over a long horizon.
+     *
+     * @param     timesOfFlight   Array of times-of-flight from initial epoch          [s]
+     * @param     elements        Arrays of propagated mean Keplerian elements (output)
+     *                                                                                 [m, -, rad]
+     * @param     numberOfEpochs  Number of epochs                                     [-]
+     */
+    void propagate(const Real* const   timesOfFlight,
+                   Real* const         elements[6],
+                   const std::size_t   numberOfEpochs) const
+    {
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            elements[semiMajorAxisIndex][j] = initialElements[semiMajorAxisIndex];
+            elements[eccentricityIndex][j] = initialElements[eccentricityIndex];
+            elements[inclinationIndex][j] = initialElements[inclinationIndex];
+            computeAngles(timesOfFlight[j],
+                          elements[argumentOfPeriapsisIndex][j],
+                          elements[longitudeOfAscendingNodeIndex][j],
+                          elements[trueAnomalyIndex][j]);
+        }
+    }
+
+    //! Get secular rate of argument of periapsis.
+    /*!
+     * @return Secular rate of argument of periapsis  [rad/s]
+     */
+    Real getArgumentOfPeriapsisRate() const { return argumentOfPeriapsisRate; }
+
+    //! Get secular rate of longitude of ascending node.
+    /*!
+     * @return Secular rate of longitude of ascending node  [rad/s]
+     */
+    Real getLongitudeOfAscendingNodeRate() const { return longitudeOfAscendingNodeRate; }
+
+    //! Get secular rate of mean anomaly.
+    /*!
+     * @return Secular rate of mean anomaly  [rad/s]
+     */
+    Real getMeanAnomalyRate() const { return meanAnomalyRate; }
+
+private:
+
+    //! Compute propagated angles, in range 0 to 2pi.
+    void computeAngles(const Real timeOfFlight,
+                       Real&      argumentOfPeriapsis,
+                       Real&      longitudeOfAscendingNode,
+                       Real&      trueAnomaly) const
+    {
+        const Real eccentricity = initialElements[eccentricityIndex];
+
+        argumentOfPeriapsis = wrapAngle(
+            initialElements[argumentOfPeriapsisIndex] + argumentOfPeriapsisRate * timeOfFlight);
+        longitudeOfAscendingNode = wrapAngle(
+            initialElements[longitudeOfAscendingNodeIndex]
+            + longitudeOfAscendingNodeRate * timeOfFlight);
+
+        const Real eccentricAnomaly = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+            eccentricity, initialMeanAnomaly + meanAnomalyRate * timeOfFlight);
+        trueAnomaly = wrapAngle(
+            convertEllipticalEccentricAnomalyToTrueAnomaly(eccentricAnomaly, eccentricity));
+    }
+
+    //! Wrap angle to range 0 to 2pi.
+    static Real wrapAngle(const Real angle)
+    {
+        const Real twoPi = Real(2.0) * Real(3.14159265358979323846);
+        const Real wrappedAngle = std::fmod(angle, twoPi);
+        return wrappedAngle < Real(0.0) ? wrappedAngle + twoPi : wrappedAngle;
+    }
+
+    //! Mean Keplerian elements at initial epoch.
+    const Vector6 initialElements;
+
+    //! Mean anomaly at initial epoch.
+    const Real initialMeanAnomaly;
+
+    //! Secular rate of argument of periapsis.
+    Real argumentOfPeriapsisRate;
+
+    //! Secular rate of longitude of ascending node.
+    Real longitudeOfAscendingNodeRate;
+
+    //! Secular rate of mean anomaly.
+    Real meanAnomalyRate;
+};
+
+//! Propagate mean Keplerian elements of multiple orbits with secular J2 rates.
+/*!
+ * Propagates the mean Keplerian elements of each orbit by the given time-of-flight with the
+ * secular rates due to J2, as SecularJ2Propagator, using structure-of-arrays layout, similar to
+ * the batch element conversions. The argument of periapsis, longitude of ascending node and true
+ * anomaly are returned in the range 0 to 2pi.
+ *
+ * The output arrays may coincide with the input arrays (in-place propagation).
+ *
+ * @sa SecularJ2Propagator, computeSecularJ2Rates
+ * @tparam     Real                    Real type
+ * @param[in]  keplerianElements       Array of pointers to mean Keplerian element arrays,
+ *                                     ordered using KeplerianElementIndices (0 <= e < 1)
+ *                                                                                [m, -, rad]
+ * @param[in]  numberOfOrbits          Number of orbits stored in each array      [-]
+ * @param[in]  timeOfFlight            Time-of-flight                             [s]
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body    [m^3 s^-2]
+ * @param[in]  equatorialRadius        Equatorial radius of central body          [m]
+ * @param[in]  j2Coefficient           Unnormalized J2-coefficient                [-]
+ * @param[out] propagatedElements      Array of pointers to propagated mean Keplerian element
+ *                                     arrays, ordered using KeplerianElementIndices
+ *                                                                                [m, -, rad]
+ */
+template <typename Real>
+void propagateSecularJ2(const Real* const  keplerianElements[6],
+                        const std::size_t  numberOfOrbits,
+                        const Real         timeOfFlight,
+                        const Real         gravitationalParameter,
+                        const Real         equatorialRadius,
+                        const Real         j2Coefficient,
+                        Real* const        propagatedElements[6])
+{
+    const Real pi = Real(3.14159265358979323846);
+    const Real twoPi = Real(2.0) * pi;
+
+    for (std::size_t n = 0; n < numberOfOrbits; ++n)
+    {
+        // Read all elements before writing, such that the propagation can be done in place.
+        const Real semiMajorAxis = keplerianElements[semiMajorAxisIndex][n];
+        const Real eccentricity = keplerianElements[eccentricityIndex][n];
+        const Real inclination = keplerianElements[inclinationIndex][n];
+        const Real argumentOfPeriapsis = keplerianElements[argumentOfPeriapsisIndex][n];
+        const Real longitudeOfAscendingNode = keplerianElements[longitudeOfAscendingNodeIndex][n];
+        const Real trueAnomaly = keplerianElements[trueAnomalyIndex][n];
+
+        Real argumentOfPeriapsisRate;
+        Real longitudeOfAscendingNodeRate;
+        Real meanAnomalyRate;
+        computeSecularJ2Rates(semiMajorAxis,
+                              eccentricity,
+                              inclination,
+                              gravitationalParameter,
+                              equatorialRadius,
+                              j2Coefficient,
+                              argumentOfPeriapsisRate,
+                              longitudeOfAscendingNodeRate,
+                              meanAnomalyRate);
+
+        const Real meanAnomaly
+            = convertTrueAnomalyToEllipticalMeanAnomaly(trueAnomaly, eccentricity)
+              + meanAnomalyRate * timeOfFlight;
+        const Real eccentricAnomaly
+            = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(eccentricity, meanAnomaly);
+        const Real propagatedTrueAnomaly
+            = convertEllipticalEccentricAnomalyToTrueAnomaly(eccentricAnomaly, eccentricity);
+
+        const Real propagatedArgumentOfPeriapsis
+            = std::fmod(argumentOfPeriapsis + argumentOfPeriapsisRate * timeOfFlight, twoPi);
+        const Real propagatedLongitudeOfAscendingNode
+            = std::fmod(longitudeOfAscendingNode + longitudeOfAscendingNodeRate * timeOfFlight,
+                        twoPi);
+
+        propagatedElements[semiMajorAxisIndex][n] = semiMajorAxis;
+        propagatedElements[eccentricityIndex][n] = eccentricity;
+        propagatedElements[inclinationIndex][n] = inclination;
+        propagatedElements[argumentOfPeriapsisIndex][n]
+            = propagatedArgumentOfPeriapsis < Real(0.0)
+                ? propagatedArgumentOfPeriapsis + twoPi : propagatedArgumentOfPeriapsis;
+        propagatedElements[longitudeOfAscendingNodeIndex][n]
+            = propagatedLongitudeOfAscendingNode < Real(0.0)
+                ? propagatedLongitudeOfAscendingNode + twoPi : propagatedLongitudeOfAscendingNode;
+        propagatedElements[trueAnomalyIndex][n]
+            = propagatedTrueAnomaly < Real(0.0)
+                ? propagatedTrueAnomaly + twoPi : propagatedTrueAnomaly;
+    }
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A.. Fundamentals of Astrodynamics and Applications. Third Edition, Microcosm Press,
+ *      2007.
+ */
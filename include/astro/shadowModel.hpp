@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace astro
+{
+
+//! Compute conical shadow function from apparent radii and separation.
+/*!
+ * Computes the fraction of the solar disk that is visible to an observer, given the apparent
+ * radius of the Sun \f$a\f$, the apparent radius of the occulting body \f$b\f$, and the apparent
+ * separation of their centers \f$c\f$, all as seen by the observer (Montenbruck, 2000):
+ *
+ * \f[
+ *      \nu = \begin{cases}
+ *          1                               & c \geq a + b \\
+ *          0                               & c \leq b - a \\
+ *          1 - \frac{b^{2}}{a^{2}}         & c \leq a - b \\
+ *          1 - \frac{A}{\pi a^{2}}         & \text{otherwise}
+ *      \end{cases}
+ * \f]
+ *
+ * where the occulted area \f$A\f$ of the overlapping disks in the partial case is given by
+ *
+ * \f[
+ *      A = a^{2} \arccos\left(\frac{x}{a}\right) + b^{2} \arccos\left(\frac{c - x}{b}\right) - cy
+ * \f]
+ *
+ * with \f$x = \frac{c^{2} + a^{2} - b^{2}}{2c}\f$ and \f$y = \sqrt{a^{2} - x^{2}}\f$. The four
+ * cases correspond to full sunlight, umbra, annular eclipse (antumbra) and penumbra,
+ * respectively.
+ *
+ * The occulted area is evaluated for all cases, with its arguments clamped to their domains, and
+ * the result is then selected, such that the function is free of branches (other than selects)
+ * and can be used in loops over many objects.
+ *
+ * @sa computeConicalShadowFunction
+ * @tparam    Real                 Real type
+ * @param[in] apparentSunRadius    Apparent radius of Sun                                 [rad]
+ * @param[in] apparentBodyRadius   Apparent radius of occulting body                      [rad]
+ * @param[in] apparentSeparation   Apparent separation of centers of Sun and body         [rad]
+ * @return                         Shadow function, i.e., fraction of solar disk visible  [-]
+ */
+template <typename Real>
+Real computeConicalShadowFunctionFromApparentRadii(const Real apparentSunRadius,
+                                                   const Real apparentBodyRadius,
+                                                   const Real apparentSeparation)
+{
+    const Real pi = Real(3.14159265358979323846);
+
+    const Real a = apparentSunRadius;
+    const Real b = apparentBodyRadius;
+    const Real c = apparentSeparation;
+    const Real aSquared = a * a;
+    const Real bSquared = b * b;
+
+    // The separation is bounded away from zero for the partial case, which is not selected for
+    // concentric disks. The difference of squares is factorized, and the angles are computed
+    // using atan2 instead of the arccosine of x/a and (c - x)/b, to retain accuracy if one of the
+    // disks is much smaller than the other (e.g., the solar disk seen from low Earth orbit).
+    const Real safeSeparation = std::max(c, std::numeric_limits<Real>::min());
+    const Real x = ((c - b) * (c + b) + aSquared) / (Real(2.0) * safeSeparation);
+    const Real y = std::sqrt(std::max(aSquared - x * x, Real(0.0)));
+    const Real occultedArea
+        = aSquared * std::atan2(y, x) + bSquared * std::atan2(y, c - x) - c * y;
+
+    const Real partialShadowFunction = Real(1.0) - occultedArea / (pi * aSquared);
+    const Real annularShadowFunction = Real(1.0) - bSquared / aSquared;
+
+    return c >= a + b ? Real(1.0)
+           : c <= b - a ? Real(0.0)
+           : c <= a - b ? annularShadowFunction
+           : partialShadowFunction;
+}
+
+//! Compute conical shadow function.
+/*!
+ * Computes the conical shadow function, i.e., the fraction of the solar disk that is visible from
+ * a given position, for a spherical occulting body (e.g., the Earth) and a spherical Sun
+ * (Montenbruck, 2000). The shadow function is 1 in full sunlight, 0 in the umbra, and takes a
+ * value in between in the penumbra and (for occulting bodies that appear smaller than the Sun)
+ * the antumbra. The radiation pressure acceleration is scaled by the shadow function.
+ *
+ * The apparent radius of the Sun \f$a\f$, the apparent radius of the occulting body \f$b\f$, and
+ * their apparent separation \f$c\f$ are given by
+ *
+ * \f[
+ *      a = \arcsin\left(\frac{R_{\odot}}{|\vec{r}_{\odot} - \vec{r}|}\right), \quad
+ *      b = \arcsin\left(\frac{R_{B}}{|\vec{r}|}\right), \quad
+ *      c = \arccos\left(\frac{-\vec{r} \cdot (\vec{r}_{\odot} - \vec{r})}
+ *                            {|\vec{r}| |\vec{r}_{\odot} - \vec{r}|}\right)
+ * \f]
+ *
+ * where \f$\vec{r}\f$ and \f$\vec{r}_{\odot}\f$ are the positions of the object and the Sun with
+ * respect to the center of the occulting body, and \f$R_{\odot}\f$ and \f$R_{B}\f$ are the radii
+ * of the Sun and the occulting body. The position must lie outside the occulting body.
+ *
+ * The positions and radii can be given in any units, so long as they are all in the same units.
+ *
+ * @sa computeConicalShadowFunctionFromApparentRadii, computeCylindricalShadowFunction
+ * @tparam    Real                 Real type
+ * @tparam    Vector3              3-vector type
+ * @param[in] position             Position of object wrt occulting body       [m]
+ * @param[in] sunPosition          Position of Sun wrt occulting body          [m]
+ * @param[in] sunRadius            Radius of Sun                               [m]
+ * @param[in] occultingBodyRadius  Radius of occulting body                    [m]
+ * @return                         Shadow function, i.e., fraction of solar
+ *                                 disk visible                                [-]
+ */
+template <typename Real, typename Vector3>
+Real computeConicalShadowFunction(const Vector3& position,
+                                  const Vector3& sunPosition,
+                                  const Real     sunRadius,
+                                  const Real     occultingBodyRadius)
+{
+    const Real relativeSunPosition[3] = {sunPosition[0] - position[0],
+                                         sunPosition[1] - position[1],
+                                         sunPosition[2] - position[2]};
+
+    const Real positionNorm = std::sqrt(position[0] * position[0]
+                                        + position[1] * position[1]
+                                        + position[2] * position[2]);
+    const Real sunDistance = std::sqrt(relativeSunPosition[0] * relativeSunPosition[0]
+                                       + relativeSunPosition[1] * relativeSunPosition[1]
+                                       + relativeSunPosition[2] * relativeSunPosition[2]);
+
+    const Real cosineSeparation = -(position[0] * relativeSunPosition[0]
+                                    + position[1] * relativeSunPosition[1]
+                                    + position[2] * relativeSunPosition[2])
+                                  / (positionNorm * sunDistance);
+
+    return computeConicalShadowFunctionFromApparentRadii(
+        std::asin(sunRadius / sunDistance),
+        std::asin(occultingBodyRadius / positionNorm),
+        std::acos(std::min(std::max(cosineSeparation, Real(-1.0)), Real(1.0))));
+}
+
+//! Compute cylindrical shadow function.
+/*!
+ * Computes the cylindrical shadow function, for which the shadow of the occulting body is modelled
+ * as a cylinder with the radius of the body, extending from the body in the direction away from
+ * the Sun (Montenbruck, 2000). The Sun is assumed to be infinitely far away, such that there is
+ * no penumbra: the shadow function is 0 inside the cylinder and 1 outside.
+ *
+ * The object is in the shadow if
+ *
+ * \f[
+ *      \vec{r} \cdot \hat{u}_{\odot} < 0 \quad \text{and} \quad
+ *      |\vec{r} - (\vec{r} \cdot \hat{u}_{\odot}) \hat{u}_{\odot}| < R_{B}
+ * \f]
+ *
+ * where \f$\vec{r}\f$ is the position of the object with respect to the center of the occulting
+ * body, \f$\hat{u}_{\odot}\f$ is the unit vector from the occulting body to the Sun, and
+ * \f$R_{B}\f$ is the radius of the occulting body. The model is cheaper than the conical model and
+ * suffices if the duration of the penumbra transitions is not of interest.
+ *
+ * @sa computeConicalShadowFunction
+ * @tparam    Real                 Real type
+ * @tparam    Vector3              3-vector type
+ * @param[in] position             Position of object wrt occulting body             [m]
+ * @param[in] unitVectorToSun      Unit vector pointing from occulting body to Sun   [-]
+ * @param[in] occultingBodyRadius  Radius of occulting body                          [m]
+ * @return                         Shadow function (0 in shadow, 1 in sunlight)      [-]
+ */
+template <typename Real, typename Vector3>
+Real computeCylindricalShadowFunction(const Vector3& position,
+                                      const Vector3& unitVectorToSun,
+                                      const Real     occultingBodyRadius)
+{
+    const Real projection = position[0] * unitVectorToSun[0]
+                            + position[1] * unitVectorToSun[1]
+                            + position[2] * unitVectorToSun[2];
+
+    const Real perpendicularDistanceSquared
+        = position[0] * position[0] + position[1] * position[1] + position[2] * position[2]
+          - projection * projection;
+
+    return (projection < Real(0.0)
+            && perpendicularDistanceSquared < occultingBodyRadius * occultingBodyRadius)
+           ? Real(0.0) : Real(1.0);
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications. Springer, 2000.
+ */
@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "astro/vectorTraits.hpp"
+
+namespace astro
+{
+
+template <typename Real>
+class SphericalHarmonicsAccelerationModel;
+
+//! Spherical harmonics gravity field.
+/*!
+ * Gravity field of a central body, expanded in fully normalized spherical harmonics up to a
+ * maximum degree and order \f$N\f$. The gravitational potential is given by (Montenbruck, 2000):
+ *
+ * \f[
+ *      U = \frac{\mu}{r} \sum_{n=0}^{N} \sum_{m=0}^{n} \left(\frac{R}{r}\right)^{n}
+ *          \bar{P}_{nm}(\sin\phi) \left(\bar{C}_{nm} \cos m\lambda + \bar{S}_{nm} \sin m\lambda
+ *          \right)
+ * \f]
+ *
+ * where \f$\mu\f$ is the gravitational parameter of the central body, \f$R\f$ is the reference
+ * (equatorial) radius, \f$\phi\f$ and \f$\lambda\f$ are the body-fixed latitude and longitude,
+ * \f$\bar{P}_{nm}\f$ are the fully normalized associated Legendre functions (without the
+ * Condon-Shortley phase) and \f$\bar{C}_{nm}\f$ and \f$\bar{S}_{nm}\f$ are the fully normalized
+ * coefficients. The normalization is given by:
+ *
+ * \f[
+ *      \bar{C}_{nm} = \sqrt{\frac{(n+m)!}{(2-\delta_{0m})(2n+1)(n-m)!}} C_{nm}
+ * \f]
+ *
+ * The coefficients are stored in triangular (packed) arrays, such that the coefficients of degree
+ * \f$n\f$ and order \f$m\f$ are stored at index \f$n(n+1)/2 + m\f$ (see getTriangularIndex). The
+ * coefficients of degree 0 and 1 are included, i.e., \f$\bar{C}_{00} = 1\f$ yields the central
+ * body acceleration and \f$\bar{C}_{1m} = \bar{S}_{1m} = 0\f$ for a reference frame centered at the
+ * center of mass.
+ *
+ * At construction, the normalization factors that appear in the recursions used by
+ * SphericalHarmonicsAccelerationModel are precomputed and stored in triangular arrays alongside
+ * the coefficients. The gravity field is immutable after construction and can be shared between
+ * (multiple instances of) SphericalHarmonicsAccelerationModel.
+ *
+ * @sa SphericalHarmonicsAccelerationModel
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class SphericalHarmonicsGravityField
+{
+public:
+
+    //! Construct spherical harmonics gravity field.
+    /*!
+     * @param[in] gravitationalParameter  Gravitational parameter of central body      [m^3 s^-2]
+     * @param[in] referenceRadius         Reference (equatorial) radius of central body [m]
+     * @param[in] maximumDegree           Maximum degree and order of expansion         [-]
+     * @param[in] cosineCoefficients      Fully normalized cosine coefficients, stored in
+     *                                    triangular array of size
+     *                                    (maximumDegree + 1)(maximumDegree + 2)/2      [-]
+     * @param[in] sineCoefficients        Fully normalized sine coefficients, stored in
+     *                                    triangular array of size
+     *                                    (maximumDegree + 1)(maximumDegree + 2)/2      [-]
+     */
+    SphericalHarmonicsGravityField(const Real        gravitationalParameter,
+                                   const Real        referenceRadius,
+                                   const std::size_t maximumDegree,
+                                   const Real* const cosineCoefficients,
+                                   const Real* const sineCoefficients)
+        : gravitationalParameter(gravitationalParameter),
+          referenceRadius(referenceRadius),
+          maximumDegree(maximumDegree),
+          cosineCoefficients(cosineCoefficients,
+                             cosineCoefficients + getTriangularIndex(maximumDegree + 1, 0)),
+          sineCoefficients(sineCoefficients,
+                           sineCoefficients + getTriangularIndex(maximumDegree + 1, 0)),
+          sectorialFactors(maximumDegree + 2),
+          firstRecursionFactors(getTriangularIndex(maximumDegree + 2, 0)),
+          secondRecursionFactors(getTriangularIndex(maximumDegree + 2, 0)),
+          lowerOrderFactors(getTriangularIndex(maximumDegree + 1, 0)),
+          equalOrderFactors(getTriangularIndex(maximumDegree + 1, 0)),
+          higherOrderFactors(getTriangularIndex(maximumDegree + 1, 0))
+    {
+        assert(gravitationalParameter > Real(0.0));
+        assert(referenceRadius > Real(0.0));
+
+        // Compute factors of recursions for the normalized V and W functions, up to degree and
+        // order maximumDegree + 1.
+        sectorialFactors[0] = Real(1.0);
+        for (std::size_t m = 1; m <= maximumDegree + 1; ++m)
+        {
+            const Real order = static_cast<Real>(m);
+            sectorialFactors[m]
+                = m == 1 ? std::sqrt(Real(3.0))
+                         : std::sqrt((Real(2.0) * order + Real(1.0)) / (Real(2.0) * order));
+        }
+
+        for (std::size_t n = 1; n <= maximumDegree + 1; ++n)
+        {
+            const Real degree = static_cast<Real>(n);
+            for (std::size_t m = 0; m < n; ++m)
+            {
+                const Real order = static_cast<Real>(m);
+                const std::size_t index = getTriangularIndex(n, m);
+
+                firstRecursionFactors[index]
+                    = std::sqrt((Real(2.0) * degree + Real(1.0)) * (Real(2.0) * degree - Real(1.0))
+                                / ((degree - order) * (degree + order)));
+                secondRecursionFactors[index]
+                    = n > m + 1
+                      ? std::sqrt((Real(2.0) * degree + Real(1.0)) * (degree + order - Real(1.0))
+                                  * (degree - order - Real(1.0))
+                                  / ((Real(2.0) * degree - Real(3.0)) * (degree + order)
+                                     * (degree - order)))
+                      : Real(0.0);
+            }
+        }
+
+        // Compute factors that relate the V and W functions of degree n + 1 and order m - 1, m and
+        // m + 1 to the acceleration due to the coefficients of degree n and order m.
+        for (std::size_t n = 0; n <= maximumDegree; ++n)
+        {
+            const Real degree = static_cast<Real>(n);
+            const Real degreeRatio
+                = (Real(2.0) * degree + Real(1.0)) / (Real(2.0) * degree + Real(3.0));
+            for (std::size_t m = 0; m <= n; ++m)
+            {
+                const Real order = static_cast<Real>(m);
+                const std::size_t index = getTriangularIndex(n, m);
+
+                lowerOrderFactors[index]
+                    = m == 0 ? Real(0.0)
+                             : std::sqrt((m == 1 ? Real(2.0) : Real(1.0)) * degreeRatio
+                                         * (degree - order + Real(1.0))
+                                         * (degree - order + Real(2.0)));
+                equalOrderFactors[index]
+                    = std::sqrt(degreeRatio * (degree + order + Real(1.0))
+                                * (degree - order + Real(1.0)));
+                higherOrderFactors[index]
+                    = std::sqrt((m == 0 ? Real(0.5) : Real(1.0)) * degreeRatio
+                                * (degree + order + Real(1.0)) * (degree + order + Real(2.0)));
+            }
+        }
+    }
+
+    //! Get index of coefficient in triangular array.
+    /*!
+     * @param[in] degree  Degree
+     * @param[in] order   Order (0 <= order <= degree)
+     * @return            Index of coefficient in triangular array, degree(degree + 1)/2 + order
+     */
+    static std::size_t getTriangularIndex(const std::size_t degree, const std::size_t order)
+    {
+        return degree * (degree + 1) / 2 + order;
+    }
+
+    //! Get gravitational parameter of central body.
+    /*!
+     * @return Gravitational parameter of central body [m^3 s^-2]
+     */
+    Real getGravitationalParameter() const { return gravitationalParameter; }
+
+    //! Get reference radius of central body.
+    /*!
+     * @return Reference (equatorial) radius of central body [m]
+     */
+    Real getReferenceRadius() const { return referenceRadius; }
+
+    //! Get maximum degree and order of expansion.
+    /*!
+     * @return Maximum degree and order of expansion [-]
+     */
+    std::size_t getMaximumDegree() const { return maximumDegree; }
+
+private:
+
+    friend class SphericalHarmonicsAccelerationModel<Real>;
+
+    //! Gravitational parameter of central body [m^3 s^-2].
+    const Real gravitationalParameter;
+
+    //! Reference (equatorial) radius of central body [m].
+    const Real referenceRadius;
+
+    //! Maximum degree and order of expansion.
+    const std::size_t maximumDegree;
+
+    //! Fully normalized cosine coefficients (triangular array).
+    const std::vector<Real> cosineCoefficients;
+
+    //! Fully normalized sine coefficients (triangular array).
+    const std::vector<Real> sineCoefficients;
+
+    //! Factors of sectorial recursion, indexed by order.
+    std::vector<Real> sectorialFactors;
+
+    //! Factors of the first term of the vertical recursion (triangular array).
+    std::vector<Real> firstRecursionFactors;
+
+    //! Factors of the second term of the vertical recursion (triangular array).
+    std::vector<Real> secondRecursionFactors;
+
+    //! Factors of terms of order m - 1 in the acceleration (triangular array).
+    std::vector<Real> lowerOrderFactors;
+
+    //! Factors of terms of order m in the acceleration (triangular array).
+    std::vector<Real> equalOrderFactors;
+
+    //! Factors of terms of order m + 1 in the acceleration (triangular array).
+    std::vector<Real> higherOrderFactors;
+};
+
+//! Spherical harmonics acceleration model.
+/*!
+ * Computes the gravitational acceleration due to a spherical harmonics gravity field, using
+ * Cunningham's recursion for the (fully normalized) V and W functions (Montenbruck, 2000):
+ *
+ * \f{eqnarray*}{
+ *      V_{nm} &=& \left(\frac{R}{r}\right)^{n+1} P_{nm}(\sin\phi) \cos m\lambda \\
+ *      W_{nm} &=& \left(\frac{R}{r}\right)^{n+1} P_{nm}(\sin\phi) \sin m\lambda
+ * \f}
+ *
+ * which are evaluated directly in terms of the Cartesian position components, such that the
+ * formulation is free of singularities at the poles. The acceleration follows from the V and W
+ * functions of degree \f$n+1\f$ and orders \f$m-1\f$, \f$m\f$ and \f$m+1\f$. For the fully
+ * normalized formulation, the factors in the recursions are precomputed by
+ * SphericalHarmonicsGravityField.
+ *
+ * The expansion can be truncated per call to any degree and order up to the maximum degree of the
+ * gravity field, e.g., to use the same gravity field for coarse (8x8) and fine (70x70)
+ * computations.
+ *
+ * The model contains work arrays that are sized to the maximum degree of the gravity field, such
+ * that no memory is allocated when the acceleration is computed. As a result, the acceleration
+ * computation is not const; use an instance of the model per thread. The gravity field is
+ * referenced (not copied) and must outlive the model.
+ *
+ * The positions and accelerations are given with respect to the body-fixed reference frame in
+ * which the coefficients are defined.
+ *
+ * @sa SphericalHarmonicsGravityField
+ * @tparam Real  Real type
+ */
+template <typename Real>
+class SphericalHarmonicsAccelerationModel
+{
+public:
+
+    //! Construct spherical harmonics acceleration model.
+    /*!
+     * @param[in] gravityField  Spherical harmonics gravity field
+     */
+    explicit SphericalHarmonicsAccelerationModel(
+        const SphericalHarmonicsGravityField<Real>& gravityField)
+        : gravityField(gravityField),
+          cosineTerms(SphericalHarmonicsGravityField<Real>::getTriangularIndex(
+              gravityField.maximumDegree + 2, 0)),
+          sineTerms(cosineTerms.size())
+    { }
+
+    //! Compute acceleration, writing into given output vector.
+    /*!
+     * Computes the acceleration, identical to the computation that returns the acceleration
+     * vector, but writes into a caller-provided output vector. The position and acceleration
+     * vectors can be of any type whose elements are accessed with operator[] (see IsVector). The
+     * acceleration can be written in-place, i.e., the output can be the input.
+     *
+     * @sa IsVector
+     * @tparam     InputVector3   3-vector type of position
+     * @tparam     OutputVector3  3-vector type of acceleration
+     * @param[in]  position       Position vector in body-fixed reference frame        [m]
+     * @param[in]  degree         Degree of truncated expansion (<= maximum degree)    [-]
+     * @param[in]  order          Order of truncated expansion (<= degree)             [-]
+     * @param[out] acceleration   Gravitational acceleration in body-fixed frame       [m s^-2]
+     */
+    template <typename InputVector3, typename OutputVector3>
+    typename std::enable_if<IsVector<OutputVector3>::value>::type
+    computeAcceleration(const InputVector3& position,
+                        const std::size_t   degree,
+                        const std::size_t   order,
+                        OutputVector3&&     acceleration)
+    {
+        assert(degree <= gravityField.maximumDegree);
+        assert(order <= degree);
+
+        typedef SphericalHarmonicsGravityField<Real> GravityField;
+
+        const Real x = position[0];
+        const Real y = position[1];
+        const Real z = position[2];
+
+        const Real referenceRadius = gravityField.referenceRadius;
+        const Real positionNormSquared = x * x + y * y + z * z;
+        const Real scaling = referenceRadius / positionNormSquared;
+        const Real scaledX = x * scaling;
+        const Real scaledY = y * scaling;
+        const Real scaledZ = z * scaling;
+        const Real scaledRadiusSquared = referenceRadius * scaling;
+
+        // Compute V and W functions up to degree + 1 and order + 1, column by column (order).
+        Real* const V = cosineTerms.data();
+        Real* const W = sineTerms.data();
+        V[0] = referenceRadius / std::sqrt(positionNormSquared);
+        W[0] = Real(0.0);
+
+        for (std::size_t m = 0; m <= order + 1; ++m)
+        {
+            const std::size_t sectorialIndex = GravityField::getTriangularIndex(m, m);
+            if (m > 0)
+            {
+                const std::size_t previousIndex = GravityField::getTriangularIndex(m - 1, m - 1);
+                const Real factor = gravityField.sectorialFactors[m];
+                V[sectorialIndex] = factor * (scaledX * V[previousIndex]
+                                              - scaledY * W[previousIndex]);
+                W[sectorialIndex] = factor * (scaledX * W[previousIndex]
+                                              + scaledY * V[previousIndex]);
+            }
+
+            if (m <= degree)
+            {
+                const std::size_t index = GravityField::getTriangularIndex(m + 1, m);
+                const Real factor = gravityField.firstRecursionFactors[index] * scaledZ;
+                V[index] = factor * V[sectorialIndex];
+                W[index] = factor * W[sectorialIndex];
+            }
+
+            for (std::size_t n = m + 2; n <= degree + 1; ++n)
+            {
+                const std::size_t index = GravityField::getTriangularIndex(n, m);
+                const std::size_t previousIndex = index - n;
+                const std::size_t secondPreviousIndex = previousIndex - (n - 1);
+                const Real firstFactor = gravityField.firstRecursionFactors[index] * scaledZ;
+                const Real secondFactor
+                    = gravityField.secondRecursionFactors[index] * scaledRadiusSquared;
+                V[index] = firstFactor * V[previousIndex] - secondFactor * V[secondPreviousIndex];
+                W[index] = firstFactor * W[previousIndex] - secondFactor * W[secondPreviousIndex];
+            }
+        }
+
+        // Sum the contributions of the coefficients to the acceleration.
+        Real accelerationX = Real(0.0);
+        Real accelerationY = Real(0.0);
+        Real accelerationZ = Real(0.0);
+
+        for (std::size_t n = 0; n <= degree; ++n)
+        {
+            // Zonal term (m = 0).
+            const std::size_t zonalIndex = GravityField::getTriangularIndex(n, 0);
+            const std::size_t nextZonalIndex = zonalIndex + n + 1;
+            const Real cosineCoefficient = gravityField.cosineCoefficients[zonalIndex];
+            const Real higherOrderCoefficient
+                = cosineCoefficient * gravityField.higherOrderFactors[zonalIndex];
+
+            accelerationX -= higherOrderCoefficient * V[nextZonalIndex + 1];
+            accelerationY -= higherOrderCoefficient * W[nextZonalIndex + 1];
+            accelerationZ -= cosineCoefficient * gravityField.equalOrderFactors[zonalIndex]
+                             * V[nextZonalIndex];
+
+            // Tesseral and sectorial terms (m > 0).
+            const std::size_t maximumOrder = std::min(n, order);
+            for (std::size_t m = 1; m <= maximumOrder; ++m)
+            {
+                const std::size_t index = zonalIndex + m;
+                const std::size_t nextIndex = nextZonalIndex + m;
+                const Real C = gravityField.cosineCoefficients[index];
+                const Real S = gravityField.sineCoefficients[index];
+                const Real lowerOrderFactor = Real(0.5) * gravityField.lowerOrderFactors[index];
+                const Real higherOrderFactor = Real(0.5) * gravityField.higherOrderFactors[index];
+
+                accelerationX += lowerOrderFactor * (C * V[nextIndex - 1] + S * W[nextIndex - 1])
+                                 - higherOrderFactor * (C * V[nextIndex + 1]
+                                                        + S * W[nextIndex + 1]);
+                accelerationY += lowerOrderFactor * (S * V[nextIndex - 1] - C * W[nextIndex - 1])
+                                 + higherOrderFactor * (S * V[nextIndex + 1]
+                                                        - C * W[nextIndex + 1]);
+                accelerationZ -= gravityField.equalOrderFactors[index]
+                                 * (C * V[nextIndex] + S * W[nextIndex]);
+            }
+        }
+
+        const Real preMultiplier
+            = gravityField.gravitationalParameter / (referenceRadius * referenceRadius);
+
+        acceleration[0] = preMultiplier * accelerationX;
+        acceleration[1] = preMultiplier * accelerationY;
+        acceleration[2] = preMultiplier * accelerationZ;
+    }
+
+    //! Compute acceleration.
+    /*!
+     * @tparam    Vector3   3-vector type
+     * @param[in] position  Position vector in body-fixed reference frame        [m]
+     * @param[in] degree    Degree of truncated expansion (<= maximum degree)    [-]
+     * @param[in] order     Order of truncated expansion (<= degree)             [-]
+     * @return              Gravitational acceleration in body-fixed frame       [m s^-2]
+     */
+    template <typename Vector3>
+    Vector3 computeAcceleration(const Vector3&    position,
+                                const std::size_t degree,
+                                const std::size_t order)
+    {
+        Vector3 acceleration = position;
+        computeAcceleration(position, degree, order, acceleration);
+        return acceleration;
+    }
+
+    //! Compute acceleration using full expansion, writing into given output vector.
+    /*!
+     * @sa IsVector
+     * @tparam     InputVector3   3-vector type of position
+     * @tparam     OutputVector3  3-vector type of acceleration
+     * @param[in]  position       Position vector in body-fixed reference frame        [m]
+     * @param[out] acceleration   Gravitational acceleration in body-fixed frame       [m s^-2]
+     */
+    template <typename InputVector3, typename OutputVector3>
+    typename std::enable_if<IsVector<OutputVector3>::value>::type
+    computeAcceleration(const InputVector3& position, OutputVector3&& acceleration)
+    {
+        computeAcceleration(
+            position, gravityField.maximumDegree, gravityField.maximumDegree, acceleration);
+    }
+
+    //! Compute acceleration using full expansion.
+    /*!
+     * @tparam    Vector3   3-vector type
+     * @param[in] position  Position vector in body-fixed reference frame        [m]
+     * @return              Gravitational acceleration in body-fixed frame       [m s^-2]
+     */
+    template <typename Vector3>
+    Vector3 computeAcceleration(const Vector3& position)
+    {
+        return computeAcceleration(
+            position, gravityField.maximumDegree, gravityField.maximumDegree);
+    }
+
+private:
+
+    //! Spherical harmonics gravity field.
+    const SphericalHarmonicsGravityField<Real>& gravityField;
+
+    //! Work array of (normalized) V functions (triangular array).
+    std::vector<Real> cosineTerms;
+
+    //! Work array of (normalized) W functions (triangular array).
+    std::vector<Real> sineTerms;
+};
+
+} // namespace astro
+
+/*!
+ * References
+ *  Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods and Applications, Springer, 2000.
+ */
@@ -36,4 +36,15 @@ enum KeplerianElementIndices
     meanAnomalyIndex              = 5
 };
 
+//! Modified equinoctial element array indices.
+enum ModifiedEquinoctialElementIndices
+{
+    semiLatusRectumEquinoctialIndex = 0,
+    fEquinoctialIndex               = 1,
+    gEquinoctialIndex               = 2,
+    hEquinoctialIndex               = 3,
+    kEquinoctialIndex               = 4,
+    trueLongitudeEquinoctialIndex   = 5
+};
+
 } // namespace astro
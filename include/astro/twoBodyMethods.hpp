@@ -11,8 +11,10 @@
 
 #include <cassert>
 #include <cmath>
+#include <limits>
 
 #include "astro/constants.hpp"
+#include "astro/constexprMath.hpp"
 
 namespace astro
 {
@@ -43,7 +45,7 @@ Real computeKeplerMeanMotion(const Real semiMajorAxis,
                              const Real gravitationalParameterOfCentralBody,
                              const Real massOfOrbitingBody = 0.0)
 {
-    return std::sqrt(((ASTRO_GRAVITATIONAL_CONSTANT * massOfOrbitingBody)
+    return std::sqrt(((PhysicalConstants<Real>::gravitationalConstant * massOfOrbitingBody)
                        + gravitationalParameterOfCentralBody)
                        / (semiMajorAxis * semiMajorAxis * semiMajorAxis));
 }
@@ -74,9 +76,9 @@ Real computeKeplerOrbitalPeriod(const Real semiMajorAxis,
                                 const Real gravitationalParameterOfCentralBody,
                                 const Real massOfOrbitingBody = 0.0)
 {
-    return 2.0 * 3.14159265358979323846
+    return Real(2.0 * 3.14159265358979323846)
         * std::sqrt((semiMajorAxis * semiMajorAxis * semiMajorAxis)
-                     / ((ASTRO_GRAVITATIONAL_CONSTANT * massOfOrbitingBody)
+                     / ((PhysicalConstants<Real>::gravitationalConstant * massOfOrbitingBody)
                          + gravitationalParameterOfCentralBody));
 }
 
@@ -107,4 +109,72 @@ Real computeCircularVelocity(const Real semiMajorAxis,
     return std::sqrt(gravitationalParameterOfCentralBody / semiMajorAxis);
 }
 
+//! Compute mean motion at compile time.
+/*!
+ * Computes the two-body mean motion in a constant expression, e.g., to precompute the mean motion
+ * of a reference orbit of a mission at compile time. The result is identical to that of
+ * computeKeplerMeanMotion to within one unit in the last place.
+ *
+ * @sa computeKeplerMeanMotion, computeConstexprSquareRoot
+ * @tparam Real                                 Real type
+ * @param  semiMajorAxis                        Semi-major axis of Kepler orbit          [m]
+ * @param  gravitationalParameterOfCentralBody  Gravitational parameter of central body  [m^3 s^-2]
+ * @param  massOfOrbitingBody                   Mass of orbiting body                    [kg]
+ * @return                                      Two-body mean motion                     [rad/s]
+ */
+template <typename Real>
+constexpr Real computeKeplerMeanMotionConstexpr(const Real semiMajorAxis,
+                                                const Real gravitationalParameterOfCentralBody,
+                                                const Real massOfOrbitingBody = Real(0.0))
+{
+    return computeConstexprSquareRoot(
+        ((PhysicalConstants<Real>::gravitationalConstant * massOfOrbitingBody)
+          + gravitationalParameterOfCentralBody)
+        / (semiMajorAxis * semiMajorAxis * semiMajorAxis));
+}
+
+//! Compute orbital period at compile time.
+/*!
+ * Computes the two-body orbital period in a constant expression, e.g., to precompute the period
+ * of a reference orbit of a mission at compile time. The result is identical to that of
+ * computeKeplerOrbitalPeriod to within one unit in the last place.
+ *
+ * @sa computeKeplerOrbitalPeriod, computeConstexprSquareRoot
+ * @tparam Real                                 Real type
+ * @param  semiMajorAxis                        Semi-major axis of Kepler orbit          [m]
+ * @param  gravitationalParameterOfCentralBody  Gravitational parameter of central body  [m^3 s^-2]
+ * @param  massOfOrbitingBody                   Mass of orbiting body                    [kg]
+ * @return                                      Two-body orbital period                  [s]
+ */
+template <typename Real>
+constexpr Real computeKeplerOrbitalPeriodConstexpr(const Real semiMajorAxis,
+                                                   const Real gravitationalParameterOfCentralBody,
+                                                   const Real massOfOrbitingBody = Real(0.0))
+{
+    return Real(2.0 * 3.14159265358979323846)
+        * computeConstexprSquareRoot(
+            (semiMajorAxis * semiMajorAxis * semiMajorAxis)
+            / ((PhysicalConstants<Real>::gravitationalConstant * massOfOrbitingBody)
+                + gravitationalParameterOfCentralBody));
+}
+
+//! Compute circular velocity at compile time.
+/*!
+ * Computes the circular velocity in a constant expression. The result is identical to that of
+ * computeCircularVelocity to within one unit in the last place. The semi-major axis must be
+ * non-zero.
+ *
+ * @sa computeCircularVelocity, computeConstexprSquareRoot
+ * @tparam Real                                 Real type
+ * @param  semiMajorAxis                        Semi-major axis of Kepler orbit          [m]
+ * @param  gravitationalParameterOfCentralBody  Gravitational parameter of central body  [m^3 s^-2]
+ * @return                                      Circular velocity                        [m/s]
+ */
+template <typename Real>
+constexpr Real computeCircularVelocityConstexpr(const Real semiMajorAxis,
+                                                const Real gravitationalParameterOfCentralBody)
+{
+    return computeConstexprSquareRoot(gravitationalParameterOfCentralBody / semiMajorAxis);
+}
+
 } // namespace astro
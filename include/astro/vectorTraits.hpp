@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "astro/hostDevice.hpp"
+
+namespace astro
+{
+
+//! Check if type is a vector type, i.e., if its elements can be accessed using operator[].
+/*!
+ * The value of this trait is true for vector types whose elements can be accessed with
+ * operator[], e.g., std::vector, std::array, Eigen fixed-size vectors and maps, built-in arrays and
+ * raw pointers, and false otherwise (e.g., for floating-point types). References and cv-qualifiers
+ * are ignored.
+ *
+ * The trait is used to enable the overloads of the element conversions and acceleration models
+ * that write into a caller-provided output vector, instead of returning a (copy-constructed)
+ * vector. These overloads accept any combination of input and output vector types.
+ *
+ * @tparam Vector  Type to check
+ */
+template <typename Vector>
+struct IsVector
+{
+private:
+
+    typedef typename std::remove_cv<typename std::remove_reference<Vector>::type>::type Type;
+
+    template <typename T>
+    static auto check(int) -> decltype(static_cast<void>(std::declval<T&>()[0]), std::true_type());
+
+    template <typename T>
+    static std::false_type check(...);
+
+public:
+
+    //! Flag indicating if type is a vector type.
+    static const bool value = decltype(check<Type>(0))::value;
+};
+
+//! Traits of vector types.
+/*!
+ * Provides the element type of a vector type and a check of its size, for container types with a
+ * size() member function (e.g., std::vector, std::array, Eigen vectors and maps). Specializations
+ * are provided for raw pointers, whose size is unknown, and built-in arrays.
+ *
+ * @sa IsVector
+ * @tparam Vector  Vector type
+ */
+template <typename Vector>
+struct VectorTraits
+{
+    //! Element type of vector.
+    typedef typename std::remove_cv<typename std::remove_reference<
+        decltype(std::declval<Vector&>()[0])>::type>::type ValueType;
+
+    //! Check size of vector.
+    /*!
+     * @param[in] vector  Vector
+     * @param[in] size    Expected size of vector
+     * @return            True if vector has expected size
+     */
+    ASTRO_HOST_DEVICE
+    static bool hasSize(const Vector& vector, const std::size_t size)
+    {
+        return static_cast<std::size_t>(vector.size()) == size;
+    }
+};
+
+//! Traits of raw pointers to vector elements.
+template <typename Real>
+struct VectorTraits<Real*>
+{
+    //! Element type of vector.
+    typedef typename std::remove_cv<Real>::type ValueType;
+
+    //! Check size of vector, which is unknown for raw pointers.
+    ASTRO_HOST_DEVICE
+    static bool hasSize(Real* const, const std::size_t) { return true; }
+};
+
+//! Traits of built-in arrays.
+template <typename Real, std::size_t Size>
+struct VectorTraits<Real[Size]>
+{
+    //! Element type of vector.
+    typedef typename std::remove_cv<Real>::type ValueType;
+
+    //! Check size of vector.
+    ASTRO_HOST_DEVICE
+    static bool hasSize(const Real (&)[Size], const std::size_t size) { return Size == size; }
+};
+
+//! Check size of vector.
+/*!
+ * Checks the size of a vector using VectorTraits, e.g., in assertions on the inputs and outputs of
+ * functions that accept generic vector types. The check always passes for raw pointers.
+ *
+ * @sa VectorTraits
+ * @tparam    Vector  Vector type
+ * @param[in] vector  Vector
+ * @param[in] size    Expected size of vector
+ * @return            True if vector has expected size, or if the size of the vector is unknown
+ */
+template <typename Vector>
+ASTRO_HOST_DEVICE
+bool hasVectorSize(const Vector& vector, const std::size_t size)
+{
+    return VectorTraits<Vector>::hasSize(vector, size);
+}
+
+} // namespace astro
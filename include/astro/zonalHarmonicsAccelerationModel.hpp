@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "astro/vectorTraits.hpp"
+
+namespace astro
+{
+
+//! Compute gravitational acceleration due to zonal harmonics, writing into given output vector.
+/*!
+ * Computes the gravitational acceleration due to zonal harmonics, identical to the computation
+ * that returns the acceleration vector, but writes into a caller-provided output vector. The
+ * position and acceleration vectors can be of any type whose elements are accessed with
+ * operator[] (see IsVector). The acceleration can be written in-place, i.e., the output can be
+ * the input.
+ *
+ * @sa IsVector, computeZonalHarmonicsAcceleration
+ * @tparam     Degree                  Maximum degree of zonal harmonics expansion (N >= 2)
+ * @tparam     Real                    Real type
+ * @tparam     InputVector3            3-vector type of position
+ * @tparam     ZonalCoefficients       Zonal coefficients type (must provide operator[])
+ * @tparam     OutputVector3           3-vector type of acceleration
+ * @param[in]  gravitationalParameter  Gravitational parameter of central body         [m^3 s^-2]
+ * @param[in]  position                Position vector of body subject to zonal
+ *                                     accelerations                                   [m]
+ * @param[in]  equatorialRadius        Equatorial radius of central body, in
+ *                                     formulation of spherical harmonics expansion    [m]
+ * @param[in]  zonalCoefficients       Unnormalized zonal coefficients, such that
+ *                                     zonalCoefficients[n - 2] is J_n, for
+ *                                     n = 2, ..., Degree                              [-]
+ * @param[out] acceleration            Gravitational acceleration due to zonal
+ *                                     harmonics                                       [m s^-2]
+ */
+template <std::size_t Degree,
+          typename Real,
+          typename InputVector3,
+          typename ZonalCoefficients,
+          typename OutputVector3>
+typename std::enable_if<IsVector<OutputVector3>::value>::type
+computeZonalHarmonicsAcceleration(const Real               gravitationalParameter,
+                                  const InputVector3&      position,
+                                  const Real               equatorialRadius,
+                                  const ZonalCoefficients& zonalCoefficients,
+                                  OutputVector3&&          acceleration)
+{
+    static_assert(Degree >= 2, "Degree of zonal harmonics expansion must be at least 2!");
+
+    const Real x = position[0];
+    const Real y = position[1];
+    const Real z = position[2];
+
+    const Real positionNormSquared = x * x + y * y + z * z;
+    const Real inversePositionNorm = Real(1.0) / std::sqrt(positionNormSquared);
+
+    const Real scaledZ = z * inversePositionNorm;
+    const Real scaledRadius = equatorialRadius * inversePositionNorm;
+
+    // Initialize the recursions with the Legendre polynomials of degree 0 and 1, and their
+    // derivatives.
+    Real legendrePolynomialMinusTwo = Real(1.0);
+    Real legendrePolynomialMinusOne = scaledZ;
+    Real legendreDerivativeMinusOne = Real(1.0);
+    Real scaledRadiusPower = scaledRadius;
+
+    // Sums of the radial and axial contributions.
+    Real radialSum = Real(0.0);
+    Real axialSum = Real(0.0);
+
+    for (std::size_t n = 2; n <= Degree; ++n)
+    {
+        // The coefficients of the recursions are compile-time constants once the loop is unrolled.
+        const Real degree = static_cast<Real>(n);
+        const Real inverseDegree = Real(1.0) / degree;
+
+        const Real legendrePolynomial
+            = ((Real(2.0) * degree - Real(1.0)) * inverseDegree) * scaledZ
+                * legendrePolynomialMinusOne
+              - ((degree - Real(1.0)) * inverseDegree) * legendrePolynomialMinusTwo;
+        const Real legendreDerivative
+            = degree * legendrePolynomialMinusOne + scaledZ * legendreDerivativeMinusOne;
+
+        scaledRadiusPower *= scaledRadius;
+        const Real weight = zonalCoefficients[n - 2] * scaledRadiusPower;
+
+        radialSum += weight * ((degree + Real(1.0)) * legendrePolynomial
+                               + scaledZ * legendreDerivative);
+        axialSum += weight * legendreDerivative;
+
+        legendrePolynomialMinusTwo = legendrePolynomialMinusOne;
+        legendrePolynomialMinusOne = legendrePolynomial;
+        legendreDerivativeMinusOne = legendreDerivative;
+    }
+
+    const Real preMultiplier = gravitationalParameter * inversePositionNorm * inversePositionNorm;
+    const Real radialPreMultiplier = preMultiplier * radialSum * inversePositionNorm;
+
+    acceleration[0] = radialPreMultiplier * x;
+    acceleration[1] = radialPreMultiplier * y;
+    acceleration[2] = radialPreMultiplier * z - preMultiplier * axialSum;
+}
+
+//! Compute gravitational acceleration due to zonal harmonics.
+/*!
+ * Compute gravitational acceleration at given position vector subject to an axially symmetric
+ * gravity field, expanded in zonal harmonics up to and including the given degree \f$N\f$. The
+ * disturbing potential is given by (Montenbruck, 2000):
+ *
+ * \f[
+ *      U = -\frac{\mu}{r} \sum_{n=2}^{N} J_{n} \left(\frac{R}{r}\right)^{n} P_{n}(\hat{z})
+ * \f]
+ *
+ * where \f$\mu\f$ is the gravitational parameter of the central body, \f$R\f$ is the equatorial
+ * radius of the central body, \f$J_{n}\f$ are the unnormalized zonal coefficients,
+ * \f$P_{n}\f$ are the Legendre polynomials, \f$\hat{z} = \frac{z}{r}\f$ and \f$r\f$ is the radial
+ * position. The acceleration is the gradient of the disturbing potential
+ * (\f$\vec{a} = \nabla U\f$):
+ *
+ * \f[
+ *      \vec{a} = \frac{\mu}{r^{2}} \sum_{n=2}^{N} J_{n} \left(\frac{R}{r}\right)^{n}
+ *                \left[ \left( (n+1) P_{n}(\hat{z}) + \hat{z} P'_{n}(\hat{z}) \right)
+ *                       \frac{\vec{r}}{r} - P'_{n}(\hat{z}) \hat{e}_{z} \right]
+ * \f]
+ *
+ * The Legendre polynomials and their derivatives are evaluated using Bonnet's recursion and the
+ * associated derivative recursion:
+ *
+ * \f{eqnarray*}{
+ *      n P_{n}(\hat{z}) &=& (2n-1) \hat{z} P_{n-1}(\hat{z}) - (n-1) P_{n-2}(\hat{z}) \\
+ *      P'_{n}(\hat{z}) &=& n P_{n-1}(\hat{z}) + \hat{z} P'_{n-1}(\hat{z})
+ * \f}
+ *
+ * such that each additional degree costs a constant number of operations. The degree is a
+ * template parameter, such that the loop over the degrees has a compile-time trip count and is
+ * unrolled by the compiler.
+ *
+ * For degree 2, the acceleration is identical to that computed by computeJ2Acceleration. The
+ * central body acceleration is not included.
+ *
+ * The positions and accelerations are given with respect to a reference frame that is centered
+ * at and aligned with the symmetry axis of the central body.
+ *
+ * @sa computeJ2Acceleration
+ * @tparam    Degree                  Maximum degree of zonal harmonics expansion (N >= 2)
+ * @tparam    Real                    Real type
+ * @tparam    Vector3                 3-vector type
+ * @tparam    ZonalCoefficients       Zonal coefficients type (must provide operator[])
+ * @param[in] gravitationalParameter  Gravitational parameter of central body         [m^3 s^-2]
+ * @param[in] position                Position vector of body subject to zonal
+ *                                    accelerations                                   [m]
+ * @param[in] equatorialRadius        Equatorial radius of central body, in
+ *                                    formulation of spherical harmonics expansion    [m]
+ * @param[in] zonalCoefficients       Unnormalized zonal coefficients, such that
+ *                                    zonalCoefficients[n - 2] is J_n, for
+ *                                    n = 2, ..., Degree                              [-]
+ * @return                            Gravitational acceleration due to zonal
+ *                                    harmonics                                       [m s^-2]
+ */
+template <std::size_t Degree, typename Real, typename Vector3, typename ZonalCoefficients>
+Vector3 computeZonalHarmonicsAcceleration(const Real               gravitationalParameter,
+                                          const Vector3&           position,
+                                          const Real               equatorialRadius,
+                                          const ZonalCoefficients& zonalCoefficients)
+{
+    Vector3 acceleration = position;
+    computeZonalHarmonicsAcceleration<Degree>(
+        gravitationalParameter, position, equatorialRadius, zonalCoefficients, acceleration);
+    return acceleration;
+}
+
+} // namespace astro
+
+/*!
+ * References
+ *  Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods and Applications, Springer, 2000.
+ */
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/cartesianDynamics.hpp"
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/integrators.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/radiationPressureAccelerationModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Compute Cartesian state derivative for sum of acceleration models",
+          "[cartesian-dynamics]")
+{
+    // Set value of gravitational parameter, equatorial radius and J2 coefficient of Mercury
+    // [m^3 s^-2, m, -].
+    const Real gravitationalParameter = 2.2032e13;
+    const Real equatorialRadius = 2439.0e3;
+    const Real j2Coefficient = 0.00006;
+
+    // Set radiation pressure at 1 AU [N m^-2], 1 AU [m], radiation pressure coefficient [-], and
+    // cannonball radius [m] and bulk density [kg m^-3].
+    const Real referenceRadiationPressure = 4.56e-6;
+    const Real referenceDistance = 1.495978707e11;
+    const Real radiationPressureCoefficient = 1.5;
+    const Real radius = 1.0e-3;
+    const Real bulkDensity = 2000.0;
+
+    // Set Cartesian state [m, m/s].
+    const Real state[6] = {1513.3e3, -7412.67e3, 3012.1e3, 1.2e3, 0.3e3, -0.8e3};
+
+    Vector position(state, state + 3);
+    Vector velocity(state + 3, state + 6);
+
+    // Compute expected accelerations using acceleration model functions [m s^-2].
+    const Vector centralBodyAcceleration
+        = computeCentralBodyAcceleration(gravitationalParameter, position);
+    const Vector j2Acceleration = computeJ2Acceleration(
+        gravitationalParameter, position, equatorialRadius, j2Coefficient);
+
+    const Real distance = std::sqrt(position[0] * position[0]
+                                    + position[1] * position[1]
+                                    + position[2] * position[2]);
+    Vector unitVectorToSource(3);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        unitVectorToSource[i] = -position[i] / distance;
+    }
+    const Vector radiationPressureAcceleration = computeCannonballRadiationPressureAcceleration(
+        computeRadiationPressure(referenceRadiationPressure, referenceDistance, distance),
+        radiationPressureCoefficient,
+        unitVectorToSource,
+        radius,
+        bulkDensity);
+    const Vector poyntingRobertsonDragAcceleration
+        = computeCannonballPoyntingRobertsonDragAcceleration(
+            computeRadiationPressure(referenceRadiationPressure, referenceDistance, distance),
+            radiationPressureCoefficient,
+            unitVectorToSource,
+            radius,
+            bulkDensity,
+            velocity);
+
+    SECTION("Test individual acceleration models")
+    {
+        const CartesianStateQuantities<Real> quantities(state, state + 3);
+
+        Real acceleration[4][3] = {{0.0, 0.0, 0.0},
+                                   {0.0, 0.0, 0.0},
+                                   {0.0, 0.0, 0.0},
+                                   {0.0, 0.0, 0.0}};
+        CentralBodyAccelerationModel<Real>(gravitationalParameter).addAcceleration(
+            0.0, quantities, acceleration[0]);
+        J2AccelerationModel<Real>(gravitationalParameter, equatorialRadius, j2Coefficient)
+            .addAcceleration(0.0, quantities, acceleration[1]);
+        CannonballRadiationPressureAccelerationModel<Real>(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           radius,
+                                                           bulkDensity)
+            .addAcceleration(0.0, quantities, acceleration[2]);
+        CannonballPoyntingRobertsonDragAccelerationModel<Real>(referenceRadiationPressure,
+                                                               referenceDistance,
+                                                               radiationPressureCoefficient,
+                                                               radius,
+                                                               bulkDensity)
+            .addAcceleration(0.0, quantities, acceleration[3]);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[0][i]
+                        == Catch::Approx(centralBodyAcceleration[i]).epsilon(1.0e-15));
+            REQUIRE(acceleration[1][i] == Catch::Approx(j2Acceleration[i]).epsilon(1.0e-15));
+            REQUIRE(acceleration[2][i]
+                        == Catch::Approx(radiationPressureAcceleration[i]).epsilon(1.0e-15));
+            REQUIRE(acceleration[3][i]
+                        == Catch::Approx(poyntingRobertsonDragAcceleration[i]).epsilon(1.0e-15));
+        }
+    }
+
+    SECTION("Test sum of central body, J2, radiation pressure and Poynting-Robertson drag "
+            "accelerations")
+    {
+        const auto dynamics = makeCartesianDynamics<Real>(
+            CentralBodyAccelerationModel<Real>(gravitationalParameter),
+            J2AccelerationModel<Real>(gravitationalParameter, equatorialRadius, j2Coefficient),
+            CannonballRadiationPressureAccelerationModel<Real>(referenceRadiationPressure,
+                                                               referenceDistance,
+                                                               radiationPressureCoefficient,
+                                                               radius,
+                                                               bulkDensity),
+            CannonballPoyntingRobertsonDragAccelerationModel<Real>(referenceRadiationPressure,
+                                                                   referenceDistance,
+                                                                   radiationPressureCoefficient,
+                                                                   radius,
+                                                                   bulkDensity));
+
+        Real stateDerivative[6];
+        dynamics(0.0, state, stateDerivative);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(stateDerivative[i] == state[i + 3]);
+            REQUIRE(stateDerivative[i + 3]
+                        == Catch::Approx(centralBodyAcceleration[i]
+                                         + j2Acceleration[i]
+                                         + radiationPressureAcceleration[i]
+                                         + poyntingRobertsonDragAcceleration[i])
+                               .epsilon(1.0e-15));
+        }
+
+        Real acceleration[3];
+        dynamics(0.0, state, state + 3, acceleration);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == stateDerivative[i + 3]);
+        }
+    }
+
+    SECTION("Test empty set of acceleration models")
+    {
+        const CartesianDynamics<Real> dynamics;
+
+        Real stateDerivative[6];
+        dynamics(0.0, state, stateDerivative);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(stateDerivative[i] == state[i + 3]);
+            REQUIRE(stateDerivative[i + 3] == 0.0);
+        }
+    }
+}
+
+TEST_CASE("Compute Cartesian state and state transition matrix derivative",
+          "[cartesian-dynamics]")
+{
+    // Set value of gravitational parameter, equatorial radius and J2 coefficient of Mercury
+    // [m^3 s^-2, m, -].
+    const Real gravitationalParameter = 2.2032e13;
+    const Real equatorialRadius = 2439.0e3;
+    const Real j2Coefficient = 0.00006;
+
+    // Set radiation pressure at 1 AU [N m^-2], 1 AU [m], radiation pressure coefficient [-], and
+    // cannonball radius [m] and bulk density [kg m^-3].
+    const Real referenceRadiationPressure = 4.56e-6;
+    const Real referenceDistance = 1.495978707e11;
+    const Real radiationPressureCoefficient = 1.5;
+    const Real radius = 1.0e-3;
+    const Real bulkDensity = 2000.0;
+
+    // Set Cartesian state [m, m/s].
+    const Real state[6] = {1513.3e3, -7412.67e3, 3012.1e3, 1.2e3, 0.3e3, -0.8e3};
+    const Vector position(state, state + 3);
+
+    const CentralBodyAccelerationModel<Real> centralBodyModel(gravitationalParameter);
+    const J2AccelerationModel<Real> j2Model(
+        gravitationalParameter, equatorialRadius, j2Coefficient);
+    const CannonballRadiationPressureAccelerationModel<Real> radiationPressureModel(
+        referenceRadiationPressure,
+        referenceDistance,
+        radiationPressureCoefficient,
+        radius,
+        bulkDensity);
+
+    SECTION("Test individual acceleration models")
+    {
+        const CartesianStateQuantities<Real> quantities(state, state + 3);
+
+        Real expectedGradient[3][3][3];
+        computeCentralBodyAccelerationGradient(
+            gravitationalParameter, position, expectedGradient[0]);
+        computeJ2AccelerationGradient(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient, expectedGradient[1]);
+        computeCannonballRadiationPressureAccelerationGradient(referenceRadiationPressure,
+                                                               referenceDistance,
+                                                               radiationPressureCoefficient,
+                                                               position,
+                                                               radius,
+                                                               bulkDensity,
+                                                               expectedGradient[2]);
+
+        Real expectedAcceleration[3][3];
+        Real acceleration[3][3];
+        Real gradient[3][3][3];
+        for (int k = 0; k < 3; ++k)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                expectedAcceleration[k][i] = 0.0;
+                acceleration[k][i] = 0.0;
+                for (int j = 0; j < 3; ++j)
+                {
+                    gradient[k][i][j] = 0.0;
+                }
+            }
+        }
+
+        centralBodyModel.addAcceleration(0.0, quantities, expectedAcceleration[0]);
+        j2Model.addAcceleration(0.0, quantities, expectedAcceleration[1]);
+        radiationPressureModel.addAcceleration(0.0, quantities, expectedAcceleration[2]);
+
+        centralBodyModel.addAccelerationAndGradient(0.0, quantities, acceleration[0], gradient[0]);
+        j2Model.addAccelerationAndGradient(0.0, quantities, acceleration[1], gradient[1]);
+        radiationPressureModel.addAccelerationAndGradient(
+            0.0, quantities, acceleration[2], gradient[2]);
+
+        for (int k = 0; k < 3; ++k)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                REQUIRE(acceleration[k][i]
+                            == Catch::Approx(expectedAcceleration[k][i]).epsilon(1.0e-15));
+                for (int j = 0; j < 3; ++j)
+                {
+                    REQUIRE(gradient[k][i][j]
+                                == Catch::Approx(expectedGradient[k][i][j]).epsilon(1.0e-14));
+                }
+            }
+        }
+    }
+
+    SECTION("Test state derivative")
+    {
+        const auto dynamics = makeCartesianDynamics<Real>(
+            centralBodyModel, j2Model, radiationPressureModel);
+        const auto variationalDynamics = makeCartesianVariationalDynamics<Real>(
+            centralBodyModel, j2Model, radiationPressureModel);
+
+        // Set state transition matrix to an arbitrary, non-identity matrix.
+        Real variationalState[42];
+        initializeCartesianVariationalState(state, variationalState);
+        for (std::size_t k = 6; k < 42; ++k)
+        {
+            variationalState[k] += 0.01 * static_cast<Real>(k);
+        }
+
+        Real expectedStateDerivative[6];
+        dynamics(0.0, state, expectedStateDerivative);
+
+        Real variationalStateDerivative[42];
+        variationalDynamics(0.0, variationalState, variationalStateDerivative);
+
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(variationalStateDerivative[i]
+                        == Catch::Approx(expectedStateDerivative[i]).epsilon(1.0e-15));
+        }
+
+        // Compute expected derivative of state transition matrix, A Phi, with
+        // A = [0 I; G 0].
+        Real totalGradient[3][3];
+        Real gradient[3][3];
+        computeCentralBodyAccelerationGradient(gravitationalParameter, position, totalGradient);
+        computeJ2AccelerationGradient(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient, gradient);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                totalGradient[i][j] += gradient[i][j];
+            }
+        }
+        computeCannonballRadiationPressureAccelerationGradient(referenceRadiationPressure,
+                                                               referenceDistance,
+                                                               radiationPressureCoefficient,
+                                                               position,
+                                                               radius,
+                                                               bulkDensity,
+                                                               gradient);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                totalGradient[i][j] += gradient[i][j];
+            }
+        }
+
+        const Real* const matrix = variationalState + 6;
+        const Real* const matrixDerivative = variationalStateDerivative + 6;
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                REQUIRE(matrixDerivative[6 * i + j] == matrix[6 * (i + 3) + j]);
+
+                Real expectedElement = 0.0;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    expectedElement += totalGradient[i][k] * matrix[6 * k + j];
+                }
+                REQUIRE(matrixDerivative[6 * (i + 3) + j]
+                            == Catch::Approx(expectedElement).epsilon(1.0e-13));
+            }
+        }
+    }
+
+    SECTION("Test propagated state transition matrix against finite differences")
+    {
+        const auto dynamics = makeCartesianDynamics<Real>(centralBodyModel, j2Model);
+        const auto variationalDynamics
+            = makeCartesianVariationalDynamics<Real>(centralBodyModel, j2Model);
+
+        const Real endTime = 3000.0;
+        const Real stepSize = 10.0;
+
+        Real variationalState[42];
+        initializeCartesianVariationalState(state, variationalState);
+        RungeKutta4Integrator<Real, 42> variationalIntegrator;
+        Real time = 0.0;
+        variationalIntegrator.integrate(
+            variationalDynamics, time, variationalState, endTime, stepSize);
+
+        // Check that the propagated Cartesian state is the same as without the variational
+        // equations.
+        RungeKutta4Integrator<Real, 6> integrator;
+        Real finalState[6];
+        std::copy(state, state + 6, finalState);
+        time = 0.0;
+        integrator.integrate(dynamics, time, finalState, endTime, stepSize);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(variationalState[i] == Catch::Approx(finalState[i]).epsilon(1.0e-15));
+        }
+
+        // Check columns of state transition matrix against central differences of the propagated
+        // state, with perturbations of the initial position [m] and velocity [m s^-1].
+        const Real perturbations[6] = {1.0, 1.0, 1.0, 1.0e-3, 1.0e-3, 1.0e-3};
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            Real perturbedStates[2][6];
+            for (int k = 0; k < 2; ++k)
+            {
+                std::copy(state, state + 6, perturbedStates[k]);
+                perturbedStates[k][j] += (k == 0 ? 1.0 : -1.0) * perturbations[j];
+                time = 0.0;
+                integrator.integrate(dynamics, time, perturbedStates[k], endTime, stepSize);
+            }
+
+            Real maximumElement = 0.0;
+            Real maximumError = 0.0;
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                const Real finiteDifference
+                    = (perturbedStates[0][i] - perturbedStates[1][i]) / (2.0 * perturbations[j]);
+                const Real element = variationalState[6 + 6 * i + j];
+                maximumElement = std::max(maximumElement, std::fabs(element));
+                maximumError = std::max(maximumError, std::fabs(element - finiteDifference));
+            }
+            REQUIRE(maximumError <= 1.0e-6 * maximumElement);
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "astro/catalogFile.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Write and map catalog file", "[catalog-file]")
+{
+    const std::string fileName = "testCatalogFile.bin";
+    const std::size_t chunkCapacity = 32;
+    const std::size_t numberOfObjects = 75;
+
+    // Set columns such that each value uniquely identifies its object and element.
+    std::vector<Vector> columns(6, Vector(numberOfObjects));
+    const Real* inputColumns[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            columns[k][i] = 1000.0 * static_cast<Real>(k) + static_cast<Real>(i);
+        }
+        inputColumns[k] = columns[k].data();
+    }
+
+    {
+        CatalogFileWriter<Real> writer(fileName, keplerianCatalogElements, chunkCapacity);
+
+        // Append a single object, followed by batches that straddle the chunk boundaries.
+        Vector state(6);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            state[k] = columns[k][0];
+        }
+        writer.appendState(state);
+
+        const Real* batchColumns[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            batchColumns[k] = inputColumns[k] + 1;
+        }
+        writer.append(batchColumns, 40);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            batchColumns[k] = inputColumns[k] + 41;
+        }
+        writer.append(batchColumns, numberOfObjects - 41);
+
+        REQUIRE(writer.getNumberOfObjects() == numberOfObjects);
+    }
+
+    SECTION("Test reading catalog file")
+    {
+        const MappedCatalogFile<Real> catalog(fileName);
+        REQUIRE(catalog.getElementType() == keplerianCatalogElements);
+        REQUIRE(catalog.getNumberOfObjects() == numberOfObjects);
+        REQUIRE(catalog.getChunkCapacity() == chunkCapacity);
+        REQUIRE(catalog.getNumberOfChunks() == 3);
+
+        std::size_t objectIndex = 0;
+        for (std::size_t chunkIndex = 0; chunkIndex < catalog.getNumberOfChunks(); ++chunkIndex)
+        {
+            const Real* elements[6];
+            const std::size_t chunkSize = catalog.getChunk(chunkIndex, elements);
+            REQUIRE(chunkSize == (chunkIndex < 2 ? chunkCapacity : numberOfObjects - 64));
+
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                // Columns are aligned to cache lines.
+                REQUIRE(reinterpret_cast<std::size_t>(elements[k]) % 64 == 0);
+                for (std::size_t i = 0; i < chunkSize; ++i)
+                {
+                    REQUIRE(elements[k][i] == columns[k][objectIndex + i]);
+                }
+            }
+            objectIndex += chunkSize;
+        }
+        REQUIRE(objectIndex == numberOfObjects);
+    }
+
+    SECTION("Test mismatching real type")
+    {
+        REQUIRE_THROWS_AS(MappedCatalogFile<float>(fileName), std::runtime_error);
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("Convert catalog file in place", "[catalog-file]")
+{
+    const std::string fileName = "testCatalogFileConversion.bin";
+    const Real earthGravitationalParameter = 3.986004418e14;
+
+    // Set Keplerian elements of a range of orbits.
+    const std::size_t numberOfObjects = 50;
+    std::vector<Vector> keplerianElements(numberOfObjects, Vector(6));
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        keplerianElements[i][semiMajorAxisIndex] = 7.0e6 + 1.0e5 * static_cast<Real>(i);
+        keplerianElements[i][eccentricityIndex] = 0.01 + 0.01 * static_cast<Real>(i % 10);
+        keplerianElements[i][inclinationIndex] = 0.1 + 0.05 * static_cast<Real>(i % 20);
+        keplerianElements[i][argumentOfPeriapsisIndex] = 0.2 + 0.1 * static_cast<Real>(i % 7);
+        keplerianElements[i][longitudeOfAscendingNodeIndex] = 0.3 + 0.1 * static_cast<Real>(i % 5);
+        keplerianElements[i][trueAnomalyIndex] = 0.4 + 0.1 * static_cast<Real>(i % 11);
+    }
+
+    {
+        CatalogFileWriter<Real> writer(fileName, cartesianCatalogElements, 16);
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            writer.appendState(convertKeplerianToCartesianElements(keplerianElements[i],
+                                                                   earthGravitationalParameter));
+        }
+    }
+
+    // Convert the Cartesian elements to Keplerian elements in place, in the mapped file.
+    {
+        MappedCatalogFile<Real> catalog(fileName, true);
+        REQUIRE(catalog.getElementType() == cartesianCatalogElements);
+        for (std::size_t chunkIndex = 0; chunkIndex < catalog.getNumberOfChunks(); ++chunkIndex)
+        {
+            Real* elements[6];
+            const std::size_t chunkSize = catalog.getChunk(chunkIndex, elements);
+            convertCartesianToKeplerianElements(
+                elements, elements, chunkSize, earthGravitationalParameter);
+        }
+        catalog.setElementType(keplerianCatalogElements);
+    }
+
+    const MappedCatalogFile<Real> catalog(fileName);
+    REQUIRE(catalog.getElementType() == keplerianCatalogElements);
+    REQUIRE(catalog.getNumberOfObjects() == numberOfObjects);
+
+    std::size_t objectIndex = 0;
+    for (std::size_t chunkIndex = 0; chunkIndex < catalog.getNumberOfChunks(); ++chunkIndex)
+    {
+        const Real* elements[6];
+        const std::size_t chunkSize = catalog.getChunk(chunkIndex, elements);
+        for (std::size_t i = 0; i < chunkSize; ++i)
+        {
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                REQUIRE(elements[k][i]
+                            == Catch::Approx(keplerianElements[objectIndex + i][k])
+                                .epsilon(1.0e-10));
+            }
+        }
+        objectIndex += chunkSize;
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST_CASE("Map invalid catalog file", "[catalog-file]")
+{
+    SECTION("Test missing file")
+    {
+        REQUIRE_THROWS_AS(MappedCatalogFile<Real>("missingCatalogFile.bin"), std::runtime_error);
+    }
+
+    SECTION("Test file that is not a catalog file")
+    {
+        const std::string fileName = "testInvalidCatalogFile.bin";
+        std::FILE* const file = std::fopen(fileName.c_str(), "wb");
+        REQUIRE(file != nullptr);
+        const char contents[128] = "This is not a catalog file.";
+        std::fwrite(contents, 1, sizeof(contents), file);
+        std::fclose(file);
+
+        REQUIRE_THROWS_AS(MappedCatalogFile<Real>(fileName), std::runtime_error);
+        std::remove(fileName.c_str());
+    }
+
+    SECTION("Test header with oversized chunk capacity or number of objects")
+    {
+        // The sizes in the header are chosen such that the required file size overflows if it is
+        // computed by multiplication.
+        const std::uint64_t chunkCapacities[3] = {16, std::uint64_t(1) << 61, 16};
+        const std::uint64_t numbersOfObjects[3]
+            = {1, 1, std::numeric_limits<std::uint64_t>::max()};
+        const std::string fileName = "testOversizedCatalogFile.bin";
+        for (int i = 0; i < 3; ++i)
+        {
+            CatalogFileHeader header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, catalogFileMagic, sizeof(header.magic));
+            header.version = catalogFileVersion;
+            header.elementType = static_cast<std::uint32_t>(cartesianCatalogElements);
+            header.scalarSize = static_cast<std::uint32_t>(sizeof(Real));
+            header.numberOfElements = 6;
+            header.numberOfObjects = numbersOfObjects[i];
+            header.chunkCapacity = chunkCapacities[i];
+
+            // Only the first header describes a file of valid size, with a single chunk.
+            const Vector chunk(6 * 16, 0.0);
+            std::FILE* const file = std::fopen(fileName.c_str(), "wb");
+            REQUIRE(file != nullptr);
+            std::fwrite(&header, sizeof(header), 1, file);
+            std::fwrite(chunk.data(), sizeof(Real), chunk.size(), file);
+            std::fclose(file);
+
+            if (i == 0)
+            {
+                const MappedCatalogFile<Real> catalogFile(fileName);
+                REQUIRE(catalogFile.getNumberOfChunks() == 1);
+            }
+            else
+            {
+                REQUIRE_THROWS_AS(MappedCatalogFile<Real>(fileName), std::runtime_error);
+            }
+        }
+        std::remove(fileName.c_str());
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -10,6 +10,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -100,6 +101,53 @@ TEST_CASE("Compute acceleration vector for arbitrary case using Tudat library va
                 == Catch::Approx(expectedAcceleration[2]).epsilon(tolerance));
 }
 
+TEST_CASE("Compute gradient of central body acceleration with respect to position",
+          "[central_gravity, acceleration, models]")
+{
+    // Set value of gravitational parameter of central body (Mercury) [m^3 s^-2].
+    const Real gravitationalParameter = 2.2032e13;
+
+    // Set position vector of the body relative to the origin of the reference frame [m].
+    Vector position(3);
+    position[0] =  1513.3e3;
+    position[1] = -7412.67e3;
+    position[2] =  3012.1e3;
+
+    Real gradient[3][3];
+    computeCentralBodyAccelerationGradient(gravitationalParameter, position, gradient);
+
+    // Compute gradient using central differences, with a step size that balances the truncation
+    // and round-off errors [m].
+    const Real stepSize = 100.0;
+    Real maximumGradient = 0.0;
+    Real maximumError = 0.0;
+    for (int j = 0; j < 3; ++j)
+    {
+        Vector forwardPosition = position;
+        Vector backwardPosition = position;
+        forwardPosition[j] += stepSize;
+        backwardPosition[j] -= stepSize;
+        const Vector forwardAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, forwardPosition);
+        const Vector backwardAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, backwardPosition);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const Real finiteDifference
+                = (forwardAcceleration[i] - backwardAcceleration[i]) / (2.0 * stepSize);
+            maximumGradient = std::max(maximumGradient, std::fabs(gradient[i][j]));
+            maximumError = std::max(maximumError, std::fabs(gradient[i][j] - finiteDifference));
+            REQUIRE(gradient[i][j] == gradient[j][i]);
+        }
+    }
+    REQUIRE(maximumError <= 1.0e-8 * maximumGradient);
+
+    // The trace of the gradient is zero, since the potential satisfies Laplace's equation.
+    REQUIRE(std::fabs(gradient[0][0] + gradient[1][1] + gradient[2][2])
+                <= 1.0e-15 * maximumGradient);
+}
+
 } // namespace tests
 } // namespace astro
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "astro/chebyshevEphemeris.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Evaluate Chebyshev series", "[chebyshev-ephemeris]")
+{
+    // f(x) = 1 + 2 T1(x) + 3 T2(x) - T3(x) = 1 + 2x + 3 (2x^2 - 1) - (4x^3 - 3x).
+    const Real coefficients[4] = {1.0, 2.0, 3.0, -1.0};
+
+    for (int i = 0; i <= 10; ++i)
+    {
+        const Real x = -1.0 + 0.2 * static_cast<Real>(i);
+        Real derivative = 0.0;
+        const Real value = evaluateChebyshevSeries(coefficients, 3, x, derivative);
+
+        REQUIRE(value == Catch::Approx(-2.0 + 5.0 * x + 6.0 * x * x - 4.0 * x * x * x)
+                             .epsilon(1.0e-14).scale(1.0));
+        REQUIRE(derivative == Catch::Approx(5.0 + 12.0 * x - 12.0 * x * x)
+                                  .epsilon(1.0e-14).scale(1.0));
+    }
+}
+
+TEST_CASE("Fit Chebyshev ephemeris to Kepler orbit", "[chebyshev-ephemeris]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+
+    // Set initial state of low Earth orbit, with an orbital period of about 1.7 hours.
+    Vector initialState(6, 0.0);
+    initialState[xPositionIndex] = 7.0e6;
+    initialState[yPositionIndex] = 1.0e5;
+    initialState[zPositionIndex] = -2.0e5;
+    initialState[xVelocityIndex] = -50.0;
+    initialState[yVelocityIndex] = 6.5e3;
+    initialState[zVelocityIndex] = 3.5e3;
+
+    const KeplerPropagator<Real, Vector> propagator(initialState, earthGravitationalParameter);
+    const auto positionFunction = [&propagator](const Real epoch, Real position[3])
+    {
+        const Vector state = propagator.propagate(epoch);
+        position[0] = state[xPositionIndex];
+        position[1] = state[yPositionIndex];
+        position[2] = state[zPositionIndex];
+    };
+
+    const Real startEpoch = -3600.0;
+    const Real endEpoch = 86400.0;
+    const Real tolerance = 1.0e-3;
+    const ChebyshevEphemeris<Real> ephemeris(positionFunction, startEpoch, endEpoch, tolerance);
+
+    REQUIRE(ephemeris.getStartEpoch() == startEpoch);
+    REQUIRE(ephemeris.getEndEpoch() == endEpoch);
+    REQUIRE(ephemeris.getDegree() == 12);
+    REQUIRE(ephemeris.getMaximumError() <= tolerance);
+    REQUIRE(ephemeris.getCoefficients().size() == ephemeris.getNumberOfSegments() * 3 * 13);
+
+    // The ephemeris is much more compact than a dense sampling of the orbit, e.g., every 10 s.
+    REQUIRE(ephemeris.getCoefficients().size() < (endEpoch - startEpoch) / 10.0 * 3.0 / 10.0);
+
+    SECTION("Test position and velocity")
+    {
+        for (int i = 0; i <= 1000; ++i)
+        {
+            const Real epoch = startEpoch + (endEpoch - startEpoch) * static_cast<Real>(i) / 1000.0;
+            const Vector expectedState = propagator.propagate(epoch);
+
+            Real state[6];
+            ephemeris.evaluateState(epoch, state);
+
+            Real position[3];
+            ephemeris.evaluatePosition(epoch, position);
+
+            Real positionError = 0.0;
+            Real velocityError = 0.0;
+            for (int k = 0; k < 3; ++k)
+            {
+                REQUIRE(position[k] == state[k]);
+                positionError += (state[k] - expectedState[k]) * (state[k] - expectedState[k]);
+                velocityError += (state[k + 3] - expectedState[k + 3])
+                                 * (state[k + 3] - expectedState[k + 3]);
+            }
+            REQUIRE(std::sqrt(positionError) < 2.0 * tolerance);
+            REQUIRE(std::sqrt(velocityError) < 1.0e-4);
+        }
+    }
+
+    SECTION("Test batch evaluation of positions")
+    {
+        const std::size_t numberOfEpochs = 100;
+        Vector epochs(numberOfEpochs);
+        for (std::size_t n = 0; n < numberOfEpochs; ++n)
+        {
+            epochs[n] = startEpoch + 863.0 * static_cast<Real>(n);
+        }
+
+        std::vector<Vector> positions(3, Vector(numberOfEpochs));
+        Real* positionColumns[3] = {positions[0].data(), positions[1].data(), positions[2].data()};
+        ephemeris.evaluatePositions(epochs.data(), numberOfEpochs, positionColumns);
+
+        for (std::size_t n = 0; n < numberOfEpochs; ++n)
+        {
+            Real position[3];
+            ephemeris.evaluatePosition(epochs[n], position);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(positions[k][n] == position[k]);
+            }
+        }
+    }
+
+    SECTION("Test tolerance not met with maximum number of segments")
+    {
+        REQUIRE_THROWS_AS(ChebyshevEphemeris<Real>(
+                              positionFunction, startEpoch, endEpoch, tolerance, 12, 8),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("Fit Chebyshev ephemeris to trajectory with converged segments",
+          "[chebyshev-ephemeris]")
+{
+    // The trajectory is a cubic polynomial in the first half of the interval, which is fitted
+    // exactly by a single segment, and oscillates rapidly in the second half, which requires many
+    // segments.
+    std::size_t numberOfCallsInFirstHalf = 0;
+    const auto positionFunction = [&numberOfCallsInFirstHalf](const Real epoch, Real position[3])
+    {
+        if (epoch < 0.5)
+        {
+            ++numberOfCallsInFirstHalf;
+        }
+        position[0] = epoch * epoch * epoch;
+        position[1] = epoch > 0.5 ? std::sin(40.0 * (epoch - 0.5)) : 0.0;
+        position[2] = 1.0;
+    };
+
+    const Real tolerance = 1.0e-9;
+    const ChebyshevEphemeris<Real> ephemeris(positionFunction, 0.0, 1.0, tolerance);
+
+    REQUIRE(ephemeris.getNumberOfSegments() >= 8);
+    REQUIRE(ephemeris.getMaximumError() <= tolerance);
+
+    // The first half is only sampled by the fit of the whole interval and by the fit of the first
+    // half, which is then kept when the number of segments is doubled. Each fit samples 13 nodes
+    // and 14 check points.
+    REQUIRE(numberOfCallsInFirstHalf <= 2 * (13 + 14));
+
+    for (int n = 0; n <= 100; ++n)
+    {
+        const Real epoch = 0.01 * n;
+        Real position[3];
+        positionFunction(epoch, position);
+
+        Real state[6];
+        ephemeris.evaluateState(epoch, state);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(state[i] == Catch::Approx(position[i]).epsilon(0.0).margin(tolerance));
+        }
+        REQUIRE(state[3] == Catch::Approx(3.0 * epoch * epoch).epsilon(0.0).margin(1.0e-6));
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "astro/conjunctionScreening.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::array<Real, 6> Vector6;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Check perigee/apogee filter", "[conjunction-screening]")
+{
+    const Real infinity = std::numeric_limits<Real>::infinity();
+
+    REQUIRE(isPassingPerigeeApogeeFilter(7.0e6, 7.2e6, 7.1e6, 7.3e6, 1.0e3));
+    REQUIRE(isPassingPerigeeApogeeFilter(7.0e6, 7.2e6, 7.2005e6, 7.3e6, 1.0e3));
+    REQUIRE(!isPassingPerigeeApogeeFilter(7.0e6, 7.2e6, 7.202e6, 7.3e6, 1.0e3));
+    REQUIRE(!isPassingPerigeeApogeeFilter(7.202e6, 7.3e6, 7.0e6, 7.2e6, 1.0e3));
+    REQUIRE(isPassingPerigeeApogeeFilter(7.0e6, 7.2e6, 4.0e7, infinity, 5.0e7));
+    REQUIRE(isPassingPerigeeApogeeFilter(7.0e6, infinity, 4.0e7, 4.3e7, 1.0e3));
+}
+
+TEST_CASE("Merge conjunctions", "[conjunction-screening]")
+{
+    // Set conjunctions (first object, second object, TCA, miss distance), including a chain of
+    // conjunctions of the same pair that are each within the merge interval of the previous one,
+    // with decreasing miss distances.
+    const Real data[7][4] = {{0.0, 1.0, 2.4, 0.5e3},
+                             {0.0, 1.0, 0.0, 4.0e3},
+                             {0.0, 1.0, 0.8, 3.0e3},
+                             {0.0, 1.0, 1.6, 2.0e3},
+                             {0.0, 2.0, 0.5, 1.0e3},
+                             {0.0, 2.0, 1.0, 2.0e3},
+                             {1.0, 2.0, 0.7, 1.5e3}};
+    std::vector<Conjunction<Real> > conjunctions(7);
+    for (std::size_t n = 0; n < conjunctions.size(); ++n)
+    {
+        conjunctions[n].firstObjectIndex = static_cast<std::size_t>(data[n][0]);
+        conjunctions[n].secondObjectIndex = static_cast<std::size_t>(data[n][1]);
+        conjunctions[n].timeOfClosestApproach = data[n][2];
+        conjunctions[n].missDistance = data[n][3];
+        conjunctions[n].relativeSpeed = 1.0e4;
+    }
+
+    const std::vector<Conjunction<Real> > mergedConjunctions
+        = mergeConjunctions(conjunctions, 1.0);
+
+    // The chain is split into groups that span at most the merge interval from their first TCA.
+    const Real expectedData[4][4] = {{0.0, 1.0, 0.8, 3.0e3},
+                                     {0.0, 1.0, 2.4, 0.5e3},
+                                     {0.0, 2.0, 0.5, 1.0e3},
+                                     {1.0, 2.0, 0.7, 1.5e3}};
+    REQUIRE(mergedConjunctions.size() == 4);
+    for (std::size_t n = 0; n < mergedConjunctions.size(); ++n)
+    {
+        REQUIRE(mergedConjunctions[n].firstObjectIndex
+                == static_cast<std::size_t>(expectedData[n][0]));
+        REQUIRE(mergedConjunctions[n].secondObjectIndex
+                == static_cast<std::size_t>(expectedData[n][1]));
+        REQUIRE(mergedConjunctions[n].timeOfClosestApproach == expectedData[n][2]);
+        REQUIRE(mergedConjunctions[n].missDistance == expectedData[n][3]);
+    }
+}
+
+TEST_CASE("Screen catalog for conjunctions", "[conjunction-screening]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real windowDuration = 3600.0;
+    const Real screeningDistance = 5.0e3;
+
+    // Generate catalog of low Earth orbits, in which each of the first objects has a partner that
+    // passes it at a given epoch, with a given miss distance, on a crossing orbit.
+    const std::size_t numberOfPairs = 6;
+    const std::size_t numberOfObjects = 2 * numberOfPairs + 8;
+    const Real missDistances[numberOfPairs] = {1.0e3, 2.5e3, 6.0e3, 1.0e2, 8.0e3, 4.5e3};
+    std::vector<Vector6> catalog(numberOfObjects);
+    for (std::size_t n = 0; n < numberOfObjects; ++n)
+    {
+        Vector6 keplerianElements;
+        keplerianElements[semiMajorAxisIndex] = 6.9e6 + 2.0e4 * static_cast<Real>(n % 7);
+        keplerianElements[eccentricityIndex] = 0.001 * static_cast<Real>(n % 5);
+        keplerianElements[inclinationIndex] = 0.2 + 0.11 * static_cast<Real>(n);
+        keplerianElements[argumentOfPeriapsisIndex] = 0.3 * static_cast<Real>(n);
+        keplerianElements[longitudeOfAscendingNodeIndex] = 0.7 * static_cast<Real>(n);
+        keplerianElements[trueAnomalyIndex] = 0.5 * static_cast<Real>(n);
+        catalog[n]
+            = convertKeplerianToCartesianElements(keplerianElements, earthGravitationalParameter);
+    }
+
+    std::vector<Real> encounterEpochs(numberOfPairs);
+    for (std::size_t n = 0; n < numberOfPairs; ++n)
+    {
+        encounterEpochs[n] = 200.0 + 550.0 * static_cast<Real>(n);
+        const Vector6 state
+            = KeplerPropagator<Real, Vector6>(catalog[n], earthGravitationalParameter)
+                  .propagate(encounterEpochs[n]);
+
+        // Rotate the velocity about the radial direction, and offset the position perpendicular
+        // to the radial direction and the relative velocity.
+        const Real radius = std::sqrt(
+            state[0] * state[0] + state[1] * state[1] + state[2] * state[2]);
+        const Real unitRadial[3] = {state[0] / radius, state[1] / radius, state[2] / radius};
+        const Real angle = 0.3 + 0.2 * static_cast<Real>(n);
+        const Real crossProduct[3] = {unitRadial[1] * state[5] - unitRadial[2] * state[4],
+                                      unitRadial[2] * state[3] - unitRadial[0] * state[5],
+                                      unitRadial[0] * state[4] - unitRadial[1] * state[3]};
+        Vector6 partnerState = state;
+        Real relativeVelocity[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            partnerState[k + 3] = std::cos(angle) * state[k + 3]
+                                  + std::sin(angle) * crossProduct[k];
+            relativeVelocity[k] = partnerState[k + 3] - state[k + 3];
+        }
+        const Real offset[3]
+            = {unitRadial[1] * relativeVelocity[2] - unitRadial[2] * relativeVelocity[1],
+               unitRadial[2] * relativeVelocity[0] - unitRadial[0] * relativeVelocity[2],
+               unitRadial[0] * relativeVelocity[1] - unitRadial[1] * relativeVelocity[0]};
+        const Real offsetNorm
+            = std::sqrt(offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2]);
+        for (int k = 0; k < 3; ++k)
+        {
+            partnerState[k] += missDistances[n] * offset[k] / offsetNorm;
+        }
+
+        catalog[numberOfPairs + n]
+            = KeplerPropagator<Real, Vector6>(partnerState, earthGravitationalParameter)
+                  .propagate(-encounterEpochs[n]);
+    }
+
+    std::vector<Vector> columns(6, Vector(numberOfObjects));
+    const Real* states[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        for (std::size_t n = 0; n < numberOfObjects; ++n)
+        {
+            columns[k][n] = catalog[n][k];
+        }
+        states[k] = columns[k].data();
+    }
+
+    // Compute reference conjunctions by brute force: sample the distance of all pairs at 1 s and
+    // refine each local minimum.
+    std::vector<Conjunction<Real> > expectedConjunctions;
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        const KeplerPropagator<Real, Vector6> first(catalog[i], earthGravitationalParameter);
+        for (std::size_t j = i + 1; j < numberOfObjects; ++j)
+        {
+            const KeplerPropagator<Real, Vector6> second(catalog[j], earthGravitationalParameter);
+            const std::size_t numberOfSamples = static_cast<std::size_t>(windowDuration) + 1;
+            Vector distances(numberOfSamples);
+            for (std::size_t n = 0; n < numberOfSamples; ++n)
+            {
+                const Vector6 firstState = first.propagate(static_cast<Real>(n));
+                const Vector6 secondState = second.propagate(static_cast<Real>(n));
+                distances[n] = std::sqrt((firstState[0] - secondState[0])
+                                         * (firstState[0] - secondState[0])
+                                         + (firstState[1] - secondState[1])
+                                           * (firstState[1] - secondState[1])
+                                         + (firstState[2] - secondState[2])
+                                           * (firstState[2] - secondState[2]));
+            }
+            for (std::size_t n = 0; n < numberOfSamples; ++n)
+            {
+                const bool isLocalMinimum
+                    = (n == 0 || distances[n] <= distances[n - 1])
+                      && (n + 1 == numberOfSamples || distances[n] < distances[n + 1]);
+                if (!isLocalMinimum || distances[n] > 2.0 * screeningDistance + 1.0e4)
+                {
+                    continue;
+                }
+                Conjunction<Real> conjunction = refineTimeOfClosestApproach(
+                    first,
+                    second,
+                    earthGravitationalParameter,
+                    static_cast<Real>(n),
+                    std::max(static_cast<Real>(n) - 1.0, 0.0),
+                    std::min(static_cast<Real>(n) + 1.0, windowDuration));
+                if (conjunction.missDistance <= screeningDistance)
+                {
+                    conjunction.firstObjectIndex = i;
+                    conjunction.secondObjectIndex = j;
+                    expectedConjunctions.push_back(conjunction);
+                }
+            }
+        }
+    }
+
+    // All crafted pairs with a miss distance below the screening distance are found.
+    std::size_t numberOfCraftedConjunctions = 0;
+    for (std::size_t n = 0; n < numberOfPairs; ++n)
+    {
+        numberOfCraftedConjunctions += missDistances[n] <= screeningDistance ? 1 : 0;
+    }
+    REQUIRE(expectedConjunctions.size() >= numberOfCraftedConjunctions);
+
+    for (std::size_t numberOfThreads = 1; numberOfThreads <= 2; ++numberOfThreads)
+    {
+        for (int stepIndex = 0; stepIndex < 2; ++stepIndex)
+        {
+            const Real stepDuration = stepIndex == 0 ? 20.0 : 90.0;
+            const std::vector<Conjunction<Real> > conjunctions
+                = screenConjunctions(states,
+                                     numberOfObjects,
+                                     earthGravitationalParameter,
+                                     windowDuration,
+                                     screeningDistance,
+                                     stepDuration,
+                                     numberOfThreads);
+
+            REQUIRE(conjunctions.size() == expectedConjunctions.size());
+            for (std::size_t n = 0; n < conjunctions.size(); ++n)
+            {
+                REQUIRE(conjunctions[n].firstObjectIndex
+                        == expectedConjunctions[n].firstObjectIndex);
+                REQUIRE(conjunctions[n].secondObjectIndex
+                        == expectedConjunctions[n].secondObjectIndex);
+                REQUIRE(conjunctions[n].timeOfClosestApproach
+                        == Catch::Approx(expectedConjunctions[n].timeOfClosestApproach)
+                               .epsilon(1.0e-8));
+                REQUIRE(conjunctions[n].missDistance
+                        == Catch::Approx(expectedConjunctions[n].missDistance).epsilon(1.0e-6));
+                REQUIRE(conjunctions[n].relativeSpeed
+                        == Catch::Approx(expectedConjunctions[n].relativeSpeed).epsilon(1.0e-6));
+            }
+        }
+    }
+
+    // Crafted encounters are found at the given epochs, with the given miss distances. Since the
+    // orbits of each crafted pair have the same period, the objects can also pass each other on
+    // the opposite side of the Earth.
+    const std::vector<Conjunction<Real> > conjunctions
+        = screenConjunctions(states,
+                             numberOfObjects,
+                             earthGravitationalParameter,
+                             windowDuration,
+                             screeningDistance,
+                             30.0);
+    for (std::size_t n = 0; n < numberOfPairs; ++n)
+    {
+        bool isFound = false;
+        for (std::size_t m = 0; m < conjunctions.size(); ++m)
+        {
+            if (conjunctions[m].firstObjectIndex == n
+                && conjunctions[m].secondObjectIndex == numberOfPairs + n
+                && std::fabs(conjunctions[m].timeOfClosestApproach - encounterEpochs[n]) < 1.0)
+            {
+                isFound = true;
+                REQUIRE(conjunctions[m].timeOfClosestApproach
+                        == Catch::Approx(encounterEpochs[n]).epsilon(1.0e-4));
+                REQUIRE(conjunctions[m].missDistance
+                        == Catch::Approx(missDistances[n]).epsilon(1.0e-2));
+            }
+        }
+        REQUIRE(isFound == (missDistances[n] <= screeningDistance));
+    }
+}
+
+} // namespace tests
+} // namespace astro
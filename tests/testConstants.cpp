@@ -21,7 +21,42 @@ TEST_CASE("Test definition of constants", "[constants]")
     REQUIRE(ASTRO_JULIAN_YEAR_IN_SECONDS 			== 3.15576e7  );
     REQUIRE(ASTRO_AU_IN_KM               			== 149597870.7);
     REQUIRE(ASTRO_GREGORIAN_EPOCH_IN_JULIAN_DAYS	== 1721425.5  );
+    REQUIRE(ASTRO_SPEED_OF_LIGHT                    == 299792458.0);
+}
+
+TEST_CASE("Test definition of templated constants", "[constants]")
+{
+    SECTION("Test double-precision constants")
+    {
+        REQUIRE(PhysicalConstants<double>::gravitationalConstant == ASTRO_GRAVITATIONAL_CONSTANT);
+        REQUIRE(PhysicalConstants<double>::julianDayInSeconds == ASTRO_JULIAN_DAY_IN_SECONDS);
+        REQUIRE(PhysicalConstants<double>::julianYearInDays == ASTRO_JULIAN_YEAR_IN_DAYS);
+        REQUIRE(PhysicalConstants<double>::julianYearInSeconds == ASTRO_JULIAN_YEAR_IN_SECONDS);
+        REQUIRE(PhysicalConstants<double>::astronomicalUnitInKilometers == ASTRO_AU_IN_KM);
+        REQUIRE(PhysicalConstants<double>::gregorianEpochInJulianDays
+                    == ASTRO_GREGORIAN_EPOCH_IN_JULIAN_DAYS);
+        REQUIRE(PhysicalConstants<double>::speedOfLight == ASTRO_SPEED_OF_LIGHT);
+    }
+
+    SECTION("Test single-precision constants")
+    {
+        REQUIRE(PhysicalConstants<float>::gravitationalConstant == 6.67259e-11f);
+        REQUIRE(PhysicalConstants<float>::julianDayInSeconds == 86400.0f);
+        REQUIRE(PhysicalConstants<float>::speedOfLight == 299792458.0f);
+    }
+
+    SECTION("Test use of constants in constant expressions")
+    {
+        static_assert(PhysicalConstants<double>::julianDayInSeconds == 86400.0,
+                      "Constant must be usable in constant expression!");
+        static_assert(ASTRO_JULIAN_YEAR_IN_DAYS * ASTRO_JULIAN_DAY_IN_SECONDS
+                          == ASTRO_JULIAN_YEAR_IN_SECONDS,
+                      "Constant must be usable in constant expression!");
 
+        // Bind a reference to the constant, which requires it to have a definition (ODR-use).
+        const double& speedOfLight = PhysicalConstants<double>::speedOfLight;
+        REQUIRE(speedOfLight == 299792458.0);
+    }
 }
 
 } // namespace tests
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include "astro/constexprMath.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+TEST_CASE("Compute square root at compile time", "[constexpr, square-root]")
+{
+    SECTION("Test constant expressions")
+    {
+        static_assert(computeConstexprSquareRoot(0.0) == 0.0,
+                      "Square root must be computed at compile time!");
+        static_assert(computeConstexprSquareRoot(1.0) == 1.0,
+                      "Square root must be computed at compile time!");
+        static_assert(computeConstexprSquareRoot(4.0) == 2.0,
+                      "Square root must be computed at compile time!");
+        static_assert(computeConstexprSquareRoot(0.25f) == 0.5f,
+                      "Square root must be computed at compile time!");
+    }
+
+    SECTION("Test against std::sqrt over range of magnitudes")
+    {
+        for (int exponent = -30; exponent <= 30; ++exponent)
+        {
+            const double value = 1.2345 * std::pow(10.0, exponent);
+            REQUIRE(computeConstexprSquareRoot(value)
+                        == Catch::Approx(std::sqrt(value))
+                               .epsilon(std::numeric_limits<double>::epsilon()));
+
+            const float singlePrecisionValue = static_cast<float>(value);
+            REQUIRE(computeConstexprSquareRoot(singlePrecisionValue)
+                        == Catch::Approx(std::sqrt(singlePrecisionValue))
+                               .epsilon(std::numeric_limits<float>::epsilon()));
+        }
+    }
+
+    SECTION("Test invalid values")
+    {
+        REQUIRE(std::isnan(computeConstexprSquareRoot(-1.0)));
+        REQUIRE(std::isnan(computeConstexprSquareRoot(std::numeric_limits<double>::infinity())));
+        REQUIRE(std::isnan(computeConstexprSquareRoot(std::numeric_limits<double>::quiet_NaN())));
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include "astro/cudaBackend.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/parallelCatalog.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Check if a CUDA device is available, such that the tests can be skipped on hosts without one.
+bool isDeviceAvailable()
+{
+    int numberOfDevices = 0;
+    if (cudaGetDeviceCount(&numberOfDevices) != cudaSuccess || numberOfDevices == 0)
+    {
+        WARN("No CUDA device available, skipping device test.");
+        return false;
+    }
+    return true;
+}
+
+//! Generate catalog of Keplerian elements of elliptical orbits, covering a range of eccentricities.
+std::vector<Vector> generateKeplerianCatalog(const std::size_t numberOfObjects)
+{
+    std::vector<Vector> catalog(6, Vector(numberOfObjects));
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        const Real fraction = static_cast<Real>(i) / static_cast<Real>(numberOfObjects);
+        catalog[eccentricityIndex][i] = 0.9 * fraction;
+        catalog[semiMajorAxisIndex][i] = 7.0e6 / (1.0 - catalog[eccentricityIndex][i]);
+        catalog[inclinationIndex][i] = 0.1 + 3.0 * fraction;
+        catalog[argumentOfPeriapsisIndex][i] = 0.3 + 5.0 * fraction;
+        catalog[longitudeOfAscendingNodeIndex][i] = 6.0 * fraction;
+        catalog[trueAnomalyIndex][i] = 0.2 + 6.0 * fraction;
+    }
+    return catalog;
+}
+
+//! Get read-only column pointers of catalog.
+void getColumns(const std::vector<Vector>& catalog, const Real* columns[6])
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        columns[i] = catalog[i].data();
+    }
+}
+
+//! Get column pointers of catalog.
+void getColumns(std::vector<Vector>& catalog, Real* columns[6])
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        columns[i] = catalog[i].data();
+    }
+}
+
+//! Copy columns of catalog to device.
+void copyCatalogToDevice(const std::vector<Vector>& catalog,
+                         DeviceElementArrays<Real>& deviceElements)
+{
+    const Real* columns[6];
+    getColumns(catalog, columns);
+    deviceElements.copyFromHost(columns);
+}
+
+//! Copy columns of catalog from device.
+std::vector<Vector> copyCatalogFromDevice(const DeviceElementArrays<Real>& deviceElements)
+{
+    std::vector<Vector> catalog(6, Vector(deviceElements.getNumberOfElements()));
+    Real* columns[6];
+    getColumns(catalog, columns);
+    checkCudaError(cudaDeviceSynchronize());
+    deviceElements.copyToHost(columns);
+    return catalog;
+}
+
+const Real earthGravitationalParameter = 3.986004418e14;
+
+// The number of objects exceeds a single block, such that the grid-stride loops are exercised.
+const std::size_t numberOfObjects = 1031;
+
+TEST_CASE("Copy device element arrays", "[cuda-backend]")
+{
+    if (!isDeviceAvailable())
+    {
+        return;
+    }
+
+    const std::vector<Vector> catalog = generateKeplerianCatalog(numberOfObjects);
+    DeviceElementArrays<Real> deviceElements(numberOfObjects);
+    REQUIRE(deviceElements.getNumberOfElements() == numberOfObjects);
+
+    copyCatalogToDevice(catalog, deviceElements);
+    const std::vector<Vector> copiedCatalog = copyCatalogFromDevice(deviceElements);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        REQUIRE(copiedCatalog[i] == catalog[i]);
+    }
+}
+
+TEST_CASE("Convert catalog on device", "[cuda-backend]")
+{
+    if (!isDeviceAvailable())
+    {
+        return;
+    }
+
+    const std::vector<Vector> keplerianCatalog = generateKeplerianCatalog(numberOfObjects);
+
+    // Compute the expected catalogs with the host batch conversions.
+    const Real* keplerianColumns[6];
+    getColumns(keplerianCatalog, keplerianColumns);
+    std::vector<Vector> expectedCartesianCatalog(6, Vector(numberOfObjects));
+    Real* expectedCartesianColumns[6];
+    getColumns(expectedCartesianCatalog, expectedCartesianColumns);
+    convertCatalogKeplerianToCartesianElements(
+        keplerianColumns, expectedCartesianColumns, numberOfObjects, earthGravitationalParameter);
+
+    const Real* cartesianColumns[6];
+    getColumns(expectedCartesianCatalog, cartesianColumns);
+    std::vector<Vector> expectedKeplerianCatalog(6, Vector(numberOfObjects));
+    Real* expectedKeplerianColumns[6];
+    getColumns(expectedKeplerianCatalog, expectedKeplerianColumns);
+    convertCatalogCartesianToKeplerianElements(
+        cartesianColumns, expectedKeplerianColumns, numberOfObjects, earthGravitationalParameter);
+
+    DeviceElementArrays<Real> deviceKeplerianElements(numberOfObjects);
+    DeviceElementArrays<Real> deviceCartesianElements(numberOfObjects);
+
+    SECTION("Test Keplerian to Cartesian elements")
+    {
+        copyCatalogToDevice(keplerianCatalog, deviceKeplerianElements);
+        convertCatalogKeplerianToCartesianElementsOnDevice(deviceKeplerianElements.getColumns(),
+                                                           deviceCartesianElements.getColumns(),
+                                                           numberOfObjects,
+                                                           earthGravitationalParameter);
+        const std::vector<Vector> cartesianCatalog
+            = copyCatalogFromDevice(deviceCartesianElements);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            for (std::size_t j = 0; j < numberOfObjects; ++j)
+            {
+                REQUIRE(cartesianCatalog[i][j]
+                        == Catch::Approx(expectedCartesianCatalog[i][j])
+                               .epsilon(1.0e-12).margin(1.0e-6));
+            }
+        }
+    }
+
+    SECTION("Test Cartesian to Keplerian elements")
+    {
+        copyCatalogToDevice(expectedCartesianCatalog, deviceCartesianElements);
+        convertCatalogCartesianToKeplerianElementsOnDevice(deviceCartesianElements.getColumns(),
+                                                           deviceKeplerianElements.getColumns(),
+                                                           numberOfObjects,
+                                                           earthGravitationalParameter);
+        const std::vector<Vector> keplerianCatalogOnDevice
+            = copyCatalogFromDevice(deviceKeplerianElements);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            for (std::size_t j = 0; j < numberOfObjects; ++j)
+            {
+                REQUIRE(keplerianCatalogOnDevice[i][j]
+                        == Catch::Approx(expectedKeplerianCatalog[i][j])
+                               .epsilon(1.0e-12).margin(1.0e-9));
+            }
+        }
+    }
+
+    SECTION("Test empty catalog")
+    {
+        // Launches for empty catalogs are no-ops and do not report errors.
+        convertCatalogKeplerianToCartesianElementsOnDevice(deviceKeplerianElements.getColumns(),
+                                                           deviceCartesianElements.getColumns(),
+                                                           0,
+                                                           earthGravitationalParameter);
+        convertCatalogCartesianToKeplerianElementsOnDevice(deviceCartesianElements.getColumns(),
+                                                           deviceKeplerianElements.getColumns(),
+                                                           0,
+                                                           earthGravitationalParameter);
+        REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+    }
+}
+
+TEST_CASE("Propagate ensemble on device", "[cuda-backend]")
+{
+    if (!isDeviceAvailable())
+    {
+        return;
+    }
+
+    const std::vector<Vector> keplerianCatalog = generateKeplerianCatalog(numberOfObjects);
+    const Real timeOfFlight = 12345.6;
+
+    DeviceElementArrays<Real> deviceKeplerianElements(numberOfObjects);
+    DeviceElementArrays<Real> deviceCartesianElements(numberOfObjects);
+    copyCatalogToDevice(keplerianCatalog, deviceKeplerianElements);
+    propagateEnsembleOnDevice(deviceKeplerianElements.getColumns(),
+                              deviceCartesianElements.getColumns(),
+                              numberOfObjects,
+                              earthGravitationalParameter,
+                              timeOfFlight);
+    const std::vector<Vector> cartesianCatalog = copyCatalogFromDevice(deviceCartesianElements);
+
+    // The propagated states agree with propagateKeplerianElements on the host.
+    for (std::size_t j = 0; j < numberOfObjects; ++j)
+    {
+        Real keplerianState[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            keplerianState[i] = keplerianCatalog[i][j];
+        }
+        propagateKeplerianElements(
+            keplerianState, earthGravitationalParameter, timeOfFlight, keplerianState);
+        Real expectedCartesianState[6];
+        convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter, expectedCartesianState);
+
+        for (int i = 0; i < 6; ++i)
+        {
+            REQUIRE(cartesianCatalog[i][j]
+                    == Catch::Approx(expectedCartesianState[i]).epsilon(1.0e-10).margin(1.0e-6));
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+// This test is compiled into a separate executable with ASTRO_ENABLE_INSTRUMENTATION defined.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "astro/instrumentation.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/parallelCatalog.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef int Integer;
+typedef std::vector<Real> Vector;
+
+//! Sum bins of iteration histogram of solver counters.
+std::uint64_t sumInstrumentationHistogram(const SolverCounters& counters)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < numberOfIterationHistogramBins; ++i)
+    {
+        sum += counters.iterationHistogram[i];
+    }
+    return sum;
+}
+
+TEST_CASE("Collect solver instrumentation counters", "[instrumentation]")
+{
+    REQUIRE(isInstrumentationEnabled);
+    resetInstrumentationCounters();
+
+    SECTION("Test scalar elliptical and hyperbolic solvers")
+    {
+        const std::size_t numberOfSolves = 50;
+        for (std::size_t i = 0; i < numberOfSolves; ++i)
+        {
+            const Real fraction = static_cast<Real>(i) / static_cast<Real>(numberOfSolves);
+            convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(0.99 * fraction,
+                                                                          6.0 * fraction);
+            convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(1.1 + 10.0 * fraction,
+                                                                          6.0 * fraction);
+        }
+
+        // A single iteration does not suffice for this eccentricity.
+        const Integer maximumIterations = 1;
+        REQUIRE_THROWS_AS((convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                              0.9, 0.1, 1.0e-15, maximumIterations)),
+                          std::runtime_error);
+
+        const InstrumentationCounters counters = collectInstrumentationCounters();
+
+        const SolverCounters& elliptical = counters.ellipticalKeplerSolver;
+        REQUIRE(elliptical.numberOfSolves == numberOfSolves + 1);
+        REQUIRE(elliptical.numberOfNonConvergences == 1);
+        REQUIRE(sumInstrumentationHistogram(elliptical) == elliptical.numberOfSolves);
+        REQUIRE(elliptical.iterationHistogram[0] == 0);
+        REQUIRE(elliptical.iterationHistogram[1] >= 1);
+
+        std::uint64_t numberOfIterations = 0;
+        for (std::size_t i = 0; i < numberOfIterationHistogramBins; ++i)
+        {
+            numberOfIterations += i * elliptical.iterationHistogram[i];
+        }
+        REQUIRE(elliptical.numberOfIterations == numberOfIterations);
+
+        const SolverCounters& hyperbolic = counters.hyperbolicKeplerSolver;
+        REQUIRE(hyperbolic.numberOfSolves == numberOfSolves);
+        REQUIRE(hyperbolic.numberOfNonConvergences == 0);
+        REQUIRE(sumInstrumentationHistogram(hyperbolic) == numberOfSolves);
+        REQUIRE(hyperbolic.numberOfIterations >= numberOfSolves);
+
+        REQUIRE(counters.ellipticalKeplerBatchSolver.numberOfSolves == 0);
+        REQUIRE(counters.cartesianToKeplerianElements.numberOfConversions == 0);
+
+        resetInstrumentationCounters();
+        REQUIRE(collectInstrumentationCounters().ellipticalKeplerSolver.numberOfSolves == 0);
+    }
+
+    SECTION("Test batch elliptical solver")
+    {
+        // Set 100 elements, i.e., two blocks, with too few iterations to converge for high
+        // eccentricities.
+        const std::size_t numberOfElements = 100;
+        Vector eccentricities(numberOfElements);
+        Vector meanAnomalies(numberOfElements);
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            eccentricities[i] = 0.99 * static_cast<Real>(i) / static_cast<Real>(numberOfElements);
+            meanAnomalies[i] = 0.1 + 0.05 * static_cast<Real>(i);
+        }
+        Vector eccentricAnomalies(numberOfElements);
+        bool isConverged[numberOfElements];
+
+        const Integer maximumIterations = 3;
+        convertEllipticalMeanAnomalyToEccentricAnomaly(eccentricities.data(),
+                                                       meanAnomalies.data(),
+                                                       eccentricAnomalies.data(),
+                                                       isConverged,
+                                                       numberOfElements,
+                                                       1.0e-15,
+                                                       maximumIterations);
+
+        std::uint64_t numberOfNonConvergedElements = 0;
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            numberOfNonConvergedElements += isConverged[i] ? 0 : 1;
+        }
+        REQUIRE(numberOfNonConvergedElements > 0);
+
+        const SolverCounters counters
+            = collectInstrumentationCounters().ellipticalKeplerBatchSolver;
+        REQUIRE(counters.numberOfSolves == 2);
+        REQUIRE(counters.numberOfNonConvergences == numberOfNonConvergedElements);
+        REQUIRE(counters.iterationHistogram[maximumIterations] >= 1);
+        REQUIRE(sumInstrumentationHistogram(counters) == 2);
+    }
+
+    SECTION("Test universal Kepler solver")
+    {
+        Vector state(6);
+        state[xPositionIndex] = 7.0e6;
+        state[yPositionIndex] = 0.0;
+        state[zPositionIndex] = 0.0;
+        state[xVelocityIndex] = 0.0;
+        state[yVelocityIndex] = 7.5e3;
+        state[zVelocityIndex] = 1.0e3;
+
+        const KeplerPropagator<Real, Vector> propagator(state, 3.986004418e14);
+        const std::size_t numberOfSolves = 10;
+        for (std::size_t i = 0; i < numberOfSolves; ++i)
+        {
+            propagator.propagate(1000.0 * static_cast<Real>(i + 1));
+        }
+
+        const SolverCounters counters = collectInstrumentationCounters().universalKeplerSolver;
+        REQUIRE(counters.numberOfSolves == numberOfSolves);
+        REQUIRE(counters.numberOfNonConvergences == 0);
+        REQUIRE(counters.numberOfIterations >= numberOfSolves);
+    }
+}
+
+TEST_CASE("Collect limit-case instrumentation counters", "[instrumentation]")
+{
+    resetInstrumentationCounters();
+
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real radius = 7.0e6;
+    const Real circularVelocity = std::sqrt(earthGravitationalParameter / radius);
+
+    // Set elliptical inclined, circular inclined, elliptical equatorial, circular equatorial and
+    // parabolic states.
+    const std::size_t numberOfStates = 5;
+    const Real velocities[numberOfStates][3]
+        = {{0.0, 1.1 * circularVelocity, 0.3 * circularVelocity},
+           {0.0, 0.6 * circularVelocity, 0.8 * circularVelocity},
+           {0.0, 1.1 * circularVelocity, 0.0},
+           {0.0, circularVelocity, 0.0},
+           {0.0, 0.0, std::sqrt(2.0) * circularVelocity}};
+
+    std::vector<Vector> columns(6, Vector(numberOfStates, 0.0));
+    const Real* cartesianElements[6];
+    Real* keplerianElements[6];
+    std::vector<Vector> outputs(6, Vector(numberOfStates));
+    for (std::size_t j = 0; j < numberOfStates; ++j)
+    {
+        columns[xPositionIndex][j] = radius;
+        columns[xVelocityIndex][j] = velocities[j][0];
+        columns[yVelocityIndex][j] = velocities[j][1];
+        columns[zVelocityIndex][j] = velocities[j][2];
+    }
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        cartesianElements[i] = columns[i].data();
+        keplerianElements[i] = outputs[i].data();
+    }
+
+    SECTION("Test scalar conversion")
+    {
+        for (std::size_t j = 0; j < numberOfStates; ++j)
+        {
+            Vector state(6);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                state[i] = columns[i][j];
+            }
+            convertCartesianToKeplerianElements(state, earthGravitationalParameter);
+        }
+
+        const CartesianToKeplerianElementCounters counters
+            = collectInstrumentationCounters().cartesianToKeplerianElements;
+        REQUIRE(counters.numberOfConversions == numberOfStates);
+        REQUIRE(counters.numberOfCircularInclinedOrbits == 1);
+        REQUIRE(counters.numberOfEllipticalEquatorialOrbits == 1);
+        REQUIRE(counters.numberOfCircularEquatorialOrbits == 1);
+        REQUIRE(counters.numberOfParabolicOrbits == 1);
+    }
+
+    SECTION("Test batch conversion")
+    {
+        convertCartesianToKeplerianElements(
+            cartesianElements, keplerianElements, numberOfStates, earthGravitationalParameter);
+
+        const CartesianToKeplerianElementCounters counters
+            = collectInstrumentationCounters().cartesianToKeplerianElements;
+        REQUIRE(counters.numberOfConversions == numberOfStates);
+        REQUIRE(counters.numberOfCircularInclinedOrbits == 1);
+        REQUIRE(counters.numberOfEllipticalEquatorialOrbits == 1);
+        REQUIRE(counters.numberOfCircularEquatorialOrbits == 1);
+        REQUIRE(counters.numberOfParabolicOrbits == 1);
+    }
+
+    SECTION("Test parallel conversion")
+    {
+        // The counters of the worker threads are accumulated when the threads exit.
+        const std::size_t numberOfConversions = 1000;
+        executeInParallel(
+            numberOfConversions,
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                for (std::size_t j = begin; j < end; ++j)
+                {
+                    Vector state(6);
+                    for (std::size_t i = 0; i < 6; ++i)
+                    {
+                        state[i] = columns[i][j % numberOfStates];
+                    }
+                    convertCartesianToKeplerianElements(state, earthGravitationalParameter);
+                }
+            },
+            4,
+            10);
+
+        const CartesianToKeplerianElementCounters counters
+            = collectInstrumentationCounters().cartesianToKeplerianElements;
+        REQUIRE(counters.numberOfConversions == numberOfConversions);
+        REQUIRE(counters.numberOfCircularEquatorialOrbits == numberOfConversions / numberOfStates);
+        REQUIRE(counters.numberOfParabolicOrbits == numberOfConversions / numberOfStates);
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/cartesianDynamics.hpp"
+#include "astro/integrators.hpp"
+#include "astro/keplerPropagator.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 2> Vector2;
+
+//! Dynamics of harmonic oscillator (x'' = -x).
+struct HarmonicOscillatorDynamics
+{
+    void operator()(const Real, const Real* state, Real* stateDerivative) const
+    {
+        stateDerivative[0] = state[1];
+        stateDerivative[1] = -state[0];
+    }
+};
+
+//! Dynamics of harmonic oscillator (x'' = -x) in single precision.
+struct SinglePrecisionHarmonicOscillatorDynamics
+{
+    void operator()(const float, const float* state, float* stateDerivative) const
+    {
+        stateDerivative[0] = state[1];
+        stateDerivative[1] = -state[0];
+    }
+};
+
+template <typename Tableau>
+void checkTableauConsistency()
+{
+    Real sumOfWeights = 0.0;
+    Real sumOfErrorWeights = 0.0;
+    for (std::size_t i = 0; i < Tableau::numberOfStages; ++i)
+    {
+        Real sumOfRow = 0.0;
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            sumOfRow += Tableau::a[i][j];
+        }
+        REQUIRE(sumOfRow == Catch::Approx(Tableau::c[i]).margin(1.0e-15));
+
+        sumOfWeights += Tableau::b[i];
+        sumOfErrorWeights += Tableau::bError[i];
+    }
+
+    REQUIRE(sumOfWeights == Catch::Approx(1.0).epsilon(1.0e-15));
+    REQUIRE(sumOfErrorWeights == Catch::Approx(0.0).margin(1.0e-15));
+}
+
+TEST_CASE("Check Butcher tableaus", "[integrators]")
+{
+    SECTION("Test Dormand-Prince 5(4) tableau")
+    {
+        checkTableauConsistency<DormandPrince54Tableau<Real> >();
+    }
+
+    SECTION("Test Runge-Kutta-Fehlberg 7(8) tableau")
+    {
+        checkTableauConsistency<RungeKuttaFehlberg78Tableau<Real> >();
+    }
+}
+
+TEST_CASE("Integrate harmonic oscillator using RK4 integrator", "[integrators][rk4]")
+{
+    const HarmonicOscillatorDynamics dynamics;
+    RungeKutta4Integrator<Real, 2> integrator;
+
+    SECTION("Test 4th-order convergence")
+    {
+        Real errors[2];
+        const Real stepSizes[2] = {0.1, 0.05};
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            Real time = 0.0;
+            Vector2 state = {{1.0, 0.0}};
+            integrator.integrate(dynamics, time, state, 1.0, stepSizes[i]);
+
+            REQUIRE(time == 1.0);
+            errors[i] = std::fabs(state[0] - std::cos(1.0));
+        }
+
+        REQUIRE(std::log(errors[0] / errors[1]) / std::log(2.0)
+                    == Catch::Approx(4.0).margin(0.1));
+    }
+
+    SECTION("Test backward integration with shortened last step")
+    {
+        Real time = 0.0;
+        Vector state(2);
+        state[0] = 1.0;
+        state[1] = 0.0;
+        integrator.integrate(dynamics, time, state, -1.05, 0.01);
+
+        REQUIRE(time == -1.05);
+        REQUIRE(state[0] == Catch::Approx(std::cos(-1.05)).epsilon(1.0e-9));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(-1.05)).epsilon(1.0e-9));
+    }
+}
+
+TEST_CASE("Integrate harmonic oscillator using embedded Runge-Kutta integrators",
+          "[integrators][embedded]")
+{
+    const HarmonicOscillatorDynamics dynamics;
+
+    SECTION("Test Dormand-Prince 5(4) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<Real, 2, DormandPrince54Tableau<Real> > integrator(
+            1.0e-12, 1.0e-12);
+
+        Real time = 0.0;
+        Real stepSize = 0.1;
+        Vector2 state = {{1.0, 0.0}};
+        integrator.integrate(dynamics, time, state, 10.0, stepSize);
+
+        REQUIRE(time == 10.0);
+        REQUIRE(state[0] == Catch::Approx(std::cos(10.0)).epsilon(1.0e-10));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(10.0)).epsilon(1.0e-10));
+    }
+
+    SECTION("Test Runge-Kutta-Fehlberg 7(8) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<Real, 2, RungeKuttaFehlberg78Tableau<Real> > integrator(
+            1.0e-12, 1.0e-12);
+
+        Real time = 0.0;
+        Real stepSize = 0.1;
+        Vector2 state = {{1.0, 0.0}};
+        integrator.integrate(dynamics, time, state, -10.0, stepSize);
+
+        REQUIRE(time == -10.0);
+        REQUIRE(state[0] == Catch::Approx(std::cos(-10.0)).epsilon(1.0e-10));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(-10.0)).epsilon(1.0e-10));
+    }
+
+    SECTION("Test rejected step")
+    {
+        EmbeddedRungeKuttaIntegrator<Real, 2, DormandPrince54Tableau<Real> > integrator(
+            1.0e-12, 1.0e-12);
+
+        Real time = 0.0;
+        Real stepSize = 1.0;
+        Vector2 state = {{1.0, 0.0}};
+
+        REQUIRE(!integrator.step(dynamics, time, state, stepSize));
+        REQUIRE(time == 0.0);
+        REQUIRE(state[0] == 1.0);
+        REQUIRE(state[1] == 0.0);
+        REQUIRE(stepSize < 1.0);
+    }
+}
+
+TEST_CASE("Integrate harmonic oscillator in single precision", "[integrators][float]")
+{
+    const SinglePrecisionHarmonicOscillatorDynamics dynamics;
+
+    SECTION("Test RK4 integrator")
+    {
+        RungeKutta4Integrator<float, 2> integrator;
+
+        float time = 0.0f;
+        float state[2] = {1.0f, 0.0f};
+        integrator.integrate(dynamics, time, state, 1.0f, 0.01f);
+
+        REQUIRE(time == 1.0f);
+        REQUIRE(state[0] == Catch::Approx(std::cos(1.0)).epsilon(1.0e-5));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(1.0)).epsilon(1.0e-5));
+    }
+
+    SECTION("Test Dormand-Prince 5(4) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<float, 2, DormandPrince54Tableau<float> > integrator(
+            1.0e-6f, 1.0e-6f, 1.0e-6f);
+
+        float time = 0.0f;
+        float stepSize = 0.1f;
+        float state[2] = {1.0f, 0.0f};
+        integrator.integrate(dynamics, time, state, 1.0f, stepSize);
+
+        REQUIRE(time == 1.0f);
+        REQUIRE(state[0] == Catch::Approx(std::cos(1.0)).epsilon(1.0e-5));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(1.0)).epsilon(1.0e-5));
+    }
+
+    SECTION("Test Runge-Kutta-Fehlberg 7(8) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<float, 2, RungeKuttaFehlberg78Tableau<float> > integrator(
+            1.0e-6f, 1.0e-6f, 1.0e-6f);
+
+        float time = 0.0f;
+        float stepSize = 0.1f;
+        float state[2] = {1.0f, 0.0f};
+        integrator.integrate(dynamics, time, state, -1.0f, stepSize);
+
+        REQUIRE(time == -1.0f);
+        REQUIRE(state[0] == Catch::Approx(std::cos(-1.0)).epsilon(1.0e-5));
+        REQUIRE(state[1] == Catch::Approx(-std::sin(-1.0)).epsilon(1.0e-5));
+    }
+}
+
+TEST_CASE("Integrate Kepler orbit using embedded Runge-Kutta integrators",
+          "[integrators][embedded][cartesian-dynamics]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2].
+    const Real earthGravitationalParameter = 3.986004415e14;
+
+    // Set initial Cartesian state [m, m/s] (elliptical orbit from ODTBX test case).
+    const Real initialStateArray[6] = {3.75e6, 4.24e6, -1.39e6, -4.65e3, -2.21e3, 1.66e3};
+    const Vector initialState(initialStateArray, initialStateArray + 6);
+
+    const Real timeOfFlight = 20000.0;
+    const Vector expectedState
+        = propagateKeplerOrbit(initialState, earthGravitationalParameter, timeOfFlight);
+
+    const auto dynamics = makeCartesianDynamics<Real>(
+        CentralBodyAccelerationModel<Real>(earthGravitationalParameter));
+
+    // The margin [m, m/s] accounts for state components that are close to zero.
+
+    SECTION("Test Dormand-Prince 5(4) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<Real, 6, DormandPrince54Tableau<Real> > integrator(
+            1.0e-12, 0.0);
+
+        Real time = 0.0;
+        Real stepSize = 10.0;
+        Vector state = initialState;
+        integrator.integrate(dynamics, time, state, timeOfFlight, stepSize);
+
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == Catch::Approx(expectedState[i]).epsilon(1.0e-8).margin(1.0e-4));
+        }
+    }
+
+    SECTION("Test Runge-Kutta-Fehlberg 7(8) integrator")
+    {
+        EmbeddedRungeKuttaIntegrator<Real, 6, RungeKuttaFehlberg78Tableau<Real> > integrator(
+            1.0e-12, 0.0);
+
+        Real time = 0.0;
+        Real stepSize = 10.0;
+        Vector state = initialState;
+        integrator.integrate(dynamics, time, state, timeOfFlight, stepSize);
+
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == Catch::Approx(expectedState[i]).epsilon(1.0e-8).margin(1.0e-4));
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
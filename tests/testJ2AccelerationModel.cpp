@@ -10,7 +10,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 #include "astro/centralBodyAccelerationModel.hpp"
@@ -71,5 +73,208 @@ TEST_CASE("Compute central+J2 acceleration vector for spacecraft around Mercury"
                 == Catch::Approx(expectedAcceleration[2]).epsilon(tolerance));
 }
 
+TEST_CASE("Compute fused central+J2 acceleration vector for spacecraft around Mercury",
+          "[central_gravity, j2_gravity, acceleration, models]")
+{
+    // Benchmark values for test case obtained using the gravityzonal() function in MATLAB.
+
+    // Set expected acceleration vector (central+J2) [m s^-2].
+    Vector expectedAcceleration(3);
+    expectedAcceleration[0] = -6.174568462599339e-02;
+    expectedAcceleration[1] = 3.024518496375884e-01;
+    expectedAcceleration[2] = -1.229017246366501e-01;
+
+    // Set tolerance = error between expected value and computed value.
+    const Real tolerance = 1.0e-15;
+
+    // Set value of gravitational parameter of central body [m^3 s^-2].
+    const Real gravitationalParameter = 2.2032e13;
+
+    // Set the J2 coefficient of the spherical harmonics expansion and the corresponding
+    // equatorial radius [m].
+    const Real equatorialRadius       = 2439.0e3;
+    const Real j2Coefficient          = 0.00006;
+
+    // Set position vector of the orbiting body relative to the origin of the reference frame [m].
+    Vector position(3);
+    position[0] = 1513.3e3;
+    position[1] = -7412.67e3;
+    position[2] = 3012.1e3;
+
+    SECTION("Test sum of accelerations")
+    {
+        const Vector computedAcceleration = computeCentralBodyAndJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(tolerance));
+        }
+    }
+
+    SECTION("Test individual accelerations")
+    {
+        Vector computedCentralBodyAcceleration(3);
+        Vector computedJ2Acceleration(3);
+        const Vector computedAcceleration = computeCentralBodyAndJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient,
+            computedCentralBodyAcceleration, computedJ2Acceleration);
+
+        const Vector expectedCentralBodyAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, position);
+        const Vector expectedJ2Acceleration = computeJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedCentralBodyAcceleration[i]
+                        == Catch::Approx(expectedCentralBodyAcceleration[i]).epsilon(tolerance));
+            REQUIRE(computedJ2Acceleration[i]
+                        == Catch::Approx(expectedJ2Acceleration[i]).epsilon(tolerance));
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(tolerance));
+        }
+    }
+
+    SECTION("Test batch of positions")
+    {
+        // Generate a batch that spans multiple blocks, with positions scattered over the sphere.
+        const std::size_t numberOfPositions = 150;
+        std::vector<Vector> positionColumns(3, Vector(numberOfPositions));
+        for (std::size_t j = 0; j < numberOfPositions; ++j)
+        {
+            const Real scale = 1.0 + 0.01 * static_cast<Real>(j);
+            const Real angle = 0.1 * static_cast<Real>(j);
+            positionColumns[0][j] = scale * position[0] * std::cos(angle);
+            positionColumns[1][j] = scale * position[1];
+            positionColumns[2][j] = scale * position[2] * std::sin(angle);
+        }
+
+        std::vector<Vector> accelerationColumns(3, Vector(numberOfPositions));
+        const Real* positions[3];
+        Real* accelerations[3];
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            positions[k] = positionColumns[k].data();
+            accelerations[k] = accelerationColumns[k].data();
+        }
+
+        computeCentralBodyAndJ2Acceleration(gravitationalParameter, positions,
+                                            equatorialRadius, j2Coefficient,
+                                            accelerations, numberOfPositions);
+
+        for (std::size_t j = 0; j < numberOfPositions; ++j)
+        {
+            Vector singlePosition(3);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                singlePosition[k] = positionColumns[k][j];
+            }
+            const Vector expectedSingleAcceleration = computeCentralBodyAndJ2Acceleration(
+                gravitationalParameter, singlePosition, equatorialRadius, j2Coefficient);
+
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(accelerations[k][j] == expectedSingleAcceleration[k]);
+            }
+        }
+
+        // Check that the computation can be performed in-place.
+        Real* inPlace[3];
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            inPlace[k] = positionColumns[k].data();
+        }
+        computeCentralBodyAndJ2Acceleration(gravitationalParameter, inPlace,
+                                            equatorialRadius, j2Coefficient,
+                                            inPlace, numberOfPositions);
+
+        for (std::size_t j = 0; j < numberOfPositions; ++j)
+        {
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(positionColumns[k][j] == accelerationColumns[k][j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Compute gradient of J2 acceleration with respect to position",
+          "[j2_gravity, acceleration, models]")
+{
+    // Set value of gravitational parameter, equatorial radius and J2 coefficient of Mercury
+    // [m^3 s^-2, m, -].
+    const Real gravitationalParameter = 2.2032e13;
+    const Real equatorialRadius = 2439.0e3;
+    const Real j2Coefficient = 0.00006;
+
+    // Set positions of the body [m], including positions above the poles and in the equatorial
+    // plane.
+    const Real positions[3][3] = {{1513.3e3, -7412.67e3, 3012.1e3},
+                                  {0.0, 0.0, 5.0e6},
+                                  {-3.0e6, 4.0e6, 0.0}};
+
+    for (int k = 0; k < 3; ++k)
+    {
+        const Vector position(positions[k], positions[k] + 3);
+
+        Real gradient[3][3];
+        computeJ2AccelerationGradient(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient, gradient);
+
+        // Compute gradient using central differences [m].
+        const Real stepSize = 100.0;
+        Real maximumGradient = 0.0;
+        Real maximumError = 0.0;
+        for (int j = 0; j < 3; ++j)
+        {
+            Vector forwardPosition = position;
+            Vector backwardPosition = position;
+            forwardPosition[j] += stepSize;
+            backwardPosition[j] -= stepSize;
+            const Vector forwardAcceleration = computeJ2Acceleration(
+                gravitationalParameter, forwardPosition, equatorialRadius, j2Coefficient);
+            const Vector backwardAcceleration = computeJ2Acceleration(
+                gravitationalParameter, backwardPosition, equatorialRadius, j2Coefficient);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                const Real finiteDifference
+                    = (forwardAcceleration[i] - backwardAcceleration[i]) / (2.0 * stepSize);
+                maximumGradient = std::max(maximumGradient, std::fabs(gradient[i][j]));
+                maximumError
+                    = std::max(maximumError, std::fabs(gradient[i][j] - finiteDifference));
+            }
+        }
+        REQUIRE(maximumError <= 1.0e-7 * maximumGradient);
+
+        // The gradient is symmetric and its trace is zero, since the J2 potential satisfies
+        // Laplace's equation.
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                REQUIRE(std::fabs(gradient[i][j] - gradient[j][i])
+                            <= 1.0e-15 * maximumGradient);
+            }
+        }
+        REQUIRE(std::fabs(gradient[0][0] + gradient[1][1] + gradient[2][2])
+                    <= 1.0e-14 * maximumGradient);
+
+        // The partial derivative of the acceleration wrt the J2-coefficient is the acceleration
+        // for a unit J2-coefficient.
+        const Vector unitJ2Acceleration
+            = computeJ2Acceleration(gravitationalParameter, position, equatorialRadius, 1.0);
+        const Vector j2Acceleration = computeJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, j2Coefficient);
+        for (int i = 0; i < 3; ++i)
+        {
+            REQUIRE(j2Coefficient * unitJ2Acceleration[i]
+                        == Catch::Approx(j2Acceleration[i]).epsilon(1.0e-15));
+        }
+    }
+}
+
 } // namespace tests
 } // namespace astro
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef int Integer;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Compute Stumpff functions", "[stumpff-functions]")
+{
+    SECTION("Test limit case (psi = 0)")
+    {
+        REQUIRE(computeStumpffFunctionC2(0.0) == 0.5);
+        REQUIRE(computeStumpffFunctionC3(0.0) == Catch::Approx(1.0 / 6.0));
+    }
+
+    SECTION("Test series and closed-form expressions")
+    {
+        // Compare the series (|psi| < 1) against the closed-form expressions and check that the
+        // closed-form expressions (|psi| >= 1) match the direct evaluation.
+        const Real psis[6] = {0.5, -0.5, 1.0, -1.0, 40.0, -40.0};
+
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            const Real psi = psis[i];
+            const Real expectedC2 = psi > 0.0
+                ? (1.0 - std::cos(std::sqrt(psi))) / psi
+                : (std::cosh(std::sqrt(-psi)) - 1.0) / (-psi);
+            const Real expectedC3 = psi > 0.0
+                ? (std::sqrt(psi) - std::sin(std::sqrt(psi))) / std::sqrt(psi * psi * psi)
+                : (std::sinh(std::sqrt(-psi)) - std::sqrt(-psi)) / std::sqrt(-psi * psi * psi);
+
+            REQUIRE(computeStumpffFunctionC2(psi) == Catch::Approx(expectedC2).epsilon(1.0e-14));
+            REQUIRE(computeStumpffFunctionC3(psi) == Catch::Approx(expectedC3).epsilon(1.0e-14));
+        }
+    }
+}
+
+TEST_CASE("Propagate Kepler orbit", "[kepler-propagator]")
+{
+    SECTION("Test elliptical orbit using Vallado data")
+    {
+        // The benchmark data is obtained from (Vallado, 2007), Example 2-4.
+
+        // Set Earth gravitational parameter [km^3 s^-2].
+        const Real earthGravitationalParameter = 398600.4418;
+
+        // Set initial Cartesian state [km, km/s].
+        Vector initialState(6);
+        initialState[xPositionIndex] = 1131.340;
+        initialState[yPositionIndex] = -2282.343;
+        initialState[zPositionIndex] = 6672.423;
+        initialState[xVelocityIndex] = -5.64305;
+        initialState[yVelocityIndex] = 4.30333;
+        initialState[zVelocityIndex] = 2.42879;
+
+        // Set expected Cartesian state after 40 minutes [km, km/s].
+        Vector expectedState(6);
+        expectedState[xPositionIndex] = -4219.7527;
+        expectedState[yPositionIndex] = 4363.0292;
+        expectedState[zPositionIndex] = -3958.7666;
+        expectedState[xVelocityIndex] = 3.689866;
+        expectedState[yVelocityIndex] = -1.916735;
+        expectedState[zVelocityIndex] = -6.112511;
+
+        const Vector computedState
+            = propagateKeplerOrbit(initialState, earthGravitationalParameter, 40.0 * 60.0);
+
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            REQUIRE(computedState[i] == Catch::Approx(expectedState[i]).epsilon(1.0e-6));
+        }
+    }
+
+    // Set Earth gravitational parameter [m^3 s^-2].
+    const Real earthGravitationalParameter = 3.986004415e14;
+
+    SECTION("Test elliptical and hyperbolic orbits against conversion chain")
+    {
+        // Set Keplerian elements of elliptical (LEO, GTO) and hyperbolic orbits [m, -, rad].
+        const Real keplerianStates[4][6]
+            = {{7.0e6, 0.001, 0.9, 0.3, 1.2, 0.4},
+               {2.4e7, 0.73, 0.12, 4.0, 2.0, 3.0},
+               {-2.0e7, 1.4, 1.1, 5.0, 0.1, -0.8},
+               {-1.0e6, 12.0, 2.5, 1.0, 3.0, 0.2}};
+        const Real timesOfFlight[4] = {3000.0, -20000.0, 7200.0, 500.0};
+
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            const Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const Vector initialState = convertKeplerianToCartesianElements(
+                keplerianState, earthGravitationalParameter);
+
+            // Compute expected state by advancing the mean anomaly.
+            const Real semiMajorAxis = keplerianState[semiMajorAxisIndex];
+            const Real eccentricity = keplerianState[eccentricityIndex];
+            const Real meanMotion = std::sqrt(earthGravitationalParameter
+                                              / std::fabs(semiMajorAxis * semiMajorAxis
+                                                          * semiMajorAxis));
+            const Real meanAnomaly
+                = convertEccentricAnomalyToMeanAnomaly(
+                    convertTrueAnomalyToEccentricAnomaly(keplerianState[trueAnomalyIndex],
+                                                         eccentricity),
+                    eccentricity)
+                  + meanMotion * timesOfFlight[i];
+            const Real eccentricAnomaly = eccentricity < 1.0
+                ? convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricity, meanAnomaly)
+                : convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricity, meanAnomaly);
+
+            Vector expectedKeplerianState = keplerianState;
+            expectedKeplerianState[trueAnomalyIndex]
+                = convertEccentricAnomalyToTrueAnomaly(eccentricAnomaly, eccentricity);
+            const Vector expectedState = convertKeplerianToCartesianElements(
+                expectedKeplerianState, earthGravitationalParameter);
+
+            const KeplerPropagator<Real, Vector> propagator(initialState,
+                                                            earthGravitationalParameter);
+            const Vector computedState = propagator.propagate(timesOfFlight[i]);
+
+            REQUIRE(propagator.getSemiMajorAxisReciprocal()
+                        == Catch::Approx(1.0 / semiMajorAxis).epsilon(1.0e-12));
+
+            for (unsigned int j = 0; j < 6; ++j)
+            {
+                REQUIRE(computedState[j] == Catch::Approx(expectedState[j]).epsilon(1.0e-10));
+            }
+        }
+    }
+
+    SECTION("Test parabolic orbit against Barker's equation")
+    {
+        // Set semi-latus rectum [m] and true anomalies [rad].
+        const Real semiLatusRectum = 1.0e7;
+        const Real initialTrueAnomaly = -0.5;
+        const Real finalTrueAnomaly = 1.5;
+
+        Vector keplerianState(6);
+        keplerianState[semiLatusRectumIndex] = semiLatusRectum;
+        keplerianState[eccentricityIndex] = 1.0;
+        keplerianState[inclinationIndex] = 0.4;
+        keplerianState[argumentOfPeriapsisIndex] = 1.0;
+        keplerianState[longitudeOfAscendingNodeIndex] = 2.0;
+        keplerianState[trueAnomalyIndex] = initialTrueAnomaly;
+        const Vector initialState = convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter);
+
+        keplerianState[trueAnomalyIndex] = finalTrueAnomaly;
+        const Vector expectedState = convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter);
+
+        // Compute time-of-flight using Barker's equation.
+        const Real initialD = std::tan(0.5 * initialTrueAnomaly);
+        const Real finalD = std::tan(0.5 * finalTrueAnomaly);
+        const Real timeOfFlight
+            = 0.5 * std::sqrt(semiLatusRectum * semiLatusRectum * semiLatusRectum
+                              / earthGravitationalParameter)
+              * ((finalD + finalD * finalD * finalD / 3.0)
+                 - (initialD + initialD * initialD * initialD / 3.0));
+
+        const Vector computedState
+            = propagateKeplerOrbit(initialState, earthGravitationalParameter, timeOfFlight);
+
+        for (unsigned int j = 0; j < 6; ++j)
+        {
+            REQUIRE(computedState[j] == Catch::Approx(expectedState[j]).epsilon(1.0e-10));
+        }
+    }
+
+    SECTION("Test full orbital period and zero time-of-flight")
+    {
+        const Real keplerianStateArray[6] = {2.4e7, 0.73, 0.12, 4.0, 2.0, 3.0};
+        const Vector keplerianState(keplerianStateArray, keplerianStateArray + 6);
+        const Vector initialState = convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter);
+
+        const Real orbitalPeriod = 2.0 * 3.14159265358979323846
+                                   * std::sqrt(2.4e7 * 2.4e7 * 2.4e7
+                                               / earthGravitationalParameter);
+
+        const KeplerPropagator<Real, Vector> propagator(initialState, earthGravitationalParameter);
+        const Vector computedStateAfterPeriod = propagator.propagate(orbitalPeriod);
+        const Vector computedStateAtEpoch = propagator.propagate(0.0);
+
+        for (unsigned int j = 0; j < 6; ++j)
+        {
+            REQUIRE(computedStateAfterPeriod[j]
+                        == Catch::Approx(initialState[j]).epsilon(1.0e-10));
+            REQUIRE(computedStateAtEpoch[j]
+                        == Catch::Approx(initialState[j]).epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test propagation to multiple epochs")
+    {
+        const Real keplerianStateArray[6] = {-2.0e7, 1.4, 1.1, 5.0, 0.1, -0.8};
+        const Vector keplerianState(keplerianStateArray, keplerianStateArray + 6);
+        const Vector initialState = convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter);
+
+        const KeplerPropagator<Real, Vector> propagator(initialState, earthGravitationalParameter);
+
+        const std::size_t numberOfEpochs = 50;
+        Vector timesOfFlight(numberOfEpochs);
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            timesOfFlight[j] = -10000.0 + 500.0 * static_cast<Real>(j);
+        }
+
+        std::vector<Vector> stateColumns(6, Vector(numberOfEpochs));
+        Real* states[6];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            states[i] = stateColumns[i].data();
+        }
+
+        propagator.propagate(timesOfFlight.data(), states, numberOfEpochs);
+
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            const Vector expectedState = propagator.propagate(timesOfFlight[j]);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                REQUIRE(states[i][j] == expectedState[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Propagate Keplerian elements", "[kepler-propagator]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real pi = 3.14159265358979323846;
+
+    // Set Keplerian elements of circular, LEO, GTO and highly eccentric orbits [m, -, rad].
+    const Real keplerianStates[4][6]
+        = {{7.0e6, 0.0, 0.9, 0.0, 1.2, 0.4},
+           {7.0e6, 0.001, 0.9, 0.3, 1.2, 0.4},
+           {2.4e7, 0.73, 0.12, 4.0, 2.0, 3.0},
+           {4.0e7, 0.97, 1.1, 5.0, 0.1, 6.0}};
+    const Real timesOfFlight[4] = {3000.0, 1.0e5, -20000.0, 7200.0};
+
+    SECTION("Test against Kepler propagator")
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            const Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            Vector propagatedKeplerianState(6);
+            propagateKeplerianElements(keplerianState,
+                                       earthGravitationalParameter,
+                                       timesOfFlight[i],
+                                       propagatedKeplerianState);
+
+            for (unsigned int j = 0; j < 5; ++j)
+            {
+                REQUIRE(propagatedKeplerianState[j] == keplerianState[j]);
+            }
+            REQUIRE(propagatedKeplerianState[trueAnomalyIndex] >= 0.0);
+            REQUIRE(propagatedKeplerianState[trueAnomalyIndex] < 2.0 * pi);
+
+            const Vector computedState = convertKeplerianToCartesianElements(
+                propagatedKeplerianState, earthGravitationalParameter);
+            const Vector expectedState = propagateKeplerOrbit(
+                convertKeplerianToCartesianElements(keplerianState, earthGravitationalParameter),
+                earthGravitationalParameter,
+                timesOfFlight[i]);
+
+            for (unsigned int j = 0; j < 6; ++j)
+            {
+                REQUIRE(computedState[j] == Catch::Approx(expectedState[j]).epsilon(1.0e-10));
+            }
+        }
+    }
+
+    SECTION("Test in-place propagation")
+    {
+        Real keplerianState[6];
+        Real expectedKeplerianState[6];
+        for (unsigned int j = 0; j < 6; ++j)
+        {
+            keplerianState[j] = keplerianStates[2][j];
+        }
+        propagateKeplerianElements(
+            keplerianState, earthGravitationalParameter, timesOfFlight[2], expectedKeplerianState);
+        propagateKeplerianElements(
+            keplerianState, earthGravitationalParameter, timesOfFlight[2], keplerianState);
+
+        for (unsigned int j = 0; j < 6; ++j)
+        {
+            REQUIRE(keplerianState[j] == expectedKeplerianState[j]);
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A. Fundamentals of Astrodynmics and Applications, Third Edition,
+ *    Microcosm Press, Hawthorne, CA, 2007.
+ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/keplerianOrbit.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef int Integer;
+typedef std::vector<Real> Vector;
+
+//! Check that Cartesian elements agree, relative to the position and velocity magnitudes.
+void requireCartesianElementsClose(const Vector& computedState,
+                                   const Vector& expectedState,
+                                   const Real    relativeTolerance)
+{
+    Real positionNormSquared = 0.0;
+    Real velocityNormSquared = 0.0;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        const Real position = expectedState[xPositionIndex + i];
+        const Real velocity = expectedState[xVelocityIndex + i];
+        positionNormSquared += position * position;
+        velocityNormSquared += velocity * velocity;
+    }
+    const Real positionNorm = std::sqrt(positionNormSquared);
+    const Real velocityNorm = std::sqrt(velocityNormSquared);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        REQUIRE(std::fabs(computedState[xPositionIndex + i] - expectedState[xPositionIndex + i])
+                    <= relativeTolerance * positionNorm);
+        REQUIRE(std::fabs(computedState[xVelocityIndex + i] - expectedState[xVelocityIndex + i])
+                    <= relativeTolerance * velocityNorm);
+    }
+}
+
+TEST_CASE("Evaluate Keplerian orbit", "[keplerian-orbit]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2].
+    const Real earthGravitationalParameter = 3.986004415e14;
+
+    // Set Keplerian elements of circular, elliptical (LEO, GTO), equatorial and hyperbolic orbits
+    // [m, -, rad].
+    const Real keplerianStates[5][6]
+        = {{7.0e6, 0.0, 0.9, 0.3, 1.2, 0.4},
+           {7.0e6, 0.001, 1.7, 5.5, 4.2, 0.0},
+           {2.4e7, 0.73, 0.12, 4.0, 2.0, 0.0},
+           {4.2e7, 0.1, 0.0, 1.3, 0.0, 0.0},
+           {-2.0e7, 1.4, 1.1, 5.0, 0.1, 0.0}};
+
+    const std::size_t numberOfAnomalies = 37;
+
+    SECTION("Test true anomalies against Keplerian-to-Cartesian conversion")
+    {
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const KeplerianOrbit<Real, Vector> orbit(keplerianState, earthGravitationalParameter);
+
+            // Stay within the asymptotes of the hyperbolic orbit.
+            const Real maximumTrueAnomaly = keplerianState[eccentricityIndex] > 1.0
+                ? 0.95 * std::acos(-1.0 / keplerianState[eccentricityIndex]) : 3.1;
+
+            for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+            {
+                keplerianState[trueAnomalyIndex]
+                    = maximumTrueAnomaly * (2.0 * static_cast<Real>(j) / (numberOfAnomalies - 1)
+                                           - 1.0);
+                const Vector expectedState = convertKeplerianToCartesianElements(
+                    keplerianState, earthGravitationalParameter);
+                const Vector computedState
+                    = orbit.computeCartesianElements(keplerianState[trueAnomalyIndex]);
+
+                requireCartesianElementsClose(computedState, expectedState, 1.0e-15);
+            }
+        }
+    }
+
+    SECTION("Test mean anomalies against conversion chain")
+    {
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const Real eccentricity = keplerianState[eccentricityIndex];
+            const KeplerianOrbit<Real, Vector> orbit(keplerianState, earthGravitationalParameter);
+
+            for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+            {
+                const Real meanAnomaly = -6.0 + 0.5 * static_cast<Real>(j);
+                const Real eccentricAnomaly = eccentricity < 1.0
+                    ? convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                        eccentricity, meanAnomaly)
+                    : convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                        eccentricity, meanAnomaly);
+                keplerianState[trueAnomalyIndex]
+                    = convertEccentricAnomalyToTrueAnomaly(eccentricAnomaly, eccentricity);
+
+                const Vector expectedState = convertKeplerianToCartesianElements(
+                    keplerianState, earthGravitationalParameter);
+                const Vector computedState
+                    = orbit.computeCartesianElementsFromMeanAnomaly(meanAnomaly);
+
+                requireCartesianElementsClose(computedState, expectedState, 1.0e-13);
+            }
+        }
+    }
+
+    SECTION("Test parabolic orbit")
+    {
+        Vector keplerianState(6);
+        keplerianState[semiLatusRectumIndex] = 1.0e7;
+        keplerianState[eccentricityIndex] = 1.0;
+        keplerianState[inclinationIndex] = 0.4;
+        keplerianState[argumentOfPeriapsisIndex] = 1.0;
+        keplerianState[longitudeOfAscendingNodeIndex] = 2.0;
+        keplerianState[trueAnomalyIndex] = 1.5;
+
+        const KeplerianOrbit<Real, Vector> orbit(keplerianState, earthGravitationalParameter);
+        const Vector expectedState = convertKeplerianToCartesianElements(
+            keplerianState, earthGravitationalParameter);
+        const Vector computedState = orbit.computeCartesianElements(1.5);
+
+        REQUIRE(orbit.getSemiLatusRectum() == 1.0e7);
+        requireCartesianElementsClose(computedState, expectedState, 1.0e-15);
+    }
+
+    SECTION("Test batch evaluation")
+    {
+        const Vector keplerianState(keplerianStates[2], keplerianStates[2] + 6);
+        const KeplerianOrbit<Real, Vector> orbit(keplerianState, earthGravitationalParameter);
+
+        Vector anomalies(numberOfAnomalies);
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            anomalies[j] = -3.0 + 0.2 * static_cast<Real>(j);
+        }
+
+        std::vector<Vector> trueAnomalyColumns(6, Vector(numberOfAnomalies));
+        std::vector<Vector> meanAnomalyColumns(6, Vector(numberOfAnomalies));
+        Real* trueAnomalyStates[6];
+        Real* meanAnomalyStates[6];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            trueAnomalyStates[i] = trueAnomalyColumns[i].data();
+            meanAnomalyStates[i] = meanAnomalyColumns[i].data();
+        }
+
+        orbit.computeCartesianElements(anomalies.data(), trueAnomalyStates, numberOfAnomalies);
+        orbit.computeCartesianElementsFromMeanAnomaly(
+            anomalies.data(), meanAnomalyStates, numberOfAnomalies);
+
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            const Vector expectedTrueAnomalyState = orbit.computeCartesianElements(anomalies[j]);
+            const Vector expectedMeanAnomalyState
+                = orbit.computeCartesianElementsFromMeanAnomaly(anomalies[j]);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                REQUIRE(trueAnomalyStates[i][j] == expectedTrueAnomalyState[i]);
+                REQUIRE(meanAnomalyStates[i][j] == expectedMeanAnomalyState[i]);
+            }
+        }
+
+        // Test in-place evaluation, with the anomalies stored in the x-position array.
+        Vector inPlaceColumn = anomalies;
+        trueAnomalyStates[xPositionIndex] = inPlaceColumn.data();
+        orbit.computeCartesianElements(inPlaceColumn.data(), trueAnomalyStates, numberOfAnomalies);
+
+        for (std::size_t j = 0; j < numberOfAnomalies; ++j)
+        {
+            REQUIRE(inPlaceColumn[j]
+                        == orbit.computeCartesianElements(anomalies[j])[xPositionIndex]);
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/lambertSolver.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Compute Lambert time-of-flight", "[lambert-solver]")
+{
+    // The time-of-flight is continuous across the thresholds between the Battin, Lagrange and
+    // Lancaster expressions.
+    const Real lambdas[3] = {-0.6, 0.2, 0.9};
+    const Real thresholds[4] = {0.8, 0.99, 1.01, 1.2};
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            const Real below = computeLambertTimeOfFlight(thresholds[j] - 1.0e-9, lambdas[i]);
+            const Real above = computeLambertTimeOfFlight(thresholds[j] + 1.0e-9, lambdas[i]);
+            REQUIRE(below == Catch::Approx(above).epsilon(1.0e-7));
+        }
+    }
+
+    // The minimum-energy transfer (x = 0) has time-of-flight acos(lambda) + lambda sqrt(1 - l^2).
+    for (int i = 0; i < 3; ++i)
+    {
+        const Real lambda = lambdas[i];
+        REQUIRE(computeLambertTimeOfFlight(0.0, lambda)
+                == Catch::Approx(std::acos(lambda) + lambda * std::sqrt(1.0 - lambda * lambda))
+                       .epsilon(1.0e-14));
+    }
+
+    // The parabolic transfer (x = 1) has time-of-flight 2 (1 - lambda^3) / 3.
+    for (int i = 0; i < 3; ++i)
+    {
+        const Real lambda = lambdas[i];
+        REQUIRE(computeLambertTimeOfFlight(1.0, lambda)
+                == Catch::Approx(2.0 / 3.0 * (1.0 - lambda * lambda * lambda)).epsilon(1.0e-14));
+    }
+}
+
+TEST_CASE("Solve Lambert problem", "[lambert-solver]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+
+    // Set Keplerian elements (a, e, i, w, RAAN, TA) and time-of-flight as fraction of the orbital
+    // period (or of 1 hour, for hyperbolic orbits), covering short and long-way transfers,
+    // prograde and retrograde transfers and elliptical and hyperbolic transfers.
+    const Real cases[8][7] = {{7.0e6, 0.01, 0.5, 0.2, 0.3, 0.1, 0.2},
+                              {7.0e6, 0.01, 0.5, 0.2, 0.3, 0.1, 0.7},
+                              {2.4e7, 0.7, 0.1, 1.2, 4.0, 2.5, 0.3},
+                              {2.4e7, 0.7, 0.1, 1.2, 4.0, 0.3, 0.9},
+                              {4.2e7, 0.0001, 0.0001, 0.0, 0.0, 1.0, 0.45},
+                              {1.0e7, 0.3, 2.6, 0.5, 1.0, 0.5, 0.2},
+                              {1.0e7, 0.3, 2.6, 0.5, 1.0, 0.5, 0.8},
+                              {-2.0e7, 1.5, 0.7, 0.4, 0.2, -0.5, 0.5}};
+
+    for (int n = 0; n < 8; ++n)
+    {
+        Vector keplerianElements(cases[n], cases[n] + 6);
+        const Vector state
+            = convertKeplerianToCartesianElements(keplerianElements, earthGravitationalParameter);
+        const Real semiMajorAxis = cases[n][0];
+        const Real timeOfFlight = cases[n][6]
+            * (semiMajorAxis > 0.0
+                ? 2.0 * 3.14159265358979323846
+                  * std::sqrt(semiMajorAxis * semiMajorAxis * semiMajorAxis
+                              / earthGravitationalParameter)
+                : 3600.0);
+        const Vector arrivalState
+            = KeplerPropagator<Real, Vector>(state, earthGravitationalParameter)
+                  .propagate(timeOfFlight);
+
+        const Vector departurePosition(state.begin(), state.begin() + 3);
+        const Vector arrivalPosition(arrivalState.begin(), arrivalState.begin() + 3);
+        Vector departureVelocity(3);
+        Vector arrivalVelocity(3);
+
+        // The transfer is retrograde for inclinations larger than 90 degrees.
+        solveLambertProblem(departurePosition,
+                            arrivalPosition,
+                            timeOfFlight,
+                            earthGravitationalParameter,
+                            departureVelocity,
+                            arrivalVelocity,
+                            cases[n][2] > 0.5 * 3.14159265358979323846);
+
+        for (int k = 0; k < 3; ++k)
+        {
+            REQUIRE(departureVelocity[k]
+                    == Catch::Approx(state[xVelocityIndex + k]).epsilon(1.0e-9).scale(1.0e3));
+            REQUIRE(arrivalVelocity[k]
+                    == Catch::Approx(arrivalState[xVelocityIndex + k])
+                           .epsilon(1.0e-9).scale(1.0e3));
+        }
+    }
+}
+
+TEST_CASE("Compute porkchop grid", "[lambert-solver]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+
+    // Transfers from a low Earth orbit to a medium Earth orbit.
+    Vector departureElements(6, 0.0);
+    departureElements[semiMajorAxisIndex] = 7.0e6;
+    departureElements[inclinationIndex] = 0.3;
+    Vector arrivalElements(6, 0.0);
+    arrivalElements[semiMajorAxisIndex] = 2.0e7;
+    arrivalElements[inclinationIndex] = 0.5;
+    arrivalElements[longitudeOfAscendingNodeIndex] = 1.0;
+
+    const KeplerPropagator<Real, Vector> departurePropagator(
+        convertKeplerianToCartesianElements(departureElements, earthGravitationalParameter),
+        earthGravitationalParameter);
+    const KeplerPropagator<Real, Vector> arrivalPropagator(
+        convertKeplerianToCartesianElements(arrivalElements, earthGravitationalParameter),
+        earthGravitationalParameter);
+
+    const std::size_t numberOfDepartureEpochs = 70;
+    const std::size_t numberOfArrivalEpochs = 90;
+    Vector departureEpochs(numberOfDepartureEpochs);
+    Vector arrivalEpochs(numberOfArrivalEpochs);
+    std::vector<Vector> departureColumns(6, Vector(numberOfDepartureEpochs));
+    std::vector<Vector> arrivalColumns(6, Vector(numberOfArrivalEpochs));
+    for (std::size_t i = 0; i < numberOfDepartureEpochs; ++i)
+    {
+        departureEpochs[i] = 60.0 * static_cast<Real>(i);
+        const Vector state = departurePropagator.propagate(departureEpochs[i]);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            departureColumns[k][i] = state[k];
+        }
+    }
+    for (std::size_t j = 0; j < numberOfArrivalEpochs; ++j)
+    {
+        arrivalEpochs[j] = 3000.0 + 77.0 * static_cast<Real>(j);
+        const Vector state = arrivalPropagator.propagate(arrivalEpochs[j]);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            arrivalColumns[k][j] = state[k];
+        }
+    }
+
+    const Real* departureStates[6];
+    const Real* arrivalStates[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        departureStates[k] = departureColumns[k].data();
+        arrivalStates[k] = arrivalColumns[k].data();
+    }
+
+    for (std::size_t numberOfThreads = 1; numberOfThreads <= 3; numberOfThreads += 2)
+    {
+        Vector departureExcessVelocities(numberOfDepartureEpochs * numberOfArrivalEpochs);
+        Vector arrivalExcessVelocities(numberOfDepartureEpochs * numberOfArrivalEpochs);
+        computePorkchopGrid(departureEpochs.data(),
+                            departureStates,
+                            numberOfDepartureEpochs,
+                            arrivalEpochs.data(),
+                            arrivalStates,
+                            numberOfArrivalEpochs,
+                            earthGravitationalParameter,
+                            departureExcessVelocities.data(),
+                            arrivalExcessVelocities.data(),
+                            numberOfThreads);
+
+        for (std::size_t i = 0; i < numberOfDepartureEpochs; ++i)
+        {
+            for (std::size_t j = 0; j < numberOfArrivalEpochs; ++j)
+            {
+                const std::size_t index = i * numberOfArrivalEpochs + j;
+                const Real timeOfFlight = arrivalEpochs[j] - departureEpochs[i];
+                if (timeOfFlight <= 0.0)
+                {
+                    REQUIRE(std::isnan(departureExcessVelocities[index]));
+                    REQUIRE(std::isnan(arrivalExcessVelocities[index]));
+                    continue;
+                }
+
+                Vector departurePosition(3);
+                Vector arrivalPosition(3);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    departurePosition[k] = departureColumns[k][i];
+                    arrivalPosition[k] = arrivalColumns[k][j];
+                }
+                Vector departureVelocity(3);
+                Vector arrivalVelocity(3);
+                solveLambertProblem(departurePosition,
+                                    arrivalPosition,
+                                    timeOfFlight,
+                                    earthGravitationalParameter,
+                                    departureVelocity,
+                                    arrivalVelocity);
+
+                Real departureExcessVelocitySquared = 0.0;
+                Real arrivalExcessVelocitySquared = 0.0;
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    departureExcessVelocitySquared
+                        += (departureVelocity[k] - departureColumns[k + 3][i])
+                           * (departureVelocity[k] - departureColumns[k + 3][i]);
+                    arrivalExcessVelocitySquared
+                        += (arrivalVelocity[k] - arrivalColumns[k + 3][j])
+                           * (arrivalVelocity[k] - arrivalColumns[k + 3][j]);
+                }
+                REQUIRE(departureExcessVelocities[index]
+                        == Catch::Approx(std::sqrt(departureExcessVelocitySquared)));
+                REQUIRE(arrivalExcessVelocities[index]
+                        == Catch::Approx(std::sqrt(arrivalExcessVelocitySquared)));
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/modifiedEquinoctialElementConversions.hpp"
+#include "astro/orbitalElementConversions.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+// Set Earth gravitational parameter [m^3 s^-2].
+const Real earthGravitationalParameter = 3.986004415e14;
+
+// Set Keplerian elements of general (LEO, GTO, Molniya), hyperbolic and near-singular orbits
+// [m, -, rad].
+const std::size_t numberOfOrbits = 7;
+const Real keplerianStates[numberOfOrbits][6]
+    = {{7.0e6, 0.001, 0.9, 0.3, 1.2, 0.4},
+       {2.4e7, 0.73, 0.12, 4.0, 2.0, 3.0},
+       {2.66e7, 0.74, 1.1, 4.7, 5.5, 0.2},
+       {-2.0e7, 1.4, 1.1, 5.0, 0.1, 0.8},
+       {4.2164e7, 1.0e-9, 1.0e-9, 1.0, 2.0, 3.0},
+       {4.2164e7, 0.0, 0.0, 0.0, 0.0, 1.5},
+       {7.0e6, 0.0, 1.7, 0.0, 4.2, 2.5}};
+
+//! Check that Cartesian elements agree, relative to the position and velocity magnitudes.
+void requireCartesianStatesClose(const Vector& computedState,
+                                 const Vector& expectedState,
+                                 const Real    relativeTolerance)
+{
+    const Real positionNorm = std::sqrt(expectedState[0] * expectedState[0]
+                                        + expectedState[1] * expectedState[1]
+                                        + expectedState[2] * expectedState[2]);
+    const Real velocityNorm = std::sqrt(expectedState[3] * expectedState[3]
+                                        + expectedState[4] * expectedState[4]
+                                        + expectedState[5] * expectedState[5]);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        REQUIRE(std::fabs(computedState[i] - expectedState[i])
+                    <= relativeTolerance * positionNorm);
+        REQUIRE(std::fabs(computedState[i + 3] - expectedState[i + 3])
+                    <= relativeTolerance * velocityNorm);
+    }
+}
+
+TEST_CASE("Convert Keplerian elements to modified equinoctial elements", "[mee]")
+{
+    const Real pi = 3.14159265358979323846;
+
+    SECTION("Test definition of elements")
+    {
+        const Vector keplerianState(keplerianStates[1], keplerianStates[1] + 6);
+        const Vector computedState = convertKeplerianToModifiedEquinoctialElements(keplerianState);
+
+        REQUIRE(computedState[semiLatusRectumEquinoctialIndex]
+                    == Catch::Approx(2.4e7 * (1.0 - 0.73 * 0.73)).epsilon(1.0e-15));
+        REQUIRE(computedState[fEquinoctialIndex]
+                    == Catch::Approx(0.73 * std::cos(6.0)).epsilon(1.0e-15));
+        REQUIRE(computedState[gEquinoctialIndex]
+                    == Catch::Approx(0.73 * std::sin(6.0)).epsilon(1.0e-15));
+        REQUIRE(computedState[hEquinoctialIndex]
+                    == Catch::Approx(std::tan(0.06) * std::cos(2.0)).epsilon(1.0e-15));
+        REQUIRE(computedState[kEquinoctialIndex]
+                    == Catch::Approx(std::tan(0.06) * std::sin(2.0)).epsilon(1.0e-15));
+        REQUIRE(computedState[trueLongitudeEquinoctialIndex]
+                    == Catch::Approx(9.0 - 2.0 * pi).epsilon(1.0e-15));
+    }
+
+    SECTION("Test round trip through modified equinoctial elements")
+    {
+        for (std::size_t i = 0; i < numberOfOrbits; ++i)
+        {
+            const Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const Vector modifiedEquinoctialState
+                = convertKeplerianToModifiedEquinoctialElements(keplerianState);
+            const Vector computedKeplerianState
+                = convertModifiedEquinoctialToKeplerianElements(modifiedEquinoctialState);
+
+            // The angles of near-singular orbits are not unique, such that the round trip is
+            // checked on the corresponding Cartesian elements.
+            requireCartesianStatesClose(
+                convertKeplerianToCartesianElements(computedKeplerianState,
+                                                    earthGravitationalParameter),
+                convertKeplerianToCartesianElements(keplerianState, earthGravitationalParameter),
+                1.0e-14);
+
+            REQUIRE(computedKeplerianState[semiMajorAxisIndex]
+                        == Catch::Approx(keplerianState[semiMajorAxisIndex]).epsilon(1.0e-14));
+            REQUIRE(std::fabs(computedKeplerianState[eccentricityIndex]
+                              - keplerianState[eccentricityIndex]) <= 1.0e-15);
+            REQUIRE(std::fabs(computedKeplerianState[inclinationIndex]
+                              - keplerianState[inclinationIndex]) <= 1.0e-15);
+        }
+    }
+
+    SECTION("Test limit cases of Keplerian elements")
+    {
+        // Circular, inclined orbit: argument of periapsis is zero and the argument of latitude is
+        // stored as true anomaly.
+        const Vector circularState(keplerianStates[6], keplerianStates[6] + 6);
+        const Vector circularKeplerianState = convertModifiedEquinoctialToKeplerianElements(
+            convertKeplerianToModifiedEquinoctialElements(circularState));
+        REQUIRE(circularKeplerianState[argumentOfPeriapsisIndex] == 0.0);
+        REQUIRE(circularKeplerianState[longitudeOfAscendingNodeIndex]
+                    == Catch::Approx(4.2).epsilon(1.0e-15));
+        REQUIRE(circularKeplerianState[trueAnomalyIndex] == Catch::Approx(2.5).epsilon(1.0e-15));
+
+        // Circular, equatorial orbit: the true longitude is stored as true anomaly.
+        const Vector equatorialState(keplerianStates[5], keplerianStates[5] + 6);
+        const Vector equatorialKeplerianState = convertModifiedEquinoctialToKeplerianElements(
+            convertKeplerianToModifiedEquinoctialElements(equatorialState));
+        REQUIRE(equatorialKeplerianState[argumentOfPeriapsisIndex] == 0.0);
+        REQUIRE(equatorialKeplerianState[longitudeOfAscendingNodeIndex] == 0.0);
+        REQUIRE(equatorialKeplerianState[trueAnomalyIndex]
+                    == Catch::Approx(1.5).epsilon(1.0e-15));
+
+        // Parabolic orbit: semi-latus rectum is stored in place of the semi-major axis.
+        const Real parabolicStateArray[6] = {1.0e7, 1.0, 0.4, 1.0, 2.0, 1.5};
+        const Vector parabolicState(parabolicStateArray, parabolicStateArray + 6);
+        const Vector parabolicModifiedEquinoctialState
+            = convertKeplerianToModifiedEquinoctialElements(parabolicState);
+        REQUIRE(parabolicModifiedEquinoctialState[semiLatusRectumEquinoctialIndex] == 1.0e7);
+        REQUIRE(convertModifiedEquinoctialToKeplerianElements(
+                    parabolicModifiedEquinoctialState)[semiLatusRectumIndex]
+                        == 1.0e7);
+        requireCartesianStatesClose(
+            convertModifiedEquinoctialToCartesianElements(parabolicModifiedEquinoctialState,
+                                                          earthGravitationalParameter),
+            convertKeplerianToCartesianElements(parabolicState, earthGravitationalParameter),
+            1.0e-14);
+    }
+}
+
+TEST_CASE("Convert Cartesian elements to modified equinoctial elements", "[mee]")
+{
+    SECTION("Test against conversion via Keplerian elements")
+    {
+        for (std::size_t i = 0; i < numberOfOrbits; ++i)
+        {
+            const Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const Vector cartesianState
+                = convertKeplerianToCartesianElements(keplerianState, earthGravitationalParameter);
+
+            const Vector expectedState
+                = convertKeplerianToModifiedEquinoctialElements(keplerianState);
+            const Vector computedState = convertCartesianToModifiedEquinoctialElements(
+                cartesianState, earthGravitationalParameter);
+
+            REQUIRE(computedState[semiLatusRectumEquinoctialIndex]
+                        == Catch::Approx(expectedState[semiLatusRectumEquinoctialIndex])
+                               .epsilon(1.0e-14));
+            for (std::size_t j = 1; j < 6; ++j)
+            {
+                REQUIRE(std::fabs(computedState[j] - expectedState[j]) <= 1.0e-13);
+            }
+        }
+    }
+
+    SECTION("Test round trip through modified equinoctial elements")
+    {
+        for (std::size_t i = 0; i < numberOfOrbits; ++i)
+        {
+            const Vector keplerianState(keplerianStates[i], keplerianStates[i] + 6);
+            const Vector cartesianState
+                = convertKeplerianToCartesianElements(keplerianState, earthGravitationalParameter);
+
+            const Vector computedState = convertModifiedEquinoctialToCartesianElements(
+                convertCartesianToModifiedEquinoctialElements(cartesianState,
+                                                              earthGravitationalParameter),
+                earthGravitationalParameter);
+
+            requireCartesianStatesClose(computedState, cartesianState, 1.0e-14);
+        }
+    }
+
+    SECTION("Test exactly circular, equatorial orbit")
+    {
+        const Real radius = 4.2164e7;
+        const Real speed = std::sqrt(earthGravitationalParameter / radius);
+        const Real cartesianStateArray[6] = {0.0, radius, 0.0, -speed, 0.0, 0.0};
+        const Vector cartesianState(cartesianStateArray, cartesianStateArray + 6);
+
+        const Vector computedState = convertCartesianToModifiedEquinoctialElements(
+            cartesianState, earthGravitationalParameter);
+
+        REQUIRE(computedState[semiLatusRectumEquinoctialIndex]
+                    == Catch::Approx(radius).epsilon(1.0e-15));
+        REQUIRE(std::fabs(computedState[fEquinoctialIndex]) <= 1.0e-15);
+        REQUIRE(std::fabs(computedState[gEquinoctialIndex]) <= 1.0e-15);
+        REQUIRE(computedState[hEquinoctialIndex] == 0.0);
+        REQUIRE(computedState[kEquinoctialIndex] == 0.0);
+        REQUIRE(computedState[trueLongitudeEquinoctialIndex]
+                    == Catch::Approx(0.5 * 3.14159265358979323846).epsilon(1.0e-15));
+    }
+}
+
+TEST_CASE("Convert batch of modified equinoctial elements", "[mee]")
+{
+    // Set up batch that spans more than one block.
+    const std::size_t numberOfStates = 150;
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    for (std::size_t j = 0; j < numberOfStates; ++j)
+    {
+        Vector keplerianState(keplerianStates[j % numberOfOrbits],
+                              keplerianStates[j % numberOfOrbits] + 6);
+        keplerianState[trueAnomalyIndex] += 0.01 * static_cast<Real>(j);
+        const Vector cartesianState
+            = convertKeplerianToCartesianElements(keplerianState, earthGravitationalParameter);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            cartesianColumns[k][j] = cartesianState[k];
+        }
+    }
+
+    const Real* cartesianElements[6];
+    std::vector<Vector> modifiedEquinoctialColumns(6, Vector(numberOfStates));
+    std::vector<Vector> roundTripColumns(6, Vector(numberOfStates));
+    Real* modifiedEquinoctialElements[6];
+    const Real* constModifiedEquinoctialElements[6];
+    Real* roundTripElements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        cartesianElements[k] = cartesianColumns[k].data();
+        modifiedEquinoctialElements[k] = modifiedEquinoctialColumns[k].data();
+        constModifiedEquinoctialElements[k] = modifiedEquinoctialColumns[k].data();
+        roundTripElements[k] = roundTripColumns[k].data();
+    }
+
+    convertCartesianToModifiedEquinoctialElements(
+        cartesianElements, modifiedEquinoctialElements, numberOfStates,
+        earthGravitationalParameter);
+    convertModifiedEquinoctialToCartesianElements(
+        constModifiedEquinoctialElements, roundTripElements, numberOfStates,
+        earthGravitationalParameter);
+
+    SECTION("Test that batch conversions match single-state conversions")
+    {
+        for (std::size_t j = 0; j < numberOfStates; ++j)
+        {
+            Vector cartesianState(6);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                cartesianState[k] = cartesianColumns[k][j];
+            }
+            const Vector expectedState = convertCartesianToModifiedEquinoctialElements(
+                cartesianState, earthGravitationalParameter);
+            const Vector expectedRoundTripState = convertModifiedEquinoctialToCartesianElements(
+                expectedState, earthGravitationalParameter);
+
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                REQUIRE(modifiedEquinoctialElements[k][j] == expectedState[k]);
+                REQUIRE(roundTripElements[k][j] == expectedRoundTripState[k]);
+            }
+        }
+    }
+
+    SECTION("Test in-place batch conversions")
+    {
+        std::vector<Vector> inPlaceColumns = cartesianColumns;
+        Real* inPlaceElements[6];
+        const Real* constInPlaceElements[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            inPlaceElements[k] = inPlaceColumns[k].data();
+            constInPlaceElements[k] = inPlaceColumns[k].data();
+        }
+
+        convertCartesianToModifiedEquinoctialElements(
+            constInPlaceElements, inPlaceElements, numberOfStates, earthGravitationalParameter);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t j = 0; j < numberOfStates; ++j)
+            {
+                REQUIRE(inPlaceColumns[k][j] == modifiedEquinoctialColumns[k][j]);
+            }
+        }
+
+        convertModifiedEquinoctialToCartesianElements(
+            constInPlaceElements, inPlaceElements, numberOfStates, earthGravitationalParameter);
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t j = 0; j < numberOfStates; ++j)
+            {
+                REQUIRE(inPlaceColumns[k][j] == roundTripColumns[k][j]);
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Walker, M.J.H., Ireland, B., Owens, J. A Set of Modified Equinoctial Orbit Elements. Celestial
+ *      Mechanics, 36(4), 409-419, 1985.
+ */
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "astro/integrators.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/monteCarloEnsemble.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Ensemble stored as structure-of-arrays.
+struct Ensemble
+{
+    explicit Ensemble(const std::size_t numberOfMembers)
+        : columns(6, Vector(numberOfMembers))
+    {
+        setPointers();
+    }
+
+    explicit Ensemble(const std::vector<Vector>& columns)
+        : columns(columns)
+    {
+        setPointers();
+    }
+
+    Ensemble(const Ensemble&) = delete;
+    Ensemble& operator=(const Ensemble&) = delete;
+
+    void setPointers()
+    {
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            states[k] = columns[k].data();
+            constStates[k] = columns[k].data();
+        }
+    }
+
+    std::vector<Vector> columns;
+    Real* states[6];
+    const Real* constStates[6];
+};
+
+//! Central body and J2 dynamics of single Cartesian state.
+struct CentralBodyAndJ2Dynamics
+{
+    void operator()(const Real, const Real* const state, Real* const stateDerivative) const
+    {
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            stateDerivative[i] = state[i + 3];
+        }
+        computeCentralBodyAndJ2Acceleration(
+            gravitationalParameter, state, equatorialRadius, j2Coefficient, stateDerivative + 3);
+    }
+
+    Real gravitationalParameter;
+    Real equatorialRadius;
+    Real j2Coefficient;
+};
+
+TEST_CASE("Generate random numbers using Philox4x32-10", "[monte-carlo-ensemble]")
+{
+    SECTION("Test known-answer vectors")
+    {
+        // The known-answer vectors are obtained from the Random123 library (Salmon et al., 2011).
+        const std::uint32_t counters[3][4]
+            = {{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+               {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+               {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+        const std::uint32_t keys[3][2]
+            = {{0x00000000, 0x00000000},
+               {0xffffffff, 0xffffffff},
+               {0xa4093822, 0x299f31d0}};
+        const std::uint32_t expectedRandomNumbers[3][4]
+            = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+               {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+               {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            std::uint32_t randomNumbers[4];
+            generatePhilox4x32RandomNumbers(counters[i], keys[i], randomNumbers);
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                REQUIRE(randomNumbers[j] == expectedRandomNumbers[i][j]);
+            }
+        }
+    }
+
+    SECTION("Test uniform limits")
+    {
+        REQUIRE(convertRandomNumberToUniform<Real>(0) > 0.0);
+        REQUIRE(convertRandomNumberToUniform<Real>(0xffffffff) < 1.0);
+        REQUIRE(convertRandomNumberToUniform<float>(0xffffffff) <= 1.0f);
+    }
+
+    SECTION("Test moments of standard normal samples")
+    {
+        const std::uint32_t key[2] = {0x12345678, 0x9abcdef0};
+        const std::size_t numberOfCounters = 25000;
+
+        Real sum = 0.0;
+        Real sumOfSquares = 0.0;
+        for (std::uint32_t i = 0; i < numberOfCounters; ++i)
+        {
+            const std::uint32_t counter[4] = {i, 0, 0, 0};
+            Real samples[4];
+            generateStandardNormalSamples(counter, key, samples);
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                sum += samples[j];
+                sumOfSquares += samples[j] * samples[j];
+            }
+        }
+
+        const Real numberOfSamples = 4.0 * static_cast<Real>(numberOfCounters);
+        const Real mean = sum / numberOfSamples;
+        REQUIRE(std::fabs(mean) < 0.01);
+        REQUIRE(sumOfSquares / numberOfSamples - mean * mean == Catch::Approx(1.0).epsilon(0.02));
+    }
+}
+
+TEST_CASE("Generate ensemble of dispersed states", "[monte-carlo-ensemble]")
+{
+    // Set nominal Cartesian state [m, m/s].
+    const Real nominalState[6] = {7.0e6, 1.0e5, -2.0e5, 100.0, 7.4e3, 1.2e3};
+
+    // Set Cholesky factor of covariance with correlated position and velocity errors [m, m/s].
+    const Real choleskyFactor[6][6]
+        = {{100.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+           {20.0, 80.0, 0.0, 0.0, 0.0, 0.0},
+           {-10.0, 5.0, 50.0, 0.0, 0.0, 0.0},
+           {0.01, 0.0, 0.0, 0.1, 0.0, 0.0},
+           {0.0, -0.02, 0.0, 0.01, 0.1, 0.0},
+           {0.0, 0.0, 0.03, 0.0, 0.0, 0.05}};
+
+    const std::size_t numberOfMembers = 20000;
+    const std::uint64_t seed = 0x0123456789abcdefULL;
+
+    Ensemble ensemble(numberOfMembers);
+    generateEnsembleDispersions(
+        nominalState, choleskyFactor, seed, ensemble.states, numberOfMembers, 1);
+
+    SECTION("Test independence of number of threads")
+    {
+        Ensemble parallelEnsemble(numberOfMembers);
+        generateEnsembleDispersions(
+            nominalState, choleskyFactor, seed, parallelEnsemble.states, numberOfMembers, 4);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t i = 0; i < numberOfMembers; ++i)
+            {
+                REQUIRE(parallelEnsemble.columns[k][i] == ensemble.columns[k][i]);
+            }
+        }
+
+        // A different seed yields a different ensemble.
+        generateEnsembleDispersions(
+            nominalState, choleskyFactor, seed + 1, parallelEnsemble.states, numberOfMembers, 4);
+        REQUIRE(parallelEnsemble.columns[0][0] != ensemble.columns[0][0]);
+    }
+
+    SECTION("Test sample mean and covariance")
+    {
+        Real mean[6];
+        Real covariance[6][6];
+        computeEnsembleStatistics(ensemble.constStates, numberOfMembers, mean, covariance);
+
+        Real expectedCovariance[6][6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t l = 0; l < 6; ++l)
+            {
+                expectedCovariance[k][l] = 0.0;
+                for (std::size_t m = 0; m < 6; ++m)
+                {
+                    expectedCovariance[k][l] += choleskyFactor[k][m] * choleskyFactor[l][m];
+                }
+            }
+        }
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            const Real standardDeviation = std::sqrt(expectedCovariance[k][k]);
+            REQUIRE(std::fabs(mean[k] - nominalState[k]) < 0.05 * standardDeviation);
+
+            for (std::size_t l = 0; l < 6; ++l)
+            {
+                REQUIRE(std::fabs(covariance[k][l] - expectedCovariance[k][l])
+                        < 0.05 * standardDeviation * std::sqrt(expectedCovariance[l][l]));
+            }
+        }
+    }
+}
+
+TEST_CASE("Propagate ensemble of Cartesian states", "[monte-carlo-ensemble]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2], equatorial radius [m] and J2 [-].
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real earthEquatorialRadius = 6.378137e6;
+    const Real earthJ2 = 1.082626925638815e-3;
+
+    const Real nominalState[6] = {7.0e6, 1.0e5, -2.0e5, 100.0, 7.4e3, 1.2e3};
+    const Real choleskyFactor[6][6]
+        = {{1.0e3, 0.0, 0.0, 0.0, 0.0, 0.0},
+           {0.0, 1.0e3, 0.0, 0.0, 0.0, 0.0},
+           {0.0, 0.0, 1.0e3, 0.0, 0.0, 0.0},
+           {0.0, 0.0, 0.0, 1.0, 0.0, 0.0},
+           {0.0, 0.0, 0.0, 0.0, 1.0, 0.0},
+           {0.0, 0.0, 0.0, 0.0, 0.0, 1.0}};
+
+    // Set number of members, such that the last block is padded.
+    const std::size_t numberOfMembers = 2 * ensembleBlockSize + 17;
+    const Real timeOfFlight = 3000.0;
+    const Real stepSize = 10.0;
+
+    Ensemble initialEnsemble(numberOfMembers);
+    generateEnsembleDispersions(
+        nominalState, choleskyFactor, 42, initialEnsemble.states, numberOfMembers);
+
+    Ensemble ensemble(initialEnsemble.columns);
+    propagateEnsemble(ensemble.states,
+                      numberOfMembers,
+                      earthGravitationalParameter,
+                      earthEquatorialRadius,
+                      earthJ2,
+                      timeOfFlight,
+                      stepSize,
+                      1);
+
+    SECTION("Test against RK4 integration of each member")
+    {
+        const CentralBodyAndJ2Dynamics dynamics
+            = {earthGravitationalParameter, earthEquatorialRadius, earthJ2};
+        RungeKutta4Integrator<Real, 6> integrator;
+
+        for (std::size_t i = 0; i < numberOfMembers; ++i)
+        {
+            Real state[6];
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                state[k] = initialEnsemble.columns[k][i];
+            }
+
+            Real time = 0.0;
+            integrator.integrate(dynamics, time, state, timeOfFlight, stepSize);
+
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                REQUIRE(ensemble.columns[k][i] == Catch::Approx(state[k]).epsilon(1.0e-12));
+            }
+        }
+    }
+
+    SECTION("Test independence of number of threads")
+    {
+        Ensemble parallelEnsemble(initialEnsemble.columns);
+        propagateEnsemble(parallelEnsemble.states,
+                          numberOfMembers,
+                          earthGravitationalParameter,
+                          earthEquatorialRadius,
+                          earthJ2,
+                          timeOfFlight,
+                          stepSize,
+                          4);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t i = 0; i < numberOfMembers; ++i)
+            {
+                REQUIRE(parallelEnsemble.columns[k][i] == ensemble.columns[k][i]);
+            }
+        }
+    }
+
+    SECTION("Test central body dynamics against Kepler propagator")
+    {
+        Ensemble keplerEnsemble(initialEnsemble.columns);
+        propagateEnsemble(keplerEnsemble.states,
+                          numberOfMembers,
+                          earthGravitationalParameter,
+                          earthEquatorialRadius,
+                          0.0,
+                          timeOfFlight,
+                          0.5 * stepSize);
+
+        for (std::size_t i = 0; i < numberOfMembers; i += 13)
+        {
+            Vector initialState(6);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                initialState[k] = initialEnsemble.columns[k][i];
+            }
+
+            const Vector expectedState
+                = propagateKeplerOrbit(initialState, earthGravitationalParameter, timeOfFlight);
+            // The truncation error of the RK4 integrator is of the order of millimeters.
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(keplerEnsemble.columns[k][i]
+                        == Catch::Approx(expectedState[k]).margin(1.0e-2));
+                REQUIRE(keplerEnsemble.columns[k + 3][i]
+                        == Catch::Approx(expectedState[k + 3]).margin(1.0e-5));
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Salmon, J.K., Moraes, M.A., Dror, R.O., Shaw, D.E. Parallel random numbers: as easy as 1, 2,
+ *      3, Proceedings of the International Conference for High Performance Computing, Networking,
+ *      Storage and Analysis (SC11), 2011.
+ */
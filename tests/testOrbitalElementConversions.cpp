@@ -11,6 +11,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <limits>
 #include <vector>
@@ -279,6 +282,148 @@ TEST_CASE("Convert Keplerian elements to Cartesian elements",
     }
 }
 
+TEST_CASE("Convert batch of Cartesian elements to Keplerian elements",
+           "[cartesian-to-keplerian-elements][batch]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2].
+    const Real gravitationalParameter = 3.986004415e14;
+
+    // Set sample of Cartesian states [m, m/s], including a circular, equatorial orbit.
+    const Real cartesianStates[4][6]
+        = {{3.75e6, 4.24e6, -1.39e6, -4.65e3, -2.21e3, 1.66e3},
+           {-2700816.14, -3314092.80, 5266346.42, 5168.606550, -5597.546618, -868.878445},
+           {5.580537430785387e6, 2.816487703435473e6, 0.0,
+            -3.248092722413634e3, 6.435711753323540e3, 0.0},
+           {6.678e6, 0.0, 0.0, 0.0, 8.5e3, 0.0}};
+
+    // Set number of states in batch, such that the batch spans multiple processing blocks.
+    const std::size_t numberOfStates = 150;
+
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfStates));
+    for (std::size_t i = 0; i < numberOfStates; ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            cartesianColumns[j][i] = cartesianStates[i % 4][j];
+        }
+    }
+
+    const Real* cartesianElements[6];
+    Real* keplerianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        cartesianElements[j] = cartesianColumns[j].data();
+        keplerianElements[j] = keplerianColumns[j].data();
+    }
+
+    SECTION("Test that batch conversion matches single-state conversion")
+    {
+        convertCartesianToKeplerianElements(
+            cartesianElements, keplerianElements, numberOfStates, gravitationalParameter);
+
+        for (std::size_t i = 0; i < numberOfStates; ++i)
+        {
+            const Vector expectedKeplerianElements
+                = convertCartesianToKeplerianElements<Real, Vector>(
+                    Vector(cartesianStates[i % 4], cartesianStates[i % 4] + 6),
+                    gravitationalParameter);
+
+            for (std::size_t j = 0; j < 6; ++j)
+            {
+                if (std::isnan(expectedKeplerianElements[j]))
+                {
+                    REQUIRE(std::isnan(keplerianColumns[j][i]));
+                }
+                else
+                {
+                    REQUIRE(keplerianColumns[j][i]
+                                == Catch::Approx(expectedKeplerianElements[j]).epsilon(1.0e-14));
+                }
+            }
+        }
+    }
+
+    SECTION("Test in-place batch conversion")
+    {
+        std::vector<Vector> columns = cartesianColumns;
+        Real* elements[6];
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            elements[j] = columns[j].data();
+        }
+
+        convertCartesianToKeplerianElements(
+            cartesianElements, keplerianElements, numberOfStates, gravitationalParameter);
+        convertCartesianToKeplerianElements(
+            elements, elements, numberOfStates, gravitationalParameter);
+
+        for (std::size_t i = 0; i < numberOfStates; ++i)
+        {
+            for (std::size_t j = 0; j < 6; ++j)
+            {
+                REQUIRE((columns[j][i] == keplerianColumns[j][i]
+                         || (std::isnan(columns[j][i]) && std::isnan(keplerianColumns[j][i]))));
+            }
+        }
+    }
+}
+
+TEST_CASE("Convert batch of Keplerian elements to Cartesian elements",
+           "[keplerian-to-cartesian-elements][batch]")
+{
+    const Real pi = 3.14159265358979323846;
+
+    // Set Earth gravitational parameter [m^3/s^2] .
+    const Real earthGravitationalParameter = 3.986004415e14;
+
+    // Set sample of Keplerian elements [m,-,rad,rad,rad,rad], including a parabolic orbit, for
+    // which the first element is the semi-latus rectum.
+    const Real keplerianStates[3][6]
+        = {{8000.0 * 1000.0, 0.23, 20.6 / 180.0 * pi, 274.78 / 180.0 * pi, 108.77 / 180.0 * pi,
+            46.11 / 180.0 * pi},
+           {6787746.891, 0.000731104, 51.68714486 / 180.0 * pi, 74.21987137 / 180.0 * pi,
+            127.5486706 / 180.0 * pi, 24.10027677 / 180.0 * pi},
+           {1.0e7, 1.0, 0.5, 1.0, 2.0, 0.3}};
+
+    // Set number of states in batch, such that the batch spans multiple processing blocks.
+    const std::size_t numberOfStates = 100;
+
+    std::vector<Vector> keplerianColumns(6, Vector(numberOfStates));
+    std::vector<Vector> cartesianColumns(6, Vector(numberOfStates));
+    for (std::size_t i = 0; i < numberOfStates; ++i)
+    {
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            keplerianColumns[j][i] = keplerianStates[i % 3][j];
+        }
+    }
+
+    const Real* keplerianElements[6];
+    Real* cartesianElements[6];
+    for (std::size_t j = 0; j < 6; ++j)
+    {
+        keplerianElements[j] = keplerianColumns[j].data();
+        cartesianElements[j] = cartesianColumns[j].data();
+    }
+
+    convertKeplerianToCartesianElements(
+        keplerianElements, cartesianElements, numberOfStates, earthGravitationalParameter);
+
+    for (std::size_t i = 0; i < numberOfStates; ++i)
+    {
+        const Vector expectedCartesianElements = convertKeplerianToCartesianElements<Real, Vector>(
+            Vector(keplerianStates[i % 3], keplerianStates[i % 3] + 6),
+            earthGravitationalParameter);
+
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            REQUIRE(cartesianColumns[j][i]
+                        == Catch::Approx(expectedCartesianElements[j]).epsilon(1.0e-14));
+        }
+    }
+}
+
 TEST_CASE("Convert true anomaly to eccentric anomaly" , "[true-to-eccentric-anomaly]")
 {
     SECTION("Test elliptical orbits")
@@ -447,6 +592,74 @@ TEST_CASE("Convert eccentric anomaly to mean anomaly" , "[eccentric-to-mean-anom
 
 }
 
+TEST_CASE("Convert true anomaly to mean anomaly" , "[true-to-mean-anomaly]")
+{
+    SECTION("Test elliptical orbits against conversion chain")
+    {
+        const Real eccentricities[4] = {0.0, 0.01, 0.5, 0.99};
+
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            for (int j = -20; j <= 20; j++)
+            {
+                const Real trueAnomaly = 0.157 * j;
+
+                // Compute expected mean anomaly via eccentric anomaly [rad].
+                const Real expectedMeanAnomaly
+                    = convertEllipticalEccentricAnomalyToMeanAnomaly(
+                        convertTrueAnomalyToEllipticalEccentricAnomaly(trueAnomaly,
+                                                                       eccentricities[i]),
+                        eccentricities[i]);
+
+                const Real computedMeanAnomaly
+                    = convertTrueAnomalyToEllipticalMeanAnomaly(trueAnomaly, eccentricities[i]);
+                const Real computedMeanAnomalyWrapper
+                    = convertTrueAnomalyToMeanAnomaly(trueAnomaly, eccentricities[i]);
+
+                REQUIRE(std::fabs(computedMeanAnomaly - expectedMeanAnomaly) <= 1.0e-14);
+                REQUIRE(computedMeanAnomalyWrapper == computedMeanAnomaly);
+            }
+        }
+    }
+
+    SECTION("Test hyperbolic orbits against conversion chain")
+    {
+        // The benchmark data is obtained from (Vallado, 2004).
+        REQUIRE(convertTrueAnomalyToHyperbolicMeanAnomaly(
+                    convertHyperbolicEccentricAnomalyToTrueAnomaly(1.6013761449, 2.4), 2.4)
+                    == Catch::Approx(235.4 / 180.0 * 3.14159265358979323846).epsilon(1.0e-10));
+
+        const Real eccentricities[3] = {1.01, 2.4, 30.0};
+
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            // Stay within the asymptotes of the hyperbolic orbit.
+            const Real maximumTrueAnomaly = 0.95 * std::acos(-1.0 / eccentricities[i]);
+
+            for (int j = -20; j <= 20; j++)
+            {
+                const Real trueAnomaly = maximumTrueAnomaly * j / 20.0;
+
+                // Compute expected mean anomaly via hyperbolic eccentric anomaly [rad].
+                const Real expectedMeanAnomaly
+                    = convertHyperbolicEccentricAnomalyToMeanAnomaly(
+                        convertTrueAnomalyToHyperbolicEccentricAnomaly(trueAnomaly,
+                                                                       eccentricities[i]),
+                        eccentricities[i]);
+
+                const Real computedMeanAnomaly
+                    = convertTrueAnomalyToHyperbolicMeanAnomaly(trueAnomaly, eccentricities[i]);
+                const Real computedMeanAnomalyWrapper
+                    = convertTrueAnomalyToMeanAnomaly(trueAnomaly, eccentricities[i]);
+
+                REQUIRE(std::fabs(computedMeanAnomaly - expectedMeanAnomaly)
+                            <= 1.0e-14 * std::max(std::fabs(expectedMeanAnomaly), 1.0));
+                REQUIRE(computedMeanAnomalyWrapper == computedMeanAnomaly);
+            }
+        }
+    }
+}
+
 TEST_CASE("Convert eccentric anomaly to true anomaly" , "[eccentric-to-true-anomaly]")
 {
     const Real pi = 3.14159265358979323846;
@@ -729,6 +942,282 @@ TEST_CASE("Convert elliptical mean anomaly to eccentric anomaly for elliptical o
                             10.0 * std::numeric_limits<Real>::epsilon()));
         }
     }
+
+    SECTION("Test convergence for mean anomalies > pi and near-parabolic orbits")
+    {
+        const Real eccentricities[5] = {0.1, 0.5, 0.9, 0.99999, 1.0 - 1.0e-10};
+        const Real ellipticalMeanAnomalies[5] = {4.0, 5.5, 3.2, 3.1, 6.2};
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            const Real computedEccentricAnomaly
+                = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricities[i], ellipticalMeanAnomalies[i]);
+
+            REQUIRE(std::fabs(computeEllipticalKeplerFunction(computedEccentricAnomaly,
+                                                              eccentricities[i],
+                                                              ellipticalMeanAnomalies[i]))
+                    < 10.0 * std::numeric_limits<Real>::epsilon());
+        }
+    }
+}
+
+TEST_CASE("Convert batch of elliptical mean anomalies to eccentric anomalies",
+          "[mean-to-eccentric-anomaly][batch]")
+{
+    const Real pi = 3.14159265358979323846;
+
+    // Set up batch that covers circular, elliptical and near-parabolic orbits, and mean anomalies
+    // outside of the 0 to 2pi range.
+    const std::size_t numberOfElements = 150;
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = (i % 5 == 0) ? 0.0 : 0.99999 * static_cast<Real>(i % 37) / 36.0;
+        meanAnomalies[i] = -3.0 * pi + 6.0 * pi * static_cast<Real>(i) / numberOfElements;
+    }
+
+    SECTION("Test against scalar conversion")
+    {
+        Vector eccentricAnomalies(numberOfElements);
+        bool isConverged[numberOfElements];
+
+        convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), meanAnomalies.data(), eccentricAnomalies.data(), isConverged,
+            numberOfElements);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            const Real expectedEccentricAnomaly
+                = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricities[i], meanAnomalies[i]);
+
+            REQUIRE(isConverged[i]);
+            REQUIRE(eccentricAnomalies[i]
+                        == Catch::Approx(expectedEccentricAnomaly).epsilon(
+                            10.0 * std::numeric_limits<Real>::epsilon()));
+        }
+    }
+
+    SECTION("Test in-place conversion")
+    {
+        Vector eccentricAnomalies = meanAnomalies;
+        bool isConverged[numberOfElements];
+
+        convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), eccentricAnomalies.data(), eccentricAnomalies.data(),
+            isConverged, numberOfElements);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            REQUIRE(isConverged[i]);
+            REQUIRE(eccentricAnomalies[i]
+                        == Catch::Approx(
+                            convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                                eccentricities[i], meanAnomalies[i])).epsilon(
+                            10.0 * std::numeric_limits<Real>::epsilon()));
+        }
+    }
+
+    SECTION("Test per-element convergence flags")
+    {
+        // Circular orbits converge in one iteration, all others require more.
+        Vector eccentricAnomalies(numberOfElements);
+        bool isConverged[numberOfElements];
+
+        convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), meanAnomalies.data(), eccentricAnomalies.data(), isConverged,
+            numberOfElements, 1.0e-3 * std::numeric_limits<Real>::epsilon(), 1);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            REQUIRE(isConverged[i] == (eccentricities[i] == 0.0));
+        }
+    }
+}
+
+TEST_CASE("Convert elliptical mean anomaly to eccentric anomaly using Markley's method",
+          "[mean-to-eccentric-anomaly][markley]")
+{
+    const Real pi = 3.14159265358979323846;
+
+    SECTION("Test against GTOP and PyKEP data")
+    {
+        const Real eccentricities[5] = {0.01671, 0.43582, 0.78514, 0.5132, 0.991};
+        const Real ellipticalMeanAnomalies[5] = {60.0 / 180.0 * pi,
+                                                 90.0 / 180.0 * pi,
+                                                 120.0 / 180.0 * pi,
+                                                 2.5746,
+                                                 0.5571};
+        const Real expectedEccentricAnomalies[5] = {1.06178920406832,
+                                                    1.97200731113253,
+                                                    2.5392410896466,
+                                                    2.76387035891018,
+                                                    1.54783886054501};
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            REQUIRE(convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+                        eccentricities[i], ellipticalMeanAnomalies[i])
+                        == Catch::Approx(expectedEccentricAnomalies[i]).epsilon(
+                            10.0 * std::numeric_limits<Real>::epsilon()));
+        }
+    }
+
+    SECTION("Test accuracy against Newton-Raphson solver over 0 <= e < 1")
+    {
+        // Sample eccentricity including near-parabolic orbits, and mean anomaly outside of the
+        // 0 to 2pi range. The residual of Kepler's equation is computed modulo 2pi.
+        Real maximumMarkleyResidual = 0.0;
+        Real maximumNewtonRaphsonResidual = 0.0;
+        for (int i = 0; i <= 100; ++i)
+        {
+            const Real eccentricity = (i < 100) ? i / 100.0 : 1.0 - 1.0e-10;
+            for (int j = -200; j <= 200; ++j)
+            {
+                const Real meanAnomaly = j / 100.0 * pi;
+
+                const Real markleyEccentricAnomaly
+                    = convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+                        eccentricity, meanAnomaly);
+                const Real newtonRaphsonEccentricAnomaly
+                    = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                        eccentricity, meanAnomaly);
+
+                REQUIRE(markleyEccentricAnomaly >= 0.0);
+                REQUIRE(markleyEccentricAnomaly <= 2.0 * pi);
+
+                maximumMarkleyResidual = std::max(
+                    maximumMarkleyResidual,
+                    std::fabs(std::remainder(computeEllipticalKeplerFunction(
+                        markleyEccentricAnomaly, eccentricity, meanAnomaly), 2.0 * pi)));
+                maximumNewtonRaphsonResidual = std::max(
+                    maximumNewtonRaphsonResidual,
+                    std::fabs(std::remainder(computeEllipticalKeplerFunction(
+                        newtonRaphsonEccentricAnomaly, eccentricity, meanAnomaly), 2.0 * pi)));
+            }
+        }
+
+        REQUIRE(maximumMarkleyResidual < 10.0 * std::numeric_limits<Real>::epsilon());
+        REQUIRE(maximumNewtonRaphsonResidual < 10.0 * std::numeric_limits<Real>::epsilon());
+    }
+}
+
+TEST_CASE("Convert hyperbolic mean anomaly to eccentric anomaly for hyperbolic orbits",
+          "[mean-to-eccentric-anomaly][hyperbolic]")
+{
+    SECTION("Test hyperbolic orbit using Vallado data")
+    {
+        // The benchmark data is obtained from (Vallado, 2004).
+        const Real eccentricity = 2.4;
+        const Real meanAnomaly = 235.4 / 180.0 * 3.14159265358979323846;
+        const Real expectedHyperbolicEccentricAnomaly = 1.6013761449;
+
+        const Real computedHyperbolicEccentricAnomaly
+            = convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                eccentricity, meanAnomaly);
+
+        REQUIRE(computedHyperbolicEccentricAnomaly
+                    == Catch::Approx(expectedHyperbolicEccentricAnomaly).epsilon(1.0e-10));
+
+        // Check symmetry for negative mean anomaly.
+        REQUIRE(convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricity, -meanAnomaly)
+                == -computedHyperbolicEccentricAnomaly);
+    }
+
+    SECTION("Test round-trip conversion for near-parabolic to highly hyperbolic orbits")
+    {
+        const Real eccentricities[5] = {1.0 + 1.0e-6, 1.01, 1.5, 10.0, 1000.0};
+        const Real hyperbolicEccentricAnomalies[5] = {0.1, -0.5, 2.0, -4.0, 10.0};
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            for (unsigned int j = 0; j < 5; ++j)
+            {
+                const Real meanAnomaly = convertHyperbolicEccentricAnomalyToMeanAnomaly(
+                    hyperbolicEccentricAnomalies[j], eccentricities[i]);
+
+                REQUIRE(convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                            eccentricities[i], meanAnomaly)
+                            == Catch::Approx(hyperbolicEccentricAnomalies[j]).epsilon(1.0e-12));
+            }
+        }
+    }
+}
+
+TEST_CASE("Convert batch of hyperbolic mean anomalies to eccentric anomalies",
+          "[mean-to-eccentric-anomaly][hyperbolic][batch]")
+{
+    // Set up batch that covers near-parabolic to highly hyperbolic orbits, and positive and
+    // negative mean anomalies.
+    const std::size_t numberOfElements = 150;
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 1.0 + std::pow(10.0, -6.0 + static_cast<Real>(i % 11));
+        meanAnomalies[i] = (static_cast<Real>(i) - 75.0) * static_cast<Real>(i % 7 + 1);
+    }
+
+    SECTION("Test against scalar conversion")
+    {
+        Vector hyperbolicEccentricAnomalies(numberOfElements);
+        bool isConverged[numberOfElements];
+
+        convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), meanAnomalies.data(), hyperbolicEccentricAnomalies.data(),
+            isConverged, numberOfElements);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            const Real expectedHyperbolicEccentricAnomaly
+                = convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                    eccentricities[i], meanAnomalies[i]);
+
+            REQUIRE(isConverged[i]);
+            REQUIRE(hyperbolicEccentricAnomalies[i]
+                        == Catch::Approx(expectedHyperbolicEccentricAnomaly).epsilon(
+                            10.0 * std::numeric_limits<Real>::epsilon()));
+        }
+    }
+
+    SECTION("Test in-place conversion")
+    {
+        Vector hyperbolicEccentricAnomalies = meanAnomalies;
+        bool isConverged[numberOfElements];
+
+        convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), hyperbolicEccentricAnomalies.data(),
+            hyperbolicEccentricAnomalies.data(), isConverged, numberOfElements);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            REQUIRE(isConverged[i]);
+            REQUIRE(hyperbolicEccentricAnomalies[i]
+                        == Catch::Approx(
+                            convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+                                eccentricities[i], meanAnomalies[i])).epsilon(
+                            10.0 * std::numeric_limits<Real>::epsilon()));
+        }
+    }
+
+    SECTION("Test per-element convergence flags")
+    {
+        // Zero mean anomalies converge in one iteration, all others require more.
+        Vector hyperbolicEccentricAnomalies(numberOfElements);
+        bool isConverged[numberOfElements];
+
+        convertHyperbolicMeanAnomalyToEccentricAnomaly<Real, Integer>(
+            eccentricities.data(), meanAnomalies.data(), hyperbolicEccentricAnomalies.data(),
+            isConverged, numberOfElements, 1.0e-3 * std::numeric_limits<Real>::epsilon(), 1);
+
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            REQUIRE(isConverged[i] == (meanAnomalies[i] == 0.0));
+        }
+    }
 }
 
 } // namespace tests
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "astro/keplerPropagator.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/parallelCatalog.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Generate catalog of Keplerian elements, covering a range of eccentricities.
+std::vector<Vector> generateKeplerianCatalog(const std::size_t numberOfObjects)
+{
+    std::vector<Vector> catalog(6, Vector(numberOfObjects));
+    for (std::size_t i = 0; i < numberOfObjects; ++i)
+    {
+        const Real fraction = static_cast<Real>(i) / static_cast<Real>(numberOfObjects);
+        catalog[eccentricityIndex][i] = 0.9 * fraction;
+        catalog[semiMajorAxisIndex][i] = 7.0e6 / (1.0 - catalog[eccentricityIndex][i]);
+        catalog[inclinationIndex][i] = 0.1 + 3.0 * fraction;
+        catalog[argumentOfPeriapsisIndex][i] = 0.3 + 5.0 * fraction;
+        catalog[longitudeOfAscendingNodeIndex][i] = 6.0 * fraction;
+        catalog[trueAnomalyIndex][i] = 0.2 + 17.0 * fraction - 6.0;
+    }
+    return catalog;
+}
+
+TEST_CASE("Execute in parallel", "[parallel-catalog]")
+{
+    const std::size_t numberOfItems = 10007;
+
+    SECTION("Test that each item is processed exactly once")
+    {
+        const std::size_t threadCounts[4] = {0, 1, 3, 16};
+        const std::size_t chunkSizes[4] = {1, 7, 64, 20000};
+
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            std::vector<int> counts(numberOfItems, 0);
+            executeInParallel(numberOfItems,
+                              [&](const std::size_t begin, const std::size_t end)
+                              {
+                                  for (std::size_t j = begin; j < end; ++j)
+                                  {
+                                      ++counts[j];
+                                  }
+                              },
+                              threadCounts[i],
+                              chunkSizes[i]);
+
+            for (std::size_t j = 0; j < numberOfItems; ++j)
+            {
+                REQUIRE(counts[j] == 1);
+            }
+        }
+    }
+
+    SECTION("Test empty range")
+    {
+        bool isCalled = false;
+        executeInParallel(0,
+                          [&](const std::size_t, const std::size_t) { isCalled = true; },
+                          4);
+        REQUIRE(!isCalled);
+    }
+
+    SECTION("Test that exception is rethrown on calling thread")
+    {
+        REQUIRE_THROWS_AS(
+            executeInParallel(numberOfItems,
+                              [](const std::size_t begin, const std::size_t end)
+                              {
+                                  if (begin <= 5000 && 5000 < end)
+                                  {
+                                      throw std::runtime_error("ERROR: Test exception!");
+                                  }
+                              },
+                              4,
+                              16),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE("Convert and propagate catalog in parallel", "[parallel-catalog]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2].
+    const Real earthGravitationalParameter = 3.986004415e14;
+
+    const std::size_t numberOfObjects = 1000;
+    const std::vector<Vector> keplerianCatalog = generateKeplerianCatalog(numberOfObjects);
+
+    const Real* keplerianElements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        keplerianElements[k] = keplerianCatalog[k].data();
+    }
+
+    std::vector<Vector> expectedCartesianCatalog(6, Vector(numberOfObjects));
+    Real* expectedCartesianElements[6];
+    for (std::size_t k = 0; k < 6; ++k)
+    {
+        expectedCartesianElements[k] = expectedCartesianCatalog[k].data();
+    }
+    convertKeplerianToCartesianElements(keplerianElements,
+                                        expectedCartesianElements,
+                                        numberOfObjects,
+                                        earthGravitationalParameter);
+
+    SECTION("Test element conversions against batch conversions")
+    {
+        std::vector<Vector> cartesianCatalog(6, Vector(numberOfObjects));
+        std::vector<Vector> keplerianRoundTripCatalog(6, Vector(numberOfObjects));
+        std::vector<Vector> expectedKeplerianCatalog(6, Vector(numberOfObjects));
+        Real* cartesianElements[6];
+        Real* keplerianRoundTripElements[6];
+        Real* expectedKeplerianElements[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            cartesianElements[k] = cartesianCatalog[k].data();
+            keplerianRoundTripElements[k] = keplerianRoundTripCatalog[k].data();
+            expectedKeplerianElements[k] = expectedKeplerianCatalog[k].data();
+        }
+
+        convertCatalogKeplerianToCartesianElements(
+            keplerianElements, cartesianElements, numberOfObjects, earthGravitationalParameter, 4);
+
+        const Real* constCartesianElements[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            constCartesianElements[k] = cartesianElements[k];
+        }
+        convertCatalogCartesianToKeplerianElements(constCartesianElements,
+                                                   keplerianRoundTripElements,
+                                                   numberOfObjects,
+                                                   earthGravitationalParameter,
+                                                   4);
+        convertCartesianToKeplerianElements(constCartesianElements,
+                                            expectedKeplerianElements,
+                                            numberOfObjects,
+                                            earthGravitationalParameter);
+
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            for (std::size_t i = 0; i < numberOfObjects; ++i)
+            {
+                REQUIRE(cartesianElements[k][i] == expectedCartesianElements[k][i]);
+                REQUIRE(keplerianRoundTripElements[k][i] == expectedKeplerianElements[k][i]);
+            }
+        }
+    }
+
+    SECTION("Test propagation against Kepler propagator")
+    {
+        const std::size_t numberOfEpochs = 5;
+        const Real timesOfFlight[numberOfEpochs] = {-3600.0, 0.0, 60.0, 5400.0, 86400.0};
+
+        const Real* initialStates[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            initialStates[k] = expectedCartesianElements[k];
+        }
+
+        std::vector<Vector> propagatedCatalog(6, Vector(numberOfObjects * numberOfEpochs));
+        Real* propagatedStates[6];
+        for (std::size_t k = 0; k < 6; ++k)
+        {
+            propagatedStates[k] = propagatedCatalog[k].data();
+        }
+
+        propagateCatalog(initialStates,
+                         numberOfObjects,
+                         timesOfFlight,
+                         numberOfEpochs,
+                         earthGravitationalParameter,
+                         propagatedStates,
+                         3);
+
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            Vector initialState(6);
+            for (std::size_t k = 0; k < 6; ++k)
+            {
+                initialState[k] = initialStates[k][i];
+            }
+            const KeplerPropagator<Real, Vector> propagator(initialState,
+                                                            earthGravitationalParameter);
+
+            for (std::size_t j = 0; j < numberOfEpochs; ++j)
+            {
+                const Vector expectedState = propagator.propagate(timesOfFlight[j]);
+                for (std::size_t k = 0; k < 6; ++k)
+                {
+                    REQUIRE(propagatedStates[k][i * numberOfEpochs + j] == expectedState[k]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -10,7 +10,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 #include "astro/radiationPressureAccelerationModel.hpp"
@@ -112,6 +114,259 @@ TEST_CASE("Compute radiation pressure acceleration for cannonball at Earth dista
     REQUIRE(acceleration[2] == Catch::Approx(expectedAcceleration[2]).epsilon(tolerance));
 }
 
+TEST_CASE("Compute radiation pressure acceleration for cannonball including shadow",
+          "[radiation_pressure, acceleration, models]")
+{
+    // Set Earth radius and solar radius [m], and reference distance (1 AU) [m].
+    const Real earthRadius = 6378136.3;
+    const Real sunRadius = 6.96e8;
+    const Real astronomicalUnit = 1.495978707e11;
+
+    // Set radiation pressure at 1 AU [N m^-2], radiation pressure coefficient [-], and radius [m]
+    // and bulk density [kg m^-3] of cannonball.
+    const Real referenceRadiationPressure = 4.56e-6;
+    const Real radiationPressureCoefficient = 1.3;
+    const Real radius = 0.5;
+    const Real bulkDensity = 200.0;
+
+    // Set position of Sun wrt Earth [m].
+    Vector sunPosition(3);
+    sunPosition[0] = 0.6 * astronomicalUnit;
+    sunPosition[1] = 0.0;
+    sunPosition[2] = 0.8 * astronomicalUnit;
+
+    // Set positions of cannonballs wrt Earth [m] in sunlight, umbra and penumbra.
+    const std::size_t numberOfObjects = 3;
+    const Real positions[numberOfObjects][3]
+        = {{7.0e6, 1.0e6, 0.0},
+           {-0.6 * 7.0e6, 0.0, -0.8 * 7.0e6},
+           {-0.6 * 4.2164e7 + 0.8 * earthRadius, 0.0, -0.8 * 4.2164e7 - 0.6 * earthRadius}};
+
+    SECTION("Test against unshadowed acceleration and shadow function")
+    {
+        for (std::size_t i = 0; i < numberOfObjects; ++i)
+        {
+            const Vector position(positions[i], positions[i] + 3);
+
+            Vector relativeSunPosition(3);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                relativeSunPosition[k] = sunPosition[k] - position[k];
+            }
+            const Real sunDistance = std::sqrt(relativeSunPosition[0] * relativeSunPosition[0]
+                                               + relativeSunPosition[1] * relativeSunPosition[1]
+                                               + relativeSunPosition[2] * relativeSunPosition[2]);
+            Vector unitVectorToSun(3);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                unitVectorToSun[k] = relativeSunPosition[k] / sunDistance;
+            }
+
+            const Real shadowFunction
+                = computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius);
+            const Vector unshadowedAcceleration = computeCannonballRadiationPressureAcceleration(
+                computeRadiationPressure(referenceRadiationPressure, astronomicalUnit, sunDistance),
+                radiationPressureCoefficient,
+                unitVectorToSun,
+                radius,
+                bulkDensity);
+
+            const Vector acceleration = computeShadowedCannonballRadiationPressureAcceleration(
+                referenceRadiationPressure,
+                astronomicalUnit,
+                radiationPressureCoefficient,
+                position,
+                sunPosition,
+                sunRadius,
+                earthRadius,
+                radius,
+                bulkDensity);
+
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(acceleration[k]
+                            == Catch::Approx(shadowFunction * unshadowedAcceleration[k])
+                                .epsilon(1.0e-14));
+            }
+        }
+
+        // Check that the objects are in sunlight, umbra and penumbra, respectively.
+        REQUIRE(computeConicalShadowFunction(
+                    Vector(positions[0], positions[0] + 3), sunPosition, sunRadius, earthRadius)
+                        == 1.0);
+        REQUIRE(computeConicalShadowFunction(
+                    Vector(positions[1], positions[1] + 3), sunPosition, sunRadius, earthRadius)
+                        == 0.0);
+        const Real penumbraShadowFunction = computeConicalShadowFunction(
+            Vector(positions[2], positions[2] + 3), sunPosition, sunRadius, earthRadius);
+        REQUIRE(penumbraShadowFunction > 0.0);
+        REQUIRE(penumbraShadowFunction < 1.0);
+    }
+
+    SECTION("Test batch computation")
+    {
+        // Set positions on a ring through the shadow, which includes the sunlit, umbra and
+        // penumbra regions.
+        const std::size_t numberOfRingObjects = 150;
+        std::vector<Vector> positionColumns(3, Vector(numberOfRingObjects));
+        for (std::size_t i = 0; i < numberOfRingObjects; ++i)
+        {
+            const Real angle = 6.28 * static_cast<Real>(i) / static_cast<Real>(numberOfRingObjects);
+            positionColumns[0][i] = 4.2164e7 * std::cos(angle);
+            positionColumns[1][i] = 1.0e6;
+            positionColumns[2][i] = 4.2164e7 * std::sin(angle);
+        }
+
+        const Real* constPositions[3];
+        Real* inPlaceAccelerations[3];
+        std::vector<Vector> accelerationColumns(3, Vector(numberOfRingObjects));
+        Real* accelerations[3];
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            constPositions[k] = positionColumns[k].data();
+            inPlaceAccelerations[k] = positionColumns[k].data();
+            accelerations[k] = accelerationColumns[k].data();
+        }
+        Vector shadowFunctions(numberOfRingObjects);
+
+        computeShadowedCannonballRadiationPressureAccelerations(constPositions,
+                                                                numberOfRingObjects,
+                                                                sunPosition,
+                                                                referenceRadiationPressure,
+                                                                astronomicalUnit,
+                                                                radiationPressureCoefficient,
+                                                                sunRadius,
+                                                                earthRadius,
+                                                                radius,
+                                                                bulkDensity,
+                                                                accelerations,
+                                                                shadowFunctions.data());
+
+        std::size_t numberOfShadowedObjects = 0;
+        for (std::size_t i = 0; i < numberOfRingObjects; ++i)
+        {
+            Vector position(3);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                position[k] = positionColumns[k][i];
+            }
+
+            REQUIRE(shadowFunctions[i]
+                        == Catch::Approx(computeConicalShadowFunction(
+                            position, sunPosition, sunRadius, earthRadius)).epsilon(1.0e-14));
+
+            const Vector expectedAcceleration
+                = computeShadowedCannonballRadiationPressureAcceleration(
+                    referenceRadiationPressure,
+                    astronomicalUnit,
+                    radiationPressureCoefficient,
+                    position,
+                    sunPosition,
+                    sunRadius,
+                    earthRadius,
+                    radius,
+                    bulkDensity);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                REQUIRE(accelerations[k][i]
+                            == Catch::Approx(expectedAcceleration[k]).epsilon(1.0e-14));
+            }
+
+            if (shadowFunctions[i] < 1.0)
+            {
+                ++numberOfShadowedObjects;
+            }
+        }
+        REQUIRE(numberOfShadowedObjects > 0);
+        REQUIRE(numberOfShadowedObjects < numberOfRingObjects);
+
+        // Check that computation in-place, without shadow function output, gives the same result.
+        computeShadowedCannonballRadiationPressureAccelerations(constPositions,
+                                                                numberOfRingObjects,
+                                                                sunPosition,
+                                                                referenceRadiationPressure,
+                                                                astronomicalUnit,
+                                                                radiationPressureCoefficient,
+                                                                sunRadius,
+                                                                earthRadius,
+                                                                radius,
+                                                                bulkDensity,
+                                                                inPlaceAccelerations);
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            for (std::size_t i = 0; i < numberOfRingObjects; ++i)
+            {
+                REQUIRE(positionColumns[k][i] == accelerationColumns[k][i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Compute gradient of radiation pressure acceleration for cannonball",
+          "[radiation_pressure, acceleration, models]")
+{
+    // Set radiation pressure at 1 AU [N m^-2], 1 AU [m], radiation pressure coefficient [-], and
+    // radius [m] and bulk density [kg m^-3] of cannonball.
+    const Real referenceRadiationPressure = 4.56e-6;
+    const Real referenceDistance = 1.495978707e11;
+    const Real radiationPressureCoefficient = 1.3;
+    const Real radius = 0.5;
+    const Real bulkDensity = 200.0;
+
+    // Set position of cannonball wrt Sun [m].
+    Vector positionWrtSource(3);
+    positionWrtSource[0] = -0.6 * referenceDistance;
+    positionWrtSource[1] = 1.0e7;
+    positionWrtSource[2] = -0.8 * referenceDistance;
+
+    Real gradient[3][3];
+    computeCannonballRadiationPressureAccelerationGradient(referenceRadiationPressure,
+                                                           referenceDistance,
+                                                           radiationPressureCoefficient,
+                                                           positionWrtSource,
+                                                           radius,
+                                                           bulkDensity,
+                                                           gradient);
+
+    // Compute gradient using central differences of the acceleration, by moving the
+    // cannonball with respect to the Sun [m].
+    const Real stepSize = 1.0e6;
+    Real maximumGradient = 0.0;
+    Real maximumError = 0.0;
+    for (int j = 0; j < 3; ++j)
+    {
+        Vector accelerations[2];
+        for (int k = 0; k < 2; ++k)
+        {
+            Vector position = positionWrtSource;
+            position[j] += (k == 0 ? 1.0 : -1.0) * stepSize;
+            const Real distance = std::sqrt(position[0] * position[0]
+                                            + position[1] * position[1]
+                                            + position[2] * position[2]);
+            Vector unitVectorToSource(3);
+            for (int i = 0; i < 3; ++i)
+            {
+                unitVectorToSource[i] = -position[i] / distance;
+            }
+            accelerations[k] = computeCannonballRadiationPressureAcceleration(
+                computeRadiationPressure(referenceRadiationPressure, referenceDistance, distance),
+                radiationPressureCoefficient,
+                unitVectorToSource,
+                radius,
+                bulkDensity);
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const Real finiteDifference
+                = (accelerations[0][i] - accelerations[1][i]) / (2.0 * stepSize);
+            maximumGradient = std::max(maximumGradient, std::fabs(gradient[i][j]));
+            maximumError = std::max(maximumError, std::fabs(gradient[i][j] - finiteDifference));
+        }
+    }
+    REQUIRE(maximumError <= 1.0e-7 * maximumGradient);
+}
+
 TEST_CASE("Compute Poynting-Robertson drag acceleration for cannonball at Earth distance")
 {
     // @TODO: Add tests for PR drag.
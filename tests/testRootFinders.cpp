@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/rootFinders.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef int Integer;
+typedef std::vector<Real> Vector;
+
+//! Quadratic function f(x) = x^2 - 2, including derivatives.
+struct SquareRootOfTwoFunction
+{
+    void operator()(const Real x,
+                    Real& function,
+                    Real& firstDerivative,
+                    Real& secondDerivative) const
+    {
+        function = x * x - 2.0;
+        firstDerivative = 2.0 * x;
+        secondDerivative = 2.0;
+    }
+};
+
+//! Safeguard that replaces iterates outside of [1, 2] by the midpoint of the interval.
+struct UnitIntervalSafeguard
+{
+    Real operator()(const Real, const Real nextIterate) const
+    {
+        return nextIterate >= 1.0 && nextIterate <= 2.0 ? nextIterate : 1.5;
+    }
+};
+
+//! Solve Kepler's equation with given iteration scheme and count the iterations.
+template <typename IterationScheme>
+Real solveKeplerEquationWithScheme(const Real eccentricity,
+                                   const Real meanAnomaly,
+                                   const Real initialGuess,
+                                   Integer& numberOfIterations)
+{
+    Real eccentricAnomaly = initialGuess;
+    const bool isConverged
+        = findRoot<IterationScheme>(EllipticalKeplerFunction<Real>(eccentricity, meanAnomaly),
+                                    AbsoluteStepStoppingCondition<Real>(1.0e-14),
+                                    100,
+                                    eccentricAnomaly,
+                                    numberOfIterations);
+    REQUIRE(isConverged);
+    return eccentricAnomaly;
+}
+
+TEST_CASE("Find root with iteration schemes", "[root-finders]")
+{
+    SECTION("Test square root of two")
+    {
+        const RelativeStepStoppingCondition<Real> stoppingCondition(
+            10.0 * std::numeric_limits<Real>::epsilon());
+
+        Real newtonRoot = 1.0;
+        Integer newtonIterations = 0;
+        REQUIRE(findRoot<NewtonRaphsonScheme>(
+            SquareRootOfTwoFunction(), stoppingCondition, 100, newtonRoot, newtonIterations));
+
+        Real halleyRoot = 1.0;
+        Integer halleyIterations = 0;
+        REQUIRE(findRoot<HalleyScheme>(
+            SquareRootOfTwoFunction(), stoppingCondition, 100, halleyRoot, halleyIterations));
+
+        Real laguerreRoot = 1.0;
+        Integer laguerreIterations = 0;
+        REQUIRE(findRoot<LaguerreScheme<> >(
+            SquareRootOfTwoFunction(), stoppingCondition, 100, laguerreRoot, laguerreIterations));
+
+        const Real expectedRoot = std::sqrt(2.0);
+        REQUIRE(newtonRoot == Catch::Approx(expectedRoot).epsilon(1.0e-15));
+        REQUIRE(halleyRoot == Catch::Approx(expectedRoot).epsilon(1.0e-15));
+        REQUIRE(laguerreRoot == Catch::Approx(expectedRoot).epsilon(1.0e-15));
+        REQUIRE(halleyIterations < newtonIterations);
+        REQUIRE(laguerreIterations < newtonIterations);
+    }
+
+    SECTION("Test Kepler's equation")
+    {
+        // Solve Kepler's equation from a poor initial guess (E = M), which is challenging for
+        // Newton-Raphson iterations at high eccentricities (Conway, 1986).
+        Integer totalNewtonIterations = 0;
+        Integer totalHalleyIterations = 0;
+        Integer totalLaguerreIterations = 0;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            const Real eccentricity = 0.99 * static_cast<Real>(i % 10) / 9.0;
+            const Real meanAnomaly = 0.01 + 0.06 * static_cast<Real>(i);
+
+            Integer newtonIterations = 0;
+            Integer halleyIterations = 0;
+            Integer laguerreIterations = 0;
+            const Real newtonRoot = solveKeplerEquationWithScheme<NewtonRaphsonScheme>(
+                eccentricity, meanAnomaly, meanAnomaly, newtonIterations);
+            const Real halleyRoot = solveKeplerEquationWithScheme<HalleyScheme>(
+                eccentricity, meanAnomaly, meanAnomaly, halleyIterations);
+            const Real laguerreRoot = solveKeplerEquationWithScheme<LaguerreScheme<> >(
+                eccentricity, meanAnomaly, meanAnomaly, laguerreIterations);
+
+            const Real expectedRoot
+                = convertEllipticalMeanAnomalyToEccentricAnomaly<Real, Integer>(eccentricity,
+                                                                                meanAnomaly);
+            REQUIRE(newtonRoot == Catch::Approx(expectedRoot).epsilon(1.0e-13));
+            REQUIRE(halleyRoot == Catch::Approx(expectedRoot).epsilon(1.0e-13));
+            REQUIRE(laguerreRoot == Catch::Approx(expectedRoot).epsilon(1.0e-13));
+            REQUIRE(laguerreIterations <= 8);
+
+            totalNewtonIterations += newtonIterations;
+            totalHalleyIterations += halleyIterations;
+            totalLaguerreIterations += laguerreIterations;
+        }
+
+        REQUIRE(totalHalleyIterations < totalNewtonIterations);
+        REQUIRE(totalLaguerreIterations < totalNewtonIterations);
+    }
+
+    SECTION("Test non-convergence")
+    {
+        Real root = 1.0;
+        Integer numberOfIterations = 0;
+        const Integer maximumIterations = 2;
+        REQUIRE(!findRoot<NewtonRaphsonScheme>(SquareRootOfTwoFunction(),
+                                               AbsoluteStepStoppingCondition<Real>(0.0),
+                                               maximumIterations,
+                                               root,
+                                               numberOfIterations));
+        REQUIRE(numberOfIterations == maximumIterations);
+
+        // The root is the last iterate, i.e., the second Newton-Raphson iterate.
+        REQUIRE(root == Catch::Approx(17.0 / 12.0).epsilon(1.0e-15));
+    }
+
+    SECTION("Test safeguard")
+    {
+        // The first Newton-Raphson iterate from x = 0.1 is 10.05, which the safeguard replaces by
+        // 1.5, such that the remaining iterates are those starting from x = 1.5.
+        const RelativeStepStoppingCondition<Real> stoppingCondition(
+            10.0 * std::numeric_limits<Real>::epsilon());
+
+        Real root = 0.1;
+        Integer numberOfIterations = 0;
+        REQUIRE(findRoot<NewtonRaphsonScheme>(SquareRootOfTwoFunction(),
+                                              stoppingCondition,
+                                              100,
+                                              root,
+                                              numberOfIterations,
+                                              UnitIntervalSafeguard()));
+
+        Real referenceRoot = 1.5;
+        Integer referenceIterations = 0;
+        REQUIRE(findRoot<NewtonRaphsonScheme>(
+            SquareRootOfTwoFunction(), stoppingCondition, 100, referenceRoot, referenceIterations));
+
+        REQUIRE(root == Catch::Approx(std::sqrt(2.0)).epsilon(1.0e-15));
+        REQUIRE(numberOfIterations == referenceIterations + 1);
+    }
+}
+
+TEST_CASE("Find roots of block with iteration schemes", "[root-finders]")
+{
+    const std::size_t numberOfElements = 50;
+    Vector eccentricities(numberOfElements);
+    Vector meanAnomalies(numberOfElements);
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        eccentricities[i] = 0.98 * static_cast<Real>(i) / static_cast<Real>(numberOfElements);
+        meanAnomalies[i] = 0.12 * static_cast<Real>(i);
+    }
+
+    const AbsoluteStepStoppingCondition<Real> stoppingCondition(1.0e-14);
+    const EllipticalKeplerBlockFunction<Real> function(eccentricities.data(),
+                                                       meanAnomalies.data());
+
+    SECTION("Test against scalar root-finder")
+    {
+        Vector roots(meanAnomalies);
+        bool isConverged[numberOfElements];
+        Integer numberOfIterations = 0;
+        findRootsOfBlock<HalleyScheme>(function,
+                                       stoppingCondition,
+                                       100,
+                                       numberOfElements,
+                                       roots.data(),
+                                       isConverged,
+                                       numberOfIterations);
+
+        Integer maximumNumberOfIterations = 0;
+        for (std::size_t i = 0; i < numberOfElements; ++i)
+        {
+            Real expectedRoot = meanAnomalies[i];
+            Integer expectedNumberOfIterations = 0;
+            REQUIRE(findRoot<HalleyScheme>(
+                EllipticalKeplerFunction<Real>(eccentricities[i], meanAnomalies[i]),
+                stoppingCondition,
+                100,
+                expectedRoot,
+                expectedNumberOfIterations));
+
+            REQUIRE(isConverged[i]);
+            REQUIRE(roots[i] == expectedRoot);
+            maximumNumberOfIterations
+                = std::max(maximumNumberOfIterations, expectedNumberOfIterations);
+        }
+
+        // The block is iterated until the slowest element has converged.
+        REQUIRE(numberOfIterations == maximumNumberOfIterations);
+    }
+
+    SECTION("Test non-convergence")
+    {
+        Vector roots(meanAnomalies);
+        bool isConverged[numberOfElements];
+        Integer numberOfIterations = 0;
+        findRootsOfBlock<NewtonRaphsonScheme>(function,
+                                              stoppingCondition,
+                                              2,
+                                              numberOfElements,
+                                              roots.data(),
+                                              isConverged,
+                                              numberOfIterations);
+        REQUIRE(numberOfIterations == 2);
+
+        // The mean anomaly is the root for the circular orbit, but not for the most eccentric
+        // orbit.
+        REQUIRE(isConverged[0]);
+        REQUIRE(!isConverged[numberOfElements - 1]);
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Conway, B.A. An improved algorithm due to Laguerre for the solution of Kepler's equation,
+ *      Celestial Mechanics, 39(2), 199-211, 1986.
+ */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/cartesianDynamics.hpp"
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/integrators.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/secularJ2Propagator.hpp"
+#include "astro/stateVectorIndices.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Compute secular J2 rates", "[secular-j2-propagator]")
+{
+    const Real pi = 3.14159265358979323846;
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real earthEquatorialRadius = 6378137.0;
+    const Real earthJ2 = 1.08262668e-3;
+
+    SECTION("Test sun-synchronous orbit")
+    {
+        // Sun-synchronous orbit at 700 km altitude has an inclination of about 98.19 deg, for
+        // which the node precesses eastward at about 360 deg per year (Vallado, 2007).
+        Real argumentOfPeriapsisRate = 0.0;
+        Real longitudeOfAscendingNodeRate = 0.0;
+        Real meanAnomalyRate = 0.0;
+        computeSecularJ2Rates(earthEquatorialRadius + 700.0e3,
+                              0.0,
+                              98.19 * pi / 180.0,
+                              earthGravitationalParameter,
+                              earthEquatorialRadius,
+                              earthJ2,
+                              argumentOfPeriapsisRate,
+                              longitudeOfAscendingNodeRate,
+                              meanAnomalyRate);
+
+        const Real nodalRateInDegreesPerDay = longitudeOfAscendingNodeRate * 86400.0 * 180.0 / pi;
+        REQUIRE(nodalRateInDegreesPerDay
+                    == Catch::Approx(360.0 / 365.2422).epsilon(2.0e-3));
+    }
+
+    SECTION("Test critical inclination and equatorial orbit")
+    {
+        const Real semiMajorAxis = 26.6e6;
+        const Real eccentricity = 0.7;
+
+        // At the critical inclination of 63.43 deg the argument of periapsis is frozen.
+        Real argumentOfPeriapsisRate = 0.0;
+        Real longitudeOfAscendingNodeRate = 0.0;
+        Real meanAnomalyRate = 0.0;
+        computeSecularJ2Rates(semiMajorAxis,
+                              eccentricity,
+                              std::acos(1.0 / std::sqrt(5.0)),
+                              earthGravitationalParameter,
+                              earthEquatorialRadius,
+                              earthJ2,
+                              argumentOfPeriapsisRate,
+                              longitudeOfAscendingNodeRate,
+                              meanAnomalyRate);
+        REQUIRE(argumentOfPeriapsisRate == Catch::Approx(0.0).scale(1.0).epsilon(1.0e-20));
+        REQUIRE(longitudeOfAscendingNodeRate < 0.0);
+
+        // For an equatorial orbit the periapsis and node rates satisfy dw/dt = -2 dO/dt.
+        computeSecularJ2Rates(semiMajorAxis,
+                              eccentricity,
+                              0.0,
+                              earthGravitationalParameter,
+                              earthEquatorialRadius,
+                              earthJ2,
+                              argumentOfPeriapsisRate,
+                              longitudeOfAscendingNodeRate,
+                              meanAnomalyRate);
+        REQUIRE(argumentOfPeriapsisRate
+                    == Catch::Approx(-2.0 * longitudeOfAscendingNodeRate).epsilon(1.0e-14));
+        REQUIRE(meanAnomalyRate
+                    > computeKeplerMeanMotion(semiMajorAxis, earthGravitationalParameter));
+    }
+}
+
+TEST_CASE("Propagate mean elements with secular J2 rates", "[secular-j2-propagator]")
+{
+    const Real pi = 3.14159265358979323846;
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real earthEquatorialRadius = 6378137.0;
+    const Real earthJ2 = 1.08262668e-3;
+
+    Vector keplerianElements(6);
+    keplerianElements[semiMajorAxisIndex] = 7.2e6;
+    keplerianElements[eccentricityIndex] = 0.01;
+    keplerianElements[inclinationIndex] = 0.9;
+    keplerianElements[argumentOfPeriapsisIndex] = 1.2;
+    keplerianElements[longitudeOfAscendingNodeIndex] = 0.4;
+    keplerianElements[trueAnomalyIndex] = 2.5;
+
+    const SecularJ2Propagator<Real, Vector> propagator(
+        keplerianElements, earthGravitationalParameter, earthEquatorialRadius, earthJ2);
+
+    SECTION("Test initial epoch and constant elements")
+    {
+        const Vector elements = propagator.propagate(0.0);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(elements[i] == Catch::Approx(keplerianElements[i]).epsilon(1.0e-14));
+        }
+
+        const Vector propagatedElements = propagator.propagate(1.0e8);
+        REQUIRE(propagatedElements[semiMajorAxisIndex] == keplerianElements[semiMajorAxisIndex]);
+        REQUIRE(propagatedElements[eccentricityIndex] == keplerianElements[eccentricityIndex]);
+        REQUIRE(propagatedElements[inclinationIndex] == keplerianElements[inclinationIndex]);
+        for (std::size_t i = argumentOfPeriapsisIndex; i < 6; ++i)
+        {
+            REQUIRE(propagatedElements[i] >= 0.0);
+            REQUIRE(propagatedElements[i] < 2.0 * pi);
+        }
+    }
+
+    SECTION("Test against numerical integration of J2 acceleration")
+    {
+        // Integrate the Cartesian state with RK4 over 5 days and compare the drift in the
+        // longitude of ascending node with the secular rate. The osculating node oscillates about
+        // the mean node with a short-periodic amplitude of the order of J2, which is small
+        // compared to the drift of several degrees.
+        const CentralBodyAccelerationModel<Real> centralBodyModel(earthGravitationalParameter);
+        const J2AccelerationModel<Real> j2Model(
+            earthGravitationalParameter, earthEquatorialRadius, earthJ2);
+        const auto dynamics = makeCartesianDynamics<Real>(centralBodyModel, j2Model);
+
+        const Vector initialState
+            = convertKeplerianToCartesianElements(keplerianElements, earthGravitationalParameter);
+        Real state[6];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            state[i] = initialState[i];
+        }
+
+        const Real endTime = 5.0 * 86400.0;
+        RungeKutta4Integrator<Real, 6> integrator;
+        Real time = 0.0;
+        integrator.integrate(dynamics, time, state, endTime, 10.0);
+
+        const Vector finalState(state, state + 6);
+        const Vector finalElements
+            = convertCartesianToKeplerianElements(finalState, earthGravitationalParameter);
+        const Real integratedNodeDrift
+            = finalElements[longitudeOfAscendingNodeIndex]
+              - keplerianElements[longitudeOfAscendingNodeIndex];
+
+        const Vector propagatedElements = propagator.propagate(endTime);
+        const Real secularNodeDrift
+            = propagatedElements[longitudeOfAscendingNodeIndex]
+              - keplerianElements[longitudeOfAscendingNodeIndex];
+
+        REQUIRE(secularNodeDrift
+                    == Catch::Approx(propagator.getLongitudeOfAscendingNodeRate() * endTime)
+                        .epsilon(1.0e-12));
+        REQUIRE(secularNodeDrift == Catch::Approx(integratedNodeDrift).epsilon(1.0e-2));
+    }
+
+    SECTION("Test propagation to multiple epochs")
+    {
+        const std::size_t numberOfEpochs = 10;
+        Vector timesOfFlight(numberOfEpochs);
+        std::vector<Vector> columns(6, Vector(numberOfEpochs));
+        Real* elements[6];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            elements[i] = columns[i].data();
+        }
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            timesOfFlight[j] = 1.0e7 * static_cast<Real>(j) - 2.0e7;
+        }
+
+        propagator.propagate(timesOfFlight.data(), elements, numberOfEpochs);
+
+        for (std::size_t j = 0; j < numberOfEpochs; ++j)
+        {
+            const Vector expectedElements = propagator.propagate(timesOfFlight[j]);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                REQUIRE(columns[i][j] == expectedElements[i]);
+            }
+        }
+    }
+
+    SECTION("Test batch propagation against propagator")
+    {
+        // Set range of orbits, including the orbit of the propagator.
+        const std::size_t numberOfOrbits = 40;
+        std::vector<Vector> columns(6, Vector(numberOfOrbits));
+        const Real* inputColumns[6];
+        Real* outputColumns[6];
+        std::vector<Vector> outputs(6, Vector(numberOfOrbits));
+        for (std::size_t n = 0; n < numberOfOrbits; ++n)
+        {
+            const Real fraction = static_cast<Real>(n) / static_cast<Real>(numberOfOrbits);
+            columns[semiMajorAxisIndex][n] = 6.8e6 + 3.0e7 * fraction;
+            columns[eccentricityIndex][n] = 0.9 * fraction;
+            columns[inclinationIndex][n] = pi * fraction;
+            columns[argumentOfPeriapsisIndex][n] = 2.0 * pi * fraction;
+            columns[longitudeOfAscendingNodeIndex][n] = 2.0 * pi * (1.0 - fraction);
+            columns[trueAnomalyIndex][n] = 5.0 * pi * fraction - pi;
+        }
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            columns[i][0] = keplerianElements[i];
+            inputColumns[i] = columns[i].data();
+            outputColumns[i] = outputs[i].data();
+        }
+
+        const Real timeOfFlight = 3.0 * 365.25 * 86400.0;
+        propagateSecularJ2(inputColumns,
+                           numberOfOrbits,
+                           timeOfFlight,
+                           earthGravitationalParameter,
+                           earthEquatorialRadius,
+                           earthJ2,
+                           outputColumns);
+
+        for (std::size_t n = 0; n < numberOfOrbits; ++n)
+        {
+            Vector elements(6);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                elements[i] = columns[i][n];
+            }
+            const SecularJ2Propagator<Real, Vector> orbitPropagator(
+                elements, earthGravitationalParameter, earthEquatorialRadius, earthJ2);
+            const Vector expectedElements = orbitPropagator.propagate(timeOfFlight);
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                REQUIRE(outputs[i][n] == Catch::Approx(expectedElements[i]).epsilon(1.0e-12));
+            }
+        }
+
+        // Check that the batch propagation can be done in place.
+        Real* inPlaceColumns[6];
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            inPlaceColumns[i] = columns[i].data();
+        }
+        propagateSecularJ2(inPlaceColumns,
+                           numberOfOrbits,
+                           timeOfFlight,
+                           earthGravitationalParameter,
+                           earthEquatorialRadius,
+                           earthJ2,
+                           inPlaceColumns);
+        for (std::size_t n = 0; n < numberOfOrbits; ++n)
+        {
+            for (std::size_t i = 0; i < 6; ++i)
+            {
+                REQUIRE(columns[i][n] == outputs[i][n]);
+            }
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A.. Fundamentals of Astrodynamics and Applications. Third Edition, Microcosm Press,
+ *      2007.
+ */
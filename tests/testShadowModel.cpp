@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "astro/shadowModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+TEST_CASE("Compute conical shadow function from apparent radii", "[shadow]")
+{
+    const Real pi = 3.14159265358979323846;
+
+    SECTION("Test full sunlight and umbra")
+    {
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.1, 0.2, 0.35) == 1.0);
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.1, 0.2, 0.5) == 1.0);
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.1, 0.2, 0.1) == 0.0);
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.1, 0.2, 0.0) == 0.0);
+    }
+
+    SECTION("Test annular eclipse")
+    {
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.2, 0.1, 0.0)
+                    == Catch::Approx(0.75).epsilon(1.0e-15));
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.2, 0.1, 0.05)
+                    == Catch::Approx(0.75).epsilon(1.0e-15));
+    }
+
+    SECTION("Test penumbra")
+    {
+        // Disks with equal radii, for which the center of each disk lies on the edge of the other:
+        // the occulted area is the lens 2a^2 pi / 3 - a^2 sqrt(3) / 2.
+        const Real expectedShadowFunction = 1.0 - (2.0 * pi / 3.0 - std::sqrt(3.0) / 2.0) / pi;
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(0.01, 0.01, 0.01)
+                    == Catch::Approx(expectedShadowFunction).epsilon(1.0e-14));
+
+        // Small Sun with its center on the edge of a large body: half of the disk is occulted.
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(1.0e-5, 1.0, 1.0)
+                    == Catch::Approx(0.5).epsilon(1.0e-5));
+    }
+
+    SECTION("Test continuity and monotonicity across penumbra")
+    {
+        const Real a = 4.65e-3;
+        const Real b = 1.1;
+        const Real delta = 1.0e-9;
+
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(a, b, b - a + delta) < 1.0e-6);
+        REQUIRE(computeConicalShadowFunctionFromApparentRadii(a, b, a + b - delta)
+                    > 1.0 - 1.0e-6);
+
+        Real previousShadowFunction = 0.0;
+        for (int i = 0; i <= 100; ++i)
+        {
+            const Real separation = b - a + 2.0 * a * static_cast<Real>(i) / 100.0;
+            const Real shadowFunction
+                = computeConicalShadowFunctionFromApparentRadii(a, b, separation);
+            REQUIRE(shadowFunction >= 0.0);
+            REQUIRE(shadowFunction <= 1.0);
+            REQUIRE(shadowFunction >= previousShadowFunction);
+            previousShadowFunction = shadowFunction;
+        }
+    }
+}
+
+TEST_CASE("Compute shadow function for Earth-orbiting object", "[shadow]")
+{
+    // Set Earth radius and solar radius [m], and position of Sun [m] (1 AU along x-axis).
+    const Real earthRadius = 6378136.3;
+    const Real sunRadius = 6.96e8;
+    const Real astronomicalUnit = 1.495978707e11;
+
+    Vector sunPosition(3, 0.0);
+    sunPosition[0] = astronomicalUnit;
+
+    Vector unitVectorToSun(3, 0.0);
+    unitVectorToSun[0] = 1.0;
+
+    Vector position(3, 0.0);
+
+    SECTION("Test object between Earth and Sun")
+    {
+        position[0] = 7.0e6;
+        REQUIRE(computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius)
+                    == 1.0);
+        REQUIRE(computeCylindricalShadowFunction(position, unitVectorToSun, earthRadius) == 1.0);
+    }
+
+    SECTION("Test object behind Earth")
+    {
+        position[0] = -7.0e6;
+        position[2] = 1.0e6;
+        REQUIRE(computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius)
+                    == 0.0);
+        REQUIRE(computeCylindricalShadowFunction(position, unitVectorToSun, earthRadius) == 0.0);
+    }
+
+    SECTION("Test object next to Earth")
+    {
+        position[1] = 7.0e6;
+        REQUIRE(computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius)
+                    == 1.0);
+        REQUIRE(computeCylindricalShadowFunction(position, unitVectorToSun, earthRadius) == 1.0);
+
+        position[0] = -4.2e7;
+        position[1] = 0.9 * earthRadius;
+        REQUIRE(computeCylindricalShadowFunction(position, unitVectorToSun, earthRadius) == 0.0);
+    }
+
+    SECTION("Test object crossing penumbra")
+    {
+        // At the distance of the GEO ring, the penumbra is (approximately) a ring around the edge
+        // of the cylindrical shadow, with a width of approximately 2 |x| R_sun / AU ~ 392 km,
+        // such that the shadow function increases from 0 to 1 as the object crosses this ring.
+        position[0] = -4.2164e7;
+
+        position[1] = earthRadius - 2.5e5;
+        REQUIRE(computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius)
+                    == 0.0);
+
+        position[1] = earthRadius + 2.5e5;
+        REQUIRE(computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius)
+                    == 1.0);
+
+        Real previousShadowFunction = 0.0;
+        for (int i = 0; i <= 100; ++i)
+        {
+            position[1] = earthRadius - 2.5e5 + 5.0e5 * static_cast<Real>(i) / 100.0;
+            const Real shadowFunction
+                = computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius);
+            REQUIRE(shadowFunction >= previousShadowFunction);
+            previousShadowFunction = shadowFunction;
+        }
+
+        // At the edge of the cylindrical shadow, the object is close to the middle of the
+        // penumbra.
+        position[1] = earthRadius;
+        const Real shadowFunction
+            = computeConicalShadowFunction(position, sunPosition, sunRadius, earthRadius);
+        REQUIRE(shadowFunction > 0.4);
+        REQUIRE(shadowFunction < 0.6);
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Montenbruck, O, and Gill, E. Satellite orbits: models, methods and applications. Springer
+ *      Science & Business Media, 2012.
+ */
@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/keplerPropagator.hpp"
+#include "astro/lambertSolver.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/sphericalHarmonicsAccelerationModel.hpp"
+#include "astro/stateVectorIndices.hpp"
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+// The single-precision results are compared against double-precision results computed from the
+// same (single-precision) inputs, such that the measured errors are due to the single-precision
+// arithmetic only. The error bounds are expressed as multiples of the single-precision machine
+// epsilon and correspond to the bounds documented in the README.
+
+typedef std::array<float, 3> FloatVector3;
+typedef std::array<double, 3> DoubleVector3;
+typedef std::array<float, 6> FloatVector6;
+typedef std::array<double, 6> DoubleVector6;
+
+const double floatEpsilon = std::numeric_limits<float>::epsilon();
+const double pi = 3.14159265358979323846;
+
+// Set Earth gravitational parameter [m^3 s^-2] and equatorial radius [m].
+const float gravitationalParameter = 3.986004415e14f;
+const float equatorialRadius = 6378.1363e3f;
+
+// Set unnormalized zonal coefficients J2-J6 (EGM-96) [-].
+const float zonalCoefficients[5] = {1.0826266835531513e-3f,
+                                    -2.5326564853322355e-6f,
+                                    -1.6196215913670001e-6f,
+                                    -2.2729608286349703e-7f,
+                                    5.4068117008370002e-7f};
+
+//! Compute absolute difference between two angles, accounting for wrapping at 2pi [rad].
+double computeAngleDifference(const double firstAngle, const double secondAngle)
+{
+    const double difference = std::fmod(std::fabs(firstAngle - secondAngle), 2.0 * pi);
+    return std::min(difference, 2.0 * pi - difference);
+}
+
+//! Compute absolute difference between single-precision and double-precision results.
+double computeAbsoluteError(const double computed, const double expected)
+{
+    return std::fabs(computed - expected);
+}
+
+//! Compute norm of 3-vector.
+template <typename Vector3>
+double computeNorm(const Vector3& vector)
+{
+    return std::sqrt(static_cast<double>(vector[0]) * vector[0]
+                     + static_cast<double>(vector[1]) * vector[1]
+                     + static_cast<double>(vector[2]) * vector[2]);
+}
+
+//! Compute largest component-wise error of 3-vector, relative to given scale.
+double computeRelativeError(const FloatVector3& computed,
+                            const DoubleVector3& expected,
+                            const double scale)
+{
+    double error = 0.0;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        error = std::max(error, computeAbsoluteError(computed[i], expected[i]) / scale);
+    }
+    return error;
+}
+
+//! Widen single-precision vector to double-precision.
+template <typename DoubleVector, typename FloatVector>
+DoubleVector widen(const FloatVector& vector)
+{
+    DoubleVector widenedVector;
+    for (std::size_t i = 0; i < vector.size(); ++i)
+    {
+        widenedVector[i] = vector[i];
+    }
+    return widenedVector;
+}
+
+//! Generate sample of Keplerian elements, spanning LEO to highly elliptical orbits.
+std::vector<FloatVector6> generateKeplerianElements(const std::size_t numberOfSamples)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<FloatVector6> samples(numberOfSamples);
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        const float eccentricity = 0.05f + 0.85f * unit(generator);
+        const float periapsisRadius = equatorialRadius + 200.0e3f + 2000.0e3f * unit(generator);
+        samples[i][semiMajorAxisIndex] = periapsisRadius / (1.0f - eccentricity);
+        samples[i][eccentricityIndex] = eccentricity;
+        samples[i][inclinationIndex] = 0.1f + 2.9f * unit(generator);
+        samples[i][argumentOfPeriapsisIndex] = 6.28f * unit(generator);
+        samples[i][longitudeOfAscendingNodeIndex] = 6.28f * unit(generator);
+        samples[i][trueAnomalyIndex] = 6.28f * unit(generator);
+    }
+    return samples;
+}
+
+TEST_CASE("Single-precision orbital element conversions", "[single_precision, conversions]")
+{
+    const std::size_t numberOfSamples = 2000;
+    const std::vector<FloatVector6> keplerianElements = generateKeplerianElements(numberOfSamples);
+
+    SECTION("Test Keplerian to Cartesian elements")
+    {
+        double positionError = 0.0;
+        double velocityError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const FloatVector6 computed
+                = convertKeplerianToCartesianElements(keplerianElements[i], gravitationalParameter);
+            const DoubleVector6 expected = convertKeplerianToCartesianElements(
+                widen<DoubleVector6>(keplerianElements[i]),
+                static_cast<double>(gravitationalParameter));
+
+            const double positionNorm = computeNorm(&expected[xPositionIndex]);
+            const double velocityNorm = computeNorm(&expected[xVelocityIndex]);
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                positionError
+                    = std::max(positionError,
+                               computeAbsoluteError(computed[j], expected[j]) / positionNorm);
+                velocityError = std::max(velocityError,
+                                         computeAbsoluteError(computed[j + 3], expected[j + 3])
+                                         / velocityNorm);
+            }
+        }
+
+        REQUIRE(positionError < 16.0 * floatEpsilon);
+        REQUIRE(velocityError < 16.0 * floatEpsilon);
+    }
+
+    SECTION("Test Cartesian to Keplerian elements (scalar and batch)")
+    {
+        std::vector<std::vector<float> > cartesianColumns(6, std::vector<float>(numberOfSamples));
+        std::vector<std::vector<float> > keplerianColumns(6, std::vector<float>(numberOfSamples));
+        const float* cartesianPointers[6];
+        float* keplerianPointers[6];
+
+        std::vector<FloatVector6> cartesianElements(numberOfSamples);
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            cartesianElements[i]
+                = convertKeplerianToCartesianElements(keplerianElements[i], gravitationalParameter);
+            for (std::size_t j = 0; j < 6; ++j)
+            {
+                cartesianColumns[j][i] = cartesianElements[i][j];
+            }
+        }
+        for (std::size_t j = 0; j < 6; ++j)
+        {
+            cartesianPointers[j] = cartesianColumns[j].data();
+            keplerianPointers[j] = keplerianColumns[j].data();
+        }
+        convertCartesianToKeplerianElements(
+            cartesianPointers, keplerianPointers, numberOfSamples, gravitationalParameter);
+
+        double semiMajorAxisError = 0.0;
+        double eccentricityError = 0.0;
+        double inclinationError = 0.0;
+        double angleError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const FloatVector6 computed
+                = convertCartesianToKeplerianElements(cartesianElements[i], gravitationalParameter);
+            const DoubleVector6 expected = convertCartesianToKeplerianElements(
+                widen<DoubleVector6>(cartesianElements[i]),
+                static_cast<double>(gravitationalParameter));
+
+            for (std::size_t j = 0; j < 6; ++j)
+            {
+                REQUIRE(keplerianColumns[j][i] == computed[j]);
+            }
+
+            semiMajorAxisError
+                = std::max(semiMajorAxisError,
+                           computeAbsoluteError(computed[semiMajorAxisIndex],
+                                                expected[semiMajorAxisIndex])
+                           / expected[semiMajorAxisIndex]);
+            eccentricityError
+                = std::max(eccentricityError,
+                           computeAbsoluteError(computed[eccentricityIndex],
+                                                expected[eccentricityIndex]));
+            inclinationError
+                = std::max(inclinationError,
+                           computeAbsoluteError(computed[inclinationIndex],
+                                                expected[inclinationIndex]));
+            for (std::size_t j = argumentOfPeriapsisIndex; j <= trueAnomalyIndex; ++j)
+            {
+                angleError = std::max(angleError, computeAngleDifference(computed[j], expected[j]));
+            }
+        }
+
+        REQUIRE(semiMajorAxisError < 128.0 * floatEpsilon);
+        REQUIRE(eccentricityError < 16.0 * floatEpsilon);
+        REQUIRE(inclinationError < 32.0 * floatEpsilon);
+
+        // The angles are computed using acos, which loses accuracy as its argument approaches +/-1
+        // (e.g., close to periapsis or the ascending node): an error of epsilon in the argument
+        // yields an error of sqrt(2 epsilon) in the angle.
+        REQUIRE(angleError < 4.0 * std::sqrt(floatEpsilon));
+    }
+
+    SECTION("Test anomaly conversions")
+    {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        double trueToEccentricError = 0.0;
+        double eccentricToTrueError = 0.0;
+        double eccentricToMeanError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const float eccentricity = 0.9f * unit(generator);
+            const float angle = 6.28f * unit(generator);
+
+            trueToEccentricError = std::max(
+                trueToEccentricError,
+                computeAngleDifference(
+                    convertTrueAnomalyToEccentricAnomaly(angle, eccentricity),
+                    convertTrueAnomalyToEccentricAnomaly<double>(angle, eccentricity)));
+            eccentricToTrueError = std::max(
+                eccentricToTrueError,
+                computeAngleDifference(
+                    convertEccentricAnomalyToTrueAnomaly(angle, eccentricity),
+                    convertEccentricAnomalyToTrueAnomaly<double>(angle, eccentricity)));
+            eccentricToMeanError = std::max(
+                eccentricToMeanError,
+                computeAngleDifference(
+                    convertEccentricAnomalyToMeanAnomaly(angle, eccentricity),
+                    convertEccentricAnomalyToMeanAnomaly<double>(angle, eccentricity)));
+        }
+
+        REQUIRE(trueToEccentricError < 16.0 * floatEpsilon);
+        REQUIRE(eccentricToTrueError < 16.0 * floatEpsilon);
+        REQUIRE(eccentricToMeanError < 16.0 * floatEpsilon);
+    }
+
+    SECTION("Test elliptical mean anomaly to eccentric anomaly (scalar and batch)")
+    {
+        std::mt19937 generator(11);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<float> eccentricities(numberOfSamples);
+        std::vector<float> meanAnomalies(numberOfSamples);
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            eccentricities[i] = 0.95f * unit(generator);
+            meanAnomalies[i] = 6.28f * unit(generator);
+        }
+
+        std::vector<float> eccentricAnomalies(numberOfSamples);
+        bool isConverged[numberOfSamples];
+        convertEllipticalMeanAnomalyToEccentricAnomaly<float, int>(
+            eccentricities.data(), meanAnomalies.data(), eccentricAnomalies.data(), isConverged,
+            numberOfSamples);
+
+        double newtonError = 0.0;
+        double markleyError = 0.0;
+        double batchError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const double expected = convertEllipticalMeanAnomalyToEccentricAnomaly<double, int>(
+                eccentricities[i], meanAnomalies[i]);
+
+            newtonError = std::max(
+                newtonError,
+                computeAngleDifference(convertEllipticalMeanAnomalyToEccentricAnomaly<float, int>(
+                                           eccentricities[i], meanAnomalies[i]),
+                                       expected));
+            markleyError = std::max(
+                markleyError,
+                computeAngleDifference(convertEllipticalMeanAnomalyToEccentricAnomalyMarkley(
+                                           eccentricities[i], meanAnomalies[i]),
+                                       expected));
+            batchError = std::max(batchError,
+                                  computeAngleDifference(eccentricAnomalies[i], expected));
+            REQUIRE(isConverged[i]);
+        }
+
+        REQUIRE(newtonError < 64.0 * floatEpsilon);
+        REQUIRE(markleyError < 64.0 * floatEpsilon);
+        REQUIRE(batchError < 64.0 * floatEpsilon);
+    }
+
+    SECTION("Test hyperbolic mean anomaly to eccentric anomaly (scalar and batch)")
+    {
+        std::mt19937 generator(13);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<float> eccentricities(numberOfSamples);
+        std::vector<float> meanAnomalies(numberOfSamples);
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            eccentricities[i] = 1.1f + 4.0f * unit(generator);
+            meanAnomalies[i] = 20.0f * (unit(generator) - 0.5f);
+        }
+
+        std::vector<float> eccentricAnomalies(numberOfSamples);
+        bool isConverged[numberOfSamples];
+        convertHyperbolicMeanAnomalyToEccentricAnomaly<float, int>(
+            eccentricities.data(), meanAnomalies.data(), eccentricAnomalies.data(), isConverged,
+            numberOfSamples);
+
+        double scalarError = 0.0;
+        double batchError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const double expected = convertHyperbolicMeanAnomalyToEccentricAnomaly<double, int>(
+                eccentricities[i], meanAnomalies[i]);
+            const double scale = std::max(1.0, std::fabs(expected));
+
+            scalarError = std::max(scalarError,
+                                   computeAbsoluteError(
+                                       convertHyperbolicMeanAnomalyToEccentricAnomaly<float, int>(
+                                           eccentricities[i], meanAnomalies[i]),
+                                       expected) / scale);
+            batchError = std::max(batchError,
+                                  computeAbsoluteError(eccentricAnomalies[i], expected) / scale);
+            REQUIRE(isConverged[i]);
+        }
+
+        REQUIRE(scalarError < 16.0 * floatEpsilon);
+        REQUIRE(batchError < 16.0 * floatEpsilon);
+    }
+
+    SECTION("Test Kepler propagator")
+    {
+        double positionError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const FloatVector6 state
+                = convertKeplerianToCartesianElements(keplerianElements[i], gravitationalParameter);
+            const float semiMajorAxis = keplerianElements[i][semiMajorAxisIndex];
+
+            // Propagate by a quarter of the orbital period.
+            const float timeOfFlight
+                = 0.5f * static_cast<float>(pi)
+                  * std::sqrt(semiMajorAxis * semiMajorAxis * semiMajorAxis
+                              / gravitationalParameter);
+
+            const FloatVector6 computed
+                = propagateKeplerOrbit(state, gravitationalParameter, timeOfFlight);
+            const DoubleVector6 expected
+                = propagateKeplerOrbit(widen<DoubleVector6>(state),
+                                       static_cast<double>(gravitationalParameter),
+                                       static_cast<double>(timeOfFlight));
+
+            const double positionNorm = computeNorm(&expected[xPositionIndex]);
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                positionError
+                    = std::max(positionError,
+                               computeAbsoluteError(computed[j], expected[j]) / positionNorm);
+            }
+        }
+
+        REQUIRE(positionError < 256.0 * floatEpsilon);
+    }
+}
+
+TEST_CASE("Single-precision acceleration models", "[single_precision, acceleration, models]")
+{
+    const std::size_t numberOfSamples = 2000;
+    const std::vector<FloatVector6> keplerianElements = generateKeplerianElements(numberOfSamples);
+
+    std::vector<FloatVector3> positions(numberOfSamples);
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        const FloatVector6 state
+            = convertKeplerianToCartesianElements(keplerianElements[i], gravitationalParameter);
+        positions[i][0] = state[xPositionIndex];
+        positions[i][1] = state[yPositionIndex];
+        positions[i][2] = state[zPositionIndex];
+    }
+
+    const double doubleZonalCoefficients[5] = {zonalCoefficients[0],
+                                               zonalCoefficients[1],
+                                               zonalCoefficients[2],
+                                               zonalCoefficients[3],
+                                               zonalCoefficients[4]};
+
+    SECTION("Test central body, J2 and fused central body + J2 accelerations")
+    {
+        double centralBodyError = 0.0;
+        double j2Error = 0.0;
+        double fusedError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const DoubleVector3 position = widen<DoubleVector3>(positions[i]);
+
+            const DoubleVector3 centralBodyAcceleration
+                = computeCentralBodyAcceleration(static_cast<double>(gravitationalParameter),
+                                                 position);
+            centralBodyError = std::max(
+                centralBodyError,
+                computeRelativeError(
+                    computeCentralBodyAcceleration(gravitationalParameter, positions[i]),
+                    centralBodyAcceleration, computeNorm(centralBodyAcceleration)));
+
+            const DoubleVector3 j2Acceleration
+                = computeJ2Acceleration(static_cast<double>(gravitationalParameter), position,
+                                        static_cast<double>(equatorialRadius),
+                                        doubleZonalCoefficients[0]);
+            j2Error = std::max(
+                j2Error,
+                computeRelativeError(
+                    computeJ2Acceleration(gravitationalParameter, positions[i], equatorialRadius,
+                                          zonalCoefficients[0]),
+                    j2Acceleration, computeNorm(j2Acceleration)));
+
+            const DoubleVector3 fusedAcceleration = computeCentralBodyAndJ2Acceleration(
+                static_cast<double>(gravitationalParameter), position,
+                static_cast<double>(equatorialRadius), doubleZonalCoefficients[0]);
+            fusedError = std::max(
+                fusedError,
+                computeRelativeError(
+                    computeCentralBodyAndJ2Acceleration(gravitationalParameter, positions[i],
+                                                        equatorialRadius, zonalCoefficients[0]),
+                    fusedAcceleration, computeNorm(fusedAcceleration)));
+        }
+
+        REQUIRE(centralBodyError < 16.0 * floatEpsilon);
+        REQUIRE(j2Error < 32.0 * floatEpsilon);
+        REQUIRE(fusedError < 16.0 * floatEpsilon);
+    }
+
+    SECTION("Test zonal and spherical harmonics accelerations")
+    {
+        // Set degree 10 gravity field with zonal coefficients J2-J6 and deterministic,
+        // pseudo-random tesseral and sectorial coefficients.
+        typedef SphericalHarmonicsGravityField<float> FloatGravityField;
+        const std::size_t maximumDegree = 10;
+        const std::size_t numberOfCoefficients
+            = FloatGravityField::getTriangularIndex(maximumDegree + 1, 0);
+        std::vector<float> cosineCoefficients(numberOfCoefficients, 0.0f);
+        std::vector<float> sineCoefficients(numberOfCoefficients, 0.0f);
+        cosineCoefficients[0] = 1.0f;
+        for (std::size_t n = 2; n <= maximumDegree; ++n)
+        {
+            const std::size_t zonalIndex = FloatGravityField::getTriangularIndex(n, 0);
+            if (n <= 6)
+            {
+                cosineCoefficients[zonalIndex] = static_cast<float>(
+                    -doubleZonalCoefficients[n - 2] / std::sqrt(2.0 * n + 1.0));
+            }
+            for (std::size_t m = 1; m <= n; ++m)
+            {
+                const std::size_t index = FloatGravityField::getTriangularIndex(n, m);
+                cosineCoefficients[index] = static_cast<float>(1.0e-6 * std::sin(1.0 + 3.0 * index)
+                                                               / n);
+                sineCoefficients[index] = static_cast<float>(1.0e-6 * std::cos(2.0 + 5.0 * index)
+                                                             / n);
+            }
+        }
+        const std::vector<double> doubleCosineCoefficients(cosineCoefficients.begin(),
+                                                           cosineCoefficients.end());
+        const std::vector<double> doubleSineCoefficients(sineCoefficients.begin(),
+                                                         sineCoefficients.end());
+
+        const FloatGravityField floatGravityField(gravitationalParameter,
+                                                  equatorialRadius,
+                                                  maximumDegree,
+                                                  cosineCoefficients.data(),
+                                                  sineCoefficients.data());
+        const SphericalHarmonicsGravityField<double> doubleGravityField(
+            static_cast<double>(gravitationalParameter), static_cast<double>(equatorialRadius),
+            maximumDegree, doubleCosineCoefficients.data(), doubleSineCoefficients.data());
+        SphericalHarmonicsAccelerationModel<float> floatModel(floatGravityField);
+        SphericalHarmonicsAccelerationModel<double> doubleModel(doubleGravityField);
+
+        double zonalError = 0.0;
+        double sphericalError = 0.0;
+        for (std::size_t i = 0; i < numberOfSamples; ++i)
+        {
+            const DoubleVector3 position = widen<DoubleVector3>(positions[i]);
+
+            const DoubleVector3 zonalAcceleration = computeZonalHarmonicsAcceleration<6>(
+                static_cast<double>(gravitationalParameter), position,
+                static_cast<double>(equatorialRadius), doubleZonalCoefficients);
+            zonalError = std::max(
+                zonalError,
+                computeRelativeError(
+                    computeZonalHarmonicsAcceleration<6>(gravitationalParameter, positions[i],
+                                                         equatorialRadius, zonalCoefficients),
+                    zonalAcceleration, computeNorm(zonalAcceleration)));
+
+            // The error of the spherical harmonics acceleration (which includes the central body
+            // term) is expressed relative to the central body acceleration.
+            const DoubleVector3 centralBodyAcceleration
+                = computeCentralBodyAcceleration(static_cast<double>(gravitationalParameter),
+                                                 position);
+            sphericalError = std::max(
+                sphericalError,
+                computeRelativeError(floatModel.computeAcceleration(positions[i]),
+                                     doubleModel.computeAcceleration(position),
+                                     computeNorm(centralBodyAcceleration)));
+        }
+
+        REQUIRE(zonalError < 64.0 * floatEpsilon);
+        REQUIRE(sphericalError < 32.0 * floatEpsilon);
+    }
+}
+
+TEST_CASE("Single-precision Lambert solver", "[single_precision, lambert-solver]")
+{
+    const std::size_t numberOfSamples = 2000;
+    const std::vector<FloatVector6> keplerianElements = generateKeplerianElements(numberOfSamples);
+
+    double velocityError = 0.0;
+    for (std::size_t i = 0; i < numberOfSamples; ++i)
+    {
+        const DoubleVector6 state = convertKeplerianToCartesianElements(
+            widen<DoubleVector6>(keplerianElements[i]),
+            static_cast<double>(gravitationalParameter));
+        const double semiMajorAxis = keplerianElements[i][semiMajorAxisIndex];
+        const double timeOfFlight
+            = 0.3 * 2.0 * pi
+              * std::sqrt(semiMajorAxis * semiMajorAxis * semiMajorAxis
+                          / static_cast<double>(gravitationalParameter));
+        const DoubleVector6 arrivalState
+            = KeplerPropagator<double, DoubleVector6>(state,
+                                                      static_cast<double>(gravitationalParameter))
+                  .propagate(timeOfFlight);
+
+        const FloatVector3 departurePosition = {{static_cast<float>(state[xPositionIndex]),
+                                                 static_cast<float>(state[yPositionIndex]),
+                                                 static_cast<float>(state[zPositionIndex])}};
+        const FloatVector3 arrivalPosition = {{static_cast<float>(arrivalState[xPositionIndex]),
+                                               static_cast<float>(arrivalState[yPositionIndex]),
+                                               static_cast<float>(arrivalState[zPositionIndex])}};
+        const bool isRetrograde
+            = static_cast<double>(keplerianElements[i][inclinationIndex]) > 0.5 * pi;
+
+        // The default tolerance is derived from the machine epsilon, such that the solver
+        // converges in single precision.
+        FloatVector3 floatDepartureVelocity;
+        FloatVector3 floatArrivalVelocity;
+        REQUIRE_NOTHROW(solveLambertProblem(departurePosition,
+                                            arrivalPosition,
+                                            static_cast<float>(timeOfFlight),
+                                            gravitationalParameter,
+                                            floatDepartureVelocity,
+                                            floatArrivalVelocity,
+                                            isRetrograde));
+
+        DoubleVector3 doubleDepartureVelocity;
+        DoubleVector3 doubleArrivalVelocity;
+        solveLambertProblem(widen<DoubleVector3>(departurePosition),
+                            widen<DoubleVector3>(arrivalPosition),
+                            static_cast<double>(static_cast<float>(timeOfFlight)),
+                            static_cast<double>(gravitationalParameter),
+                            doubleDepartureVelocity,
+                            doubleArrivalVelocity,
+                            isRetrograde);
+
+        velocityError = std::max(velocityError,
+                                 computeRelativeError(floatDepartureVelocity,
+                                                      doubleDepartureVelocity,
+                                                      computeNorm(doubleDepartureVelocity)));
+        velocityError = std::max(velocityError,
+                                 computeRelativeError(floatArrivalVelocity,
+                                                      doubleArrivalVelocity,
+                                                      computeNorm(doubleArrivalVelocity)));
+    }
+
+    REQUIRE(velocityError < 4096.0 * floatEpsilon);
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/sphericalHarmonicsAccelerationModel.hpp"
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef SphericalHarmonicsGravityField<Real> GravityField;
+
+//! Compute normalization factor of associated Legendre function.
+Real computeNormalizationFactor(const std::size_t degree, const std::size_t order)
+{
+    Real factorialRatio = 1.0;
+    for (std::size_t k = degree - order + 1; k <= degree + order; ++k)
+    {
+        factorialRatio *= static_cast<Real>(k);
+    }
+    return std::sqrt((order == 0 ? 1.0 : 2.0) * (2.0 * degree + 1.0) / factorialRatio);
+}
+
+//! Compute gravitational potential by direct evaluation of associated Legendre functions.
+Real computePotential(const GravityField& gravityField,
+                      const Vector& cosineCoefficients,
+                      const Vector& sineCoefficients,
+                      const Vector& position)
+{
+    const std::size_t degree = gravityField.getMaximumDegree();
+    const Real r = std::sqrt(position[0] * position[0]
+                             + position[1] * position[1]
+                             + position[2] * position[2]);
+    const Real u = position[2] / r;
+    const Real longitude = std::atan2(position[1], position[0]);
+
+    // Compute unnormalized associated Legendre functions, without Condon-Shortley phase.
+    std::vector<Vector> legendreFunctions(degree + 1, Vector(degree + 1, 0.0));
+    for (std::size_t m = 0; m <= degree; ++m)
+    {
+        Real sectorial = 1.0;
+        for (std::size_t k = 1; k <= m; ++k)
+        {
+            sectorial *= (2.0 * k - 1.0) * std::sqrt(1.0 - u * u);
+        }
+        legendreFunctions[m][m] = sectorial;
+        if (m + 1 <= degree)
+        {
+            legendreFunctions[m + 1][m] = (2.0 * m + 1.0) * u * sectorial;
+        }
+        for (std::size_t n = m + 2; n <= degree; ++n)
+        {
+            legendreFunctions[n][m] = ((2.0 * n - 1.0) * u * legendreFunctions[n - 1][m]
+                                       - (n + m - 1.0) * legendreFunctions[n - 2][m])
+                                      / static_cast<Real>(n - m);
+        }
+    }
+
+    Real potential = 0.0;
+    for (std::size_t n = 0; n <= degree; ++n)
+    {
+        for (std::size_t m = 0; m <= n; ++m)
+        {
+            const std::size_t index = GravityField::getTriangularIndex(n, m);
+            potential += std::pow(gravityField.getReferenceRadius() / r, static_cast<Real>(n))
+                         * computeNormalizationFactor(n, m) * legendreFunctions[n][m]
+                         * (cosineCoefficients[index] * std::cos(m * longitude)
+                            + sineCoefficients[index] * std::sin(m * longitude));
+        }
+    }
+    return gravityField.getGravitationalParameter() / r * potential;
+}
+
+TEST_CASE("Compute spherical harmonics acceleration vector",
+          "[spherical_harmonics_gravity, acceleration, models]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2] and equatorial radius [m].
+    const Real gravitationalParameter = 3.986004415e14;
+    const Real equatorialRadius = 6378.1363e3;
+
+    // Set unnormalized zonal coefficients J2-J6 (EGM-96) [-].
+    const Real zonalCoefficients[5]
+        = {1.0826266835531513e-3,
+           -2.5326564853322355e-6,
+           -1.6196215913670001e-6,
+           -2.2729608286349703e-7,
+           5.4068117008370002e-7};
+
+    // Set position vector [m].
+    Vector position(3);
+    position[0] = 3.75e6;
+    position[1] = 4.24e6;
+    position[2] = -1.39e6;
+
+    // Set maximum degree of gravity field.
+    const std::size_t maximumDegree = 10;
+    const std::size_t numberOfCoefficients
+        = GravityField::getTriangularIndex(maximumDegree + 1, 0);
+
+    // Set zonal gravity field.
+    Vector zonalCosineCoefficients(numberOfCoefficients, 0.0);
+    const Vector zonalSineCoefficients(numberOfCoefficients, 0.0);
+    zonalCosineCoefficients[0] = 1.0;
+    for (std::size_t n = 2; n <= 6; ++n)
+    {
+        zonalCosineCoefficients[GravityField::getTriangularIndex(n, 0)]
+            = -zonalCoefficients[n - 2] / std::sqrt(2.0 * n + 1.0);
+    }
+
+    const GravityField zonalGravityField(gravitationalParameter,
+                                         equatorialRadius,
+                                         maximumDegree,
+                                         zonalCosineCoefficients.data(),
+                                         zonalSineCoefficients.data());
+
+    // Set full gravity field with deterministic, pseudo-random tesseral and sectorial coefficients.
+    Vector cosineCoefficients = zonalCosineCoefficients;
+    Vector sineCoefficients(numberOfCoefficients, 0.0);
+    for (std::size_t n = 2; n <= maximumDegree; ++n)
+    {
+        for (std::size_t m = 1; m <= n; ++m)
+        {
+            const std::size_t index = GravityField::getTriangularIndex(n, m);
+            cosineCoefficients[index] = 1.0e-6 * std::sin(1.0 + 3.0 * index) / n;
+            sineCoefficients[index] = 1.0e-6 * std::cos(2.0 + 5.0 * index) / n;
+        }
+    }
+
+    const GravityField gravityField(gravitationalParameter,
+                                    equatorialRadius,
+                                    maximumDegree,
+                                    cosineCoefficients.data(),
+                                    sineCoefficients.data());
+
+    SECTION("Test central body acceleration (degree 0)")
+    {
+        SphericalHarmonicsAccelerationModel<Real> model(gravityField);
+        const Vector computedAcceleration = model.computeAcceleration(position, 0, 0);
+        const Vector expectedAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, position);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test zonal gravity field against zonal harmonics acceleration")
+    {
+        SphericalHarmonicsAccelerationModel<Real> model(zonalGravityField);
+        const Vector computedAcceleration = model.computeAcceleration(position);
+
+        const Vector centralBodyAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, position);
+        const Vector zonalAcceleration = computeZonalHarmonicsAcceleration<6>(
+            gravitationalParameter, position, equatorialRadius, zonalCoefficients);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(centralBodyAcceleration[i] + zonalAcceleration[i])
+                               .epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test full gravity field against gradient of potential")
+    {
+        SphericalHarmonicsAccelerationModel<Real> model(gravityField);
+        const Vector computedAcceleration = model.computeAcceleration(position);
+        const Vector centralBodyAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, position);
+
+        // Compute the gradient of the potential using central differences. The central body
+        // acceleration is subtracted to compare the (small) perturbing acceleration.
+        const Real perturbation = 1.0;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            Vector forwardPosition = position;
+            Vector backwardPosition = position;
+            forwardPosition[i] += perturbation;
+            backwardPosition[i] -= perturbation;
+
+            const Real expectedAcceleration
+                = (computePotential(gravityField, cosineCoefficients, sineCoefficients,
+                                    forwardPosition)
+                   - computePotential(gravityField, cosineCoefficients, sineCoefficients,
+                                      backwardPosition))
+                  / (2.0 * perturbation);
+
+            REQUIRE(computedAcceleration[i] - centralBodyAcceleration[i]
+                        == Catch::Approx(expectedAcceleration - centralBodyAcceleration[i])
+                               .epsilon(1.0e-5));
+        }
+    }
+
+    SECTION("Test truncation of degree and order")
+    {
+        // Set gravity field that only contains the coefficients up to degree 4 and order 3.
+        const std::size_t degree = 4;
+        const std::size_t order = 3;
+        const std::size_t numberOfTruncatedCoefficients
+            = GravityField::getTriangularIndex(degree + 1, 0);
+        Vector truncatedCosineCoefficients(numberOfTruncatedCoefficients, 0.0);
+        Vector truncatedSineCoefficients(numberOfTruncatedCoefficients, 0.0);
+        for (std::size_t n = 0; n <= degree; ++n)
+        {
+            for (std::size_t m = 0; m <= std::min(n, order); ++m)
+            {
+                const std::size_t index = GravityField::getTriangularIndex(n, m);
+                truncatedCosineCoefficients[index] = cosineCoefficients[index];
+                truncatedSineCoefficients[index] = sineCoefficients[index];
+            }
+        }
+        const GravityField truncatedGravityField(gravitationalParameter,
+                                                 equatorialRadius,
+                                                 degree,
+                                                 truncatedCosineCoefficients.data(),
+                                                 truncatedSineCoefficients.data());
+
+        SphericalHarmonicsAccelerationModel<Real> model(gravityField);
+        SphericalHarmonicsAccelerationModel<Real> truncatedModel(truncatedGravityField);
+        const Vector computedAcceleration = model.computeAcceleration(position, degree, order);
+        const Vector expectedAcceleration = truncatedModel.computeAcceleration(position);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(1.0e-15));
+        }
+    }
+
+    SECTION("Test position on the pole")
+    {
+        Vector polarPosition(3);
+        polarPosition[0] = 0.0;
+        polarPosition[1] = 0.0;
+        polarPosition[2] = 7.0e6;
+
+        SphericalHarmonicsAccelerationModel<Real> model(zonalGravityField);
+        const Vector computedAcceleration = model.computeAcceleration(polarPosition);
+
+        const Vector centralBodyAcceleration
+            = computeCentralBodyAcceleration(gravitationalParameter, polarPosition);
+        const Vector zonalAcceleration = computeZonalHarmonicsAcceleration<6>(
+            gravitationalParameter, polarPosition, equatorialRadius, zonalCoefficients);
+
+        REQUIRE(computedAcceleration[0] == 0.0);
+        REQUIRE(computedAcceleration[1] == 0.0);
+        REQUIRE(computedAcceleration[2]
+                    == Catch::Approx(centralBodyAcceleration[2] + zonalAcceleration[2])
+                           .epsilon(1.0e-14));
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -35,5 +35,15 @@ TEST_CASE("Test definition of Keplerian element indices", "[constants]")
     REQUIRE(meanAnomalyIndex              == 5);
 }
 
+TEST_CASE("Test definition of modified equinoctial element indices", "[constants]")
+{
+    REQUIRE(semiLatusRectumEquinoctialIndex == 0);
+    REQUIRE(fEquinoctialIndex               == 1);
+    REQUIRE(gEquinoctialIndex               == 2);
+    REQUIRE(hEquinoctialIndex               == 3);
+    REQUIRE(kEquinoctialIndex               == 4);
+    REQUIRE(trueLongitudeEquinoctialIndex   == 5);
+}
+
 } // namespace tests
 } // namespace astro
@@ -126,6 +126,51 @@ TEST_CASE("Compute circular velocity", "[circular-velocity]")
 
 }
 
+TEST_CASE("Compute two-body quantities at compile time", "[constexpr, two-body-methods]")
+{
+    // Set gravitational parameter of Earth [m^3 s^-2], satellite mass [kg] and semi-major axis of
+    // geostationary orbit [m].
+    constexpr Real earthGravitationalParameter = 6.67259e-11 * 5.9736e24;
+    constexpr Real satelliteMass = 1.0e3;
+    constexpr Real semiMajorAxis = 4.2164e7;
+
+    // Compute quantities in constant expressions.
+    constexpr Real meanMotion = computeKeplerMeanMotionConstexpr(
+        semiMajorAxis, earthGravitationalParameter, satelliteMass);
+    constexpr Real orbitalPeriod = computeKeplerOrbitalPeriodConstexpr(
+        semiMajorAxis, earthGravitationalParameter, satelliteMass);
+    constexpr Real circularVelocity
+        = computeCircularVelocityConstexpr(semiMajorAxis, earthGravitationalParameter);
+
+    static_assert(orbitalPeriod > 86164.0 && orbitalPeriod < 86165.0,
+                  "Orbital period of geostationary orbit must be computed at compile time!");
+
+    SECTION("Test against runtime computation")
+    {
+        REQUIRE(meanMotion
+                    == Catch::Approx(computeKeplerMeanMotion(
+                           semiMajorAxis, earthGravitationalParameter, satelliteMass))
+                           .epsilon(1.0e-15));
+        REQUIRE(orbitalPeriod
+                    == Catch::Approx(computeKeplerOrbitalPeriod(
+                           semiMajorAxis, earthGravitationalParameter, satelliteMass))
+                           .epsilon(1.0e-15));
+        REQUIRE(circularVelocity
+                    == Catch::Approx(computeCircularVelocity(
+                           semiMajorAxis, earthGravitationalParameter))
+                           .epsilon(1.0e-15));
+    }
+
+    SECTION("Test single precision")
+    {
+        constexpr float singlePrecisionOrbitalPeriod = computeKeplerOrbitalPeriodConstexpr(
+            4.2164e7f, 3.986004415e14f);
+        REQUIRE(singlePrecisionOrbitalPeriod
+                    == Catch::Approx(computeKeplerOrbitalPeriod(4.2164e7f, 3.986004415e14f))
+                           .epsilon(1.0e-6));
+    }
+}
+
 } // namespace tests
 } // namespace astro
 
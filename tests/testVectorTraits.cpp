@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "astro/centralBodyAccelerationModel.hpp"
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/modifiedEquinoctialElementConversions.hpp"
+#include "astro/orbitalElementConversions.hpp"
+#include "astro/radiationPressureAccelerationModel.hpp"
+#include "astro/sphericalHarmonicsAccelerationModel.hpp"
+#include "astro/vectorTraits.hpp"
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+typedef std::array<Real, 6> Array6;
+typedef std::array<Real, 3> Array3;
+
+TEST_CASE("Check vector traits", "[vector-traits]")
+{
+    SECTION("Test vector types")
+    {
+        REQUIRE(IsVector<Vector>::value);
+        REQUIRE(IsVector<Vector&>::value);
+        REQUIRE(IsVector<const Vector&>::value);
+        REQUIRE(IsVector<Array6>::value);
+        REQUIRE(IsVector<Real*>::value);
+        REQUIRE(IsVector<const Real*>::value);
+        REQUIRE(IsVector<Real[6]>::value);
+
+        REQUIRE(!IsVector<Real>::value);
+        REQUIRE(!IsVector<Real&>::value);
+        REQUIRE(!IsVector<int>::value);
+    }
+
+    SECTION("Test value types")
+    {
+        REQUIRE(std::is_same<VectorTraits<Vector>::ValueType, Real>::value);
+        REQUIRE(std::is_same<VectorTraits<std::array<float, 3> >::ValueType, float>::value);
+        REQUIRE(std::is_same<VectorTraits<const Real*>::ValueType, Real>::value);
+        REQUIRE(std::is_same<VectorTraits<float[6]>::ValueType, float>::value);
+    }
+
+    SECTION("Test vector sizes")
+    {
+        const Vector vector(6);
+        const Array3 array = {{0.0, 0.0, 0.0}};
+        const Real builtInArray[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        const Real* const pointer = builtInArray;
+
+        REQUIRE(hasVectorSize(vector, 6));
+        REQUIRE(!hasVectorSize(vector, 3));
+        REQUIRE(hasVectorSize(array, 3));
+        REQUIRE(!hasVectorSize(array, 6));
+        REQUIRE(hasVectorSize(builtInArray, 6));
+        REQUIRE(!hasVectorSize(builtInArray, 3));
+        REQUIRE(hasVectorSize(pointer, 6));
+        REQUIRE(hasVectorSize(pointer, 3));
+    }
+}
+
+TEST_CASE("Convert elements into given output vectors", "[vector-traits]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+
+    Vector keplerianElements(6);
+    keplerianElements[semiMajorAxisIndex] = 8000.0e3;
+    keplerianElements[eccentricityIndex] = 0.23;
+    keplerianElements[inclinationIndex] = 0.7;
+    keplerianElements[argumentOfPeriapsisIndex] = 1.3;
+    keplerianElements[longitudeOfAscendingNodeIndex] = 4.1;
+    keplerianElements[trueAnomalyIndex] = 2.6;
+
+    const Vector cartesianElements
+        = convertKeplerianToCartesianElements(keplerianElements, earthGravitationalParameter);
+    const Vector modifiedEquinoctialElements
+        = convertKeplerianToModifiedEquinoctialElements(keplerianElements);
+
+    SECTION("Test Keplerian and Cartesian elements")
+    {
+        Array6 array;
+        convertKeplerianToCartesianElements(keplerianElements, earthGravitationalParameter, array);
+
+        Real builtInArray[6];
+        convertCartesianToKeplerianElements(array, earthGravitationalParameter, builtInArray);
+
+        // Reuse the output vector, without allocation.
+        Vector vector(6);
+        convertKeplerianToCartesianElements(
+            builtInArray, earthGravitationalParameter, vector.data());
+
+        const Vector expectedKeplerianElements
+            = convertCartesianToKeplerianElements(cartesianElements, earthGravitationalParameter);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(array[i] == cartesianElements[i]);
+            REQUIRE(builtInArray[i] == expectedKeplerianElements[i]);
+        }
+
+        // Convert in-place.
+        Vector state = cartesianElements;
+        convertCartesianToKeplerianElements(state, earthGravitationalParameter, state);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == expectedKeplerianElements[i]);
+        }
+        convertKeplerianToCartesianElements(state.data(), earthGravitationalParameter, state);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == vector[i]);
+        }
+    }
+
+    SECTION("Test modified equinoctial elements")
+    {
+        Array6 array;
+        convertKeplerianToModifiedEquinoctialElements(keplerianElements, array);
+
+        Real builtInArray[6];
+        convertModifiedEquinoctialToCartesianElements(
+            array, earthGravitationalParameter, builtInArray);
+
+        const Vector expectedCartesianElements = convertModifiedEquinoctialToCartesianElements(
+            modifiedEquinoctialElements, earthGravitationalParameter);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(array[i] == modifiedEquinoctialElements[i]);
+            REQUIRE(builtInArray[i] == expectedCartesianElements[i]);
+        }
+
+        // Convert in-place.
+        Real* const state = builtInArray;
+        convertCartesianToModifiedEquinoctialElements(state, earthGravitationalParameter, state);
+        const Vector expectedModifiedEquinoctialElements
+            = convertCartesianToModifiedEquinoctialElements(expectedCartesianElements,
+                                                            earthGravitationalParameter);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == expectedModifiedEquinoctialElements[i]);
+        }
+
+        convertModifiedEquinoctialToKeplerianElements(state, state);
+        const Vector expectedKeplerianElements
+            = convertModifiedEquinoctialToKeplerianElements(expectedModifiedEquinoctialElements);
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(state[i] == expectedKeplerianElements[i]);
+        }
+    }
+}
+
+TEST_CASE("Compute accelerations into given output vectors", "[vector-traits]")
+{
+    const Real earthGravitationalParameter = 3.986004418e14;
+    const Real earthEquatorialRadius = 6378137.0;
+    const Real earthJ2 = 1.0826269e-3;
+
+    const Array3 position = {{4.0e6, -5.5e6, 2.5e6}};
+
+    SECTION("Test central body acceleration")
+    {
+        const Array3 expectedAcceleration
+            = computeCentralBodyAcceleration(earthGravitationalParameter, position);
+
+        Vector acceleration(3);
+        computeCentralBodyAcceleration(earthGravitationalParameter, position, acceleration);
+
+        Real inPlaceAcceleration[3] = {position[0], position[1], position[2]};
+        computeCentralBodyAcceleration(
+            earthGravitationalParameter, inPlaceAcceleration, inPlaceAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+        }
+    }
+
+    SECTION("Test J2 acceleration")
+    {
+        const Array3 expectedAcceleration = computeJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2);
+
+        Vector acceleration(3);
+        computeJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2, acceleration);
+
+        Real inPlaceAcceleration[3] = {position[0], position[1], position[2]};
+        computeJ2Acceleration(earthGravitationalParameter,
+                              inPlaceAcceleration,
+                              earthEquatorialRadius,
+                              earthJ2,
+                              inPlaceAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+        }
+    }
+
+    SECTION("Test fused central body and J2 acceleration")
+    {
+        const Array3 expectedAcceleration = computeCentralBodyAndJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2);
+
+        Vector acceleration(3);
+        computeCentralBodyAndJ2Acceleration(
+            earthGravitationalParameter, position, earthEquatorialRadius, earthJ2, acceleration);
+
+        Real inPlaceAcceleration[3] = {position[0], position[1], position[2]};
+        computeCentralBodyAndJ2Acceleration(earthGravitationalParameter,
+                                            inPlaceAcceleration,
+                                            earthEquatorialRadius,
+                                            earthJ2,
+                                            inPlaceAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+        }
+    }
+
+    SECTION("Test zonal harmonics acceleration")
+    {
+        const Real zonalCoefficients[3] = {earthJ2, -2.5326564853322355e-6, -1.6196215913670001e-6};
+
+        const Array3 expectedAcceleration = computeZonalHarmonicsAcceleration<4>(
+            earthGravitationalParameter, position, earthEquatorialRadius, zonalCoefficients);
+
+        Vector acceleration(3);
+        computeZonalHarmonicsAcceleration<4>(earthGravitationalParameter,
+                                             position,
+                                             earthEquatorialRadius,
+                                             zonalCoefficients,
+                                             acceleration);
+
+        Real inPlaceAcceleration[3] = {position[0], position[1], position[2]};
+        computeZonalHarmonicsAcceleration<4>(earthGravitationalParameter,
+                                             inPlaceAcceleration,
+                                             earthEquatorialRadius,
+                                             zonalCoefficients,
+                                             inPlaceAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+        }
+    }
+
+    SECTION("Test spherical harmonics acceleration")
+    {
+        // Set normalized coefficients up to degree and order 2 (triangular arrays).
+        const Real cosineCoefficients[6] = {1.0, 0.0, 0.0, -4.841651e-4, -2.0e-10, 2.439e-6};
+        const Real sineCoefficients[6] = {0.0, 0.0, 0.0, 0.0, 1.4e-9, -1.400e-6};
+        const SphericalHarmonicsGravityField<Real> gravityField(earthGravitationalParameter,
+                                                                earthEquatorialRadius,
+                                                                2,
+                                                                cosineCoefficients,
+                                                                sineCoefficients);
+        SphericalHarmonicsAccelerationModel<Real> model(gravityField);
+
+        const Array3 expectedAcceleration = model.computeAcceleration(position);
+        const Array3 expectedTruncatedAcceleration = model.computeAcceleration(position, 2, 0);
+
+        Vector acceleration(3);
+        model.computeAcceleration(position, acceleration);
+
+        Vector truncatedAcceleration(3);
+        model.computeAcceleration(position, 2, 0, truncatedAcceleration);
+
+        Real inPlaceAcceleration[3] = {position[0], position[1], position[2]};
+        model.computeAcceleration(inPlaceAcceleration, inPlaceAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(truncatedAcceleration[i] == expectedTruncatedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+        }
+    }
+
+    SECTION("Test radiation pressure accelerations")
+    {
+        const Real radiationPressure = 4.56e-6;
+        const Real radiationPressureCoefficient = 1.3;
+        const Real radius = 1.0e-3;
+        const Real bulkDensity = 2.0e3;
+        const Array3 unitVectorToSource = {{0.6, -0.8, 0.0}};
+        const Array3 velocity = {{1.2e3, 3.4e4, -5.0e2}};
+        const Array3 sunPosition = {{1.0e11, 1.0e11, 1.0e9}};
+
+        const Array3 expectedAcceleration = computeCannonballRadiationPressureAcceleration(
+            radiationPressure, radiationPressureCoefficient, unitVectorToSource, radius,
+            bulkDensity);
+        const Array3 expectedShadowedAcceleration
+            = computeShadowedCannonballRadiationPressureAcceleration(
+                radiationPressure, 1.495978707e11, radiationPressureCoefficient, position,
+                sunPosition, 6.957e8, earthEquatorialRadius, radius, bulkDensity);
+        const Array3 expectedDragAcceleration = computeCannonballPoyntingRobertsonDragAcceleration(
+            radiationPressure, radiationPressureCoefficient, unitVectorToSource, radius,
+            bulkDensity, velocity);
+
+        Vector acceleration(3);
+        computeCannonballRadiationPressureAcceleration(radiationPressure,
+                                                       radiationPressureCoefficient,
+                                                       unitVectorToSource,
+                                                       radius,
+                                                       bulkDensity,
+                                                       acceleration);
+
+        Real inPlaceAcceleration[3] = {unitVectorToSource[0],
+                                       unitVectorToSource[1],
+                                       unitVectorToSource[2]};
+        computeCannonballRadiationPressureAcceleration(radiationPressure,
+                                                       radiationPressureCoefficient,
+                                                       inPlaceAcceleration,
+                                                       radius,
+                                                       bulkDensity,
+                                                       inPlaceAcceleration);
+
+        Vector shadowedAcceleration(3);
+        computeShadowedCannonballRadiationPressureAcceleration(radiationPressure,
+                                                               1.495978707e11,
+                                                               radiationPressureCoefficient,
+                                                               position,
+                                                               sunPosition,
+                                                               6.957e8,
+                                                               earthEquatorialRadius,
+                                                               radius,
+                                                               bulkDensity,
+                                                               shadowedAcceleration);
+
+        Real dragBuffer[3];
+        Real* const dragAcceleration = dragBuffer;
+        computeCannonballPoyntingRobertsonDragAcceleration(radiationPressure,
+                                                           radiationPressureCoefficient,
+                                                           unitVectorToSource,
+                                                           radius,
+                                                           bulkDensity,
+                                                           velocity,
+                                                           dragAcceleration);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            REQUIRE(acceleration[i] == expectedAcceleration[i]);
+            REQUIRE(inPlaceAcceleration[i] == expectedAcceleration[i]);
+            REQUIRE(shadowedAcceleration[i] == expectedShadowedAcceleration[i]);
+            REQUIRE(dragAcceleration[i] == expectedDragAcceleration[i]);
+        }
+    }
+}
+
+} // namespace tests
+} // namespace astro
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2014-2022 Kartik Kumar (me@kartikkumar.com)
+ * Distributed under the MIT License.
+ * See accompanying file LICENSE.md or copy at http://opensource.org/licenses/MIT
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "astro/j2AccelerationModel.hpp"
+#include "astro/zonalHarmonicsAccelerationModel.hpp"
+
+namespace astro
+{
+namespace tests
+{
+
+typedef double Real;
+typedef std::vector<Real> Vector;
+
+//! Compute zonal disturbing potential using explicit Legendre polynomials (up to degree 6).
+Real computeZonalPotential(const Real gravitationalParameter,
+                           const Vector& position,
+                           const Real equatorialRadius,
+                           const Real zonalCoefficients[5])
+{
+    const Real r = std::sqrt(position[0] * position[0]
+                             + position[1] * position[1]
+                             + position[2] * position[2]);
+    const Real s = position[2] / r;
+    const Real s2 = s * s;
+
+    const Real legendrePolynomials[5]
+        = {(3.0 * s2 - 1.0) / 2.0,
+           (5.0 * s2 - 3.0) * s / 2.0,
+           (35.0 * s2 * s2 - 30.0 * s2 + 3.0) / 8.0,
+           (63.0 * s2 * s2 - 70.0 * s2 + 15.0) * s / 8.0,
+           (231.0 * s2 * s2 * s2 - 315.0 * s2 * s2 + 105.0 * s2 - 5.0) / 16.0};
+
+    Real potential = 0.0;
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        potential -= gravitationalParameter / r * zonalCoefficients[i]
+                     * std::pow(equatorialRadius / r, static_cast<Real>(i + 2))
+                     * legendrePolynomials[i];
+    }
+    return potential;
+}
+
+TEST_CASE("Compute zonal harmonics acceleration vector", "[zonal_gravity, acceleration, models]")
+{
+    // Set Earth gravitational parameter [m^3 s^-2] and equatorial radius [m].
+    const Real gravitationalParameter = 3.986004415e14;
+    const Real equatorialRadius = 6378.1363e3;
+
+    // Set unnormalized zonal coefficients J2-J6 (EGM-96) [-].
+    const Real zonalCoefficients[5]
+        = {1.0826266835531513e-3,
+           -2.5326564853322355e-6,
+           -1.6196215913670001e-6,
+           -2.2729608286349703e-7,
+           5.4068117008370002e-7};
+
+    // Set position vector [m].
+    Vector position(3);
+    position[0] = 3.75e6;
+    position[1] = 4.24e6;
+    position[2] = -1.39e6;
+
+    SECTION("Test degree 2 against J2 acceleration")
+    {
+        const Vector computedAcceleration = computeZonalHarmonicsAcceleration<2>(
+            gravitationalParameter, position, equatorialRadius, zonalCoefficients);
+        const Vector expectedAcceleration = computeJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, zonalCoefficients[0]);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(1.0e-14));
+        }
+    }
+
+    SECTION("Test degree 3 against closed-form J2 + J3 acceleration")
+    {
+        // The closed-form J3 acceleration is obtained from (Vallado, 2007), Eq. 8-30.
+        const Real x = position[0];
+        const Real y = position[1];
+        const Real z = position[2];
+        const Real r = std::sqrt(x * x + y * y + z * z);
+        const Real r2 = r * r;
+        const Real j3PreMultiplier = -2.5 * zonalCoefficients[1] * gravitationalParameter
+                                     * std::pow(equatorialRadius, 3.0) / std::pow(r, 7.0);
+
+        const Vector j2Acceleration = computeJ2Acceleration(
+            gravitationalParameter, position, equatorialRadius, zonalCoefficients[0]);
+        Vector expectedAcceleration(3);
+        expectedAcceleration[0]
+            = j2Acceleration[0] + j3PreMultiplier * x * (3.0 * z - 7.0 * z * z * z / r2);
+        expectedAcceleration[1]
+            = j2Acceleration[1] + j3PreMultiplier * y * (3.0 * z - 7.0 * z * z * z / r2);
+        expectedAcceleration[2]
+            = j2Acceleration[2]
+              + j3PreMultiplier * (6.0 * z * z - 7.0 * z * z * z * z / r2 - 0.6 * r2);
+
+        const std::array<Real, 2> coefficients = {{zonalCoefficients[0], zonalCoefficients[1]}};
+        const Vector computedAcceleration = computeZonalHarmonicsAcceleration<3>(
+            gravitationalParameter, position, equatorialRadius, coefficients);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration[i]).epsilon(1.0e-13));
+        }
+    }
+
+    SECTION("Test degree 6 against gradient of potential")
+    {
+        const Vector computedAcceleration = computeZonalHarmonicsAcceleration<6>(
+            gravitationalParameter, position, equatorialRadius, zonalCoefficients);
+
+        // Compute the gradient of the potential using central differences.
+        const Real perturbation = 1.0;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            Vector forwardPosition = position;
+            Vector backwardPosition = position;
+            forwardPosition[i] += perturbation;
+            backwardPosition[i] -= perturbation;
+
+            const Real expectedAcceleration
+                = (computeZonalPotential(gravitationalParameter, forwardPosition,
+                                         equatorialRadius, zonalCoefficients)
+                   - computeZonalPotential(gravitationalParameter, backwardPosition,
+                                           equatorialRadius, zonalCoefficients))
+                  / (2.0 * perturbation);
+
+            REQUIRE(computedAcceleration[i]
+                        == Catch::Approx(expectedAcceleration).epsilon(1.0e-6));
+        }
+    }
+
+    SECTION("Test position on symmetry axis")
+    {
+        Vector polarPosition(3);
+        polarPosition[0] = 0.0;
+        polarPosition[1] = 0.0;
+        polarPosition[2] = 7.0e6;
+
+        const Vector computedAcceleration = computeZonalHarmonicsAcceleration<6>(
+            gravitationalParameter, polarPosition, equatorialRadius, zonalCoefficients);
+
+        // On the symmetry axis (s = 1), P_n(1) = 1 and the acceleration is purely axial:
+        // a_z = mu / r^2 * sum (n + 1) J_n (R / r)^n.
+        Real expectedAxialAcceleration = 0.0;
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            expectedAxialAcceleration += (i + 3.0) * zonalCoefficients[i]
+                                         * std::pow(equatorialRadius / 7.0e6, i + 2.0);
+        }
+        expectedAxialAcceleration *= gravitationalParameter / (7.0e6 * 7.0e6);
+
+        REQUIRE(computedAcceleration[0] == 0.0);
+        REQUIRE(computedAcceleration[1] == 0.0);
+        REQUIRE(computedAcceleration[2]
+                    == Catch::Approx(expectedAxialAcceleration).epsilon(1.0e-14));
+    }
+}
+
+} // namespace tests
+} // namespace astro
+
+/*!
+ * References
+ *  Vallado, D.A.. Fundamentals of Astrodynamics and Applications. Third Edition, Microcosm Press,
+ *      2007.
+ */